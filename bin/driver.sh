@@ -13,13 +13,15 @@ function verbose () {
 }
 
 function usage () {
-    echo "Usage: ${PACKAGE_NAME} [Help] [Debug] [Preprocess] [Include] [Link] [Linkdir] [Linklib] [Output] FILES"
+    echo "Usage: ${PACKAGE_NAME} [Help] [Debug] [Optimize] [Preprocess] [Include] [Link] [Linkdir] [Linklib] [Output] FILES"
     echo ""
     echo "[Help]:"
     echo "    --help          print help and exit"
     echo ""
     echo "[Debug]:"
     echo "    -v              enable verbose mode"
+    echo "    --regexlex      lex with the regex lexer"
+    echo "    --pipeline      lex and parse on two threads"
     echo "    (Debug only):"
     echo "    --lex           print  lexing    stage and exit"
     echo "    --parse         print  parsing   stage and exit"
@@ -28,11 +30,20 @@ function usage () {
     echo "    --codegen       print  assembly  stage and exit"
     echo "    --codeemit      print  emission  stage and exit"
     echo ""
+    echo "[Optimize]:"
+    echo "    -O0             disable optimizations (default)"
+    echo "    -O1             fold constants and eliminate unreachable code"
+    echo "    -O2             enable all optimizations"
+    echo "    --fold          fold constants"
+    echo "    --propagate     propagate copies"
+    echo "    --unreachable   eliminate unreachable code"
+    echo ""
     echo "[Preprocess]:"
-    echo "    -E              enable macro expansion with gcc"
+    echo "    -E              enable macro expansion"
     echo ""
     echo "[Include]:"
     echo "    -I<includedir>  add a list of paths to include path"
+    echo "    --cache=<dir>   cache header tokens in <dir>"
     echo ""
     echo "[Link]:"
     echo "    -S              compile, but do not assemble and link"
@@ -57,9 +68,6 @@ function clean_exit () {
         LINK_ENUM=255
     fi
     for FILE in ${FILES}; do
-        if [ -f "${FILE}.i" ]; then
-            rm ${FILE}.i
-        fi
         if [ ${LINK_ENUM} -ne 0 ]; then
             if [ -f "${FILE}" ]; then
                 rm ${FILE}
@@ -115,6 +123,22 @@ function parse_verbose_arg () {
     return 0
 }
 
+function parse_lexer_arg () {
+    if [ ! "${ARG}" = "--regexlex" ]; then
+        return 1
+    fi
+    LEXER_ENUM=$((LEXER_ENUM | 1))
+    return 0
+}
+
+function parse_pipeline_arg () {
+    if [ ! "${ARG}" = "--pipeline" ]; then
+        return 1
+    fi
+    LEXER_ENUM=$((LEXER_ENUM | 8))
+    return 0
+}
+
 function parse_debug_arg () {
     case "${ARG}" in
         "--lex")
@@ -141,11 +165,45 @@ function parse_debug_arg () {
     return 0
 }
 
+function parse_optim_level_arg () {
+    case "${ARG}" in
+        "-O0")
+            OPTIM_ENUM=0
+            ;;
+        "-O1")
+            OPTIM_ENUM=5
+            ;;
+        "-O2")
+            OPTIM_ENUM=7
+            ;;
+        *)
+            return 1
+    esac
+    return 0
+}
+
+function parse_optim_pass_arg () {
+    case "${ARG}" in
+        "--fold")
+            OPTIM_ENUM=$((OPTIM_ENUM | 1))
+            ;;
+        "--propagate")
+            OPTIM_ENUM=$((OPTIM_ENUM | 2))
+            ;;
+        "--unreachable")
+            OPTIM_ENUM=$((OPTIM_ENUM | 4))
+            ;;
+        *)
+            return 1
+    esac
+    return 0
+}
+
 function parse_preproc_arg () {
     if [ ! "${ARG}" = "-E" ]; then
         return 1
     fi
-    IS_PREPROC=1
+    LEXER_ENUM=$((LEXER_ENUM | 4))
     return 0
 }
 
@@ -165,6 +223,23 @@ function parse_include_arg () {
     return 0
 }
 
+function parse_cache_arg () {
+    if [[ "${ARG}" != "--cache="* ]]; then
+        return 1
+    fi
+    ARG="${ARG:8}"
+    if [[ "${ARG}" == "-"* ]]; then
+        raise_error "unknown or malformed option: $(em "${ARG}")"
+    fi
+    CACHE_DIR="$(readlink -f ${ARG})"
+    if [ ! -d "${CACHE_DIR}" ]; then
+        raise_error "cannot find $(em "${CACHE_DIR}"): no such directory"
+    fi
+    CACHE_DIR="${CACHE_DIR}/"
+    LEXER_ENUM=$((LEXER_ENUM | 2))
+    return 0
+}
+
 function parse_link_arg () {
     case "${ARG}" in
         "-S")
@@ -269,6 +344,22 @@ function parse_args () {
         fi
     fi
 
+    parse_lexer_arg
+    if [ ${?} -eq 0 ]; then
+        shift_arg
+        if [ ${?} -ne 0 ]; then
+            raise_error "no input files"
+        fi
+    fi
+
+    parse_pipeline_arg
+    if [ ${?} -eq 0 ]; then
+        shift_arg
+        if [ ${?} -ne 0 ]; then
+            raise_error "no input files"
+        fi
+    fi
+
     parse_debug_arg
     if [ ${?} -eq 0 ]; then
         shift_arg
@@ -277,6 +368,26 @@ function parse_args () {
         fi
     fi
 
+    parse_optim_level_arg
+    if [ ${?} -eq 0 ]; then
+        shift_arg
+        if [ ${?} -ne 0 ]; then
+            raise_error "no input files"
+        fi
+    fi
+
+    while :; do
+        parse_optim_pass_arg
+        if [ ${?} -eq 0 ]; then
+            shift_arg
+            if [ ${?} -ne 0 ]; then
+                raise_error "no input files"
+            fi
+        else
+            break
+        fi
+    done
+
     parse_preproc_arg
     if [ ${?} -eq 0 ]; then
         shift_arg
@@ -297,6 +408,14 @@ function parse_args () {
         fi
     done
 
+    parse_cache_arg
+    if [ ${?} -eq 0 ]; then
+        shift_arg
+        if [ ${?} -ne 0 ]; then
+            raise_error "no input files"
+        fi
+    fi
+
     parse_link_arg
     if [ ${?} -eq 0 ]; then
         shift_arg
@@ -369,20 +488,6 @@ function add_linklibs () {
     return 0
 }
 
-function preprocess () {
-    if [ ${IS_PREPROC} -eq 1 ]; then
-        for FILE in ${FILES}; do
-            verbose "Preprocess -> ${FILE}.i"
-            gcc -E -P ${FILE}.c -o ${FILE}.i
-            if [ ${?} -ne 0 ]; then
-                raise_error "preprocessing failed"
-            fi
-        done
-        EXT_IN="i"
-    fi
-    return 0
-}
-
 function compile () {
     for FILE in ${FILES}; do
         verbose "Compile    -> ${FILE}.${EXT_OUT}"
@@ -391,7 +496,7 @@ function compile () {
         if [ ${?} -eq 0 ]; then
             SOURCE_DIR=""
         fi
-        STDOUT=$(${PACKAGE_DIR}/${PACKAGE_NAME} ${DEBUG_ENUM} ${FILE}.${EXT_IN} ${SOURCE_DIR} ${INCLUDE_DIRS} 2>&1)
+        STDOUT=$(${PACKAGE_DIR}/${PACKAGE_NAME} ${DEBUG_ENUM} ${LEXER_ENUM} ${CACHE_DIR} ${OPTIM_ENUM} ${FILE}.${EXT_IN} ${SOURCE_DIR} ${INCLUDE_DIRS} 2>&1)
         if [ ${?} -ne 0 ]; then
             echo "${STDOUT}" | tail -n +3 1>&2
             raise_error "compilation failed"
@@ -440,16 +545,18 @@ function link () {
 }
 
 IS_VERBOSE=0
-IS_PREPROC=0
 IS_FILE_2=0
 
 DEBUG_ENUM=0
+LEXER_ENUM=0
+OPTIM_ENUM=0
 LINK_ENUM=0
 
 EXT_IN="c"
 EXT_OUT="s"
 
 INCLUDE_DIRS=""
+CACHE_DIR=""
 LINK_DIRS=""
 LINK_LIBS=""
 FILES=""
@@ -460,7 +567,6 @@ add_includedirs
 add_linkdirs
 add_linklibs
 
-preprocess
 compile
 link
 
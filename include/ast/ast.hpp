@@ -1,10 +1,17 @@
 #ifndef _AST_AST_HPP
 #define _AST_AST_HPP
 
+#include <cstddef>
+#include <deque>
 #include <inttypes.h>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
+#include "util/throw.hpp"
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // Abstract syntax tree
@@ -34,6 +41,7 @@ enum AST_T {
     UCharInit_t,
     DoubleInit_t,
     ZeroInit_t,
+    BytesInit_t,
     StringInit_t,
     PointerInit_t,
     InitialValue_t,
@@ -148,6 +156,7 @@ enum AST_T {
     CInitializer_t,
     CSingleInit_t,
     CCompoundInit_t,
+    CZeroInit_t,
     CMemberDeclaration_t,
     CStructDeclaration_t,
     CFunctionDeclaration_t,
@@ -207,6 +216,7 @@ enum AST_T {
     TacAddPtr_t,
     TacCopyToOffset_t,
     TacCopyFromOffset_t,
+    TacZeroFill_t,
     TacJump_t,
     TacJumpIfZero_t,
     TacJumpIfNotZero_t,
@@ -288,6 +298,7 @@ enum AST_T {
     AsmIdiv_t,
     AsmDiv_t,
     AsmCdq_t,
+    AsmRepStos_t,
     AsmJmp_t,
     AsmJmpCC_t,
     AsmSetCC_t,
@@ -302,12 +313,44 @@ enum AST_T {
     AsmProgram_t
 };
 
+// Nodes are bump allocated in chunks from the arena of the current stage. An arena is released in bulk once its stage
+// is closed and its last node is deleted, as nodes shared with later stages can outlive their own stage
+struct AstArena {
+    AstArena();
+
+    bool is_open;
+    size_t n_nodes;
+    size_t chunk_offset;
+    std::vector<std::unique_ptr<char[]>> chunks;
+};
+
+// The node kind is set once by the constructor of the concrete node, so that passes dispatch on it without a virtual
+// call
 struct Ast {
+    Ast(AST_T type_t);
     virtual ~Ast() = 0;
-    virtual AST_T type() = 0;
+    AST_T type() const { return type_t; }
+
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr);
+
+    AST_T type_t;
 };
 
-using TIdentifier = std::string;
+// Downcast to a node kind that was already dispatched on, the cast is checked against the node in debug builds
+template <typename T> T* ast_cast(Ast* node) {
+#ifndef __NDEBUG__
+    if (!dynamic_cast<T*>(node)) {
+        RAISE_INTERNAL_ERROR;
+    }
+#endif
+    return static_cast<T*>(node);
+}
+
+void open_ast_arena();
+void close_ast_arena();
+
+using TIdentifier = uint32_t;
 using TChar = int8_t;
 using TInt = int32_t;
 using TLong = int64_t;
@@ -316,6 +359,29 @@ using TUInt = uint32_t;
 using TULong = uint64_t;
 using TDouble = double;
 
+// Identifiers are interned into 32-bit symbol ids, so that they are hashed and compared as integers, and their names
+// are only looked up for emission and diagnostics
+struct IdentifierContext {
+    IdentifierContext();
+
+    std::deque<std::string> names;
+    std::unordered_map<std::string_view, TIdentifier> ids;
+};
+
+extern std::unique_ptr<IdentifierContext> identifiers;
+#define INIT_IDENTIFIER_CONTEXT identifiers = std::make_unique<IdentifierContext>()
+#define FREE_IDENTIFIER_CONTEXT identifiers.reset()
+
+TIdentifier make_identifier(std::string_view name);
+const std::string& get_identifier_name(TIdentifier identifier);
+
+// Function temporaries are not interned, their ids set the top bit over their index in the function temporary table
+constexpr TIdentifier TEMP_IDENTIFIER_BIT = 2147483648u;
+#define IS_TEMP_IDENTIFIER(X) (((X) & TEMP_IDENTIFIER_BIT) != 0u)
+#define GET_TEMP_IDENTIFIER_INDEX(X) (static_cast<size_t>((X) & ~TEMP_IDENTIFIER_BIT))
+
+TIdentifier make_temp_identifier(size_t index);
+
 // https://mkhan45.github.io/2021/05/10/Modeling-ASTs-in-Different-Languages.html
 // https://github.com/agentcooper/cpp-ast-example/blob/main/ast_inheritance.cpp
 
@@ -329,60 +395,53 @@ using TDouble = double;
 //       | ConstChar(int)
 //       | ConstUChar(int)
 struct CConst : Ast {
-    AST_T type() override;
+    CConst(AST_T type_t);
 };
 
 struct CConstInt : CConst {
-    AST_T type() override;
-    CConstInt() = default;
+    CConstInt();
     CConstInt(TInt value);
 
     TInt value;
 };
 
 struct CConstLong : CConst {
-    AST_T type() override;
-    CConstLong() = default;
+    CConstLong();
     CConstLong(TLong value);
 
     TLong value;
 };
 
 struct CConstUInt : CConst {
-    AST_T type() override;
-    CConstUInt() = default;
+    CConstUInt();
     CConstUInt(TUInt value);
 
     TUInt value;
 };
 
 struct CConstULong : CConst {
-    AST_T type() override;
-    CConstULong() = default;
+    CConstULong();
     CConstULong(TULong value);
 
     TULong value;
 };
 
 struct CConstDouble : CConst {
-    AST_T type() override;
-    CConstDouble() = default;
+    CConstDouble();
     CConstDouble(TDouble value);
 
     TDouble value;
 };
 
 struct CConstChar : CConst {
-    AST_T type() override;
-    CConstChar() = default;
+    CConstChar();
     CConstChar(TChar value);
 
     TChar value;
 };
 
 struct CConstUChar : CConst {
-    AST_T type() override;
-    CConstUChar() = default;
+    CConstUChar();
     CConstUChar(TUChar value);
 
     TUChar value;
@@ -390,8 +449,7 @@ struct CConstUChar : CConst {
 
 // string = StringLiteral(int*)
 struct CStringLiteral : Ast {
-    AST_T type() override;
-    CStringLiteral() = default;
+    CStringLiteral();
     CStringLiteral(std::vector<TChar> value);
 
     std::vector<TChar> value;
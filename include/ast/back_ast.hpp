@@ -36,91 +36,91 @@
 //     | XMM14
 //     | XMM15
 struct AsmReg : Ast {
-    AST_T type() override;
+    AsmReg(AST_T type_t);
 };
 
 struct AsmAx : AsmReg {
-    AST_T type() override;
+    AsmAx();
 };
 
 struct AsmCx : AsmReg {
-    AST_T type() override;
+    AsmCx();
 };
 
 struct AsmDx : AsmReg {
-    AST_T type() override;
+    AsmDx();
 };
 
 struct AsmDi : AsmReg {
-    AST_T type() override;
+    AsmDi();
 };
 
 struct AsmSi : AsmReg {
-    AST_T type() override;
+    AsmSi();
 };
 
 struct AsmR8 : AsmReg {
-    AST_T type() override;
+    AsmR8();
 };
 
 struct AsmR9 : AsmReg {
-    AST_T type() override;
+    AsmR9();
 };
 
 struct AsmR10 : AsmReg {
-    AST_T type() override;
+    AsmR10();
 };
 
 struct AsmR11 : AsmReg {
-    AST_T type() override;
+    AsmR11();
 };
 
 struct AsmSp : AsmReg {
-    AST_T type() override;
+    AsmSp();
 };
 
 struct AsmBp : AsmReg {
-    AST_T type() override;
+    AsmBp();
 };
 
 struct AsmXMM0 : AsmReg {
-    AST_T type() override;
+    AsmXMM0();
 };
 
 struct AsmXMM1 : AsmReg {
-    AST_T type() override;
+    AsmXMM1();
 };
 
 struct AsmXMM2 : AsmReg {
-    AST_T type() override;
+    AsmXMM2();
 };
 
 struct AsmXMM3 : AsmReg {
-    AST_T type() override;
+    AsmXMM3();
 };
 
 struct AsmXMM4 : AsmReg {
-    AST_T type() override;
+    AsmXMM4();
 };
 
 struct AsmXMM5 : AsmReg {
-    AST_T type() override;
+    AsmXMM5();
 };
 
 struct AsmXMM6 : AsmReg {
-    AST_T type() override;
+    AsmXMM6();
 };
 
 struct AsmXMM7 : AsmReg {
-    AST_T type() override;
+    AsmXMM7();
 };
 
 struct AsmXMM14 : AsmReg {
-    AST_T type() override;
+    AsmXMM14();
 };
 
 struct AsmXMM15 : AsmReg {
-    AST_T type() override;
+    AsmXMM15();
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -137,51 +137,51 @@ struct AsmXMM15 : AsmReg {
 //           | BE
 //           | P
 struct AsmCondCode : Ast {
-    AST_T type() override;
+    AsmCondCode(AST_T type_t);
 };
 
 struct AsmE : AsmCondCode {
-    AST_T type() override;
+    AsmE();
 };
 
 struct AsmNE : AsmCondCode {
-    AST_T type() override;
+    AsmNE();
 };
 
 struct AsmG : AsmCondCode {
-    AST_T type() override;
+    AsmG();
 };
 
 struct AsmGE : AsmCondCode {
-    AST_T type() override;
+    AsmGE();
 };
 
 struct AsmL : AsmCondCode {
-    AST_T type() override;
+    AsmL();
 };
 
 struct AsmLE : AsmCondCode {
-    AST_T type() override;
+    AsmLE();
 };
 
 struct AsmA : AsmCondCode {
-    AST_T type() override;
+    AsmA();
 };
 
 struct AsmAE : AsmCondCode {
-    AST_T type() override;
+    AsmAE();
 };
 
 struct AsmB : AsmCondCode {
-    AST_T type() override;
+    AsmB();
 };
 
 struct AsmBE : AsmCondCode {
-    AST_T type() override;
+    AsmBE();
 };
 
 struct AsmP : AsmCondCode {
-    AST_T type() override;
+    AsmP();
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -194,12 +194,11 @@ struct AsmP : AsmCondCode {
 //         | PseudoMem(identifier, int)
 //         | Indexed(int, reg, reg)
 struct AsmOperand : Ast {
-    AST_T type() override;
+    AsmOperand(AST_T type_t);
 };
 
 struct AsmImm : AsmOperand {
-    AST_T type() override;
-    AsmImm() = default;
+    AsmImm();
     AsmImm(bool is_byte, bool is_quad, TIdentifier value);
 
     bool is_byte;
@@ -208,24 +207,21 @@ struct AsmImm : AsmOperand {
 };
 
 struct AsmRegister : AsmOperand {
-    AST_T type() override;
-    AsmRegister() = default;
+    AsmRegister();
     AsmRegister(std::unique_ptr<AsmReg> reg);
 
     std::unique_ptr<AsmReg> reg;
 };
 
 struct AsmPseudo : AsmOperand {
-    AST_T type() override;
-    AsmPseudo() = default;
+    AsmPseudo();
     AsmPseudo(TIdentifier name);
 
     TIdentifier name;
 };
 
 struct AsmMemory : AsmOperand {
-    AST_T type() override;
-    AsmMemory() = default;
+    AsmMemory();
     AsmMemory(TLong value, std::unique_ptr<AsmReg> reg);
 
     TLong value;
@@ -233,8 +229,7 @@ struct AsmMemory : AsmOperand {
 };
 
 struct AsmData : AsmOperand {
-    AST_T type() override;
-    AsmData() = default;
+    AsmData();
     AsmData(TIdentifier name, TLong offset);
 
     TIdentifier name;
@@ -242,8 +237,7 @@ struct AsmData : AsmOperand {
 };
 
 struct AsmPseudoMem : AsmOperand {
-    AST_T type() override;
-    AsmPseudoMem() = default;
+    AsmPseudoMem();
     AsmPseudoMem(TIdentifier name, TLong offset);
 
     TIdentifier name;
@@ -251,8 +245,7 @@ struct AsmPseudoMem : AsmOperand {
 };
 
 struct AsmIndexed : AsmOperand {
-    AST_T type() override;
-    AsmIndexed() = default;
+    AsmIndexed();
     AsmIndexed(TLong scale, std::unique_ptr<AsmReg> reg_base, std::unique_ptr<AsmReg> reg_index);
 
     TLong scale;
@@ -273,47 +266,47 @@ struct AsmIndexed : AsmOperand {
 //                 | BitShiftRight
 //                 | BitShrArithmetic
 struct AsmBinaryOp : Ast {
-    AST_T type() override;
+    AsmBinaryOp(AST_T type_t);
 };
 
 struct AsmAdd : AsmBinaryOp {
-    AST_T type() override;
+    AsmAdd();
 };
 
 struct AsmSub : AsmBinaryOp {
-    AST_T type() override;
+    AsmSub();
 };
 
 struct AsmMult : AsmBinaryOp {
-    AST_T type() override;
+    AsmMult();
 };
 
 struct AsmDivDouble : AsmBinaryOp {
-    AST_T type() override;
+    AsmDivDouble();
 };
 
 struct AsmBitAnd : AsmBinaryOp {
-    AST_T type() override;
+    AsmBitAnd();
 };
 
 struct AsmBitOr : AsmBinaryOp {
-    AST_T type() override;
+    AsmBitOr();
 };
 
 struct AsmBitXor : AsmBinaryOp {
-    AST_T type() override;
+    AsmBitXor();
 };
 
 struct AsmBitShiftLeft : AsmBinaryOp {
-    AST_T type() override;
+    AsmBitShiftLeft();
 };
 
 struct AsmBitShiftRight : AsmBinaryOp {
-    AST_T type() override;
+    AsmBitShiftRight();
 };
 
 struct AsmBitShrArithmetic : AsmBinaryOp {
-    AST_T type() override;
+    AsmBitShrArithmetic();
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -322,19 +315,19 @@ struct AsmBitShrArithmetic : AsmBinaryOp {
 //                | Neg
 //                | Shr
 struct AsmUnaryOp : Ast {
-    AST_T type() override;
+    AsmUnaryOp(AST_T type_t);
 };
 
 struct AsmNot : AsmUnaryOp {
-    AST_T type() override;
+    AsmNot();
 };
 
 struct AsmNeg : AsmUnaryOp {
-    AST_T type() override;
+    AsmNeg();
 };
 
 struct AsmShr : AsmUnaryOp {
-    AST_T type() override;
+    AsmShr();
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -351,6 +344,7 @@ struct AsmShr : AsmUnaryOp {
 //             | Idiv(assembly_type, operand)
 //             | Div(assembly_type, operand)
 //             | Cdq(assembly_type)
+//             | RepStos(assembly_type)
 //             | Jmp(identifier)
 //             | JmpCC(cond_code, identifier)
 //             | SetCC(cond_code, operand)
@@ -359,12 +353,11 @@ struct AsmShr : AsmUnaryOp {
 //             | Call(identifier)
 //             | Ret
 struct AsmInstruction : Ast {
-    AST_T type() override;
+    AsmInstruction(AST_T type_t);
 };
 
 struct AsmMov : AsmInstruction {
-    AST_T type() override;
-    AsmMov() = default;
+    AsmMov();
     AsmMov(
         std::shared_ptr<AssemblyType> assembly_type, std::shared_ptr<AsmOperand> src, std::shared_ptr<AsmOperand> dst);
 
@@ -374,8 +367,7 @@ struct AsmMov : AsmInstruction {
 };
 
 struct AsmMovSx : AsmInstruction {
-    AST_T type() override;
-    AsmMovSx() = default;
+    AsmMovSx();
     AsmMovSx(std::shared_ptr<AssemblyType> assembly_type_src, std::shared_ptr<AssemblyType> assembly_type_dst,
         std::shared_ptr<AsmOperand> src, std::shared_ptr<AsmOperand> dst);
 
@@ -386,8 +378,7 @@ struct AsmMovSx : AsmInstruction {
 };
 
 struct AsmMovZeroExtend : AsmInstruction {
-    AST_T type() override;
-    AsmMovZeroExtend() = default;
+    AsmMovZeroExtend();
     AsmMovZeroExtend(std::shared_ptr<AssemblyType> assembly_type_src, std::shared_ptr<AssemblyType> assembly_type_dst,
         std::shared_ptr<AsmOperand> src, std::shared_ptr<AsmOperand> dst);
 
@@ -398,8 +389,7 @@ struct AsmMovZeroExtend : AsmInstruction {
 };
 
 struct AsmLea : AsmInstruction {
-    AST_T type() override;
-    AsmLea() = default;
+    AsmLea();
     AsmLea(std::shared_ptr<AsmOperand> src, std::shared_ptr<AsmOperand> dst);
 
     std::shared_ptr<AsmOperand> src;
@@ -407,8 +397,7 @@ struct AsmLea : AsmInstruction {
 };
 
 struct AsmCvttsd2si : AsmInstruction {
-    AST_T type() override;
-    AsmCvttsd2si() = default;
+    AsmCvttsd2si();
     AsmCvttsd2si(
         std::shared_ptr<AssemblyType> assembly_type, std::shared_ptr<AsmOperand> src, std::shared_ptr<AsmOperand> dst);
 
@@ -418,8 +407,7 @@ struct AsmCvttsd2si : AsmInstruction {
 };
 
 struct AsmCvtsi2sd : AsmInstruction {
-    AST_T type() override;
-    AsmCvtsi2sd() = default;
+    AsmCvtsi2sd();
     AsmCvtsi2sd(
         std::shared_ptr<AssemblyType> assembly_type, std::shared_ptr<AsmOperand> src, std::shared_ptr<AsmOperand> dst);
 
@@ -429,8 +417,7 @@ struct AsmCvtsi2sd : AsmInstruction {
 };
 
 struct AsmUnary : AsmInstruction {
-    AST_T type() override;
-    AsmUnary() = default;
+    AsmUnary();
     AsmUnary(std::unique_ptr<AsmUnaryOp> unary_op, std::shared_ptr<AssemblyType> assembly_type,
         std::shared_ptr<AsmOperand> dst);
 
@@ -440,8 +427,7 @@ struct AsmUnary : AsmInstruction {
 };
 
 struct AsmBinary : AsmInstruction {
-    AST_T type() override;
-    AsmBinary() = default;
+    AsmBinary();
     AsmBinary(std::unique_ptr<AsmBinaryOp> binary_op, std::shared_ptr<AssemblyType> assembly_type,
         std::shared_ptr<AsmOperand> src, std::shared_ptr<AsmOperand> dst);
 
@@ -452,8 +438,7 @@ struct AsmBinary : AsmInstruction {
 };
 
 struct AsmCmp : AsmInstruction {
-    AST_T type() override;
-    AsmCmp() = default;
+    AsmCmp();
     AsmCmp(
         std::shared_ptr<AssemblyType> assembly_type, std::shared_ptr<AsmOperand> src, std::shared_ptr<AsmOperand> dst);
 
@@ -463,8 +448,7 @@ struct AsmCmp : AsmInstruction {
 };
 
 struct AsmIdiv : AsmInstruction {
-    AST_T type() override;
-    AsmIdiv() = default;
+    AsmIdiv();
     AsmIdiv(std::shared_ptr<AssemblyType> assembly_type, std::shared_ptr<AsmOperand> src);
 
     std::shared_ptr<AssemblyType> assembly_type;
@@ -472,8 +456,7 @@ struct AsmIdiv : AsmInstruction {
 };
 
 struct AsmDiv : AsmInstruction {
-    AST_T type() override;
-    AsmDiv() = default;
+    AsmDiv();
     AsmDiv(std::shared_ptr<AssemblyType> assembly_type, std::shared_ptr<AsmOperand> src);
 
     std::shared_ptr<AssemblyType> assembly_type;
@@ -481,24 +464,28 @@ struct AsmDiv : AsmInstruction {
 };
 
 struct AsmCdq : AsmInstruction {
-    AST_T type() override;
-    AsmCdq() = default;
+    AsmCdq();
     AsmCdq(std::shared_ptr<AssemblyType> assembly_type);
 
     std::shared_ptr<AssemblyType> assembly_type;
 };
 
+struct AsmRepStos : AsmInstruction {
+    AsmRepStos();
+    AsmRepStos(std::shared_ptr<AssemblyType> assembly_type);
+
+    std::shared_ptr<AssemblyType> assembly_type;
+};
+
 struct AsmJmp : AsmInstruction {
-    AST_T type() override;
-    AsmJmp() = default;
+    AsmJmp();
     AsmJmp(TIdentifier target);
 
     TIdentifier target;
 };
 
 struct AsmJmpCC : AsmInstruction {
-    AST_T type() override;
-    AsmJmpCC() = default;
+    AsmJmpCC();
     AsmJmpCC(TIdentifier target, std::unique_ptr<AsmCondCode> cond_code);
 
     TIdentifier target;
@@ -506,8 +493,7 @@ struct AsmJmpCC : AsmInstruction {
 };
 
 struct AsmSetCC : AsmInstruction {
-    AST_T type() override;
-    AsmSetCC() = default;
+    AsmSetCC();
     AsmSetCC(std::unique_ptr<AsmCondCode> cond_code, std::shared_ptr<AsmOperand> dst);
 
     std::unique_ptr<AsmCondCode> cond_code;
@@ -515,57 +501,55 @@ struct AsmSetCC : AsmInstruction {
 };
 
 struct AsmLabel : AsmInstruction {
-    AST_T type() override;
-    AsmLabel() = default;
+    AsmLabel();
     AsmLabel(TIdentifier name);
 
     TIdentifier name;
 };
 
 struct AsmPush : AsmInstruction {
-    AST_T type() override;
-    AsmPush() = default;
+    AsmPush();
     AsmPush(std::shared_ptr<AsmOperand> src);
 
     std::shared_ptr<AsmOperand> src;
 };
 
 struct AsmCall : AsmInstruction {
-    AST_T type() override;
-    AsmCall() = default;
+    AsmCall();
     AsmCall(TIdentifier name);
 
     TIdentifier name;
 };
 
 struct AsmRet : AsmInstruction {
-    AST_T type() override;
+    AsmRet();
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-// top_level = Function(identifier, bool, bool, instruction*)
+// top_level = Function(identifier, bool, bool, instruction*, assembly_type*)
 //           | StaticVariable(identifier, bool, int, static_init*)
 //           | StaticConstant(identifier, int, static_init)
 struct AsmTopLevel : Ast {
-    AST_T type() override;
+    AsmTopLevel(AST_T type_t);
 };
 
 struct AsmFunction : AsmTopLevel {
-    AST_T type() override;
-    AsmFunction() = default;
+    AsmFunction();
     AsmFunction(TIdentifier name, bool is_global, bool is_return_memory,
-        std::vector<std::unique_ptr<AsmInstruction>> instructions);
+        std::vector<std::unique_ptr<AsmInstruction>> instructions,
+        std::vector<std::shared_ptr<AssemblyType>> temp_types);
 
     TIdentifier name;
     bool is_global;
     bool is_return_memory;
     std::vector<std::unique_ptr<AsmInstruction>> instructions;
+    // Function temporary table, indexed by temporary identifier
+    std::vector<std::shared_ptr<AssemblyType>> temp_types;
 };
 
 struct AsmStaticVariable : AsmTopLevel {
-    AST_T type() override;
-    AsmStaticVariable() = default;
+    AsmStaticVariable();
     AsmStaticVariable(
         TIdentifier name, TInt alignment, bool is_global, std::vector<std::shared_ptr<StaticInit>> static_inits);
 
@@ -576,8 +560,7 @@ struct AsmStaticVariable : AsmTopLevel {
 };
 
 struct AsmStaticConstant : AsmTopLevel {
-    AST_T type() override;
-    AsmStaticConstant() = default;
+    AsmStaticConstant();
     AsmStaticConstant(TIdentifier name, TInt alignment, std::shared_ptr<StaticInit> static_init);
 
     TIdentifier name;
@@ -589,8 +572,7 @@ struct AsmStaticConstant : AsmTopLevel {
 
 // AST = Program(top_level*, top_level*)
 struct AsmProgram : Ast {
-    AST_T type() override;
-    AsmProgram() = default;
+    AsmProgram();
     AsmProgram(std::vector<std::unique_ptr<AsmTopLevel>> static_constant_top_levels,
         std::vector<std::unique_ptr<AsmTopLevel>> top_levels);
 
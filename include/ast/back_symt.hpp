@@ -18,28 +18,27 @@
 //               | BackendDouble
 //               | ByteArray(int, int)
 struct AssemblyType : Ast {
-    AST_T type() override;
+    AssemblyType(AST_T type_t);
 };
 
 struct Byte : AssemblyType {
-    AST_T type() override;
+    Byte();
 };
 
 struct LongWord : AssemblyType {
-    AST_T type() override;
+    LongWord();
 };
 
 struct QuadWord : AssemblyType {
-    AST_T type() override;
+    QuadWord();
 };
 
 struct BackendDouble : AssemblyType {
-    AST_T type() override;
+    BackendDouble();
 };
 
 struct ByteArray : AssemblyType {
-    AST_T type() override;
-    ByteArray() = default;
+    ByteArray();
     ByteArray(TLong size, TInt alignment);
 
     TLong size;
@@ -51,12 +50,11 @@ struct ByteArray : AssemblyType {
 // symbol = Obj(assembly_type, bool, bool)
 //        | Fun(bool)
 struct BackendSymbol : Ast {
-    AST_T type() override;
+    BackendSymbol(AST_T type_t);
 };
 
 struct BackendObj : BackendSymbol {
-    AST_T type() override;
-    BackendObj() = default;
+    BackendObj();
     BackendObj(bool is_static, bool is_constant, std::shared_ptr<AssemblyType> assembly_type);
 
     bool is_static;
@@ -65,8 +63,7 @@ struct BackendObj : BackendSymbol {
 };
 
 struct BackendFun : BackendSymbol {
-    AST_T type() override;
-    BackendFun() = default;
+    BackendFun();
     BackendFun(bool is_defined);
 
     bool is_defined;
@@ -17,19 +17,19 @@
 //                | Negate
 //                | Not
 struct CUnaryOp : Ast {
-    AST_T type() override;
+    CUnaryOp(AST_T type_t);
 };
 
 struct CComplement : CUnaryOp {
-    AST_T type() override;
+    CComplement();
 };
 
 struct CNegate : CUnaryOp {
-    AST_T type() override;
+    CNegate();
 };
 
 struct CNot : CUnaryOp {
-    AST_T type() override;
+    CNot();
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -54,83 +54,83 @@ struct CNot : CUnaryOp {
 //                 | GreaterThan
 //                 | GreaterOrEqual
 struct CBinaryOp : Ast {
-    AST_T type() override;
+    CBinaryOp(AST_T type_t);
 };
 
 struct CAdd : CBinaryOp {
-    AST_T type() override;
+    CAdd();
 };
 
 struct CSubtract : CBinaryOp {
-    AST_T type() override;
+    CSubtract();
 };
 
 struct CMultiply : CBinaryOp {
-    AST_T type() override;
+    CMultiply();
 };
 
 struct CDivide : CBinaryOp {
-    AST_T type() override;
+    CDivide();
 };
 
 struct CRemainder : CBinaryOp {
-    AST_T type() override;
+    CRemainder();
 };
 
 struct CBitAnd : CBinaryOp {
-    AST_T type() override;
+    CBitAnd();
 };
 
 struct CBitOr : CBinaryOp {
-    AST_T type() override;
+    CBitOr();
 };
 
 struct CBitXor : CBinaryOp {
-    AST_T type() override;
+    CBitXor();
 };
 
 struct CBitShiftLeft : CBinaryOp {
-    AST_T type() override;
+    CBitShiftLeft();
 };
 
 struct CBitShiftRight : CBinaryOp {
-    AST_T type() override;
+    CBitShiftRight();
 };
 
 struct CBitShrArithmetic : CBinaryOp {
-    AST_T type() override;
+    CBitShrArithmetic();
 };
 
 struct CAnd : CBinaryOp {
-    AST_T type() override;
+    CAnd();
 };
 
 struct COr : CBinaryOp {
-    AST_T type() override;
+    COr();
 };
 
 struct CEqual : CBinaryOp {
-    AST_T type() override;
+    CEqual();
 };
 
 struct CNotEqual : CBinaryOp {
-    AST_T type() override;
+    CNotEqual();
 };
 
 struct CLessThan : CBinaryOp {
-    AST_T type() override;
+    CLessThan();
 };
 
 struct CLessOrEqual : CBinaryOp {
-    AST_T type() override;
+    CLessOrEqual();
 };
 
 struct CGreaterThan : CBinaryOp {
-    AST_T type() override;
+    CGreaterThan();
 };
 
 struct CGreaterOrEqual : CBinaryOp {
-    AST_T type() override;
+    CGreaterOrEqual();
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -139,20 +139,18 @@ struct CGreaterOrEqual : CBinaryOp {
 //                     | AbstractArray(int, abstract_declarator)
 //                     | AbstractBase
 struct CAbstractDeclarator : Ast {
-    AST_T type() override;
+    CAbstractDeclarator(AST_T type_t);
 };
 
 struct CAbstractPointer : CAbstractDeclarator {
-    AST_T type() override;
-    CAbstractPointer() = default;
+    CAbstractPointer();
     CAbstractPointer(std::unique_ptr<CAbstractDeclarator> abstract_declarator);
 
     std::unique_ptr<CAbstractDeclarator> abstract_declarator;
 };
 
 struct CAbstractArray : CAbstractDeclarator {
-    AST_T type() override;
-    CAbstractArray() = default;
+    CAbstractArray();
     CAbstractArray(TLong size, std::unique_ptr<CAbstractDeclarator> abstract_declarator);
 
     TLong size;
@@ -160,7 +158,7 @@ struct CAbstractArray : CAbstractDeclarator {
 };
 
 struct CAbstractBase : CAbstractDeclarator {
-    AST_T type() override;
+    CAbstractBase();
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -168,8 +166,7 @@ struct CAbstractBase : CAbstractDeclarator {
 // param_info = Param(type, declarator)
 struct CDeclarator;
 struct CParam : Ast {
-    AST_T type() override;
-    CParam() = default;
+    CParam();
     CParam(std::unique_ptr<CDeclarator> declarator, std::shared_ptr<Type> param_type);
 
     std::unique_ptr<CDeclarator> declarator;
@@ -183,28 +180,25 @@ struct CParam : Ast {
 //            | ArrayDeclarator(int, declarator)
 //            | FunDeclarator(param_info*, declarator)
 struct CDeclarator : Ast {
-    AST_T type() override;
+    CDeclarator(AST_T type_t);
 };
 
 struct CIdent : CDeclarator {
-    AST_T type() override;
-    CIdent() = default;
+    CIdent();
     CIdent(TIdentifier name);
 
     TIdentifier name;
 };
 
 struct CPointerDeclarator : CDeclarator {
-    AST_T type() override;
-    CPointerDeclarator() = default;
+    CPointerDeclarator();
     CPointerDeclarator(std::unique_ptr<CDeclarator> declarator);
 
     std::unique_ptr<CDeclarator> declarator;
 };
 
 struct CArrayDeclarator : CDeclarator {
-    AST_T type() override;
-    CArrayDeclarator() = default;
+    CArrayDeclarator();
     CArrayDeclarator(TLong size, std::unique_ptr<CDeclarator> declarator);
 
     TLong size;
@@ -212,8 +206,7 @@ struct CArrayDeclarator : CDeclarator {
 };
 
 struct CFunDeclarator : CDeclarator {
-    AST_T type() override;
-    CFunDeclarator() = default;
+    CFunDeclarator();
     CFunDeclarator(std::vector<std::unique_ptr<CParam>> param_list, std::unique_ptr<CDeclarator> declarator);
 
     std::vector<std::unique_ptr<CParam>> param_list;
@@ -239,17 +232,15 @@ struct CFunDeclarator : CDeclarator {
 //     | Dot(exp, identifier, type)
 //     | Arrow(exp, identifier, type)
 struct CExp : Ast {
-    AST_T type() override;
-    CExp() = default;
-    CExp(size_t line);
+    CExp(AST_T type_t);
+    CExp(AST_T type_t, size_t line);
 
     std::shared_ptr<Type> exp_type;
     size_t line;
 };
 
 struct CConstant : CExp {
-    AST_T type() override;
-    CConstant() = default;
+    CConstant();
     CConstant(std::shared_ptr<CConst> constant, size_t line);
 
     std::shared_ptr<CConst> constant;
@@ -259,8 +250,7 @@ struct CConstant : CExp {
 };
 
 struct CString : CExp {
-    AST_T type() override;
-    CString() = default;
+    CString();
     CString(std::shared_ptr<CStringLiteral> literal, size_t line);
 
     std::shared_ptr<CStringLiteral> literal;
@@ -270,8 +260,7 @@ struct CString : CExp {
 };
 
 struct CVar : CExp {
-    AST_T type() override;
-    CVar() = default;
+    CVar();
     CVar(TIdentifier name, size_t line);
 
     TIdentifier name;
@@ -281,8 +270,7 @@ struct CVar : CExp {
 };
 
 struct CCast : CExp {
-    AST_T type() override;
-    CCast() = default;
+    CCast();
     CCast(std::unique_ptr<CExp> exp, std::shared_ptr<Type> target_type, size_t line);
 
     std::unique_ptr<CExp> exp;
@@ -293,8 +281,7 @@ struct CCast : CExp {
 };
 
 struct CUnary : CExp {
-    AST_T type() override;
-    CUnary() = default;
+    CUnary();
     CUnary(std::unique_ptr<CUnaryOp> unary_op, std::unique_ptr<CExp> exp, size_t line);
 
     std::unique_ptr<CUnaryOp> unary_op;
@@ -305,8 +292,7 @@ struct CUnary : CExp {
 };
 
 struct CBinary : CExp {
-    AST_T type() override;
-    CBinary() = default;
+    CBinary();
     CBinary(std::unique_ptr<CBinaryOp> binary_op, std::unique_ptr<CExp> exp_left, std::unique_ptr<CExp> exp_right,
         size_t line);
 
@@ -319,8 +305,7 @@ struct CBinary : CExp {
 };
 
 struct CAssignment : CExp {
-    AST_T type() override;
-    CAssignment() = default;
+    CAssignment();
     CAssignment(std::unique_ptr<CExp> exp_left, std::unique_ptr<CExp> exp_right, size_t line);
 
     // Optional
@@ -332,8 +317,7 @@ struct CAssignment : CExp {
 };
 
 struct CConditional : CExp {
-    AST_T type() override;
-    CConditional() = default;
+    CConditional();
     CConditional(std::unique_ptr<CExp> condition, std::unique_ptr<CExp> exp_middle, std::unique_ptr<CExp> exp_right,
         size_t line);
 
@@ -346,8 +330,7 @@ struct CConditional : CExp {
 };
 
 struct CFunctionCall : CExp {
-    AST_T type() override;
-    CFunctionCall() = default;
+    CFunctionCall();
     CFunctionCall(TIdentifier name, std::vector<std::unique_ptr<CExp>> args, size_t line);
 
     TIdentifier name;
@@ -358,8 +341,7 @@ struct CFunctionCall : CExp {
 };
 
 struct CDereference : CExp {
-    AST_T type() override;
-    CDereference() = default;
+    CDereference();
     CDereference(std::unique_ptr<CExp> exp, size_t line);
 
     std::unique_ptr<CExp> exp;
@@ -369,8 +351,7 @@ struct CDereference : CExp {
 };
 
 struct CAddrOf : CExp {
-    AST_T type() override;
-    CAddrOf() = default;
+    CAddrOf();
     CAddrOf(std::unique_ptr<CExp> exp, size_t line);
 
     std::unique_ptr<CExp> exp;
@@ -380,8 +361,7 @@ struct CAddrOf : CExp {
 };
 
 struct CSubscript : CExp {
-    AST_T type() override;
-    CSubscript() = default;
+    CSubscript();
     CSubscript(std::unique_ptr<CExp> primary_exp, std::unique_ptr<CExp> subscript_exp, size_t line);
 
     std::unique_ptr<CExp> primary_exp;
@@ -392,8 +372,7 @@ struct CSubscript : CExp {
 };
 
 struct CSizeOf : CExp {
-    AST_T type() override;
-    CSizeOf() = default;
+    CSizeOf();
     CSizeOf(std::unique_ptr<CExp> exp, size_t line);
 
     std::unique_ptr<CExp> exp;
@@ -403,8 +382,7 @@ struct CSizeOf : CExp {
 };
 
 struct CSizeOfT : CExp {
-    AST_T type() override;
-    CSizeOfT() = default;
+    CSizeOfT();
     CSizeOfT(std::shared_ptr<Type> target_type, size_t line);
 
     std::shared_ptr<Type> target_type;
@@ -414,8 +392,7 @@ struct CSizeOfT : CExp {
 };
 
 struct CDot : CExp {
-    AST_T type() override;
-    CDot() = default;
+    CDot();
     CDot(TIdentifier member, std::unique_ptr<CExp> structure, size_t line);
 
     TIdentifier member;
@@ -426,8 +403,7 @@ struct CDot : CExp {
 };
 
 struct CArrow : CExp {
-    AST_T type() override;
-    CArrow() = default;
+    CArrow();
     CArrow(TIdentifier member, std::unique_ptr<CExp> pointer, size_t line);
 
     TIdentifier member;
@@ -452,12 +428,11 @@ struct CArrow : CExp {
 //           | Continue(identifier)
 //           | Null
 struct CStatement : Ast {
-    AST_T type() override;
+    CStatement(AST_T type_t);
 };
 
 struct CReturn : CStatement {
-    AST_T type() override;
-    CReturn() = default;
+    CReturn();
     CReturn(std::unique_ptr<CExp> exp, size_t line);
 
     // Optional
@@ -466,16 +441,14 @@ struct CReturn : CStatement {
 };
 
 struct CExpression : CStatement {
-    AST_T type() override;
-    CExpression() = default;
+    CExpression();
     CExpression(std::unique_ptr<CExp> exp);
 
     std::unique_ptr<CExp> exp;
 };
 
 struct CIf : CStatement {
-    AST_T type() override;
-    CIf() = default;
+    CIf();
     CIf(std::unique_ptr<CExp> condition, std::unique_ptr<CStatement> then, std::unique_ptr<CStatement> else_fi);
 
     std::unique_ptr<CExp> condition;
@@ -485,16 +458,14 @@ struct CIf : CStatement {
 };
 
 struct CGoto : CStatement {
-    AST_T type() override;
-    CGoto() = default;
+    CGoto();
     CGoto(TIdentifier target);
 
     TIdentifier target;
 };
 
 struct CLabel : CStatement {
-    AST_T type() override;
-    CLabel() = default;
+    CLabel();
     CLabel(TIdentifier target, std::unique_ptr<CStatement> jump_to, size_t line);
 
     TIdentifier target;
@@ -504,16 +475,14 @@ struct CLabel : CStatement {
 
 struct CBlock;
 struct CCompound : CStatement {
-    AST_T type() override;
-    CCompound() = default;
+    CCompound();
     CCompound(std::unique_ptr<CBlock> block);
 
     std::unique_ptr<CBlock> block;
 };
 
 struct CWhile : CStatement {
-    AST_T type() override;
-    CWhile() = default;
+    CWhile();
     CWhile(std::unique_ptr<CExp> condition, std::unique_ptr<CStatement> body);
 
     TIdentifier target;
@@ -522,8 +491,7 @@ struct CWhile : CStatement {
 };
 
 struct CDoWhile : CStatement {
-    AST_T type() override;
-    CDoWhile() = default;
+    CDoWhile();
     CDoWhile(std::unique_ptr<CExp> condition, std::unique_ptr<CStatement> body);
 
     TIdentifier target;
@@ -533,8 +501,7 @@ struct CDoWhile : CStatement {
 
 struct CForInit;
 struct CFor : CStatement {
-    AST_T type() override;
-    CFor() = default;
+    CFor();
     CFor(std::unique_ptr<CForInit> init, std::unique_ptr<CExp> condition, std::unique_ptr<CExp> post,
         std::unique_ptr<CStatement> body);
 
@@ -546,8 +513,7 @@ struct CFor : CStatement {
 };
 
 struct CBreak : CStatement {
-    AST_T type() override;
-    CBreak() = default;
+    CBreak();
     CBreak(size_t line);
 
     TIdentifier target;
@@ -555,8 +521,7 @@ struct CBreak : CStatement {
 };
 
 struct CContinue : CStatement {
-    AST_T type() override;
-    CContinue() = default;
+    CContinue();
     CContinue(size_t line);
 
     TIdentifier target;
@@ -564,7 +529,7 @@ struct CContinue : CStatement {
 };
 
 struct CNull : CStatement {
-    AST_T type() override;
+    CNull();
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -572,21 +537,19 @@ struct CNull : CStatement {
 // for_init = InitDecl(variable_declaration)
 //          | InitExp(exp?)
 struct CForInit : Ast {
-    AST_T type() override;
+    CForInit(AST_T type_t);
 };
 
 struct CVariableDeclaration;
 struct CInitDecl : CForInit {
-    AST_T type() override;
-    CInitDecl() = default;
+    CInitDecl();
     CInitDecl(std::unique_ptr<CVariableDeclaration> init);
 
     std::unique_ptr<CVariableDeclaration> init;
 };
 
 struct CInitExp : CForInit {
-    AST_T type() override;
-    CInitExp() = default;
+    CInitExp();
     CInitExp(std::unique_ptr<CExp> init);
 
     // Optional
@@ -597,13 +560,12 @@ struct CInitExp : CForInit {
 
 // block = B(block_item*)
 struct CBlock : Ast {
-    AST_T type() override;
+    CBlock(AST_T type_t);
 };
 
 struct CBlockItem;
 struct CB : CBlock {
-    AST_T type() override;
-    CB() = default;
+    CB();
     CB(std::vector<std::unique_ptr<CBlockItem>> block_items);
 
     std::vector<std::unique_ptr<CBlockItem>> block_items;
@@ -614,12 +576,11 @@ struct CB : CBlock {
 // block_item = S(statement)
 //            | D(declaration)
 struct CBlockItem : Ast {
-    AST_T type() override;
+    CBlockItem(AST_T type_t);
 };
 
 struct CS : CBlockItem {
-    AST_T type() override;
-    CS() = default;
+    CS();
     CS(std::unique_ptr<CStatement> statement);
 
     std::unique_ptr<CStatement> statement;
@@ -627,8 +588,7 @@ struct CS : CBlockItem {
 
 struct CDeclaration;
 struct CD : CBlockItem {
-    AST_T type() override;
-    CD() = default;
+    CD();
     CD(std::unique_ptr<CDeclaration> declaration);
 
     std::unique_ptr<CDeclaration> declaration;
@@ -639,31 +599,30 @@ struct CD : CBlockItem {
 // storage_class = Static
 //               | Extern
 struct CStorageClass : Ast {
-    AST_T type() override;
+    CStorageClass(AST_T type_t);
 };
 
 struct CStatic : CStorageClass {
-    AST_T type() override;
+    CStatic();
 };
 
 struct CExtern : CStorageClass {
-    AST_T type() override;
+    CExtern();
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // initializer = SingleInit(exp)
 //             | CompoundInit(initializer*)
+//             | ZeroInit(int)
 struct CInitializer : Ast {
-    AST_T type() override;
-    CInitializer() = default;
+    CInitializer(AST_T type_t);
 
     std::shared_ptr<Type> init_type;
 };
 
 struct CSingleInit : CInitializer {
-    AST_T type() override;
-    CSingleInit() = default;
+    CSingleInit();
     CSingleInit(std::unique_ptr<CExp> exp);
 
     std::unique_ptr<CExp> exp;
@@ -673,8 +632,7 @@ struct CSingleInit : CInitializer {
 };
 
 struct CCompoundInit : CInitializer {
-    AST_T type() override;
-    CCompoundInit() = default;
+    CCompoundInit();
     CCompoundInit(std::vector<std::unique_ptr<CInitializer>> initializers);
 
     std::vector<std::unique_ptr<CInitializer>> initializers;
@@ -683,12 +641,21 @@ struct CCompoundInit : CInitializer {
     */
 };
 
+struct CZeroInit : CInitializer {
+    CZeroInit();
+    CZeroInit(TLong byte);
+
+    TLong byte;
+    /*
+    std::shared_ptr<Type> init_type;
+    */
+};
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // member_declaration = CMemberDeclaration(identifier, type)
 struct CMemberDeclaration : Ast {
-    AST_T type() override;
-    CMemberDeclaration() = default;
+    CMemberDeclaration();
     CMemberDeclaration(TIdentifier member_name, std::shared_ptr<Type> member_type, size_t line);
 
     TIdentifier member_name;
@@ -700,8 +667,7 @@ struct CMemberDeclaration : Ast {
 
 // struct_declaration = StructDeclaration(identifier, member_declaration*)
 struct CStructDeclaration : Ast {
-    AST_T type() override;
-    CStructDeclaration() = default;
+    CStructDeclaration();
     CStructDeclaration(TIdentifier tag, std::vector<std::unique_ptr<CMemberDeclaration>> members, size_t line);
 
     TIdentifier tag;
@@ -713,8 +679,7 @@ struct CStructDeclaration : Ast {
 
 // function_declaration = FunctionDeclaration(identifier, identifier*, block?, type, storage_class?)
 struct CFunctionDeclaration : Ast {
-    AST_T type() override;
-    CFunctionDeclaration() = default;
+    CFunctionDeclaration();
     CFunctionDeclaration(TIdentifier name, std::vector<TIdentifier> params, std::unique_ptr<CBlock> body,
         std::shared_ptr<Type> fun_type, std::unique_ptr<CStorageClass> storage_class, size_t line);
 
@@ -732,8 +697,7 @@ struct CFunctionDeclaration : Ast {
 
 // variable_declaration = VariableDeclaration(identifier, initializer?, type, storage_class?)
 struct CVariableDeclaration : Ast {
-    AST_T type() override;
-    CVariableDeclaration() = default;
+    CVariableDeclaration();
     CVariableDeclaration(TIdentifier name, std::unique_ptr<CInitializer> init, std::shared_ptr<Type> var_type,
         std::unique_ptr<CStorageClass> storage_class, size_t line);
 
@@ -751,28 +715,25 @@ struct CVariableDeclaration : Ast {
 //             | VarDecl(variable_declaration)
 //             | StructDecl(struct_declaration)
 struct CDeclaration : Ast {
-    AST_T type() override;
+    CDeclaration(AST_T type_t);
 };
 
 struct CFunDecl : CDeclaration {
-    AST_T type() override;
-    CFunDecl() = default;
+    CFunDecl();
     CFunDecl(std::unique_ptr<CFunctionDeclaration> function_decl);
 
     std::unique_ptr<CFunctionDeclaration> function_decl;
 };
 
 struct CVarDecl : CDeclaration {
-    AST_T type() override;
-    CVarDecl() = default;
+    CVarDecl();
     CVarDecl(std::unique_ptr<CVariableDeclaration> variable_decl);
 
     std::unique_ptr<CVariableDeclaration> variable_decl;
 };
 
 struct CStructDecl : CDeclaration {
-    AST_T type() override;
-    CStructDecl() = default;
+    CStructDecl();
     CStructDecl(std::unique_ptr<CStructDeclaration> struct_decl);
 
     std::unique_ptr<CStructDeclaration> struct_decl;
@@ -782,8 +743,7 @@ struct CStructDecl : CDeclaration {
 
 // AST = Program(declaration*)
 struct CProgram : Ast {
-    AST_T type() override;
-    CProgram() = default;
+    CProgram();
     CProgram(std::vector<std::unique_ptr<CDeclaration>> declarations);
 
     std::vector<std::unique_ptr<CDeclaration>> declarations;
@@ -28,48 +28,51 @@
 //      | Array(int, type)
 //      | Structure(identifier)
 struct Type : Ast {
-    AST_T type() override;
+    Type(AST_T type_t);
+
+    // Layout memoized by get_type_scale and get_type_alignment, -1 until measured
+    TLong scale;
+    TInt alignment;
 };
 
 struct Char : Type {
-    AST_T type() override;
+    Char();
 };
 
 struct SChar : Type {
-    AST_T type() override;
+    SChar();
 };
 
 struct UChar : Type {
-    AST_T type() override;
+    UChar();
 };
 
 struct Int : Type {
-    AST_T type() override;
+    Int();
 };
 
 struct Long : Type {
-    AST_T type() override;
+    Long();
 };
 
 struct UInt : Type {
-    AST_T type() override;
+    UInt();
 };
 
 struct ULong : Type {
-    AST_T type() override;
+    ULong();
 };
 
 struct Double : Type {
-    AST_T type() override;
+    Double();
 };
 
 struct Void : Type {
-    AST_T type() override;
+    Void();
 };
 
 struct FunType : Type {
-    AST_T type() override;
-    FunType() = default;
+    FunType();
     FunType(std::vector<std::shared_ptr<Type>> param_types, std::shared_ptr<Type> ret_type);
 
     std::vector<std::shared_ptr<Type>> param_types;
@@ -77,16 +80,14 @@ struct FunType : Type {
 };
 
 struct Pointer : Type {
-    AST_T type() override;
-    Pointer() = default;
+    Pointer();
     Pointer(std::shared_ptr<Type> ref_type);
 
     std::shared_ptr<Type> ref_type;
 };
 
 struct Array : Type {
-    AST_T type() override;
-    Array() = default;
+    Array();
     Array(TLong size, std::shared_ptr<Type> elem_type);
 
     TLong size;
@@ -94,8 +95,7 @@ struct Array : Type {
 };
 
 struct Structure : Type {
-    AST_T type() override;
-    Structure() = default;
+    Structure();
     Structure(TIdentifier tag);
 
     TIdentifier tag;
@@ -111,63 +111,57 @@ struct Structure : Type {
 //             | UCharInit(int)
 //             | DoubleInit(double, int)
 //             | ZeroInit(int)
+//             | BytesInit(int*)
 //             | StringInit(bool, identifier, string)
 //             | PointerInit(identifier)
 struct StaticInit : Ast {
-    AST_T type() override;
+    StaticInit(AST_T type_t);
 };
 
 struct IntInit : StaticInit {
-    AST_T type() override;
-    IntInit() = default;
+    IntInit();
     IntInit(TInt value);
 
     TInt value;
 };
 
 struct LongInit : StaticInit {
-    AST_T type() override;
-    LongInit() = default;
+    LongInit();
     LongInit(TLong value);
 
     TLong value;
 };
 
 struct UIntInit : StaticInit {
-    AST_T type() override;
-    UIntInit() = default;
+    UIntInit();
     UIntInit(TUInt value);
 
     TUInt value;
 };
 
 struct ULongInit : StaticInit {
-    AST_T type() override;
-    ULongInit() = default;
+    ULongInit();
     ULongInit(TULong value);
 
     TULong value;
 };
 
 struct CharInit : StaticInit {
-    AST_T type() override;
-    CharInit() = default;
+    CharInit();
     CharInit(TChar value);
 
     TChar value;
 };
 
 struct UCharInit : StaticInit {
-    AST_T type() override;
-    UCharInit() = default;
+    UCharInit();
     UCharInit(TUChar value);
 
     TUChar value;
 };
 
 struct DoubleInit : StaticInit {
-    AST_T type() override;
-    DoubleInit() = default;
+    DoubleInit();
     DoubleInit(TDouble value, TULong binary);
 
     TDouble value;
@@ -175,16 +169,21 @@ struct DoubleInit : StaticInit {
 };
 
 struct ZeroInit : StaticInit {
-    AST_T type() override;
-    ZeroInit() = default;
+    ZeroInit();
     ZeroInit(TLong byte);
 
     TLong byte;
 };
 
+struct BytesInit : StaticInit {
+    BytesInit();
+    BytesInit(std::vector<TUChar> bytes);
+
+    std::vector<TUChar> bytes;
+};
+
 struct StringInit : StaticInit {
-    AST_T type() override;
-    StringInit() = default;
+    StringInit();
     StringInit(bool is_null_terminated, TIdentifier string_constant, std::shared_ptr<CStringLiteral> literal);
 
     bool is_null_terminated;
@@ -193,8 +192,7 @@ struct StringInit : StaticInit {
 };
 
 struct PointerInit : StaticInit {
-    AST_T type() override;
-    PointerInit() = default;
+    PointerInit();
     PointerInit(TIdentifier name);
 
     TIdentifier name;
@@ -206,23 +204,22 @@ struct PointerInit : StaticInit {
 //               | Initial(static_init*)
 //               | NoInitializer
 struct InitialValue : Ast {
-    AST_T type() override;
+    InitialValue(AST_T type_t);
 };
 
 struct Tentative : InitialValue {
-    AST_T type() override;
+    Tentative();
 };
 
 struct Initial : InitialValue {
-    AST_T type() override;
-    Initial() = default;
+    Initial();
     Initial(std::vector<std::shared_ptr<StaticInit>> static_inits);
 
     std::vector<std::shared_ptr<StaticInit>> static_inits;
 };
 
 struct NoInitializer : InitialValue {
-    AST_T type() override;
+    NoInitializer();
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -232,12 +229,11 @@ struct NoInitializer : InitialValue {
 //                  | ConstantAttr(static_init)
 //                  | LocalAttr
 struct IdentifierAttr : Ast {
-    AST_T type() override;
+    IdentifierAttr(AST_T type_t);
 };
 
 struct FunAttr : IdentifierAttr {
-    AST_T type() override;
-    FunAttr() = default;
+    FunAttr();
     FunAttr(bool is_defined, bool is_global);
 
     bool is_defined;
@@ -245,8 +241,7 @@ struct FunAttr : IdentifierAttr {
 };
 
 struct StaticAttr : IdentifierAttr {
-    AST_T type() override;
-    StaticAttr() = default;
+    StaticAttr();
     StaticAttr(bool is_global, std::shared_ptr<InitialValue> init);
 
     bool is_global;
@@ -254,23 +249,21 @@ struct StaticAttr : IdentifierAttr {
 };
 
 struct ConstantAttr : IdentifierAttr {
-    AST_T type() override;
-    ConstantAttr() = default;
+    ConstantAttr();
     ConstantAttr(std::shared_ptr<StaticInit> static_init);
 
     std::shared_ptr<StaticInit> static_init;
 };
 
 struct LocalAttr : IdentifierAttr {
-    AST_T type() override;
+    LocalAttr();
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // symbol = Symbol(type, identifier_attrs)
 struct Symbol : Ast {
-    AST_T type() override;
-    Symbol() = default;
+    Symbol();
     Symbol(std::shared_ptr<Type> type_t, std::unique_ptr<IdentifierAttr> attrs);
 
     std::shared_ptr<Type> type_t;
@@ -279,29 +272,28 @@ struct Symbol : Ast {
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-// struct_member = StructMember(int, type)
+// struct_member = StructMember(identifier, int, type)
 struct StructMember : Ast {
-    AST_T type() override;
-    StructMember() = default;
-    StructMember(TLong offset, std::shared_ptr<Type> member_type);
+    StructMember();
+    StructMember(TIdentifier member_name, TLong offset, std::shared_ptr<Type> member_type);
 
+    TIdentifier member_name;
     TLong offset;
     std::shared_ptr<Type> member_type;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-// struct_typedef(int, int, identifier*, struct_member*)
+// struct_typedef(int, int, struct_member*)
 struct StructTypedef : Ast {
-    AST_T type() override;
-    StructTypedef() = default;
-    StructTypedef(TInt alignment, TLong size, std::vector<TIdentifier> member_names,
-        std::unordered_map<TIdentifier, std::unique_ptr<StructMember>> members);
+    StructTypedef();
+    StructTypedef(TInt alignment, TLong size, std::vector<StructMember> members);
 
     TInt alignment;
     TLong size;
-    std::vector<TIdentifier> member_names;
-    std::unordered_map<TIdentifier, std::unique_ptr<StructMember>> members;
+    // Members are stored inline in declaration order, and indexed by name through positions sorted by member name
+    std::vector<StructMember> members;
+    std::vector<size_t> member_index;
 };
 
 /*
@@ -321,16 +313,29 @@ struct FrontEndContext {
     // Frontend symbol table
     std::unordered_map<TIdentifier, std::unique_ptr<Symbol>> symbol_table;
     std::unordered_map<TIdentifier, TIdentifier> static_constant_table;
+    std::unordered_map<TULong, TIdentifier> double_constant_table;
     std::unordered_map<TIdentifier, std::unique_ptr<StructTypedef>> struct_typedef_table;
+    // Type interner
+    std::vector<std::shared_ptr<Type>> scalar_types;
+    std::unordered_map<Type*, std::shared_ptr<Type>> pointer_types;
+    std::unordered_map<Type*, std::unordered_map<TLong, std::shared_ptr<Type>>> array_types;
+    std::unordered_map<TIdentifier, std::shared_ptr<Type>> structure_types;
 };
 
 extern std::unique_ptr<FrontEndContext> frontend;
 #define INIT_FRONT_END_CONTEXT frontend = std::make_unique<FrontEndContext>()
 #define FREE_FRONT_END_CONTEXT frontend.reset()
 
-#define GET_STRUCT_TYPEDEF_MEMBER(X, Y) \
-    frontend->struct_typedef_table[(X)]->members[frontend->struct_typedef_table[(X)]->member_names[(Y)]]
-#define GET_STRUCT_TYPEDEF_MEMBER_BACK(X) \
-    frontend->struct_typedef_table[(X)]->members[frontend->struct_typedef_table[(X)]->member_names.back()]
+std::shared_ptr<Type> get_scalar_type(AST_T type_t);
+std::shared_ptr<Type> get_pointer_type(std::shared_ptr<Type> ref_type);
+std::shared_ptr<Type> get_array_type(TLong size, std::shared_ptr<Type> elem_type);
+void intern_type(std::shared_ptr<Type>& type);
+StructMember* get_struct_typedef_member(StructTypedef* struct_typedef, TIdentifier member_name);
+TInt get_scalar_type_size(Type* type);
+TLong get_type_scale(Type* type);
+TInt get_type_alignment(Type* type);
+
+#define GET_STRUCT_TYPEDEF_MEMBER(X, Y) (&frontend->struct_typedef_table[(X)]->members[(Y)])
+#define GET_STRUCT_TYPEDEF_MEMBER_BACK(X) (&frontend->struct_typedef_table[(X)]->members.back())
 
 #endif
@@ -17,19 +17,19 @@
 //                | Negate
 //                | Not
 struct TacUnaryOp : Ast {
-    AST_T type() override;
+    TacUnaryOp(AST_T type_t);
 };
 
 struct TacComplement : TacUnaryOp {
-    AST_T type() override;
+    TacComplement();
 };
 
 struct TacNegate : TacUnaryOp {
-    AST_T type() override;
+    TacNegate();
 };
 
 struct TacNot : TacUnaryOp {
-    AST_T type() override;
+    TacNot();
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -52,75 +52,75 @@ struct TacNot : TacUnaryOp {
 //                 | GreaterThan
 //                 | GreaterOrEqual
 struct TacBinaryOp : Ast {
-    AST_T type() override;
+    TacBinaryOp(AST_T type_t);
 };
 
 struct TacAdd : TacBinaryOp {
-    AST_T type() override;
+    TacAdd();
 };
 
 struct TacSubtract : TacBinaryOp {
-    AST_T type() override;
+    TacSubtract();
 };
 
 struct TacMultiply : TacBinaryOp {
-    AST_T type() override;
+    TacMultiply();
 };
 
 struct TacDivide : TacBinaryOp {
-    AST_T type() override;
+    TacDivide();
 };
 
 struct TacRemainder : TacBinaryOp {
-    AST_T type() override;
+    TacRemainder();
 };
 
 struct TacBitAnd : TacBinaryOp {
-    AST_T type() override;
+    TacBitAnd();
 };
 
 struct TacBitOr : TacBinaryOp {
-    AST_T type() override;
+    TacBitOr();
 };
 
 struct TacBitXor : TacBinaryOp {
-    AST_T type() override;
+    TacBitXor();
 };
 
 struct TacBitShiftLeft : TacBinaryOp {
-    AST_T type() override;
+    TacBitShiftLeft();
 };
 
 struct TacBitShiftRight : TacBinaryOp {
-    AST_T type() override;
+    TacBitShiftRight();
 };
 
 struct TacBitShrArithmetic : TacBinaryOp {
-    AST_T type() override;
+    TacBitShrArithmetic();
 };
 
 struct TacEqual : TacBinaryOp {
-    AST_T type() override;
+    TacEqual();
 };
 
 struct TacNotEqual : TacBinaryOp {
-    AST_T type() override;
+    TacNotEqual();
 };
 
 struct TacLessThan : TacBinaryOp {
-    AST_T type() override;
+    TacLessThan();
 };
 
 struct TacLessOrEqual : TacBinaryOp {
-    AST_T type() override;
+    TacLessOrEqual();
 };
 
 struct TacGreaterThan : TacBinaryOp {
-    AST_T type() override;
+    TacGreaterThan();
 };
 
 struct TacGreaterOrEqual : TacBinaryOp {
-    AST_T type() override;
+    TacGreaterOrEqual();
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -128,20 +128,18 @@ struct TacGreaterOrEqual : TacBinaryOp {
 // val = Constant(int)
 //     | Var(identifier)
 struct TacValue : Ast {
-    AST_T type() override;
+    TacValue(AST_T type_t);
 };
 
 struct TacConstant : TacValue {
-    AST_T type() override;
-    TacConstant() = default;
+    TacConstant();
     TacConstant(std::shared_ptr<CConst> constant);
 
     std::shared_ptr<CConst> constant;
 };
 
 struct TacVariable : TacValue {
-    AST_T type() override;
-    TacVariable() = default;
+    TacVariable();
     TacVariable(TIdentifier name);
 
     TIdentifier name;
@@ -153,28 +151,25 @@ struct TacVariable : TacValue {
 //            | DereferencedPointer(val)
 //            | SubObject(identifier, int)
 struct TacExpResult : Ast {
-    AST_T type() override;
+    TacExpResult(AST_T type_t);
 };
 
 struct TacPlainOperand : TacExpResult {
-    AST_T type() override;
-    TacPlainOperand() = default;
+    TacPlainOperand();
     TacPlainOperand(std::shared_ptr<TacValue> val);
 
     std::shared_ptr<TacValue> val;
 };
 
 struct TacDereferencedPointer : TacExpResult {
-    AST_T type() override;
-    TacDereferencedPointer() = default;
+    TacDereferencedPointer();
     TacDereferencedPointer(std::shared_ptr<TacValue> val);
 
     std::shared_ptr<TacValue> val;
 };
 
 struct TacSubObject : TacExpResult {
-    AST_T type() override;
-    TacSubObject() = default;
+    TacSubObject();
     TacSubObject(TIdentifier base_name, TLong offset);
 
     TIdentifier base_name;
@@ -204,17 +199,17 @@ struct TacSubObject : TacExpResult {
 //             | AddPtr(int, val, val, val)
 //             | CopyToOffset(identifier, int, val)
 //             | CopyFromOffset(identifier, int, val)
+//             | ZeroFill(identifier, int, int)
 //             | Jump(identifier)
 //             | JumpIfZero(val, identifier)
 //             | JumpIfNotZero(val, identifier)
 //             | Label(identifier)
 struct TacInstruction : Ast {
-    AST_T type() override;
+    TacInstruction(AST_T type_t);
 };
 
 struct TacReturn : TacInstruction {
-    AST_T type() override;
-    TacReturn() = default;
+    TacReturn();
     TacReturn(std::shared_ptr<TacValue> val);
 
     // Optional
@@ -222,8 +217,7 @@ struct TacReturn : TacInstruction {
 };
 
 struct TacSignExtend : TacInstruction {
-    AST_T type() override;
-    TacSignExtend() = default;
+    TacSignExtend();
     TacSignExtend(std::shared_ptr<TacValue> src, std::shared_ptr<TacValue> dst);
 
     std::shared_ptr<TacValue> src;
@@ -231,8 +225,7 @@ struct TacSignExtend : TacInstruction {
 };
 
 struct TacTruncate : TacInstruction {
-    AST_T type() override;
-    TacTruncate() = default;
+    TacTruncate();
     TacTruncate(std::shared_ptr<TacValue> src, std::shared_ptr<TacValue> dst);
 
     std::shared_ptr<TacValue> src;
@@ -240,8 +233,7 @@ struct TacTruncate : TacInstruction {
 };
 
 struct TacZeroExtend : TacInstruction {
-    AST_T type() override;
-    TacZeroExtend() = default;
+    TacZeroExtend();
     TacZeroExtend(std::shared_ptr<TacValue> src, std::shared_ptr<TacValue> dst);
 
     std::shared_ptr<TacValue> src;
@@ -249,8 +241,7 @@ struct TacZeroExtend : TacInstruction {
 };
 
 struct TacDoubleToInt : TacInstruction {
-    AST_T type() override;
-    TacDoubleToInt() = default;
+    TacDoubleToInt();
     TacDoubleToInt(std::shared_ptr<TacValue> src, std::shared_ptr<TacValue> dst);
 
     std::shared_ptr<TacValue> src;
@@ -258,8 +249,7 @@ struct TacDoubleToInt : TacInstruction {
 };
 
 struct TacDoubleToUInt : TacInstruction {
-    AST_T type() override;
-    TacDoubleToUInt() = default;
+    TacDoubleToUInt();
     TacDoubleToUInt(std::shared_ptr<TacValue> src, std::shared_ptr<TacValue> dst);
 
     std::shared_ptr<TacValue> src;
@@ -267,8 +257,7 @@ struct TacDoubleToUInt : TacInstruction {
 };
 
 struct TacIntToDouble : TacInstruction {
-    AST_T type() override;
-    TacIntToDouble() = default;
+    TacIntToDouble();
     TacIntToDouble(std::shared_ptr<TacValue> src, std::shared_ptr<TacValue> dst);
 
     std::shared_ptr<TacValue> src;
@@ -276,8 +265,7 @@ struct TacIntToDouble : TacInstruction {
 };
 
 struct TacUIntToDouble : TacInstruction {
-    AST_T type() override;
-    TacUIntToDouble() = default;
+    TacUIntToDouble();
     TacUIntToDouble(std::shared_ptr<TacValue> src, std::shared_ptr<TacValue> dst);
 
     std::shared_ptr<TacValue> src;
@@ -285,8 +273,7 @@ struct TacUIntToDouble : TacInstruction {
 };
 
 struct TacFunCall : TacInstruction {
-    AST_T type() override;
-    TacFunCall() = default;
+    TacFunCall();
     TacFunCall(TIdentifier name, std::vector<std::shared_ptr<TacValue>> args, std::shared_ptr<TacValue> dst);
 
     TIdentifier name;
@@ -296,8 +283,7 @@ struct TacFunCall : TacInstruction {
 };
 
 struct TacUnary : TacInstruction {
-    AST_T type() override;
-    TacUnary() = default;
+    TacUnary();
     TacUnary(std::unique_ptr<TacUnaryOp> unary_op, std::shared_ptr<TacValue> src, std::shared_ptr<TacValue> dst);
 
     std::unique_ptr<TacUnaryOp> unary_op;
@@ -306,8 +292,7 @@ struct TacUnary : TacInstruction {
 };
 
 struct TacBinary : TacInstruction {
-    AST_T type() override;
-    TacBinary() = default;
+    TacBinary();
     TacBinary(std::unique_ptr<TacBinaryOp> binary_op, std::shared_ptr<TacValue> src1, std::shared_ptr<TacValue> src2,
         std::shared_ptr<TacValue> dst);
 
@@ -318,8 +303,7 @@ struct TacBinary : TacInstruction {
 };
 
 struct TacCopy : TacInstruction {
-    AST_T type() override;
-    TacCopy() = default;
+    TacCopy();
     TacCopy(std::shared_ptr<TacValue> src, std::shared_ptr<TacValue> dst);
 
     std::shared_ptr<TacValue> src;
@@ -327,8 +311,7 @@ struct TacCopy : TacInstruction {
 };
 
 struct TacGetAddress : TacInstruction {
-    AST_T type() override;
-    TacGetAddress() = default;
+    TacGetAddress();
     TacGetAddress(std::shared_ptr<TacValue> src, std::shared_ptr<TacValue> dst);
 
     std::shared_ptr<TacValue> src;
@@ -336,8 +319,7 @@ struct TacGetAddress : TacInstruction {
 };
 
 struct TacLoad : TacInstruction {
-    AST_T type() override;
-    TacLoad() = default;
+    TacLoad();
     TacLoad(std::shared_ptr<TacValue> src_ptr, std::shared_ptr<TacValue> dst);
 
     std::shared_ptr<TacValue> src_ptr;
@@ -345,8 +327,7 @@ struct TacLoad : TacInstruction {
 };
 
 struct TacStore : TacInstruction {
-    AST_T type() override;
-    TacStore() = default;
+    TacStore();
     TacStore(std::shared_ptr<TacValue> src, std::shared_ptr<TacValue> dst_ptr);
 
     std::shared_ptr<TacValue> src;
@@ -354,8 +335,7 @@ struct TacStore : TacInstruction {
 };
 
 struct TacAddPtr : TacInstruction {
-    AST_T type() override;
-    TacAddPtr() = default;
+    TacAddPtr();
     TacAddPtr(
         TLong scale, std::shared_ptr<TacValue> src_ptr, std::shared_ptr<TacValue> index, std::shared_ptr<TacValue> dst);
 
@@ -366,8 +346,7 @@ struct TacAddPtr : TacInstruction {
 };
 
 struct TacCopyToOffset : TacInstruction {
-    AST_T type() override;
-    TacCopyToOffset() = default;
+    TacCopyToOffset();
     TacCopyToOffset(TIdentifier dst_name, TLong offset, std::shared_ptr<TacValue> src);
 
     TIdentifier dst_name;
@@ -376,8 +355,7 @@ struct TacCopyToOffset : TacInstruction {
 };
 
 struct TacCopyFromOffset : TacInstruction {
-    AST_T type() override;
-    TacCopyFromOffset() = default;
+    TacCopyFromOffset();
     TacCopyFromOffset(TIdentifier src_name, TLong offset, std::shared_ptr<TacValue> dst);
 
     TIdentifier src_name;
@@ -385,17 +363,24 @@ struct TacCopyFromOffset : TacInstruction {
     std::shared_ptr<TacValue> dst;
 };
 
+struct TacZeroFill : TacInstruction {
+    TacZeroFill();
+    TacZeroFill(TIdentifier dst_name, TLong offset, TLong byte);
+
+    TIdentifier dst_name;
+    TLong offset;
+    TLong byte;
+};
+
 struct TacJump : TacInstruction {
-    AST_T type() override;
-    TacJump() = default;
+    TacJump();
     TacJump(TIdentifier target);
 
     TIdentifier target;
 };
 
 struct TacJumpIfZero : TacInstruction {
-    AST_T type() override;
-    TacJumpIfZero() = default;
+    TacJumpIfZero();
     TacJumpIfZero(TIdentifier target, std::shared_ptr<TacValue> condition);
 
     TIdentifier target;
@@ -403,8 +388,7 @@ struct TacJumpIfZero : TacInstruction {
 };
 
 struct TacJumpIfNotZero : TacInstruction {
-    AST_T type() override;
-    TacJumpIfNotZero() = default;
+    TacJumpIfNotZero();
     TacJumpIfNotZero(TIdentifier target, std::shared_ptr<TacValue> condition);
 
     TIdentifier target;
@@ -412,8 +396,7 @@ struct TacJumpIfNotZero : TacInstruction {
 };
 
 struct TacLabel : TacInstruction {
-    AST_T type() override;
-    TacLabel() = default;
+    TacLabel();
     TacLabel(TIdentifier name);
 
     TIdentifier name;
@@ -421,28 +404,28 @@ struct TacLabel : TacInstruction {
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-// top_level = Function(identifier, bool, identifier*, instruction*)
+// top_level = Function(identifier, bool, identifier*, instruction*, type*)
 //           | StaticVariable(identifier, bool, type, static_init*)
 //           | StaticConstant(identifier, type, static_init)
 struct TacTopLevel : Ast {
-    AST_T type() override;
+    TacTopLevel(AST_T type_t);
 };
 
 struct TacFunction : TacTopLevel {
-    AST_T type() override;
-    TacFunction() = default;
+    TacFunction();
     TacFunction(TIdentifier name, bool is_global, std::vector<TIdentifier> params,
-        std::vector<std::unique_ptr<TacInstruction>> body);
+        std::vector<std::unique_ptr<TacInstruction>> body, std::vector<std::shared_ptr<Type>> temp_types);
 
     TIdentifier name;
     bool is_global;
     std::vector<TIdentifier> params;
     std::vector<std::unique_ptr<TacInstruction>> body;
+    // Function temporary table, indexed by temporary identifier
+    std::vector<std::shared_ptr<Type>> temp_types;
 };
 
 struct TacStaticVariable : TacTopLevel {
-    AST_T type() override;
-    TacStaticVariable() = default;
+    TacStaticVariable();
     TacStaticVariable(TIdentifier name, bool is_global, std::shared_ptr<Type> static_init_type,
         std::vector<std::shared_ptr<StaticInit>> static_inits);
 
@@ -453,8 +436,7 @@ struct TacStaticVariable : TacTopLevel {
 };
 
 struct TacStaticConstant : TacTopLevel {
-    AST_T type() override;
-    TacStaticConstant() = default;
+    TacStaticConstant();
     TacStaticConstant(
         TIdentifier name, std::shared_ptr<Type> static_init_type, std::shared_ptr<StaticInit> static_init);
 
@@ -467,8 +449,7 @@ struct TacStaticConstant : TacTopLevel {
 
 // AST = Program(top_level*, top_level*, top_level*)
 struct TacProgram : Ast {
-    AST_T type() override;
-    TacProgram() = default;
+    TacProgram();
     TacProgram(std::vector<std::unique_ptr<TacTopLevel>> static_constant_top_levels,
         std::vector<std::unique_ptr<TacTopLevel>> static_variable_top_levels,
         std::vector<std::unique_ptr<TacTopLevel>> function_top_levels);
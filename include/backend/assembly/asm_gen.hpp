@@ -29,6 +29,7 @@ struct AsmGenContext {
     std::unordered_map<TIdentifier, std::vector<STRUCT_8B_CLS>> struct_8b_cls_map;
     std::vector<std::unique_ptr<AsmInstruction>>* p_instructions;
     std::vector<std::unique_ptr<AsmTopLevel>>* p_static_constant_top_levels;
+    std::vector<std::shared_ptr<Type>>* p_temp_types;
 };
 
 std::unique_ptr<AsmProgram> assembly_generation(std::unique_ptr<TacProgram> tac_ast);
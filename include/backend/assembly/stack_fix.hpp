@@ -23,6 +23,8 @@ struct StackFixContext {
     // Pseudo register replacement
     TLong stack_bytes;
     std::unordered_map<TIdentifier, TLong> pseudo_stack_bytes_map;
+    std::vector<TLong> temp_stack_bytes;
+    std::vector<std::shared_ptr<AssemblyType>>* p_temp_types;
     // Instruction fix up
     std::vector<std::unique_ptr<AsmInstruction>>* p_fix_instructions;
 };
@@ -17,7 +17,7 @@ struct SymtCvtContext {
 };
 
 TInt generate_type_alignment(Type* type);
-std::shared_ptr<AssemblyType> convert_backend_assembly_type(const TIdentifier& name);
+std::shared_ptr<AssemblyType> convert_backend_assembly_type(Type* type);
 void convert_symbol_table(AsmProgram* node);
 
 #endif
@@ -19,11 +19,19 @@
 // Loop labeling
 // Identifier resolution
 
+// Each name maps to its stack of bindings, with the innermost binding last, and each scope logs the names it bound
+struct ScopedIdentifier {
+    size_t scope_depth;
+    TIdentifier name;
+};
+
 struct SemanticContext {
     // Type checking
     std::unordered_map<TIdentifier, size_t> external_linkage_scope_map;
-    std::vector<std::unordered_map<TIdentifier, TIdentifier>> scoped_identifier_maps;
-    std::vector<std::unordered_map<TIdentifier, TIdentifier>> scoped_structure_tag_maps;
+    std::unordered_map<TIdentifier, std::vector<ScopedIdentifier>> scoped_identifier_map;
+    std::unordered_map<TIdentifier, std::vector<ScopedIdentifier>> scoped_structure_tag_map;
+    std::vector<std::vector<TIdentifier>> scoped_identifier_logs;
+    std::vector<std::vector<TIdentifier>> scoped_structure_tag_logs;
     std::unordered_map<TIdentifier, TIdentifier> goto_map;
     std::unordered_set<TIdentifier> label_set;
     // Loop labeling
@@ -15,6 +15,8 @@ struct TacReprContext {
     std::vector<std::unique_ptr<TacInstruction>>* p_instructions;
     std::vector<std::unique_ptr<TacTopLevel>>* p_top_levels;
     std::vector<std::unique_ptr<TacTopLevel>>* p_static_constant_top_levels;
+    std::vector<std::shared_ptr<Type>>* p_temp_types;
+    size_t temp_counter;
 };
 
 std::unique_ptr<TacProgram> three_address_code_representation(std::unique_ptr<CProgram> c_ast);
@@ -23,6 +23,11 @@ enum ERROR_MESSAGE_ARGUMENT {
     unhandled_argument_error = 100,
     no_debug_code_in_argument,
     invalid_debug_code_in_argument,
+    no_lexer_code_in_argument,
+    invalid_lexer_code_in_argument,
+    no_cache_directory_in_argument,
+    no_optim_code_in_argument,
+    invalid_optim_code_in_argument,
     no_input_files_in_argument,
     no_include_directories_in_argument
 };
@@ -114,6 +119,7 @@ struct FileOpenLine {
 struct ErrorsContext {
     size_t line_buffer;
     std::vector<FileOpenLine> file_open_lines;
+    TokenRing* p_token_ring;
 };
 
 extern std::unique_ptr<ErrorsContext> errors;
@@ -121,8 +127,8 @@ extern std::unique_ptr<ErrorsContext> errors;
 #define FREE_ERRORS_CONTEXT errors.reset()
 
 std::string get_token_kind_hr(TOKEN_KIND token_kind);
-std::string get_name_hr(const TIdentifier& name);
-std::string get_struct_name_hr(const TIdentifier& name);
+std::string get_name_hr(TIdentifier name);
+std::string get_struct_name_hr(TIdentifier name);
 std::string get_type_hr(Type* type);
 std::string get_const_hr(CConst* node);
 std::string get_storage_class_hr(CStorageClass* node);
@@ -3,8 +3,14 @@
 
 #include "boost/regex.hpp"
 #include <array>
+#include <atomic>
+#include <exception>
+#include <inttypes.h>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -16,25 +22,132 @@
 
 constexpr size_t TOKEN_KIND_SIZE = TOKEN_KIND::error + 1;
 
+// Token stream stored as struct of arrays, each token refers to a spelling id. Fixed tokens have the spelling id of
+// their kind, and the spellings of the other tokens are appended to a single buffer
+struct Tokens {
+    std::vector<TOKEN_KIND> token_kinds;
+    std::vector<uint32_t> spelling_ids;
+    std::vector<uint32_t> lines;
+    std::vector<uint32_t> spelling_offsets;
+    std::string spellings;
+};
+
 struct Token {
-    std::string token;
+    std::string_view token;
+    TOKEN_KIND token_kind;
+    size_t line;
+};
+
+constexpr size_t TOKEN_RING_SIZE = 1 << 16;
+
+// Bounded single producer single consumer ring of tokens, filled by the lexer thread while the parser consumes it.
+// Slots are reused once the parser popped past them, fixed tokens take their spellings from the shared tokens
+struct TokenRing {
+    TokenRing();
+    ~TokenRing();
+
+    std::atomic<bool> is_done;
+    std::atomic<bool> is_discard;
+    std::atomic<size_t> head;
+    std::atomic<size_t> tail;
+    size_t last_line;
+    Tokens tokens;
+    std::vector<TOKEN_KIND> token_kinds;
+    std::vector<uint32_t> lines;
+    std::vector<std::string> spellings;
+    std::exception_ptr lexer_error;
+    std::thread lexer_thread;
+};
+
+enum SCAN_CHAR {
+    scan_other,
+    scan_space,
+    scan_separator,
+    scan_digit,
+    scan_alpha,
+    scan_punct
+};
+
+// Preprocessor tokens keep their spelling and the names of the macros they were expanded from (hide set)
+struct PreprocessorToken {
     TOKEN_KIND token_kind;
+    bool is_space;
     size_t line;
+    std::string token;
+    std::vector<std::string> hide_set;
+};
+
+struct Macro {
+    bool is_function;
+    bool is_variadic;
+    std::vector<std::string> params;
+    std::vector<PreprocessorToken> tokens;
+};
+
+// Values of conditional expressions have the type intmax_t or uintmax_t (C17 6.10.1p4)
+struct ConditionValue {
+    bool is_unsigned;
+    uint64_t value;
+};
+
+struct ConditionalGroup {
+    bool is_active;
+    bool is_taken;
+    bool is_else;
+    size_t line;
+};
+
+enum INCLUDE_GUARD {
+    guard_start,
+    guard_inside,
+    guard_end,
+    guard_none
+};
+
+struct IncludeGuard {
+    INCLUDE_GUARD state;
+    size_t depth;
+    std::string filename;
+    std::string macro_name;
 };
 
 struct LexerContext {
-    LexerContext(std::vector<Token>* p_tokens, std::vector<std::string>* p_includedirs);
+    LexerContext(Tokens* p_tokens, std::vector<std::string>* p_includedirs, std::string&& cachedir,
+        bool is_regex_lexer, bool is_preprocessor);
 
+    bool is_comment;
+    bool is_space;
+    bool is_regex_lexer;
+    bool is_preprocessor;
     size_t total_line_number;
-    std::vector<Token>* p_tokens;
+    Tokens* p_tokens;
+    TokenRing* p_token_ring;
     std::vector<std::string>* p_includedirs;
+    std::string cachedir;
+    std::vector<std::string> token_caches;
     std::vector<std::string> stdlibdirs;
     std::array<std::string, TOKEN_KIND_SIZE> TOKEN_REGEXPS;
+    std::array<SCAN_CHAR, 256> SCAN_CHARS;
     std::string token_groups[TOKEN_KIND_SIZE];
     std::unique_ptr<const boost::regex> token_pattern;
     std::unordered_set<std::string> filename_include_set;
+    // Preprocessor
+    std::vector<PreprocessorToken> preprocessor_tokens;
+    std::unordered_map<std::string, Macro> macros;
+    std::vector<ConditionalGroup> conditional_groups;
+    std::vector<IncludeGuard> include_guards;
+    std::unordered_map<std::string, std::string> guard_macros;
+    std::unordered_set<std::string> pragma_once_set;
 };
 
-std::unique_ptr<std::vector<Token>> lexing(std::string& filename, std::vector<std::string>&& includedirs);
+Token get_token(const Tokens& tokens, size_t i);
+Token get_token(const TokenRing& token_ring, size_t i);
+bool wait_token(const TokenRing& token_ring, size_t i);
+void release_tokens(TokenRing& token_ring, size_t i);
+void join_lexing(TokenRing& token_ring, bool is_discard);
+std::unique_ptr<Tokens> lexing(std::string& filename, std::vector<std::string>&& includedirs, std::string&& cachedir,
+    bool is_regex_lexer, bool is_preprocessor);
+std::unique_ptr<TokenRing> lexing_pipeline(std::string& filename, std::vector<std::string>&& includedirs,
+    std::string&& cachedir, bool is_regex_lexer, bool is_preprocessor);
 
 #endif
@@ -24,14 +24,17 @@ struct Declarator {
 };
 
 struct ParserContext {
-    ParserContext(std::vector<Token>* p_tokens);
+    ParserContext(const Tokens* p_tokens, TokenRing* p_token_ring);
 
-    std::vector<Token>* p_tokens;
-    Token* next_token;
-    Token* peek_token;
+    const Tokens* p_tokens;
+    TokenRing* p_token_ring;
+    Token next_token;
+    Token peek_token;
     size_t pop_index;
+    std::vector<size_t> skip_indices;
 };
 
-std::unique_ptr<CProgram> parsing(std::unique_ptr<std::vector<Token>> tokens);
+std::unique_ptr<CProgram> parsing(std::unique_ptr<Tokens> tokens);
+std::unique_ptr<CProgram> parsing(std::unique_ptr<TokenRing> token_ring);
 
 #endif
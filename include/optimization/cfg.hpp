@@ -0,0 +1,71 @@
+#ifndef _OPTIMIZATION_CFG_HPP
+#define _OPTIMIZATION_CFG_HPP
+
+#include <inttypes.h>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "ast/ast.hpp"
+#include "ast/interm_ast.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Control flow graph
+
+// A block is a range of instruction indices, empty instruction slots inside the range are skipped. The entry and exit
+// are virtual blocks numbered right after the last block
+struct ControlFlowBlock {
+    ControlFlowBlock(size_t instructions_front_index);
+
+    size_t instructions_front_index;
+    size_t instructions_back_index;
+    std::vector<size_t> predecessor_ids;
+    std::vector<size_t> successor_ids;
+};
+
+struct ControlFlowGraph {
+    size_t entry_id;
+    size_t exit_id;
+    std::vector<ControlFlowBlock> blocks;
+    std::vector<size_t> entry_successor_ids;
+    std::vector<size_t> exit_predecessor_ids;
+    std::unordered_map<TIdentifier, size_t> label_id_map;
+};
+
+void build_control_flow_graph(ControlFlowGraph& cfg, const std::vector<std::unique_ptr<TacInstruction>>& instructions);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Data flow analysis
+
+enum DATA_FLOW_KIND {
+    Dforward_may,
+    Dforward_must,
+    Dbackward_may,
+    Dbackward_must
+};
+
+// Sets are dense bitsets over the facts of the analysis, stored in one flat vector with one row of words per block.
+// Blocks transfer their sets through gen and kill, the boundary set flows in from the entry or the exit
+struct DataFlowAnalysis {
+    size_t n_facts;
+    size_t n_words;
+    std::vector<uint64_t> gen_sets;
+    std::vector<uint64_t> kill_sets;
+    std::vector<uint64_t> in_sets;
+    std::vector<uint64_t> out_sets;
+    std::vector<uint64_t> boundary_set;
+    std::vector<size_t> block_order;
+};
+
+#define GET_DFA_WORD_INDEX(X, Y, Z) ((Y) * (X).n_words + ((Z) >> 6))
+#define GET_DFA_BIT_MASK(Z) (static_cast<uint64_t>(1) << ((Z) & 63))
+#define IS_DFA_BIT_SET(S, X, Y, Z) (((S)[GET_DFA_WORD_INDEX(X, Y, Z)] & GET_DFA_BIT_MASK(Z)) != 0)
+#define SET_DFA_BIT(S, X, Y, Z) ((S)[GET_DFA_WORD_INDEX(X, Y, Z)] |= GET_DFA_BIT_MASK(Z))
+#define CLEAR_DFA_BIT(S, X, Y, Z) ((S)[GET_DFA_WORD_INDEX(X, Y, Z)] &= ~GET_DFA_BIT_MASK(Z))
+
+void init_data_flow_analysis(DataFlowAnalysis& dfa, const ControlFlowGraph& cfg, size_t n_facts);
+void solve_data_flow_analysis(DataFlowAnalysis& dfa, const ControlFlowGraph& cfg, DATA_FLOW_KIND data_flow_kind);
+
+#endif
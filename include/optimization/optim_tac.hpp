@@ -0,0 +1,69 @@
+#ifndef _OPTIMIZATION_OPTIM_TAC_HPP
+#define _OPTIMIZATION_OPTIM_TAC_HPP
+
+#include <array>
+#include <inttypes.h>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "ast/front_symt.hpp"
+#include "ast/interm_ast.hpp"
+
+#include "optimization/cfg.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Three address code optimization
+
+enum OPTIM_PASS_KIND {
+    Ofold_constants,
+    Opropagate_copies,
+    Oeliminate_unreachable_code
+};
+
+// Each pass is enabled by its bit in the optimization mask
+constexpr size_t OPTIM_PASS_SIZE = 3;
+constexpr int OPTIM_MASK_ALL = (1 << OPTIM_PASS_SIZE) - 1;
+#define IS_OPTIM_PASS_ENABLED(X, Y) (((X) & (1 << (Y))) != 0)
+
+struct OptimTacStats {
+    OptimTacStats();
+
+    size_t n_iterations;
+    std::array<size_t, OPTIM_PASS_SIZE> n_removed_instructions;
+    std::array<size_t, OPTIM_PASS_SIZE> n_rewritten_instructions;
+};
+
+struct OptimTacContext {
+    OptimTacContext(int optim_mask);
+
+    int optim_mask;
+    bool is_fixed_point;
+    OPTIM_PASS_KIND pass_kind;
+    OptimTacStats stats;
+    ControlFlowGraph control_flow_graph;
+    std::vector<std::unique_ptr<TacInstruction>>* p_instructions;
+    std::vector<std::shared_ptr<Type>>* p_temp_types;
+    // Copy propagation
+    DataFlowAnalysis data_flow_analysis;
+    std::vector<TIdentifier> copy_dst_names;
+    std::vector<std::shared_ptr<TacValue>> copy_srcs;
+    std::vector<size_t> instruction_copy_ids;
+    std::vector<uint64_t> aliased_copy_set;
+    std::unordered_map<TIdentifier, std::vector<size_t>> variable_copy_ids;
+    std::unordered_map<TIdentifier, std::vector<uint64_t>> variable_copy_sets;
+    std::unordered_set<TIdentifier> address_taken_names;
+    std::unordered_set<TIdentifier> written_names;
+    // Positions of the copies and writes met while a block is rewritten
+    size_t position;
+    size_t aliased_write_position;
+    std::vector<size_t> copy_positions;
+    std::unordered_map<TIdentifier, size_t> write_positions;
+    std::unordered_map<TIdentifier, size_t> dst_copy_ids;
+};
+
+OptimTacStats optimize_three_address_code(TacProgram* node, int optim_mask);
+
+#endif
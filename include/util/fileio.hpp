@@ -1,7 +1,9 @@
 #ifndef _UTIL_FILEIO_HPP
 #define _UTIL_FILEIO_HPP
 
+#include <inttypes.h>
 #include <string>
+#include <string_view>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -11,9 +13,14 @@ void set_filename(const std::string& filename);
 void file_open_read(const std::string& filename);
 void file_open_write(const std::string& filename);
 bool find_file(const std::string& filename);
-bool read_line(std::string& line);
+bool find_dir_file(const std::string& dirname, const std::string& filename);
+bool stat_file(const std::string& filename, size_t& file_size, int64_t& file_mtime);
+std::string_view get_file_read();
+bool read_binary_file(const std::string& filename, std::string& content);
+bool write_binary_file(const std::string& filename, const std::string& content);
+bool read_line(std::string_view& line);
 void write_line(std::string&& line);
-void file_close_read(size_t line_number);
+void file_close_read();
 void file_close_write();
 
 #endif
@@ -12,7 +12,7 @@
 
 // Pretty print
 
-void pretty_print_tokens(const std::vector<Token>& tokens);
+void pretty_print_tokens(const Tokens& tokens);
 void pretty_print_ast(Ast* node, const std::string& name);
 void pretty_print_symbol_table();
 void pretty_print_static_constant_table();
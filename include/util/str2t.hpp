@@ -3,26 +3,27 @@
 
 #include <inttypes.h>
 #include <string>
+#include <string_view>
 #include <vector>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // String to type
 
-intmax_t string_to_intmax(const std::string& s_int, size_t line);
+intmax_t string_to_intmax(std::string_view s_int, size_t line);
 int32_t intmax_to_int32(intmax_t intmax);
 int64_t intmax_to_int64(intmax_t intmax);
-uintmax_t string_to_uintmax(const std::string& s_uint, size_t line);
+uintmax_t string_to_uintmax(std::string_view s_uint, size_t line);
 uint32_t uintmax_to_uint32(uintmax_t uintmax);
 uint64_t uintmax_to_uint64(uintmax_t uintmax);
-uint64_t string_to_uint64(const std::string& s_uint);
+uint64_t string_to_uint64(std::string_view s_uint);
 void string_to_string_literal(const std::string& s_string, std::vector<int8_t>& string_literal);
 int32_t string_to_char_ascii(const std::string& s_char);
 int8_t string_literal_bytes_to_int8(const std::vector<int8_t>& string_literal, size_t byte_at);
 int32_t string_literal_bytes_to_int32(const std::vector<int8_t>& string_literal, size_t byte_at);
 int64_t string_literal_bytes_to_int64(const std::vector<int8_t>& string_literal, size_t byte_at);
 std::string string_literal_to_string_constant(const std::vector<int8_t>& string_literal);
-double string_to_double(const std::string& s_double, size_t line);
+double string_to_double(std::string_view s_double, size_t line);
 uint64_t double_to_binary(double decimal);
 
 #endif
@@ -4,6 +4,10 @@
 #include <memory>
 #include <stdio.h>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -14,17 +18,21 @@ struct MainContext {
     MainContext();
 
     bool is_verbose;
+    bool is_regex_lexer;
+    bool is_preprocessor;
+    bool is_pipeline;
     int debug_code;
     int optim_mask;
     std::string filename;
+    std::string cachedir;
     std::vector<std::string> includedirs;
     std::vector<std::string> args;
 };
 
 struct FileRead {
     size_t len;
+    size_t offset;
     char* buffer;
-    FILE* file_descriptor;
     std::string filename;
 };
 
@@ -34,6 +42,10 @@ struct UtilContext {
     std::string write_buffer;
     std::string filename;
     std::vector<FileRead> file_reads;
+    std::thread::id file_reads_thread_id;
+    // Directory index
+    size_t n_file_stats;
+    std::unordered_map<std::string, std::unordered_set<std::string>> dir_indexes;
 };
 
 extern std::unique_ptr<UtilContext> util;
@@ -1,3 +1,6 @@
+#include <memory>
+#include <string>
+#include <string_view>
 #include <vector>
 
 #include "ast/ast.hpp"
@@ -6,30 +9,124 @@
 
 // Abstract syntax tree
 
+static AstArena* p_ast_arena = nullptr;
+
+constexpr size_t AST_ARENA_CHUNK_SIZE = 1 << 16;
+
+// Each node is prefixed with its arena, nodes allocated outside of a stage have no arena
+constexpr size_t AST_ARENA_HEADER_SIZE = sizeof(AstArena*);
+
+AstArena::AstArena() : is_open(true), n_nodes(0), chunk_offset(AST_ARENA_CHUNK_SIZE) {}
+
+void* Ast::operator new(size_t size) {
+    size = (size + AST_ARENA_HEADER_SIZE + alignof(AstArena*) - 1) & ~(alignof(AstArena*) - 1);
+    char* buffer;
+    if (!p_ast_arena) {
+        buffer = static_cast<char*>(::operator new(size));
+    }
+    else if (size > AST_ARENA_CHUNK_SIZE) {
+        p_ast_arena->chunks.emplace_back(std::make_unique<char[]>(size));
+        p_ast_arena->chunk_offset = AST_ARENA_CHUNK_SIZE;
+        buffer = p_ast_arena->chunks.back().get();
+    }
+    else {
+        if (p_ast_arena->chunk_offset + size > AST_ARENA_CHUNK_SIZE) {
+            p_ast_arena->chunks.emplace_back(std::make_unique<char[]>(AST_ARENA_CHUNK_SIZE));
+            p_ast_arena->chunk_offset = 0;
+        }
+        buffer = p_ast_arena->chunks.back().get() + p_ast_arena->chunk_offset;
+        p_ast_arena->chunk_offset += size;
+    }
+    if (p_ast_arena) {
+        p_ast_arena->n_nodes++;
+    }
+    *reinterpret_cast<AstArena**>(buffer) = p_ast_arena;
+    return buffer + AST_ARENA_HEADER_SIZE;
+}
+
+void Ast::operator delete(void* ptr) {
+    if (!ptr) {
+        return;
+    }
+    char* buffer = static_cast<char*>(ptr) - AST_ARENA_HEADER_SIZE;
+    AstArena* p_arena = *reinterpret_cast<AstArena**>(buffer);
+    if (!p_arena) {
+        ::operator delete(buffer);
+    }
+    else if (--p_arena->n_nodes == 0 && !p_arena->is_open) {
+        delete p_arena;
+    }
+}
+
+void open_ast_arena() {
+    close_ast_arena();
+    p_ast_arena = new AstArena();
+}
+
+void close_ast_arena() {
+    if (p_ast_arena) {
+        p_ast_arena->is_open = false;
+        if (p_ast_arena->n_nodes == 0) {
+            delete p_ast_arena;
+        }
+        p_ast_arena = nullptr;
+    }
+}
+
+std::unique_ptr<IdentifierContext> identifiers;
+
+// The empty identifier is interned first, so that value initialized identifiers are empty
+IdentifierContext::IdentifierContext() {
+    names.emplace_back("");
+    ids[names.back()] = 0;
+}
+
+TIdentifier make_identifier(std::string_view name) {
+    auto it = identifiers->ids.find(name);
+    if (it != identifiers->ids.end()) {
+        return it->second;
+    }
+    TIdentifier identifier = static_cast<TIdentifier>(identifiers->names.size());
+    identifiers->names.emplace_back(name);
+    identifiers->ids[identifiers->names.back()] = identifier;
+    return identifier;
+}
+
+const std::string& get_identifier_name(TIdentifier identifier) { return identifiers->names[identifier]; }
+
+TIdentifier make_temp_identifier(size_t index) {
+    if (index >= static_cast<size_t>(TEMP_IDENTIFIER_BIT)) {
+        RAISE_INTERNAL_ERROR;
+    }
+    return static_cast<TIdentifier>(index) | TEMP_IDENTIFIER_BIT;
+}
+
+Ast::Ast(AST_T type_t) : type_t(type_t) {}
+
 Ast::~Ast() {}
 
-AST_T CConst::type() { return AST_T::CConst_t; }
-AST_T CConstInt::type() { return AST_T::CConstInt_t; }
-AST_T CConstLong::type() { return AST_T::CConstLong_t; }
-AST_T CConstUInt::type() { return AST_T::CConstUInt_t; }
-AST_T CConstULong::type() { return AST_T::CConstULong_t; }
-AST_T CConstDouble::type() { return AST_T::CConstDouble_t; }
-AST_T CConstChar::type() { return AST_T::CConstChar_t; }
-AST_T CConstUChar::type() { return AST_T::CConstUChar_t; }
-AST_T CStringLiteral::type() { return AST_T::CStringLiteral_t; }
+CConst::CConst(AST_T type_t) : Ast(type_t) {}
+CConstInt::CConstInt() : CConst(AST_T::CConstInt_t) {}
+CConstLong::CConstLong() : CConst(AST_T::CConstLong_t) {}
+CConstUInt::CConstUInt() : CConst(AST_T::CConstUInt_t) {}
+CConstULong::CConstULong() : CConst(AST_T::CConstULong_t) {}
+CConstDouble::CConstDouble() : CConst(AST_T::CConstDouble_t) {}
+CConstChar::CConstChar() : CConst(AST_T::CConstChar_t) {}
+CConstUChar::CConstUChar() : CConst(AST_T::CConstUChar_t) {}
+CStringLiteral::CStringLiteral() : Ast(AST_T::CStringLiteral_t) {}
 
-CConstInt::CConstInt(TInt value) : value(value) {}
+CConstInt::CConstInt(TInt value) : CConst(AST_T::CConstInt_t), value(value) {}
 
-CConstLong::CConstLong(TLong value) : value(value) {}
+CConstLong::CConstLong(TLong value) : CConst(AST_T::CConstLong_t), value(value) {}
 
-CConstUInt::CConstUInt(TUInt value) : value(value) {}
+CConstUInt::CConstUInt(TUInt value) : CConst(AST_T::CConstUInt_t), value(value) {}
 
-CConstULong::CConstULong(TULong value) : value(value) {}
+CConstULong::CConstULong(TULong value) : CConst(AST_T::CConstULong_t), value(value) {}
 
-CConstDouble::CConstDouble(TDouble value) : value(value) {}
+CConstDouble::CConstDouble(TDouble value) : CConst(AST_T::CConstDouble_t), value(value) {}
 
-CConstChar::CConstChar(TChar value) : value(value) {}
+CConstChar::CConstChar(TChar value) : CConst(AST_T::CConstChar_t), value(value) {}
 
-CConstUChar::CConstUChar(TUChar value) : value(value) {}
+CConstUChar::CConstUChar(TUChar value) : CConst(AST_T::CConstUChar_t), value(value) {}
 
-CStringLiteral::CStringLiteral(std::vector<TChar> value) : value(std::move(value)) {}
+CStringLiteral::CStringLiteral(std::vector<TChar> value) : Ast(AST_T::CStringLiteral_t), value(std::move(value)) {}
@@ -10,184 +10,197 @@
 
 // Backend abstract syntax tree
 
-AST_T AsmReg::type() { return AST_T::AsmReg_t; }
-AST_T AsmAx::type() { return AST_T::AsmAx_t; }
-AST_T AsmCx::type() { return AST_T::AsmCx_t; }
-AST_T AsmDx::type() { return AST_T::AsmDx_t; }
-AST_T AsmDi::type() { return AST_T::AsmDi_t; }
-AST_T AsmSi::type() { return AST_T::AsmSi_t; }
-AST_T AsmR8::type() { return AST_T::AsmR8_t; }
-AST_T AsmR9::type() { return AST_T::AsmR9_t; }
-AST_T AsmR10::type() { return AST_T::AsmR10_t; }
-AST_T AsmR11::type() { return AST_T::AsmR11_t; }
-AST_T AsmSp::type() { return AST_T::AsmSp_t; }
-AST_T AsmBp::type() { return AST_T::AsmBp_t; }
-AST_T AsmXMM0::type() { return AST_T::AsmXMM0_t; }
-AST_T AsmXMM1::type() { return AST_T::AsmXMM1_t; }
-AST_T AsmXMM2::type() { return AST_T::AsmXMM2_t; }
-AST_T AsmXMM3::type() { return AST_T::AsmXMM3_t; }
-AST_T AsmXMM4::type() { return AST_T::AsmXMM4_t; }
-AST_T AsmXMM5::type() { return AST_T::AsmXMM5_t; }
-AST_T AsmXMM6::type() { return AST_T::AsmXMM6_t; }
-AST_T AsmXMM7::type() { return AST_T::AsmXMM7_t; }
-AST_T AsmXMM14::type() { return AST_T::AsmXMM14_t; }
-AST_T AsmXMM15::type() { return AST_T::AsmXMM15_t; }
-AST_T AsmCondCode::type() { return AST_T::AsmCondCode_t; }
-AST_T AsmE::type() { return AST_T::AsmE_t; }
-AST_T AsmNE::type() { return AST_T::AsmNE_t; }
-AST_T AsmG::type() { return AST_T::AsmG_t; }
-AST_T AsmGE::type() { return AST_T::AsmGE_t; }
-AST_T AsmL::type() { return AST_T::AsmL_t; }
-AST_T AsmLE::type() { return AST_T::AsmLE_t; }
-AST_T AsmA::type() { return AST_T::AsmA_t; }
-AST_T AsmAE::type() { return AST_T::AsmAE_t; }
-AST_T AsmB::type() { return AST_T::AsmB_t; }
-AST_T AsmBE::type() { return AST_T::AsmBE_t; }
-AST_T AsmP::type() { return AST_T::AsmP_t; }
-AST_T AsmOperand::type() { return AST_T::AsmOperand_t; }
-AST_T AsmImm::type() { return AST_T::AsmImm_t; }
-AST_T AsmRegister::type() { return AST_T::AsmRegister_t; }
-AST_T AsmPseudo::type() { return AST_T::AsmPseudo_t; }
-AST_T AsmMemory::type() { return AST_T::AsmMemory_t; }
-AST_T AsmData::type() { return AST_T::AsmData_t; }
-AST_T AsmPseudoMem::type() { return AST_T::AsmPseudoMem_t; }
-AST_T AsmIndexed::type() { return AST_T::AsmIndexed_t; }
-AST_T AsmBinaryOp::type() { return AST_T::AsmBinaryOp_t; }
-AST_T AsmAdd::type() { return AST_T::AsmAdd_t; }
-AST_T AsmSub::type() { return AST_T::AsmSub_t; }
-AST_T AsmMult::type() { return AST_T::AsmMult_t; }
-AST_T AsmDivDouble::type() { return AST_T::AsmDivDouble_t; }
-AST_T AsmBitAnd::type() { return AST_T::AsmBitAnd_t; }
-AST_T AsmBitOr::type() { return AST_T::AsmBitOr_t; }
-AST_T AsmBitXor::type() { return AST_T::AsmBitXor_t; }
-AST_T AsmBitShiftLeft::type() { return AST_T::AsmBitShiftLeft_t; }
-AST_T AsmBitShiftRight::type() { return AST_T::AsmBitShiftRight_t; }
-AST_T AsmBitShrArithmetic::type() { return AST_T::AsmBitShrArithmetic_t; }
-AST_T AsmUnaryOp::type() { return AST_T::AsmUnaryOp_t; }
-AST_T AsmNot::type() { return AST_T::AsmNot_t; }
-AST_T AsmNeg::type() { return AST_T::AsmNeg_t; }
-AST_T AsmShr::type() { return AST_T::AsmShr_t; }
-AST_T AsmInstruction::type() { return AST_T::AsmInstruction_t; }
-AST_T AsmMov::type() { return AST_T::AsmMov_t; }
-AST_T AsmMovSx::type() { return AST_T::AsmMovSx_t; }
-AST_T AsmMovZeroExtend::type() { return AST_T::AsmMovZeroExtend_t; }
-AST_T AsmLea::type() { return AST_T::AsmLea_t; }
-AST_T AsmCvttsd2si::type() { return AST_T::AsmCvttsd2si_t; }
-AST_T AsmCvtsi2sd::type() { return AST_T::AsmCvtsi2sd_t; }
-AST_T AsmUnary::type() { return AST_T::AsmUnary_t; }
-AST_T AsmBinary::type() { return AST_T::AsmBinary_t; }
-AST_T AsmCmp::type() { return AST_T::AsmCmp_t; }
-AST_T AsmIdiv::type() { return AST_T::AsmIdiv_t; }
-AST_T AsmDiv::type() { return AST_T::AsmDiv_t; }
-AST_T AsmCdq::type() { return AST_T::AsmCdq_t; }
-AST_T AsmJmp::type() { return AST_T::AsmJmp_t; }
-AST_T AsmJmpCC::type() { return AST_T::AsmJmpCC_t; }
-AST_T AsmSetCC::type() { return AST_T::AsmSetCC_t; }
-AST_T AsmLabel::type() { return AST_T::AsmLabel_t; }
-AST_T AsmPush::type() { return AST_T::AsmPush_t; }
-AST_T AsmCall::type() { return AST_T::AsmCall_t; }
-AST_T AsmRet::type() { return AST_T::AsmRet_t; }
-AST_T AsmTopLevel::type() { return AST_T::AsmTopLevel_t; }
-AST_T AsmFunction::type() { return AST_T::AsmFunction_t; }
-AST_T AsmStaticVariable::type() { return AST_T::AsmStaticVariable_t; }
-AST_T AsmStaticConstant::type() { return AST_T::AsmStaticConstant_t; }
-AST_T AsmProgram::type() { return AST_T::AsmProgram_t; }
+AsmReg::AsmReg(AST_T type_t) : Ast(type_t) {}
+AsmAx::AsmAx() : AsmReg(AST_T::AsmAx_t) {}
+AsmCx::AsmCx() : AsmReg(AST_T::AsmCx_t) {}
+AsmDx::AsmDx() : AsmReg(AST_T::AsmDx_t) {}
+AsmDi::AsmDi() : AsmReg(AST_T::AsmDi_t) {}
+AsmSi::AsmSi() : AsmReg(AST_T::AsmSi_t) {}
+AsmR8::AsmR8() : AsmReg(AST_T::AsmR8_t) {}
+AsmR9::AsmR9() : AsmReg(AST_T::AsmR9_t) {}
+AsmR10::AsmR10() : AsmReg(AST_T::AsmR10_t) {}
+AsmR11::AsmR11() : AsmReg(AST_T::AsmR11_t) {}
+AsmSp::AsmSp() : AsmReg(AST_T::AsmSp_t) {}
+AsmBp::AsmBp() : AsmReg(AST_T::AsmBp_t) {}
+AsmXMM0::AsmXMM0() : AsmReg(AST_T::AsmXMM0_t) {}
+AsmXMM1::AsmXMM1() : AsmReg(AST_T::AsmXMM1_t) {}
+AsmXMM2::AsmXMM2() : AsmReg(AST_T::AsmXMM2_t) {}
+AsmXMM3::AsmXMM3() : AsmReg(AST_T::AsmXMM3_t) {}
+AsmXMM4::AsmXMM4() : AsmReg(AST_T::AsmXMM4_t) {}
+AsmXMM5::AsmXMM5() : AsmReg(AST_T::AsmXMM5_t) {}
+AsmXMM6::AsmXMM6() : AsmReg(AST_T::AsmXMM6_t) {}
+AsmXMM7::AsmXMM7() : AsmReg(AST_T::AsmXMM7_t) {}
+AsmXMM14::AsmXMM14() : AsmReg(AST_T::AsmXMM14_t) {}
+AsmXMM15::AsmXMM15() : AsmReg(AST_T::AsmXMM15_t) {}
+AsmCondCode::AsmCondCode(AST_T type_t) : Ast(type_t) {}
+AsmE::AsmE() : AsmCondCode(AST_T::AsmE_t) {}
+AsmNE::AsmNE() : AsmCondCode(AST_T::AsmNE_t) {}
+AsmG::AsmG() : AsmCondCode(AST_T::AsmG_t) {}
+AsmGE::AsmGE() : AsmCondCode(AST_T::AsmGE_t) {}
+AsmL::AsmL() : AsmCondCode(AST_T::AsmL_t) {}
+AsmLE::AsmLE() : AsmCondCode(AST_T::AsmLE_t) {}
+AsmA::AsmA() : AsmCondCode(AST_T::AsmA_t) {}
+AsmAE::AsmAE() : AsmCondCode(AST_T::AsmAE_t) {}
+AsmB::AsmB() : AsmCondCode(AST_T::AsmB_t) {}
+AsmBE::AsmBE() : AsmCondCode(AST_T::AsmBE_t) {}
+AsmP::AsmP() : AsmCondCode(AST_T::AsmP_t) {}
+AsmOperand::AsmOperand(AST_T type_t) : Ast(type_t) {}
+AsmImm::AsmImm() : AsmOperand(AST_T::AsmImm_t) {}
+AsmRegister::AsmRegister() : AsmOperand(AST_T::AsmRegister_t) {}
+AsmPseudo::AsmPseudo() : AsmOperand(AST_T::AsmPseudo_t) {}
+AsmMemory::AsmMemory() : AsmOperand(AST_T::AsmMemory_t) {}
+AsmData::AsmData() : AsmOperand(AST_T::AsmData_t) {}
+AsmPseudoMem::AsmPseudoMem() : AsmOperand(AST_T::AsmPseudoMem_t) {}
+AsmIndexed::AsmIndexed() : AsmOperand(AST_T::AsmIndexed_t) {}
+AsmBinaryOp::AsmBinaryOp(AST_T type_t) : Ast(type_t) {}
+AsmAdd::AsmAdd() : AsmBinaryOp(AST_T::AsmAdd_t) {}
+AsmSub::AsmSub() : AsmBinaryOp(AST_T::AsmSub_t) {}
+AsmMult::AsmMult() : AsmBinaryOp(AST_T::AsmMult_t) {}
+AsmDivDouble::AsmDivDouble() : AsmBinaryOp(AST_T::AsmDivDouble_t) {}
+AsmBitAnd::AsmBitAnd() : AsmBinaryOp(AST_T::AsmBitAnd_t) {}
+AsmBitOr::AsmBitOr() : AsmBinaryOp(AST_T::AsmBitOr_t) {}
+AsmBitXor::AsmBitXor() : AsmBinaryOp(AST_T::AsmBitXor_t) {}
+AsmBitShiftLeft::AsmBitShiftLeft() : AsmBinaryOp(AST_T::AsmBitShiftLeft_t) {}
+AsmBitShiftRight::AsmBitShiftRight() : AsmBinaryOp(AST_T::AsmBitShiftRight_t) {}
+AsmBitShrArithmetic::AsmBitShrArithmetic() : AsmBinaryOp(AST_T::AsmBitShrArithmetic_t) {}
+AsmUnaryOp::AsmUnaryOp(AST_T type_t) : Ast(type_t) {}
+AsmNot::AsmNot() : AsmUnaryOp(AST_T::AsmNot_t) {}
+AsmNeg::AsmNeg() : AsmUnaryOp(AST_T::AsmNeg_t) {}
+AsmShr::AsmShr() : AsmUnaryOp(AST_T::AsmShr_t) {}
+AsmInstruction::AsmInstruction(AST_T type_t) : Ast(type_t) {}
+AsmMov::AsmMov() : AsmInstruction(AST_T::AsmMov_t) {}
+AsmMovSx::AsmMovSx() : AsmInstruction(AST_T::AsmMovSx_t) {}
+AsmMovZeroExtend::AsmMovZeroExtend() : AsmInstruction(AST_T::AsmMovZeroExtend_t) {}
+AsmLea::AsmLea() : AsmInstruction(AST_T::AsmLea_t) {}
+AsmCvttsd2si::AsmCvttsd2si() : AsmInstruction(AST_T::AsmCvttsd2si_t) {}
+AsmCvtsi2sd::AsmCvtsi2sd() : AsmInstruction(AST_T::AsmCvtsi2sd_t) {}
+AsmUnary::AsmUnary() : AsmInstruction(AST_T::AsmUnary_t) {}
+AsmBinary::AsmBinary() : AsmInstruction(AST_T::AsmBinary_t) {}
+AsmCmp::AsmCmp() : AsmInstruction(AST_T::AsmCmp_t) {}
+AsmIdiv::AsmIdiv() : AsmInstruction(AST_T::AsmIdiv_t) {}
+AsmDiv::AsmDiv() : AsmInstruction(AST_T::AsmDiv_t) {}
+AsmCdq::AsmCdq() : AsmInstruction(AST_T::AsmCdq_t) {}
+AsmRepStos::AsmRepStos() : AsmInstruction(AST_T::AsmRepStos_t) {}
+AsmJmp::AsmJmp() : AsmInstruction(AST_T::AsmJmp_t) {}
+AsmJmpCC::AsmJmpCC() : AsmInstruction(AST_T::AsmJmpCC_t) {}
+AsmSetCC::AsmSetCC() : AsmInstruction(AST_T::AsmSetCC_t) {}
+AsmLabel::AsmLabel() : AsmInstruction(AST_T::AsmLabel_t) {}
+AsmPush::AsmPush() : AsmInstruction(AST_T::AsmPush_t) {}
+AsmCall::AsmCall() : AsmInstruction(AST_T::AsmCall_t) {}
+AsmRet::AsmRet() : AsmInstruction(AST_T::AsmRet_t) {}
+AsmTopLevel::AsmTopLevel(AST_T type_t) : Ast(type_t) {}
+AsmFunction::AsmFunction() : AsmTopLevel(AST_T::AsmFunction_t) {}
+AsmStaticVariable::AsmStaticVariable() : AsmTopLevel(AST_T::AsmStaticVariable_t) {}
+AsmStaticConstant::AsmStaticConstant() : AsmTopLevel(AST_T::AsmStaticConstant_t) {}
+AsmProgram::AsmProgram() : Ast(AST_T::AsmProgram_t) {}
 
 AsmImm::AsmImm(bool is_byte, bool is_quad, TIdentifier value) :
-    is_byte(is_byte), is_quad(is_quad), value(std::move(value)) {}
+    AsmOperand(AST_T::AsmImm_t), is_byte(is_byte), is_quad(is_quad), value(std::move(value)) {}
 
-AsmRegister::AsmRegister(std::unique_ptr<AsmReg> reg) : reg(std::move(reg)) {}
+AsmRegister::AsmRegister(std::unique_ptr<AsmReg> reg) : AsmOperand(AST_T::AsmRegister_t), reg(std::move(reg)) {}
 
-AsmPseudo::AsmPseudo(TIdentifier name) : name(std::move(name)) {}
+AsmPseudo::AsmPseudo(TIdentifier name) : AsmOperand(AST_T::AsmPseudo_t), name(std::move(name)) {}
 
-AsmMemory::AsmMemory(TLong value, std::unique_ptr<AsmReg> reg) : value(value), reg(std::move(reg)) {}
+AsmMemory::AsmMemory(TLong value, std::unique_ptr<AsmReg> reg) :
+    AsmOperand(AST_T::AsmMemory_t), value(value), reg(std::move(reg)) {}
 
-AsmData::AsmData(TIdentifier name, TLong offset) : name(std::move(name)), offset(offset) {}
+AsmData::AsmData(TIdentifier name, TLong offset) :
+    AsmOperand(AST_T::AsmData_t), name(std::move(name)), offset(offset) {}
 
-AsmPseudoMem::AsmPseudoMem(TIdentifier name, TLong offset) : name(std::move(name)), offset(offset) {}
+AsmPseudoMem::AsmPseudoMem(TIdentifier name, TLong offset) :
+    AsmOperand(AST_T::AsmPseudoMem_t), name(std::move(name)), offset(offset) {}
 
 AsmIndexed::AsmIndexed(TLong scale, std::unique_ptr<AsmReg> reg_base, std::unique_ptr<AsmReg> reg_index) :
-    scale(scale), reg_base(std::move(reg_base)), reg_index(std::move(reg_index)) {}
+    AsmOperand(AST_T::AsmIndexed_t), scale(scale), reg_base(std::move(reg_base)), reg_index(std::move(reg_index)) {}
 
 AsmMov::AsmMov(
     std::shared_ptr<AssemblyType> assembly_type, std::shared_ptr<AsmOperand> src, std::shared_ptr<AsmOperand> dst) :
-    assembly_type(std::move(assembly_type)),
-    src(std::move(src)), dst(std::move(dst)) {}
+    AsmInstruction(AST_T::AsmMov_t),
+    assembly_type(std::move(assembly_type)), src(std::move(src)), dst(std::move(dst)) {}
 
 AsmMovSx::AsmMovSx(std::shared_ptr<AssemblyType> assembly_type_src, std::shared_ptr<AssemblyType> assembly_type_dst,
     std::shared_ptr<AsmOperand> src, std::shared_ptr<AsmOperand> dst) :
-    assembly_type_src(std::move(assembly_type_src)),
-    assembly_type_dst(std::move(assembly_type_dst)), src(std::move(src)), dst(std::move(dst)) {}
+    AsmInstruction(AST_T::AsmMovSx_t),
+    assembly_type_src(std::move(assembly_type_src)), assembly_type_dst(std::move(assembly_type_dst)),
+    src(std::move(src)), dst(std::move(dst)) {}
 
 AsmMovZeroExtend::AsmMovZeroExtend(std::shared_ptr<AssemblyType> assembly_type_src,
     std::shared_ptr<AssemblyType> assembly_type_dst, std::shared_ptr<AsmOperand> src, std::shared_ptr<AsmOperand> dst) :
-    assembly_type_src(std::move(assembly_type_src)),
-    assembly_type_dst(std::move(assembly_type_dst)), src(std::move(src)), dst(std::move(dst)) {}
+    AsmInstruction(AST_T::AsmMovZeroExtend_t),
+    assembly_type_src(std::move(assembly_type_src)), assembly_type_dst(std::move(assembly_type_dst)),
+    src(std::move(src)), dst(std::move(dst)) {}
 
 AsmLea::AsmLea(std::shared_ptr<AsmOperand> src, std::shared_ptr<AsmOperand> dst) :
-    src(std::move(src)), dst(std::move(dst)) {}
+    AsmInstruction(AST_T::AsmLea_t), src(std::move(src)), dst(std::move(dst)) {}
 
 AsmCvttsd2si::AsmCvttsd2si(
     std::shared_ptr<AssemblyType> assembly_type, std::shared_ptr<AsmOperand> src, std::shared_ptr<AsmOperand> dst) :
-    assembly_type(std::move(assembly_type)),
-    src(std::move(src)), dst(std::move(dst)) {}
+    AsmInstruction(AST_T::AsmCvttsd2si_t),
+    assembly_type(std::move(assembly_type)), src(std::move(src)), dst(std::move(dst)) {}
 
 AsmCvtsi2sd::AsmCvtsi2sd(
     std::shared_ptr<AssemblyType> assembly_type, std::shared_ptr<AsmOperand> src, std::shared_ptr<AsmOperand> dst) :
-    assembly_type(std::move(assembly_type)),
-    src(std::move(src)), dst(std::move(dst)) {}
+    AsmInstruction(AST_T::AsmCvtsi2sd_t),
+    assembly_type(std::move(assembly_type)), src(std::move(src)), dst(std::move(dst)) {}
 
 AsmUnary::AsmUnary(std::unique_ptr<AsmUnaryOp> unary_op, std::shared_ptr<AssemblyType> assembly_type,
     std::shared_ptr<AsmOperand> dst) :
-    unary_op(std::move(unary_op)),
-    assembly_type(std::move(assembly_type)), dst(std::move(dst)) {}
+    AsmInstruction(AST_T::AsmUnary_t),
+    unary_op(std::move(unary_op)), assembly_type(std::move(assembly_type)), dst(std::move(dst)) {}
 
 AsmBinary::AsmBinary(std::unique_ptr<AsmBinaryOp> binary_op, std::shared_ptr<AssemblyType> assembly_type,
     std::shared_ptr<AsmOperand> src, std::shared_ptr<AsmOperand> dst) :
-    binary_op(std::move(binary_op)),
-    assembly_type(std::move(assembly_type)), src(std::move(src)), dst(std::move(dst)) {}
+    AsmInstruction(AST_T::AsmBinary_t),
+    binary_op(std::move(binary_op)), assembly_type(std::move(assembly_type)), src(std::move(src)),
+    dst(std::move(dst)) {}
 
 AsmCmp::AsmCmp(
     std::shared_ptr<AssemblyType> assembly_type, std::shared_ptr<AsmOperand> src, std::shared_ptr<AsmOperand> dst) :
-    assembly_type(std::move(assembly_type)),
-    src(std::move(src)), dst(std::move(dst)) {}
+    AsmInstruction(AST_T::AsmCmp_t),
+    assembly_type(std::move(assembly_type)), src(std::move(src)), dst(std::move(dst)) {}
 
 AsmIdiv::AsmIdiv(std::shared_ptr<AssemblyType> assembly_type, std::shared_ptr<AsmOperand> src) :
-    assembly_type(std::move(assembly_type)), src(std::move(src)) {}
+    AsmInstruction(AST_T::AsmIdiv_t), assembly_type(std::move(assembly_type)), src(std::move(src)) {}
 
 AsmDiv::AsmDiv(std::shared_ptr<AssemblyType> assembly_type, std::shared_ptr<AsmOperand> src) :
-    assembly_type(std::move(assembly_type)), src(std::move(src)) {}
+    AsmInstruction(AST_T::AsmDiv_t), assembly_type(std::move(assembly_type)), src(std::move(src)) {}
+
+AsmCdq::AsmCdq(std::shared_ptr<AssemblyType> assembly_type) :
+    AsmInstruction(AST_T::AsmCdq_t), assembly_type(std::move(assembly_type)) {}
 
-AsmCdq::AsmCdq(std::shared_ptr<AssemblyType> assembly_type) : assembly_type(std::move(assembly_type)) {}
+AsmRepStos::AsmRepStos(std::shared_ptr<AssemblyType> assembly_type) :
+    AsmInstruction(AST_T::AsmRepStos_t), assembly_type(std::move(assembly_type)) {}
 
-AsmJmp::AsmJmp(TIdentifier target) : target(std::move(target)) {}
+AsmJmp::AsmJmp(TIdentifier target) : AsmInstruction(AST_T::AsmJmp_t), target(std::move(target)) {}
 
 AsmJmpCC::AsmJmpCC(TIdentifier target, std::unique_ptr<AsmCondCode> cond_code) :
-    target(std::move(target)), cond_code(std::move(cond_code)) {}
+    AsmInstruction(AST_T::AsmJmpCC_t), target(std::move(target)), cond_code(std::move(cond_code)) {}
 
 AsmSetCC::AsmSetCC(std::unique_ptr<AsmCondCode> cond_code, std::shared_ptr<AsmOperand> dst) :
-    cond_code(std::move(cond_code)), dst(std::move(dst)) {}
+    AsmInstruction(AST_T::AsmSetCC_t), cond_code(std::move(cond_code)), dst(std::move(dst)) {}
 
-AsmLabel::AsmLabel(TIdentifier name) : name(std::move(name)) {}
+AsmLabel::AsmLabel(TIdentifier name) : AsmInstruction(AST_T::AsmLabel_t), name(std::move(name)) {}
 
-AsmPush::AsmPush(std::shared_ptr<AsmOperand> src) : src(std::move(src)) {}
+AsmPush::AsmPush(std::shared_ptr<AsmOperand> src) : AsmInstruction(AST_T::AsmPush_t), src(std::move(src)) {}
 
-AsmCall::AsmCall(TIdentifier name) : name(std::move(name)) {}
+AsmCall::AsmCall(TIdentifier name) : AsmInstruction(AST_T::AsmCall_t), name(std::move(name)) {}
 
 AsmFunction::AsmFunction(TIdentifier name, bool is_global, bool is_return_memory,
-    std::vector<std::unique_ptr<AsmInstruction>> instructions) :
-    name(std::move(name)),
-    is_global(is_global), is_return_memory(is_return_memory), instructions(std::move(instructions)) {}
+    std::vector<std::unique_ptr<AsmInstruction>> instructions, std::vector<std::shared_ptr<AssemblyType>> temp_types) :
+    AsmTopLevel(AST_T::AsmFunction_t),
+    name(std::move(name)), is_global(is_global), is_return_memory(is_return_memory),
+    instructions(std::move(instructions)), temp_types(std::move(temp_types)) {}
 
 AsmStaticVariable::AsmStaticVariable(
     TIdentifier name, TInt alignment, bool is_global, std::vector<std::shared_ptr<StaticInit>> static_inits) :
-    name(std::move(name)),
-    alignment(alignment), is_global(is_global), static_inits(std::move(static_inits)) {}
+    AsmTopLevel(AST_T::AsmStaticVariable_t),
+    name(std::move(name)), alignment(alignment), is_global(is_global), static_inits(std::move(static_inits)) {}
 
 AsmStaticConstant::AsmStaticConstant(TIdentifier name, TInt alignment, std::shared_ptr<StaticInit> static_init) :
-    name(std::move(name)), alignment(alignment), static_init(std::move(static_init)) {}
+    AsmTopLevel(AST_T::AsmStaticConstant_t), name(std::move(name)), alignment(alignment),
+    static_init(std::move(static_init)) {}
 
 AsmProgram::AsmProgram(std::vector<std::unique_ptr<AsmTopLevel>> static_constant_top_levels,
     std::vector<std::unique_ptr<AsmTopLevel>> top_levels) :
-    static_constant_top_levels(std::move(static_constant_top_levels)),
-    top_levels(std::move(top_levels)) {}
+    Ast(AST_T::AsmProgram_t),
+    static_constant_top_levels(std::move(static_constant_top_levels)), top_levels(std::move(top_levels)) {}
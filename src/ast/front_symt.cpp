@@ -1,7 +1,10 @@
+#include <algorithm>
 #include <memory>
 #include <unordered_map>
 #include <vector>
 
+#include "util/throw.hpp"
+
 #include "ast/ast.hpp"
 #include "ast/front_symt.hpp"
 
@@ -9,96 +12,282 @@
 
 // Frontend symbol table
 
-AST_T Type::type() { return AST_T::Type_t; }
-AST_T Char::type() { return AST_T::Char_t; }
-AST_T SChar::type() { return AST_T::SChar_t; }
-AST_T UChar::type() { return AST_T::UChar_t; }
-AST_T Int::type() { return AST_T::Int_t; }
-AST_T Long::type() { return AST_T::Long_t; }
-AST_T UInt::type() { return AST_T::UInt_t; }
-AST_T ULong::type() { return AST_T::ULong_t; }
-AST_T Double::type() { return AST_T::Double_t; }
-AST_T Void::type() { return AST_T::Void_t; }
-AST_T FunType::type() { return AST_T::FunType_t; }
-AST_T Pointer::type() { return AST_T::Pointer_t; }
-AST_T Array::type() { return AST_T::Array_t; }
-AST_T Structure::type() { return AST_T::Structure_t; }
-AST_T StaticInit::type() { return AST_T::StaticInit_t; }
-AST_T IntInit::type() { return AST_T::IntInit_t; }
-AST_T LongInit::type() { return AST_T::LongInit_t; }
-AST_T UIntInit::type() { return AST_T::UIntInit_t; }
-AST_T ULongInit::type() { return AST_T::ULongInit_t; }
-AST_T CharInit::type() { return AST_T::CharInit_t; }
-AST_T UCharInit::type() { return AST_T::UCharInit_t; }
-AST_T DoubleInit::type() { return AST_T::DoubleInit_t; }
-AST_T ZeroInit::type() { return AST_T::ZeroInit_t; }
-AST_T StringInit::type() { return AST_T::StringInit_t; }
-AST_T PointerInit::type() { return AST_T::PointerInit_t; }
-AST_T InitialValue::type() { return AST_T::InitialValue_t; }
-AST_T Tentative::type() { return AST_T::Tentative_t; }
-AST_T Initial::type() { return AST_T::Initial_t; }
-AST_T NoInitializer::type() { return AST_T::NoInitializer_t; }
-AST_T IdentifierAttr::type() { return AST_T::IdentifierAttr_t; }
-AST_T FunAttr::type() { return AST_T::FunAttr_t; }
-AST_T StaticAttr::type() { return AST_T::StaticAttr_t; }
-AST_T ConstantAttr::type() { return AST_T::ConstantAttr_t; }
-AST_T LocalAttr::type() { return AST_T::LocalAttr_t; }
-AST_T Symbol::type() { return AST_T::Symbol_t; }
-AST_T StructMember::type() { return AST_T::StructMember_t; }
-AST_T StructTypedef::type() { return AST_T::StructTypedef_t; }
+Type::Type(AST_T type_t) : Ast(type_t), scale(-1l), alignment(-1) {}
+Char::Char() : Type(AST_T::Char_t) {}
+SChar::SChar() : Type(AST_T::SChar_t) {}
+UChar::UChar() : Type(AST_T::UChar_t) {}
+Int::Int() : Type(AST_T::Int_t) {}
+Long::Long() : Type(AST_T::Long_t) {}
+UInt::UInt() : Type(AST_T::UInt_t) {}
+ULong::ULong() : Type(AST_T::ULong_t) {}
+Double::Double() : Type(AST_T::Double_t) {}
+Void::Void() : Type(AST_T::Void_t) {}
+FunType::FunType() : Type(AST_T::FunType_t) {}
+Pointer::Pointer() : Type(AST_T::Pointer_t) {}
+Array::Array() : Type(AST_T::Array_t) {}
+Structure::Structure() : Type(AST_T::Structure_t) {}
+StaticInit::StaticInit(AST_T type_t) : Ast(type_t) {}
+IntInit::IntInit() : StaticInit(AST_T::IntInit_t) {}
+LongInit::LongInit() : StaticInit(AST_T::LongInit_t) {}
+UIntInit::UIntInit() : StaticInit(AST_T::UIntInit_t) {}
+ULongInit::ULongInit() : StaticInit(AST_T::ULongInit_t) {}
+CharInit::CharInit() : StaticInit(AST_T::CharInit_t) {}
+UCharInit::UCharInit() : StaticInit(AST_T::UCharInit_t) {}
+DoubleInit::DoubleInit() : StaticInit(AST_T::DoubleInit_t) {}
+ZeroInit::ZeroInit() : StaticInit(AST_T::ZeroInit_t) {}
+BytesInit::BytesInit() : StaticInit(AST_T::BytesInit_t) {}
+StringInit::StringInit() : StaticInit(AST_T::StringInit_t) {}
+PointerInit::PointerInit() : StaticInit(AST_T::PointerInit_t) {}
+InitialValue::InitialValue(AST_T type_t) : Ast(type_t) {}
+Tentative::Tentative() : InitialValue(AST_T::Tentative_t) {}
+Initial::Initial() : InitialValue(AST_T::Initial_t) {}
+NoInitializer::NoInitializer() : InitialValue(AST_T::NoInitializer_t) {}
+IdentifierAttr::IdentifierAttr(AST_T type_t) : Ast(type_t) {}
+FunAttr::FunAttr() : IdentifierAttr(AST_T::FunAttr_t) {}
+StaticAttr::StaticAttr() : IdentifierAttr(AST_T::StaticAttr_t) {}
+ConstantAttr::ConstantAttr() : IdentifierAttr(AST_T::ConstantAttr_t) {}
+LocalAttr::LocalAttr() : IdentifierAttr(AST_T::LocalAttr_t) {}
+Symbol::Symbol() : Ast(AST_T::Symbol_t) {}
+StructMember::StructMember() : Ast(AST_T::StructMember_t) {}
+StructTypedef::StructTypedef() : Ast(AST_T::StructTypedef_t) {}
 
 FunType::FunType(std::vector<std::shared_ptr<Type>> param_types, std::shared_ptr<Type> ret_type) :
-    param_types(std::move(param_types)), ret_type(std::move(ret_type)) {}
+    Type(AST_T::FunType_t), param_types(std::move(param_types)), ret_type(std::move(ret_type)) {}
+
+Pointer::Pointer(std::shared_ptr<Type> ref_type) : Type(AST_T::Pointer_t), ref_type(std::move(ref_type)) {}
 
-Pointer::Pointer(std::shared_ptr<Type> ref_type) : ref_type(std::move(ref_type)) {}
+Array::Array(TLong size, std::shared_ptr<Type> elem_type) :
+    Type(AST_T::Array_t), size(size), elem_type(std::move(elem_type)) {}
 
-Array::Array(TLong size, std::shared_ptr<Type> elem_type) : size(size), elem_type(std::move(elem_type)) {}
+Structure::Structure(TIdentifier tag) : Type(AST_T::Structure_t), tag(std::move(tag)) {}
 
-Structure::Structure(TIdentifier tag) : tag(std::move(tag)) {}
+IntInit::IntInit(TInt value) : StaticInit(AST_T::IntInit_t), value(value) {}
 
-IntInit::IntInit(TInt value) : value(value) {}
+LongInit::LongInit(TLong value) : StaticInit(AST_T::LongInit_t), value(value) {}
 
-LongInit::LongInit(TLong value) : value(value) {}
+UIntInit::UIntInit(TUInt value) : StaticInit(AST_T::UIntInit_t), value(value) {}
 
-UIntInit::UIntInit(TUInt value) : value(value) {}
+ULongInit::ULongInit(TULong value) : StaticInit(AST_T::ULongInit_t), value(value) {}
 
-ULongInit::ULongInit(TULong value) : value(value) {}
+CharInit::CharInit(TChar value) : StaticInit(AST_T::CharInit_t), value(value) {}
 
-CharInit::CharInit(TChar value) : value(value) {}
+UCharInit::UCharInit(TUChar value) : StaticInit(AST_T::UCharInit_t), value(value) {}
 
-UCharInit::UCharInit(TUChar value) : value(value) {}
+DoubleInit::DoubleInit(TDouble value, TULong binary) : StaticInit(AST_T::DoubleInit_t), value(value), binary(binary) {}
 
-DoubleInit::DoubleInit(TDouble value, TULong binary) : value(value), binary(binary) {}
+ZeroInit::ZeroInit(TLong byte) : StaticInit(AST_T::ZeroInit_t), byte(byte) {}
 
-ZeroInit::ZeroInit(TLong byte) : byte(byte) {}
+BytesInit::BytesInit(std::vector<TUChar> bytes) : StaticInit(AST_T::BytesInit_t), bytes(std::move(bytes)) {}
 
 StringInit::StringInit(bool is_null_terminated, TIdentifier string_constant, std::shared_ptr<CStringLiteral> literal) :
-    is_null_terminated(is_null_terminated), string_constant(std::move(string_constant)), literal(std::move(literal)) {}
+    StaticInit(AST_T::StringInit_t), is_null_terminated(is_null_terminated),
+    string_constant(std::move(string_constant)), literal(std::move(literal)) {}
 
-PointerInit::PointerInit(TIdentifier name) : name(std::move(name)) {}
+PointerInit::PointerInit(TIdentifier name) : StaticInit(AST_T::PointerInit_t), name(std::move(name)) {}
 
-Initial::Initial(std::vector<std::shared_ptr<StaticInit>> static_inits) : static_inits(std::move(static_inits)) {}
+Initial::Initial(std::vector<std::shared_ptr<StaticInit>> static_inits) :
+    InitialValue(AST_T::Initial_t), static_inits(std::move(static_inits)) {}
 
-FunAttr::FunAttr(bool is_defined, bool is_global) : is_defined(is_defined), is_global(is_global) {}
+FunAttr::FunAttr(bool is_defined, bool is_global) :
+    IdentifierAttr(AST_T::FunAttr_t), is_defined(is_defined), is_global(is_global) {}
 
 StaticAttr::StaticAttr(bool is_global, std::shared_ptr<InitialValue> init) :
-    is_global(is_global), init(std::move(init)) {}
+    IdentifierAttr(AST_T::StaticAttr_t), is_global(is_global), init(std::move(init)) {}
 
-ConstantAttr::ConstantAttr(std::shared_ptr<StaticInit> static_init) : static_init(std::move(static_init)) {}
+ConstantAttr::ConstantAttr(std::shared_ptr<StaticInit> static_init) :
+    IdentifierAttr(AST_T::ConstantAttr_t), static_init(std::move(static_init)) {}
 
 Symbol::Symbol(std::shared_ptr<Type> type_t, std::unique_ptr<IdentifierAttr> attrs) :
-    type_t(std::move(type_t)), attrs(std::move(attrs)) {}
+    Ast(AST_T::Symbol_t), type_t(std::move(type_t)), attrs(std::move(attrs)) {}
 
-StructMember::StructMember(TLong offset, std::shared_ptr<Type> member_type) :
-    offset(offset), member_type(std::move(member_type)) {}
+StructMember::StructMember(TIdentifier member_name, TLong offset, std::shared_ptr<Type> member_type) :
+    Ast(AST_T::StructMember_t), member_name(std::move(member_name)), offset(offset),
+    member_type(std::move(member_type)) {}
 
-StructTypedef::StructTypedef(TInt alignment, TLong size, std::vector<TIdentifier> member_names,
-    std::unordered_map<TIdentifier, std::unique_ptr<StructMember>> members) :
-    alignment(alignment),
-    size(size), member_names(std::move(member_names)), members(std::move(members)) {}
+StructTypedef::StructTypedef(TInt alignment, TLong size, std::vector<StructMember> members) :
+    Ast(AST_T::StructTypedef_t), alignment(alignment), size(size), members(std::move(members)) {
+    member_index.reserve(this->members.size());
+    for (size_t i = 0; i < this->members.size(); ++i) {
+        member_index.push_back(i);
+    }
+    std::sort(member_index.begin(), member_index.end(),
+        [this](size_t i, size_t j) { return this->members[i].member_name < this->members[j].member_name; });
+}
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 std::unique_ptr<FrontEndContext> frontend;
 
-FrontEndContext::FrontEndContext() : label_counter(0), variable_counter(0), structure_counter(0) {}
+FrontEndContext::FrontEndContext() :
+    label_counter(0), variable_counter(0), structure_counter(0),
+    scalar_types({std::make_shared<Char>(), std::make_shared<SChar>(), std::make_shared<UChar>(),
+        std::make_shared<Int>(), std::make_shared<Long>(), std::make_shared<UInt>(), std::make_shared<ULong>(),
+        std::make_shared<Double>(), std::make_shared<Void>()}) {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Type interner
+
+// Types are hash-consed into one canonical immutable instance per distinct type, so that the same types share the same
+// node. Function types are owned by their declarations and only have their parameter and return types interned
+
+std::shared_ptr<Type> get_scalar_type(AST_T type_t) { return frontend->scalar_types[type_t - AST_T::Char_t]; }
+
+std::shared_ptr<Type> get_pointer_type(std::shared_ptr<Type> ref_type) {
+    intern_type(ref_type);
+    std::shared_ptr<Type>& ptr_type = frontend->pointer_types[ref_type.get()];
+    if (!ptr_type) {
+        ptr_type = std::make_shared<Pointer>(std::move(ref_type));
+    }
+    return ptr_type;
+}
+
+std::shared_ptr<Type> get_array_type(TLong size, std::shared_ptr<Type> elem_type) {
+    intern_type(elem_type);
+    std::shared_ptr<Type>& arr_type = frontend->array_types[elem_type.get()][size];
+    if (!arr_type) {
+        arr_type = std::make_shared<Array>(size, std::move(elem_type));
+    }
+    return arr_type;
+}
+
+static std::shared_ptr<Type> get_structure_type(TIdentifier tag) {
+    std::shared_ptr<Type>& struct_type = frontend->structure_types[tag];
+    if (!struct_type) {
+        struct_type = std::make_shared<Structure>(tag);
+    }
+    return struct_type;
+}
+
+static void intern_fun_type(FunType* fun_type) {
+    for (auto& param_type : fun_type->param_types) {
+        intern_type(param_type);
+    }
+    intern_type(fun_type->ret_type);
+}
+
+void intern_type(std::shared_ptr<Type>& type) {
+    switch (type->type()) {
+        case AST_T::Char_t:
+        case AST_T::SChar_t:
+        case AST_T::UChar_t:
+        case AST_T::Int_t:
+        case AST_T::Long_t:
+        case AST_T::UInt_t:
+        case AST_T::ULong_t:
+        case AST_T::Double_t:
+        case AST_T::Void_t:
+            type = get_scalar_type(type->type());
+            break;
+        case AST_T::FunType_t:
+            intern_fun_type(ast_cast<FunType>(type.get()));
+            break;
+        case AST_T::Pointer_t: {
+            Pointer* ptr_type = ast_cast<Pointer>(type.get());
+            auto ptr_type_it = frontend->pointer_types.find(ptr_type->ref_type.get());
+            if (ptr_type_it == frontend->pointer_types.end() || ptr_type_it->second != type) {
+                type = get_pointer_type(ptr_type->ref_type);
+            }
+            break;
+        }
+        case AST_T::Array_t: {
+            Array* arr_type = ast_cast<Array>(type.get());
+            auto arr_types_it = frontend->array_types.find(arr_type->elem_type.get());
+            if (arr_types_it == frontend->array_types.end()
+                || arr_types_it->second.find(arr_type->size) == arr_types_it->second.end()
+                || arr_types_it->second[arr_type->size] != type) {
+                type = get_array_type(arr_type->size, arr_type->elem_type);
+            }
+            break;
+        }
+        case AST_T::Structure_t:
+            type = get_structure_type(ast_cast<Structure>(type.get())->tag);
+            break;
+        default:
+            break;
+    }
+}
+
+StructMember* get_struct_typedef_member(StructTypedef* struct_typedef, TIdentifier member_name) {
+    auto member_index_it =
+        std::lower_bound(struct_typedef->member_index.begin(), struct_typedef->member_index.end(), member_name,
+            [struct_typedef](size_t i, TIdentifier name) { return struct_typedef->members[i].member_name < name; });
+    if (member_index_it == struct_typedef->member_index.end()
+        || struct_typedef->members[*member_index_it].member_name != member_name) {
+        return nullptr;
+    }
+    return &struct_typedef->members[*member_index_it];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Type layout
+
+// Aggregate types are measured once on first use and keep their size and alignment on the node, which interned types
+// share across every use. Structures are only measured after their definition is in the struct typedef table
+
+TInt get_scalar_type_size(Type* type) {
+    switch (type->type()) {
+        case AST_T::Char_t:
+        case AST_T::SChar_t:
+        case AST_T::UChar_t:
+            return 1;
+        case AST_T::Int_t:
+        case AST_T::UInt_t:
+            return 4;
+        case AST_T::Long_t:
+        case AST_T::Double_t:
+        case AST_T::ULong_t:
+        case AST_T::Pointer_t:
+            return 8;
+        default:
+            RAISE_INTERNAL_ERROR;
+    }
+}
+
+static void set_array_aggregate_type_layout(Array* arr_type) {
+    arr_type->scale = get_type_scale(arr_type->elem_type.get()) * arr_type->size;
+    arr_type->alignment = get_type_alignment(arr_type->elem_type.get());
+}
+
+static void set_structure_aggregate_type_layout(Structure* struct_type) {
+    auto struct_typedef_it = frontend->struct_typedef_table.find(struct_type->tag);
+    if (struct_typedef_it == frontend->struct_typedef_table.end()) {
+        RAISE_INTERNAL_ERROR;
+    }
+    struct_type->scale = struct_typedef_it->second->size;
+    struct_type->alignment = struct_typedef_it->second->alignment;
+}
+
+static void set_aggregate_type_layout(Type* type) {
+    if (type->scale == -1l) {
+        if (type->type() == AST_T::Array_t) {
+            set_array_aggregate_type_layout(ast_cast<Array>(type));
+        }
+        else {
+            set_structure_aggregate_type_layout(ast_cast<Structure>(type));
+        }
+    }
+}
+
+TLong get_type_scale(Type* type) {
+    switch (type->type()) {
+        case AST_T::Array_t:
+        case AST_T::Structure_t:
+            set_aggregate_type_layout(type);
+            return type->scale;
+        default:
+            return get_scalar_type_size(type);
+    }
+}
+
+TInt get_type_alignment(Type* type) {
+    switch (type->type()) {
+        case AST_T::Array_t:
+        case AST_T::Structure_t:
+            set_aggregate_type_layout(type);
+            return type->alignment;
+        default:
+            return get_scalar_type_size(type);
+    }
+}
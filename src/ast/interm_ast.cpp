@@ -9,159 +9,170 @@
 
 // Intermediate abstract syntax tree
 
-AST_T TacUnaryOp::type() { return AST_T::TacUnaryOp_t; }
-AST_T TacComplement::type() { return AST_T::TacComplement_t; }
-AST_T TacNegate::type() { return AST_T::TacNegate_t; }
-AST_T TacNot::type() { return AST_T::TacNot_t; }
-AST_T TacBinaryOp::type() { return AST_T::TacBinaryOp_t; }
-AST_T TacAdd::type() { return AST_T::TacAdd_t; }
-AST_T TacSubtract::type() { return AST_T::TacSubtract_t; }
-AST_T TacMultiply::type() { return AST_T::TacMultiply_t; }
-AST_T TacDivide::type() { return AST_T::TacDivide_t; }
-AST_T TacRemainder::type() { return AST_T::TacRemainder_t; }
-AST_T TacBitAnd::type() { return AST_T::TacBitAnd_t; }
-AST_T TacBitOr::type() { return AST_T::TacBitOr_t; }
-AST_T TacBitXor::type() { return AST_T::TacBitXor_t; }
-AST_T TacBitShiftLeft::type() { return AST_T::TacBitShiftLeft_t; }
-AST_T TacBitShiftRight::type() { return AST_T::TacBitShiftRight_t; }
-AST_T TacBitShrArithmetic::type() { return AST_T::TacBitShrArithmetic_t; }
-AST_T TacEqual::type() { return AST_T::TacEqual_t; }
-AST_T TacNotEqual::type() { return AST_T::TacNotEqual_t; }
-AST_T TacLessThan::type() { return AST_T::TacLessThan_t; }
-AST_T TacLessOrEqual::type() { return AST_T::TacLessOrEqual_t; }
-AST_T TacGreaterThan::type() { return AST_T::TacGreaterThan_t; }
-AST_T TacGreaterOrEqual::type() { return AST_T::TacGreaterOrEqual_t; }
-AST_T TacValue::type() { return AST_T::TacValue_t; }
-AST_T TacConstant::type() { return AST_T::TacConstant_t; }
-AST_T TacVariable::type() { return AST_T::TacVariable_t; }
-AST_T TacExpResult::type() { return AST_T::TacExpResult_t; }
-AST_T TacPlainOperand::type() { return AST_T::TacPlainOperand_t; }
-AST_T TacDereferencedPointer::type() { return AST_T::TacDereferencedPointer_t; }
-AST_T TacSubObject::type() { return AST_T::TacSubObject_t; }
-AST_T TacInstruction::type() { return AST_T::TacInstruction_t; }
-AST_T TacReturn::type() { return AST_T::TacReturn_t; }
-AST_T TacSignExtend::type() { return AST_T::TacSignExtend_t; }
-AST_T TacTruncate::type() { return AST_T::TacTruncate_t; }
-AST_T TacZeroExtend::type() { return AST_T::TacZeroExtend_t; }
-AST_T TacDoubleToInt::type() { return AST_T::TacDoubleToInt_t; }
-AST_T TacDoubleToUInt::type() { return AST_T::TacDoubleToUInt_t; }
-AST_T TacIntToDouble::type() { return AST_T::TacIntToDouble_t; }
-AST_T TacUIntToDouble::type() { return AST_T::TacUIntToDouble_t; }
-AST_T TacFunCall::type() { return AST_T::TacFunCall_t; }
-AST_T TacUnary::type() { return AST_T::TacUnary_t; }
-AST_T TacBinary::type() { return AST_T::TacBinary_t; }
-AST_T TacCopy::type() { return AST_T::TacCopy_t; }
-AST_T TacGetAddress::type() { return AST_T::TacGetAddress_t; }
-AST_T TacLoad::type() { return AST_T::TacLoad_t; }
-AST_T TacStore::type() { return AST_T::TacStore_t; }
-AST_T TacAddPtr::type() { return AST_T::TacAddPtr_t; }
-AST_T TacCopyToOffset::type() { return AST_T::TacCopyToOffset_t; }
-AST_T TacCopyFromOffset::type() { return AST_T::TacCopyFromOffset_t; }
-AST_T TacJump::type() { return AST_T::TacJump_t; }
-AST_T TacJumpIfZero::type() { return AST_T::TacJumpIfZero_t; }
-AST_T TacJumpIfNotZero::type() { return AST_T::TacJumpIfNotZero_t; }
-AST_T TacLabel::type() { return AST_T::TacLabel_t; }
-AST_T TacTopLevel::type() { return AST_T::TacTopLevel_t; }
-AST_T TacFunction::type() { return AST_T::TacFunction_t; }
-AST_T TacStaticVariable::type() { return AST_T::TacStaticVariable_t; }
-AST_T TacStaticConstant::type() { return AST_T::TacStaticConstant_t; }
-AST_T TacProgram::type() { return AST_T::TacProgram_t; }
-
-TacConstant::TacConstant(std::shared_ptr<CConst> constant) : constant(std::move(constant)) {}
-
-TacVariable::TacVariable(TIdentifier name) : name(std::move(name)) {}
-
-TacPlainOperand::TacPlainOperand(std::shared_ptr<TacValue> val) : val(std::move(val)) {}
-
-TacDereferencedPointer::TacDereferencedPointer(std::shared_ptr<TacValue> val) : val(std::move(val)) {}
-
-TacSubObject::TacSubObject(TIdentifier base_name, TLong offset) : base_name(std::move(base_name)), offset(offset) {}
-
-TacReturn::TacReturn(std::shared_ptr<TacValue> val) : val(std::move(val)) {}
+TacUnaryOp::TacUnaryOp(AST_T type_t) : Ast(type_t) {}
+TacComplement::TacComplement() : TacUnaryOp(AST_T::TacComplement_t) {}
+TacNegate::TacNegate() : TacUnaryOp(AST_T::TacNegate_t) {}
+TacNot::TacNot() : TacUnaryOp(AST_T::TacNot_t) {}
+TacBinaryOp::TacBinaryOp(AST_T type_t) : Ast(type_t) {}
+TacAdd::TacAdd() : TacBinaryOp(AST_T::TacAdd_t) {}
+TacSubtract::TacSubtract() : TacBinaryOp(AST_T::TacSubtract_t) {}
+TacMultiply::TacMultiply() : TacBinaryOp(AST_T::TacMultiply_t) {}
+TacDivide::TacDivide() : TacBinaryOp(AST_T::TacDivide_t) {}
+TacRemainder::TacRemainder() : TacBinaryOp(AST_T::TacRemainder_t) {}
+TacBitAnd::TacBitAnd() : TacBinaryOp(AST_T::TacBitAnd_t) {}
+TacBitOr::TacBitOr() : TacBinaryOp(AST_T::TacBitOr_t) {}
+TacBitXor::TacBitXor() : TacBinaryOp(AST_T::TacBitXor_t) {}
+TacBitShiftLeft::TacBitShiftLeft() : TacBinaryOp(AST_T::TacBitShiftLeft_t) {}
+TacBitShiftRight::TacBitShiftRight() : TacBinaryOp(AST_T::TacBitShiftRight_t) {}
+TacBitShrArithmetic::TacBitShrArithmetic() : TacBinaryOp(AST_T::TacBitShrArithmetic_t) {}
+TacEqual::TacEqual() : TacBinaryOp(AST_T::TacEqual_t) {}
+TacNotEqual::TacNotEqual() : TacBinaryOp(AST_T::TacNotEqual_t) {}
+TacLessThan::TacLessThan() : TacBinaryOp(AST_T::TacLessThan_t) {}
+TacLessOrEqual::TacLessOrEqual() : TacBinaryOp(AST_T::TacLessOrEqual_t) {}
+TacGreaterThan::TacGreaterThan() : TacBinaryOp(AST_T::TacGreaterThan_t) {}
+TacGreaterOrEqual::TacGreaterOrEqual() : TacBinaryOp(AST_T::TacGreaterOrEqual_t) {}
+TacValue::TacValue(AST_T type_t) : Ast(type_t) {}
+TacConstant::TacConstant() : TacValue(AST_T::TacConstant_t) {}
+TacVariable::TacVariable() : TacValue(AST_T::TacVariable_t) {}
+TacExpResult::TacExpResult(AST_T type_t) : Ast(type_t) {}
+TacPlainOperand::TacPlainOperand() : TacExpResult(AST_T::TacPlainOperand_t) {}
+TacDereferencedPointer::TacDereferencedPointer() : TacExpResult(AST_T::TacDereferencedPointer_t) {}
+TacSubObject::TacSubObject() : TacExpResult(AST_T::TacSubObject_t) {}
+TacInstruction::TacInstruction(AST_T type_t) : Ast(type_t) {}
+TacReturn::TacReturn() : TacInstruction(AST_T::TacReturn_t) {}
+TacSignExtend::TacSignExtend() : TacInstruction(AST_T::TacSignExtend_t) {}
+TacTruncate::TacTruncate() : TacInstruction(AST_T::TacTruncate_t) {}
+TacZeroExtend::TacZeroExtend() : TacInstruction(AST_T::TacZeroExtend_t) {}
+TacDoubleToInt::TacDoubleToInt() : TacInstruction(AST_T::TacDoubleToInt_t) {}
+TacDoubleToUInt::TacDoubleToUInt() : TacInstruction(AST_T::TacDoubleToUInt_t) {}
+TacIntToDouble::TacIntToDouble() : TacInstruction(AST_T::TacIntToDouble_t) {}
+TacUIntToDouble::TacUIntToDouble() : TacInstruction(AST_T::TacUIntToDouble_t) {}
+TacFunCall::TacFunCall() : TacInstruction(AST_T::TacFunCall_t) {}
+TacUnary::TacUnary() : TacInstruction(AST_T::TacUnary_t) {}
+TacBinary::TacBinary() : TacInstruction(AST_T::TacBinary_t) {}
+TacCopy::TacCopy() : TacInstruction(AST_T::TacCopy_t) {}
+TacGetAddress::TacGetAddress() : TacInstruction(AST_T::TacGetAddress_t) {}
+TacLoad::TacLoad() : TacInstruction(AST_T::TacLoad_t) {}
+TacStore::TacStore() : TacInstruction(AST_T::TacStore_t) {}
+TacAddPtr::TacAddPtr() : TacInstruction(AST_T::TacAddPtr_t) {}
+TacCopyToOffset::TacCopyToOffset() : TacInstruction(AST_T::TacCopyToOffset_t) {}
+TacCopyFromOffset::TacCopyFromOffset() : TacInstruction(AST_T::TacCopyFromOffset_t) {}
+TacZeroFill::TacZeroFill() : TacInstruction(AST_T::TacZeroFill_t) {}
+TacJump::TacJump() : TacInstruction(AST_T::TacJump_t) {}
+TacJumpIfZero::TacJumpIfZero() : TacInstruction(AST_T::TacJumpIfZero_t) {}
+TacJumpIfNotZero::TacJumpIfNotZero() : TacInstruction(AST_T::TacJumpIfNotZero_t) {}
+TacLabel::TacLabel() : TacInstruction(AST_T::TacLabel_t) {}
+TacTopLevel::TacTopLevel(AST_T type_t) : Ast(type_t) {}
+TacFunction::TacFunction() : TacTopLevel(AST_T::TacFunction_t) {}
+TacStaticVariable::TacStaticVariable() : TacTopLevel(AST_T::TacStaticVariable_t) {}
+TacStaticConstant::TacStaticConstant() : TacTopLevel(AST_T::TacStaticConstant_t) {}
+TacProgram::TacProgram() : Ast(AST_T::TacProgram_t) {}
+
+TacConstant::TacConstant(std::shared_ptr<CConst> constant) :
+    TacValue(AST_T::TacConstant_t), constant(std::move(constant)) {}
+
+TacVariable::TacVariable(TIdentifier name) : TacValue(AST_T::TacVariable_t), name(std::move(name)) {}
+
+TacPlainOperand::TacPlainOperand(std::shared_ptr<TacValue> val) :
+    TacExpResult(AST_T::TacPlainOperand_t), val(std::move(val)) {}
+
+TacDereferencedPointer::TacDereferencedPointer(std::shared_ptr<TacValue> val) :
+    TacExpResult(AST_T::TacDereferencedPointer_t), val(std::move(val)) {}
+
+TacSubObject::TacSubObject(TIdentifier base_name, TLong offset) :
+    TacExpResult(AST_T::TacSubObject_t), base_name(std::move(base_name)), offset(offset) {}
+
+TacReturn::TacReturn(std::shared_ptr<TacValue> val) : TacInstruction(AST_T::TacReturn_t), val(std::move(val)) {}
 
 TacSignExtend::TacSignExtend(std::shared_ptr<TacValue> src, std::shared_ptr<TacValue> dst) :
-    src(std::move(src)), dst(std::move(dst)) {}
+    TacInstruction(AST_T::TacSignExtend_t), src(std::move(src)), dst(std::move(dst)) {}
 
 TacTruncate::TacTruncate(std::shared_ptr<TacValue> src, std::shared_ptr<TacValue> dst) :
-    src(std::move(src)), dst(std::move(dst)) {}
+    TacInstruction(AST_T::TacTruncate_t), src(std::move(src)), dst(std::move(dst)) {}
 
 TacZeroExtend::TacZeroExtend(std::shared_ptr<TacValue> src, std::shared_ptr<TacValue> dst) :
-    src(std::move(src)), dst(std::move(dst)) {}
+    TacInstruction(AST_T::TacZeroExtend_t), src(std::move(src)), dst(std::move(dst)) {}
 
 TacDoubleToInt::TacDoubleToInt(std::shared_ptr<TacValue> src, std::shared_ptr<TacValue> dst) :
-    src(std::move(src)), dst(std::move(dst)) {}
+    TacInstruction(AST_T::TacDoubleToInt_t), src(std::move(src)), dst(std::move(dst)) {}
 
 TacDoubleToUInt::TacDoubleToUInt(std::shared_ptr<TacValue> src, std::shared_ptr<TacValue> dst) :
-    src(std::move(src)), dst(std::move(dst)) {}
+    TacInstruction(AST_T::TacDoubleToUInt_t), src(std::move(src)), dst(std::move(dst)) {}
 
 TacIntToDouble::TacIntToDouble(std::shared_ptr<TacValue> src, std::shared_ptr<TacValue> dst) :
-    src(std::move(src)), dst(std::move(dst)) {}
+    TacInstruction(AST_T::TacIntToDouble_t), src(std::move(src)), dst(std::move(dst)) {}
 
 TacUIntToDouble::TacUIntToDouble(std::shared_ptr<TacValue> src, std::shared_ptr<TacValue> dst) :
-    src(std::move(src)), dst(std::move(dst)) {}
+    TacInstruction(AST_T::TacUIntToDouble_t), src(std::move(src)), dst(std::move(dst)) {}
 
 TacFunCall::TacFunCall(TIdentifier name, std::vector<std::shared_ptr<TacValue>> args, std::shared_ptr<TacValue> dst) :
-    name(std::move(name)), args(std::move(args)), dst(std::move(dst)) {}
+    TacInstruction(AST_T::TacFunCall_t), name(std::move(name)), args(std::move(args)), dst(std::move(dst)) {}
 
 TacUnary::TacUnary(std::unique_ptr<TacUnaryOp> unary_op, std::shared_ptr<TacValue> src, std::shared_ptr<TacValue> dst) :
-    unary_op(std::move(unary_op)), src(std::move(src)), dst(std::move(dst)) {}
+    TacInstruction(AST_T::TacUnary_t), unary_op(std::move(unary_op)), src(std::move(src)), dst(std::move(dst)) {}
 
 TacBinary::TacBinary(std::unique_ptr<TacBinaryOp> binary_op, std::shared_ptr<TacValue> src1,
     std::shared_ptr<TacValue> src2, std::shared_ptr<TacValue> dst) :
-    binary_op(std::move(binary_op)),
-    src1(std::move(src1)), src2(std::move(src2)), dst(std::move(dst)) {}
+    TacInstruction(AST_T::TacBinary_t),
+    binary_op(std::move(binary_op)), src1(std::move(src1)), src2(std::move(src2)), dst(std::move(dst)) {}
 
 TacCopy::TacCopy(std::shared_ptr<TacValue> src, std::shared_ptr<TacValue> dst) :
-    src(std::move(src)), dst(std::move(dst)) {}
+    TacInstruction(AST_T::TacCopy_t), src(std::move(src)), dst(std::move(dst)) {}
 
 TacGetAddress::TacGetAddress(std::shared_ptr<TacValue> src, std::shared_ptr<TacValue> dst) :
-    src(std::move(src)), dst(std::move(dst)) {}
+    TacInstruction(AST_T::TacGetAddress_t), src(std::move(src)), dst(std::move(dst)) {}
 
 TacLoad::TacLoad(std::shared_ptr<TacValue> src_ptr, std::shared_ptr<TacValue> dst) :
-    src_ptr(std::move(src_ptr)), dst(std::move(dst)) {}
+    TacInstruction(AST_T::TacLoad_t), src_ptr(std::move(src_ptr)), dst(std::move(dst)) {}
 
 TacStore::TacStore(std::shared_ptr<TacValue> src, std::shared_ptr<TacValue> dst_ptr) :
-    src(std::move(src)), dst_ptr(std::move(dst_ptr)) {}
+    TacInstruction(AST_T::TacStore_t), src(std::move(src)), dst_ptr(std::move(dst_ptr)) {}
 
 TacAddPtr::TacAddPtr(
     TLong scale, std::shared_ptr<TacValue> src_ptr, std::shared_ptr<TacValue> index, std::shared_ptr<TacValue> dst) :
-    scale(scale),
-    src_ptr(std::move(src_ptr)), index(std::move(index)), dst(std::move(dst)) {}
+    TacInstruction(AST_T::TacAddPtr_t),
+    scale(scale), src_ptr(std::move(src_ptr)), index(std::move(index)), dst(std::move(dst)) {}
 
 TacCopyToOffset::TacCopyToOffset(TIdentifier dst_name, TLong offset, std::shared_ptr<TacValue> src) :
-    dst_name(std::move(dst_name)), offset(offset), src(std::move(src)) {}
+    TacInstruction(AST_T::TacCopyToOffset_t), dst_name(std::move(dst_name)), offset(offset), src(std::move(src)) {}
 
 TacCopyFromOffset::TacCopyFromOffset(TIdentifier src_name, TLong offset, std::shared_ptr<TacValue> dst) :
-    src_name(std::move(src_name)), offset(offset), dst(std::move(dst)) {}
+    TacInstruction(AST_T::TacCopyFromOffset_t), src_name(std::move(src_name)), offset(offset), dst(std::move(dst)) {}
 
-TacJump::TacJump(TIdentifier target) : target(std::move(target)) {}
+TacZeroFill::TacZeroFill(TIdentifier dst_name, TLong offset, TLong byte) :
+    TacInstruction(AST_T::TacZeroFill_t), dst_name(std::move(dst_name)), offset(offset), byte(byte) {}
+
+TacJump::TacJump(TIdentifier target) : TacInstruction(AST_T::TacJump_t), target(std::move(target)) {}
 
 TacJumpIfZero::TacJumpIfZero(TIdentifier target, std::shared_ptr<TacValue> condition) :
-    target(std::move(target)), condition(std::move(condition)) {}
+    TacInstruction(AST_T::TacJumpIfZero_t), target(std::move(target)), condition(std::move(condition)) {}
 
 TacJumpIfNotZero::TacJumpIfNotZero(TIdentifier target, std::shared_ptr<TacValue> condition) :
-    target(std::move(target)), condition(std::move(condition)) {}
+    TacInstruction(AST_T::TacJumpIfNotZero_t), target(std::move(target)), condition(std::move(condition)) {}
 
-TacLabel::TacLabel(TIdentifier name) : name(std::move(name)) {}
+TacLabel::TacLabel(TIdentifier name) : TacInstruction(AST_T::TacLabel_t), name(std::move(name)) {}
 
 TacFunction::TacFunction(TIdentifier name, bool is_global, std::vector<TIdentifier> params,
-    std::vector<std::unique_ptr<TacInstruction>> body) :
-    name(std::move(name)),
-    is_global(is_global), params(std::move(params)), body(std::move(body)) {}
+    std::vector<std::unique_ptr<TacInstruction>> body, std::vector<std::shared_ptr<Type>> temp_types) :
+    TacTopLevel(AST_T::TacFunction_t),
+    name(std::move(name)), is_global(is_global), params(std::move(params)), body(std::move(body)),
+    temp_types(std::move(temp_types)) {}
 
 TacStaticVariable::TacStaticVariable(TIdentifier name, bool is_global, std::shared_ptr<Type> static_init_type,
     std::vector<std::shared_ptr<StaticInit>> static_inits) :
-    name(std::move(name)),
-    is_global(is_global), static_init_type(std::move(static_init_type)), static_inits(std::move(static_inits)) {}
+    TacTopLevel(AST_T::TacStaticVariable_t),
+    name(std::move(name)), is_global(is_global), static_init_type(std::move(static_init_type)),
+    static_inits(std::move(static_inits)) {}
 
 TacStaticConstant::TacStaticConstant(
     TIdentifier name, std::shared_ptr<Type> static_init_type, std::shared_ptr<StaticInit> static_init) :
-    name(std::move(name)),
-    static_init_type(std::move(static_init_type)), static_init(std::move(static_init)) {}
+    TacTopLevel(AST_T::TacStaticConstant_t),
+    name(std::move(name)), static_init_type(std::move(static_init_type)), static_init(std::move(static_init)) {}
 
 TacProgram::TacProgram(std::vector<std::unique_ptr<TacTopLevel>> static_constant_top_levels,
     std::vector<std::unique_ptr<TacTopLevel>> static_variable_top_levels,
     std::vector<std::unique_ptr<TacTopLevel>> function_top_levels) :
+    Ast(AST_T::TacProgram_t),
     static_constant_top_levels(std::move(static_constant_top_levels)),
     static_variable_top_levels(std::move(static_variable_top_levels)),
     function_top_levels(std::move(function_top_levels)) {}
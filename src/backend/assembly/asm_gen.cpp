@@ -30,56 +30,62 @@ AsmGenContext::AsmGenContext() :
 
 // Assembly generation
 
+static Type* get_variable_type(TIdentifier name) {
+    if (IS_TEMP_IDENTIFIER(name)) {
+        return (*context->p_temp_types)[GET_TEMP_IDENTIFIER_INDEX(name)].get();
+    }
+    return frontend->symbol_table[name]->type_t.get();
+}
+
 static std::shared_ptr<AsmImm> generate_char_imm_operand(CConstChar* node) {
-    TIdentifier value = std::to_string(node->value);
+    TIdentifier value = make_identifier(std::to_string(node->value));
     return std::make_shared<AsmImm>(true, false, std::move(value));
 }
 
 static std::shared_ptr<AsmImm> generate_int_imm_operand(CConstInt* node) {
     bool is_byte = node->value <= 255;
-    TIdentifier value = std::to_string(node->value);
+    TIdentifier value = make_identifier(std::to_string(node->value));
     return std::make_shared<AsmImm>(std::move(is_byte), false, std::move(value));
 }
 
 static std::shared_ptr<AsmImm> generate_long_imm_operand(CConstLong* node) {
     bool is_byte = node->value <= 255l;
-    bool is_quad = node->value > 2147483647l;
-    TIdentifier value = std::to_string(node->value);
+    bool is_quad = node->value > 2147483647l || node->value < -2147483648l;
+    TIdentifier value = make_identifier(std::to_string(node->value));
     return std::make_shared<AsmImm>(std::move(is_byte), std::move(is_quad), std::move(value));
 }
 
 static std::shared_ptr<AsmImm> generate_uchar_imm_operand(CConstUChar* node) {
-    TIdentifier value = std::to_string(node->value);
+    TIdentifier value = make_identifier(std::to_string(node->value));
     return std::make_shared<AsmImm>(true, false, std::move(value));
 }
 
 static std::shared_ptr<AsmImm> generate_uint_imm_operand(CConstUInt* node) {
     bool is_byte = node->value <= 255u;
     bool is_quad = node->value > 2147483647u;
-    TIdentifier value = std::to_string(node->value);
+    TIdentifier value = make_identifier(std::to_string(node->value));
     return std::make_shared<AsmImm>(std::move(is_byte), std::move(is_quad), std::move(value));
 }
 
 static std::shared_ptr<AsmImm> generate_ulong_imm_operand(CConstULong* node) {
     bool is_byte = node->value <= 255ul;
     bool is_quad = node->value > 2147483647ul;
-    TIdentifier value = std::to_string(node->value);
+    TIdentifier value = make_identifier(std::to_string(node->value));
     return std::make_shared<AsmImm>(std::move(is_byte), std::move(is_quad), std::move(value));
 }
 
 static void generate_double_static_constant_top_level(
-    const TIdentifier& identifier, TDouble value, TULong binary, TInt byte);
+    TIdentifier identifier, TDouble value, TULong binary, TInt byte);
 
 static std::shared_ptr<AsmData> generate_double_static_constant_operand(TDouble value, TULong binary, TInt byte) {
     TIdentifier static_constant_label;
     {
-        TIdentifier static_constant_hash = std::to_string(binary);
-        if (frontend->static_constant_table.find(static_constant_hash) != frontend->static_constant_table.end()) {
-            static_constant_label = frontend->static_constant_table[static_constant_hash];
+        if (frontend->double_constant_table.find(binary) != frontend->double_constant_table.end()) {
+            static_constant_label = frontend->double_constant_table[binary];
         }
         else {
             static_constant_label = represent_label_identifier(LABEL_KIND::Ldouble);
-            frontend->static_constant_table[static_constant_hash] = static_constant_label;
+            frontend->double_constant_table[binary] = static_constant_label;
             generate_double_static_constant_top_level(static_constant_label, value, binary, byte);
         }
     }
@@ -93,19 +99,19 @@ static std::shared_ptr<AsmData> generate_double_constant_operand(CConstDouble* n
 static std::shared_ptr<AsmOperand> generate_constant_operand(TacConstant* node) {
     switch (node->constant->type()) {
         case AST_T::CConstChar_t:
-            return generate_char_imm_operand(static_cast<CConstChar*>(node->constant.get()));
+            return generate_char_imm_operand(ast_cast<CConstChar>(node->constant.get()));
         case AST_T::CConstInt_t:
-            return generate_int_imm_operand(static_cast<CConstInt*>(node->constant.get()));
+            return generate_int_imm_operand(ast_cast<CConstInt>(node->constant.get()));
         case AST_T::CConstLong_t:
-            return generate_long_imm_operand(static_cast<CConstLong*>(node->constant.get()));
+            return generate_long_imm_operand(ast_cast<CConstLong>(node->constant.get()));
         case AST_T::CConstDouble_t:
-            return generate_double_constant_operand(static_cast<CConstDouble*>(node->constant.get()));
+            return generate_double_constant_operand(ast_cast<CConstDouble>(node->constant.get()));
         case AST_T::CConstUChar_t:
-            return generate_uchar_imm_operand(static_cast<CConstUChar*>(node->constant.get()));
+            return generate_uchar_imm_operand(ast_cast<CConstUChar>(node->constant.get()));
         case AST_T::CConstUInt_t:
-            return generate_uint_imm_operand(static_cast<CConstUInt*>(node->constant.get()));
+            return generate_uint_imm_operand(ast_cast<CConstUInt>(node->constant.get()));
         case AST_T::CConstULong_t:
-            return generate_ulong_imm_operand(static_cast<CConstULong*>(node->constant.get()));
+            return generate_ulong_imm_operand(ast_cast<CConstULong>(node->constant.get()));
         default:
             RAISE_INTERNAL_ERROR;
     }
@@ -122,7 +128,7 @@ static std::shared_ptr<AsmPseudoMem> generate_pseudo_mem_operand(TacVariable* no
 }
 
 static std::shared_ptr<AsmOperand> generate_variable_operand(TacVariable* node) {
-    switch (frontend->symbol_table[node->name]->type_t->type()) {
+    switch (get_variable_type(node->name)->type()) {
         case AST_T::Array_t:
         case AST_T::Structure_t:
             return generate_pseudo_mem_operand(node);
@@ -136,9 +142,9 @@ static std::shared_ptr<AsmOperand> generate_variable_operand(TacVariable* node)
 static std::shared_ptr<AsmOperand> generate_operand(TacValue* node) {
     switch (node->type()) {
         case AST_T::TacConstant_t:
-            return generate_constant_operand(static_cast<TacConstant*>(node));
+            return generate_constant_operand(ast_cast<TacConstant>(node));
         case AST_T::TacVariable_t:
-            return generate_variable_operand(static_cast<TacVariable*>(node));
+            return generate_variable_operand(ast_cast<TacVariable>(node));
         default:
             RAISE_INTERNAL_ERROR;
     }
@@ -237,7 +243,7 @@ static bool is_constant_value_signed(TacConstant* node) {
 }
 
 static bool is_variable_value_signed(TacVariable* node) {
-    switch (frontend->symbol_table[node->name]->type_t->type()) {
+    switch (get_variable_type(node->name)->type()) {
         case AST_T::Char_t:
         case AST_T::SChar_t:
         case AST_T::Int_t:
@@ -252,9 +258,9 @@ static bool is_variable_value_signed(TacVariable* node) {
 static bool is_value_signed(TacValue* node) {
     switch (node->type()) {
         case AST_T::TacConstant_t:
-            return is_constant_value_signed(static_cast<TacConstant*>(node));
+            return is_constant_value_signed(ast_cast<TacConstant>(node));
         case AST_T::TacVariable_t:
-            return is_variable_value_signed(static_cast<TacVariable*>(node));
+            return is_variable_value_signed(ast_cast<TacVariable>(node));
         default:
             RAISE_INTERNAL_ERROR;
     }
@@ -271,7 +277,7 @@ static bool is_constant_value_1byte(TacConstant* node) {
 }
 
 static bool is_variable_value_1byte(TacVariable* node) {
-    switch (frontend->symbol_table[node->name]->type_t->type()) {
+    switch (get_variable_type(node->name)->type()) {
         case AST_T::Char_t:
         case AST_T::SChar_t:
         case AST_T::UChar_t:
@@ -284,9 +290,9 @@ static bool is_variable_value_1byte(TacVariable* node) {
 static bool is_value_1byte(TacValue* node) {
     switch (node->type()) {
         case AST_T::TacConstant_t:
-            return is_constant_value_1byte(static_cast<TacConstant*>(node));
+            return is_constant_value_1byte(ast_cast<TacConstant>(node));
         case AST_T::TacVariable_t:
-            return is_variable_value_1byte(static_cast<TacVariable*>(node));
+            return is_variable_value_1byte(ast_cast<TacVariable>(node));
         default:
             RAISE_INTERNAL_ERROR;
     }
@@ -303,7 +309,7 @@ static bool is_constant_value_4byte(TacConstant* node) {
 }
 
 static bool is_variable_value_4byte(TacVariable* node) {
-    switch (frontend->symbol_table[node->name]->type_t->type()) {
+    switch (get_variable_type(node->name)->type()) {
         case AST_T::Int_t:
         case AST_T::UInt_t:
             return true;
@@ -315,9 +321,9 @@ static bool is_variable_value_4byte(TacVariable* node) {
 static bool is_value_4byte(TacValue* node) {
     switch (node->type()) {
         case AST_T::TacConstant_t:
-            return is_constant_value_4byte(static_cast<TacConstant*>(node));
+            return is_constant_value_4byte(ast_cast<TacConstant>(node));
         case AST_T::TacVariable_t:
-            return is_variable_value_4byte(static_cast<TacVariable*>(node));
+            return is_variable_value_4byte(ast_cast<TacVariable>(node));
         default:
             RAISE_INTERNAL_ERROR;
     }
@@ -326,28 +332,28 @@ static bool is_value_4byte(TacValue* node) {
 static bool is_constant_value_double(TacConstant* node) { return node->constant->type() == AST_T::CConstDouble_t; }
 
 static bool is_variable_value_double(TacVariable* node) {
-    return frontend->symbol_table[node->name]->type_t->type() == AST_T::Double_t;
+    return get_variable_type(node->name)->type() == AST_T::Double_t;
 }
 
 static bool is_value_double(TacValue* node) {
     switch (node->type()) {
         case AST_T::TacConstant_t:
-            return is_constant_value_double(static_cast<TacConstant*>(node));
+            return is_constant_value_double(ast_cast<TacConstant>(node));
         case AST_T::TacVariable_t:
-            return is_variable_value_double(static_cast<TacVariable*>(node));
+            return is_variable_value_double(ast_cast<TacVariable>(node));
         default:
             RAISE_INTERNAL_ERROR;
     }
 }
 
 static bool is_variable_value_structure(TacVariable* node) {
-    return frontend->symbol_table[node->name]->type_t->type() == AST_T::Structure_t;
+    return get_variable_type(node->name)->type() == AST_T::Structure_t;
 }
 
 static bool is_value_structure(TacValue* node) {
     switch (node->type()) {
         case AST_T::TacVariable_t:
-            return is_variable_value_structure(static_cast<TacVariable*>(node));
+            return is_variable_value_structure(ast_cast<TacVariable>(node));
         case AST_T::TacConstant_t:
             return false;
         default:
@@ -374,15 +380,15 @@ static std::shared_ptr<AssemblyType> generate_constant_assembly_type(TacConstant
 }
 
 static std::shared_ptr<AssemblyType> generate_variable_assembly_type(TacVariable* node) {
-    return convert_backend_assembly_type(node->name);
+    return convert_backend_assembly_type(get_variable_type(node->name));
 }
 
 static std::shared_ptr<AssemblyType> generate_assembly_type(TacValue* node) {
     switch (node->type()) {
         case AST_T::TacConstant_t:
-            return generate_constant_assembly_type(static_cast<TacConstant*>(node));
+            return generate_constant_assembly_type(ast_cast<TacConstant>(node));
         case AST_T::TacVariable_t:
-            return generate_variable_assembly_type(static_cast<TacVariable*>(node));
+            return generate_variable_assembly_type(ast_cast<TacVariable>(node));
         default:
             RAISE_INTERNAL_ERROR;
     }
@@ -406,24 +412,25 @@ static std::shared_ptr<AssemblyType> generate_8byte_assembly_type(Structure* str
 static void generate_structure_type_classes(Structure* struct_type) {
     if (context->struct_8b_cls_map.find(struct_type->tag) == context->struct_8b_cls_map.end()) {
         std::vector<STRUCT_8B_CLS> struct_8b_cls;
-        if (frontend->struct_typedef_table[struct_type->tag]->size > 16l) {
-            TLong size = frontend->struct_typedef_table[struct_type->tag]->size;
+        StructTypedef* struct_typedef = frontend->struct_typedef_table[struct_type->tag].get();
+        if (struct_typedef->size > 16l) {
+            TLong size = struct_typedef->size;
             while (size > 0l) {
                 struct_8b_cls.push_back(STRUCT_8B_CLS::MEMORY);
                 size -= 8l;
             }
         }
         else {
-            Type* member_type = GET_STRUCT_TYPEDEF_MEMBER(struct_type->tag, 0)->member_type.get();
+            Type* member_type = struct_typedef->members[0].member_type.get();
             while (true) {
                 switch (member_type->type()) {
                     case AST_T::Array_t: {
-                        member_type = static_cast<Array*>(member_type)->elem_type.get();
+                        member_type = ast_cast<Array>(member_type)->elem_type.get();
                         break;
                     }
                     case AST_T::Structure_t: {
                         member_type =
-                            GET_STRUCT_TYPEDEF_MEMBER(static_cast<Structure*>(member_type)->tag, 0)->member_type.get();
+                            GET_STRUCT_TYPEDEF_MEMBER(ast_cast<Structure>(member_type)->tag, 0)->member_type.get();
                         break;
                     }
                     default:
@@ -433,16 +440,16 @@ static void generate_structure_type_classes(Structure* struct_type) {
         Lbreak_1:
             struct_8b_cls.push_back(
                 member_type->type() == AST_T::Double_t ? STRUCT_8B_CLS::SSE : STRUCT_8B_CLS::INTEGER);
-            if (frontend->struct_typedef_table[struct_type->tag]->size > 8l) {
-                member_type = GET_STRUCT_TYPEDEF_MEMBER_BACK(struct_type->tag)->member_type.get();
+            if (struct_typedef->size > 8l) {
+                member_type = struct_typedef->members.back().member_type.get();
                 while (true) {
                     switch (member_type->type()) {
                         case AST_T::Array_t: {
-                            member_type = static_cast<Array*>(member_type)->elem_type.get();
+                            member_type = ast_cast<Array>(member_type)->elem_type.get();
                             break;
                         }
                         case AST_T::Structure_t: {
-                            member_type = GET_STRUCT_TYPEDEF_MEMBER_BACK(static_cast<Structure*>(member_type)->tag)
+                            member_type = GET_STRUCT_TYPEDEF_MEMBER_BACK(ast_cast<Structure>(member_type)->tag)
                                               ->member_type.get();
                             break;
                         }
@@ -478,16 +485,16 @@ static void generate_return_double_instructions(TacReturn* node) {
 }
 
 static void generate_8byte_return_instructions(
-    const TIdentifier& name, TLong offset, Structure* struct_type, REGISTER_KIND arg_register) {
+    TIdentifier name, TLong offset, Structure* struct_type, REGISTER_KIND arg_register) {
     TIdentifier src_name = name;
     std::shared_ptr<AsmOperand> dst = generate_register(arg_register);
     std::shared_ptr<AssemblyType> assembly_type_src =
         struct_type ? generate_8byte_assembly_type(struct_type, offset) : std::make_shared<BackendDouble>();
     if (assembly_type_src->type() == AST_T::ByteArray_t) {
         TLong size = offset + 2l;
-        offset += static_cast<ByteArray*>(assembly_type_src.get())->size - 1l;
+        offset += ast_cast<ByteArray>(assembly_type_src.get())->size - 1l;
         assembly_type_src = std::make_shared<Byte>();
-        std::shared_ptr<AsmOperand> src_shl = std::make_shared<AsmImm>(true, false, "8");
+        std::shared_ptr<AsmOperand> src_shl = std::make_shared<AsmImm>(true, false, make_identifier("8"));
         std::shared_ptr<AssemblyType> assembly_type_shl = std::make_shared<QuadWord>();
         while (offset >= size) {
             {
@@ -526,8 +533,8 @@ static void generate_8byte_return_instructions(
 }
 
 static void generate_return_structure_instructions(TacReturn* node) {
-    TIdentifier name = static_cast<TacVariable*>(node->val.get())->name;
-    Structure* struct_type = static_cast<Structure*>(frontend->symbol_table[name]->type_t.get());
+    TIdentifier name = ast_cast<TacVariable>(node->val.get())->name;
+    Structure* struct_type = ast_cast<Structure>(get_variable_type(name));
     generate_structure_type_classes(struct_type);
     if (context->struct_8b_cls_map[struct_type->tag][0] == STRUCT_8B_CLS::MEMORY) {
         {
@@ -544,7 +551,7 @@ static void generate_return_structure_instructions(TacReturn* node) {
                 if (src->type() != AST_T::AsmPseudoMem_t) {
                     RAISE_INTERNAL_ERROR;
                 }
-                static_cast<AsmPseudoMem*>(src.get())->offset = offset;
+                ast_cast<AsmPseudoMem>(src.get())->offset = offset;
                 std::shared_ptr<AsmOperand> dst = generate_memory(REGISTER_KIND::Ax, offset);
                 std::shared_ptr<AssemblyType> assembly_type_src;
                 if (size >= 8l) {
@@ -624,7 +631,7 @@ static void generate_sign_extend_instructions(TacSignExtend* node) {
 
 static void generate_imm_byte_truncate_instructions(AsmImm* node) {
     if (!node->is_byte) {
-        node->value = std::to_string(string_to_uint64(std::move(node->value)) % 256l);
+        node->value = make_identifier(std::to_string(string_to_uint64(get_identifier_name(node->value)) % 256l));
     }
 }
 
@@ -633,14 +640,15 @@ static void generate_byte_truncate_instructions(TacTruncate* node) {
     std::shared_ptr<AsmOperand> dst = generate_operand(node->dst.get());
     std::shared_ptr<AssemblyType> assembly_type_dst = std::make_shared<Byte>();
     if (src->type() == AST_T::AsmImm_t) {
-        generate_imm_byte_truncate_instructions(static_cast<AsmImm*>(src.get()));
+        generate_imm_byte_truncate_instructions(ast_cast<AsmImm>(src.get()));
     }
     push_instruction(std::make_unique<AsmMov>(std::move(assembly_type_dst), std::move(src), std::move(dst)));
 }
 
 static void generate_imm_long_truncate_instructions(AsmImm* node) {
     if (node->is_quad) {
-        node->value = std::to_string(string_to_uint64(std::move(node->value)) - 4294967296ul);
+        node->value =
+            make_identifier(std::to_string(string_to_uint64(get_identifier_name(node->value)) - 4294967296ul));
     }
 }
 
@@ -649,7 +657,7 @@ static void generate_long_truncate_instructions(TacTruncate* node) {
     std::shared_ptr<AsmOperand> dst = generate_operand(node->dst.get());
     std::shared_ptr<AssemblyType> assembly_type_dst = std::make_shared<LongWord>();
     if (src->type() == AST_T::AsmImm_t) {
-        generate_imm_long_truncate_instructions(static_cast<AsmImm*>(src.get()));
+        generate_imm_long_truncate_instructions(ast_cast<AsmImm>(src.get()));
     }
     push_instruction(std::make_unique<AsmMov>(std::move(assembly_type_dst), std::move(src), std::move(dst)));
 }
@@ -757,7 +765,8 @@ static void generate_ulong_double_to_unsigned_instructions(TacDoubleToUInt* node
     }
     push_instruction(std::make_unique<AsmCvttsd2si>(assembly_type_si, std::move(dst_out_of_range_sd), dst));
     {
-        std::shared_ptr<AsmOperand> upper_bound_si = std::make_shared<AsmImm>(false, true, "9223372036854775808");
+        std::shared_ptr<AsmOperand> upper_bound_si =
+            std::make_shared<AsmImm>(false, true, make_identifier("9223372036854775808"));
         push_instruction(std::make_unique<AsmMov>(assembly_type_si, std::move(upper_bound_si), src_out_of_range_si));
     }
     {
@@ -853,7 +862,7 @@ static void generate_ulong_unsigned_to_double_instructions(TacUIntToDouble* node
     std::shared_ptr<AsmOperand> dst_out_of_range_si_shr = generate_register(REGISTER_KIND::Dx);
     std::shared_ptr<AssemblyType> assembly_type_si = std::make_shared<QuadWord>();
     {
-        std::shared_ptr<AsmOperand> lower_bound_si = std::make_shared<AsmImm>(true, false, "0");
+        std::shared_ptr<AsmOperand> lower_bound_si = std::make_shared<AsmImm>(true, false, make_identifier("0"));
         push_instruction(std::make_unique<AsmCmp>(assembly_type_si, std::move(lower_bound_si), src));
     }
     {
@@ -872,7 +881,7 @@ static void generate_ulong_unsigned_to_double_instructions(TacUIntToDouble* node
     }
     {
         std::unique_ptr<AsmBinaryOp> binary_op_out_of_range_si_and = std::make_unique<AsmBitAnd>();
-        std::shared_ptr<AsmOperand> set_bit_si = std::make_shared<AsmImm>(true, false, "1");
+        std::shared_ptr<AsmOperand> set_bit_si = std::make_shared<AsmImm>(true, false, make_identifier("1"));
         push_instruction(std::make_unique<AsmBinary>(
             std::move(binary_op_out_of_range_si_and), assembly_type_si, std::move(set_bit_si), dst_out_of_range_si));
     }
@@ -930,11 +939,11 @@ static void generate_stack_arg_fun_call_instructions(TacValue* node) {
 }
 
 static void generate_8byte_reg_arg_fun_call_instructions(
-    const TIdentifier& name, TLong offset, Structure* struct_type, REGISTER_KIND arg_register) {
+    TIdentifier name, TLong offset, Structure* struct_type, REGISTER_KIND arg_register) {
     generate_8byte_return_instructions(name, offset, struct_type, arg_register);
 }
 
-static void generate_quadword_8byte_stack_arg_fun_call_instructions(const TIdentifier& name, TLong offset) {
+static void generate_quadword_8byte_stack_arg_fun_call_instructions(TIdentifier name, TLong offset) {
     std::shared_ptr<AsmOperand> src;
     {
         TIdentifier src_name = name;
@@ -945,7 +954,7 @@ static void generate_quadword_8byte_stack_arg_fun_call_instructions(const TIdent
 }
 
 static void generate_byte_longword_8byte_stack_arg_fun_call_instructions(
-    const TIdentifier& name, TLong offset, std::shared_ptr<AssemblyType>&& assembly_type) {
+    TIdentifier name, TLong offset, std::shared_ptr<AssemblyType>&& assembly_type) {
     std::shared_ptr<AsmOperand> src;
     {
         TIdentifier src_name = name;
@@ -959,7 +968,7 @@ static void generate_byte_longword_8byte_stack_arg_fun_call_instructions(
 }
 
 static void generate_bytearray_8byte_stack_arg_fun_call_instructions(
-    const TIdentifier& name, TLong offset, ByteArray* bytearray_type) {
+    TIdentifier name, TLong offset, ByteArray* bytearray_type) {
     {
         TLong to_offset = 0l;
         TLong size = bytearray_type->size;
@@ -993,7 +1002,7 @@ static void generate_bytearray_8byte_stack_arg_fun_call_instructions(
     }
     {
         std::unique_ptr<AsmBinaryOp> binary_op = std::make_unique<AsmSub>();
-        std::shared_ptr<AsmOperand> src = std::make_shared<AsmImm>(true, false, "8");
+        std::shared_ptr<AsmOperand> src = std::make_shared<AsmImm>(true, false, make_identifier("8"));
         std::shared_ptr<AsmOperand> dst = generate_register(REGISTER_KIND::Sp);
         std::shared_ptr<AssemblyType> assembly_type_src = std::make_shared<QuadWord>();
         push_instruction(std::make_unique<AsmBinary>(
@@ -1002,7 +1011,7 @@ static void generate_bytearray_8byte_stack_arg_fun_call_instructions(
 }
 
 static void generate_8byte_stack_arg_fun_call_instructions(
-    const TIdentifier& name, TLong offset, Structure* struct_type) {
+    TIdentifier name, TLong offset, Structure* struct_type) {
     std::shared_ptr<AssemblyType> assembly_type = generate_8byte_assembly_type(struct_type, offset);
     switch (assembly_type->type()) {
         case AST_T::QuadWord_t:
@@ -1010,7 +1019,7 @@ static void generate_8byte_stack_arg_fun_call_instructions(
             break;
         case AST_T::ByteArray_t:
             generate_bytearray_8byte_stack_arg_fun_call_instructions(
-                name, offset, static_cast<ByteArray*>(assembly_type.get()));
+                name, offset, ast_cast<ByteArray>(assembly_type.get()));
             break;
         default:
             generate_byte_longword_8byte_stack_arg_fun_call_instructions(name, offset, std::move(assembly_type));
@@ -1052,8 +1061,8 @@ static TLong generate_arg_fun_call_instructions(TacFunCall* node, bool is_return
         else {
             size_t struct_reg_size = 7;
             size_t struct_sse_size = 9;
-            TIdentifier name = static_cast<TacVariable*>(arg.get())->name;
-            Structure* struct_type = static_cast<Structure*>(frontend->symbol_table[name]->type_t.get());
+            TIdentifier name = ast_cast<TacVariable>(arg.get())->name;
+            Structure* struct_type = ast_cast<Structure>(get_variable_type(name));
             generate_structure_type_classes(struct_type);
             if (context->struct_8b_cls_map[struct_type->tag][0] != STRUCT_8B_CLS::MEMORY) {
                 struct_reg_size = 0;
@@ -1114,15 +1123,15 @@ static void generate_return_fun_call_instructions(TacValue* node, REGISTER_KIND
 }
 
 static void generate_8byte_return_fun_call_instructions(
-    const TIdentifier& name, TLong offset, Structure* struct_type, REGISTER_KIND arg_register) {
+    TIdentifier name, TLong offset, Structure* struct_type, REGISTER_KIND arg_register) {
     TIdentifier dst_name = name;
     std::shared_ptr<AsmOperand> src = generate_register(arg_register);
     std::shared_ptr<AssemblyType> assembly_type_dst =
         struct_type ? generate_8byte_assembly_type(struct_type, offset) : std::make_shared<BackendDouble>();
     if (assembly_type_dst->type() == AST_T::ByteArray_t) {
-        TLong size = static_cast<ByteArray*>(assembly_type_dst.get())->size + offset - 2l;
+        TLong size = ast_cast<ByteArray>(assembly_type_dst.get())->size + offset - 2l;
         assembly_type_dst = std::make_shared<Byte>();
-        std::shared_ptr<AsmOperand> src_shr2op = std::make_shared<AsmImm>(true, false, "8");
+        std::shared_ptr<AsmOperand> src_shr2op = std::make_shared<AsmImm>(true, false, make_identifier("8"));
         std::shared_ptr<AssemblyType> assembly_type_shr2op = std::make_shared<QuadWord>();
         while (offset < size) {
             {
@@ -1165,8 +1174,8 @@ static void generate_fun_call_instructions(TacFunCall* node) {
     bool is_return_memory = false;
     {
         if (node->dst && is_value_structure(node->dst.get())) {
-            TIdentifier name = static_cast<TacVariable*>(node->dst.get())->name;
-            Structure* struct_type = static_cast<Structure*>(frontend->symbol_table[name]->type_t.get());
+            TIdentifier name = ast_cast<TacVariable>(node->dst.get())->name;
+            Structure* struct_type = ast_cast<Structure>(get_variable_type(name));
             generate_structure_type_classes(struct_type);
             if (context->struct_8b_cls_map[struct_type->tag][0] == STRUCT_8B_CLS::MEMORY) {
                 is_return_memory = true;
@@ -1198,8 +1207,8 @@ static void generate_fun_call_instructions(TacFunCall* node) {
         }
         else {
             bool reg_size = false;
-            TIdentifier name = static_cast<TacVariable*>(node->dst.get())->name;
-            Structure* struct_type = static_cast<Structure*>(frontend->symbol_table[name]->type_t.get());
+            TIdentifier name = ast_cast<TacVariable>(node->dst.get())->name;
+            Structure* struct_type = ast_cast<Structure>(get_variable_type(name));
             switch (context->struct_8b_cls_map[struct_type->tag][0]) {
                 case STRUCT_8B_CLS::INTEGER: {
                     generate_8byte_return_fun_call_instructions(name, 0l, struct_type, REGISTER_KIND::Ax);
@@ -1231,7 +1240,7 @@ static void generate_fun_call_instructions(TacFunCall* node) {
 }
 
 static void generate_unary_operator_conditional_integer_instructions(TacUnary* node) {
-    std::shared_ptr<AsmOperand> imm_zero = std::make_shared<AsmImm>(true, false, "0");
+    std::shared_ptr<AsmOperand> imm_zero = std::make_shared<AsmImm>(true, false, make_identifier("0"));
     std::shared_ptr<AsmOperand> cmp_dst = generate_operand(node->dst.get());
     {
         std::shared_ptr<AsmOperand> src = generate_operand(node->src.get());
@@ -1265,7 +1274,7 @@ static void generate_unary_operator_conditional_double_instructions(TacUnary* no
         push_instruction(std::make_unique<AsmCmp>(std::move(assembly_type_src), std::move(reg_zero), std::move(src)));
     }
     {
-        std::shared_ptr<AsmOperand> imm_zero = std::make_shared<AsmImm>(true, false, "0");
+        std::shared_ptr<AsmOperand> imm_zero = std::make_shared<AsmImm>(true, false, make_identifier("0"));
         std::shared_ptr<AssemblyType> assembly_type_dst = std::make_shared<LongWord>();
         push_instruction(std::make_unique<AsmMov>(std::move(assembly_type_dst), std::move(imm_zero), cmp_dst));
     }
@@ -1379,7 +1388,7 @@ static void generate_binary_operator_arithmetic_unsigned_divide_instructions(Tac
         push_instruction(std::make_unique<AsmMov>(assembly_type_src1, std::move(src1), src1_dst));
     }
     {
-        std::shared_ptr<AsmOperand> imm_zero = std::make_shared<AsmImm>(true, false, "0");
+        std::shared_ptr<AsmOperand> imm_zero = std::make_shared<AsmImm>(true, false, make_identifier("0"));
         std::shared_ptr<AsmOperand> imm_zero_dst = generate_register(REGISTER_KIND::Dx);
         push_instruction(std::make_unique<AsmMov>(assembly_type_src1, std::move(imm_zero), std::move(imm_zero_dst)));
     }
@@ -1433,7 +1442,7 @@ static void generate_binary_operator_arithmetic_unsigned_remainder_instructions(
         push_instruction(std::make_unique<AsmMov>(assembly_type_src1, std::move(src1), std::move(src1_dst)));
     }
     {
-        std::shared_ptr<AsmOperand> imm_zero = std::make_shared<AsmImm>(true, false, "0");
+        std::shared_ptr<AsmOperand> imm_zero = std::make_shared<AsmImm>(true, false, make_identifier("0"));
         push_instruction(std::make_unique<AsmMov>(assembly_type_src1, std::move(imm_zero), dst_src));
     }
     {
@@ -1464,7 +1473,7 @@ static void generate_binary_operator_conditional_integer_instructions(TacBinary*
         push_instruction(std::make_unique<AsmCmp>(std::move(assembly_type_src1), std::move(src2), std::move(src1)));
     }
     {
-        std::shared_ptr<AsmOperand> imm_zero = std::make_shared<AsmImm>(true, false, "0");
+        std::shared_ptr<AsmOperand> imm_zero = std::make_shared<AsmImm>(true, false, make_identifier("0"));
         std::shared_ptr<AssemblyType> assembly_type_dst = generate_assembly_type(node->dst.get());
         push_instruction(std::make_unique<AsmMov>(std::move(assembly_type_dst), std::move(imm_zero), cmp_dst));
     }
@@ -1482,7 +1491,7 @@ static void generate_binary_operator_conditional_integer_instructions(TacBinary*
 
 static void generate_binary_operator_conditional_double_instructions(TacBinary* node) {
     TIdentifier target_nan = represent_label_identifier(LABEL_KIND::Lcomisd_nan);
-    TIdentifier target_nan_ne = "";
+    TIdentifier target_nan_ne = 0;
     std::shared_ptr<AsmOperand> cmp_dst = generate_operand(node->dst.get());
     {
         std::shared_ptr<AsmOperand> src1 = generate_operand(node->src1.get());
@@ -1491,7 +1500,7 @@ static void generate_binary_operator_conditional_double_instructions(TacBinary*
         push_instruction(std::make_unique<AsmCmp>(std::move(assembly_type_src1), std::move(src2), std::move(src1)));
     }
     {
-        std::shared_ptr<AsmOperand> imm_zero = std::make_shared<AsmImm>(true, false, "0");
+        std::shared_ptr<AsmOperand> imm_zero = std::make_shared<AsmImm>(true, false, make_identifier("0"));
         std::shared_ptr<AssemblyType> assembly_type_dst = std::make_shared<LongWord>();
         push_instruction(std::make_unique<AsmMov>(std::move(assembly_type_dst), std::move(imm_zero), cmp_dst));
     }
@@ -1511,7 +1520,7 @@ static void generate_binary_operator_conditional_double_instructions(TacBinary*
         }
     }
     push_instruction(std::make_unique<AsmLabel>(std::move(target_nan)));
-    if (!target_nan_ne.empty()) {
+    if (target_nan_ne != 0) {
         std::unique_ptr<AsmCondCode> cond_code_e = std::make_unique<AsmE>();
         push_instruction(std::make_unique<AsmSetCC>(std::move(cond_code_e), std::move(cmp_dst)));
         push_instruction(std::make_unique<AsmLabel>(std::move(target_nan_ne)));
@@ -1560,9 +1569,9 @@ static void generate_binary_instructions(TacBinary* node) {
 }
 
 static void generate_copy_structure_instructions(TacCopy* node) {
-    TIdentifier src_name = static_cast<TacVariable*>(node->src.get())->name;
-    TIdentifier dst_name = static_cast<TacVariable*>(node->dst.get())->name;
-    Structure* struct_type = static_cast<Structure*>(frontend->symbol_table[src_name]->type_t.get());
+    TIdentifier src_name = ast_cast<TacVariable>(node->src.get())->name;
+    TIdentifier dst_name = ast_cast<TacVariable>(node->dst.get())->name;
+    Structure* struct_type = ast_cast<Structure>(get_variable_type(src_name));
     TLong size = frontend->struct_typedef_table[struct_type->tag]->size;
     TLong offset = 0l;
     while (size > 0l) {
@@ -1608,7 +1617,7 @@ static void generate_get_address_instructions(TacGetAddress* node) {
     std::shared_ptr<AsmOperand> src;
     {
         if (node->src->type() == AST_T::TacVariable_t) {
-            TIdentifier name = static_cast<TacVariable*>(node->src.get())->name;
+            TIdentifier name = ast_cast<TacVariable>(node->src.get())->name;
             if (frontend->symbol_table.find(name) != frontend->symbol_table.end()
                 && frontend->symbol_table[name]->attrs->type() == AST_T::ConstantAttr_t) {
                 src = std::make_shared<AsmData>(std::move(name), 0l);
@@ -1630,8 +1639,8 @@ static void generate_load_structure_instructions(TacLoad* node) {
         push_instruction(std::make_unique<AsmMov>(std::move(assembly_type_src), std::move(src), std::move(dst)));
     }
     {
-        TIdentifier name = static_cast<TacVariable*>(node->dst.get())->name;
-        Structure* struct_type = static_cast<Structure*>(frontend->symbol_table[name]->type_t.get());
+        TIdentifier name = ast_cast<TacVariable>(node->dst.get())->name;
+        Structure* struct_type = ast_cast<Structure>(get_variable_type(name));
         TLong size = frontend->struct_typedef_table[struct_type->tag]->size;
         TLong offset = 0l;
         while (size > 0l) {
@@ -1690,8 +1699,8 @@ static void generate_store_structure_instructions(TacStore* node) {
         push_instruction(std::make_unique<AsmMov>(std::move(assembly_type_src), std::move(src), std::move(dst)));
     }
     {
-        TIdentifier name = static_cast<TacVariable*>(node->src.get())->name;
-        Structure* struct_type = static_cast<Structure*>(frontend->symbol_table[name]->type_t.get());
+        TIdentifier name = ast_cast<TacVariable>(node->src.get())->name;
+        Structure* struct_type = ast_cast<Structure>(get_variable_type(name));
         TLong size = frontend->struct_typedef_table[struct_type->tag]->size;
         TLong offset = 0l;
         while (size > 0l) {
@@ -1752,11 +1761,17 @@ static void generate_constant_index_add_ptr_instructions(TacAddPtr* node) {
     {
         TLong index;
         {
-            CConst* constant = static_cast<TacConstant*>(node->index.get())->constant.get();
-            if (constant->type() != AST_T::CConstLong_t) {
-                RAISE_INTERNAL_ERROR;
+            CConst* constant = ast_cast<TacConstant>(node->index.get())->constant.get();
+            switch (constant->type()) {
+                case AST_T::CConstLong_t:
+                    index = ast_cast<CConstLong>(constant)->value;
+                    break;
+                case AST_T::CConstULong_t:
+                    index = static_cast<TLong>(ast_cast<CConstULong>(constant)->value);
+                    break;
+                default:
+                    RAISE_INTERNAL_ERROR;
             }
-            index = static_cast<CConstLong*>(constant)->value;
         }
         std::shared_ptr<AsmOperand> src = generate_memory(REGISTER_KIND::Ax, index * node->scale);
         std::shared_ptr<AsmOperand> dst = generate_operand(node->dst.get());
@@ -1798,7 +1813,7 @@ static void generate_aggregate_scale_variable_index_add_ptr_instructions(TacAddP
     {
         bool is_byte = node->scale <= 255l;
         bool is_quad = node->scale > 2147483647l;
-        TIdentifier value = std::to_string(node->scale);
+        TIdentifier value = make_identifier(std::to_string(node->scale));
         std::shared_ptr<AsmOperand> src =
             std::make_shared<AsmImm>(std::move(is_byte), std::move(is_quad), std::move(value));
         std::unique_ptr<AsmBinaryOp> binary_op = std::make_unique<AsmMult>();
@@ -1840,8 +1855,8 @@ static void generate_add_ptr_instructions(TacAddPtr* node) {
 }
 
 static void generate_copy_to_offset_structure_instructions(TacCopyToOffset* node) {
-    TIdentifier src_name = static_cast<TacVariable*>(node->src.get())->name;
-    Structure* struct_type = static_cast<Structure*>(frontend->symbol_table[src_name]->type_t.get());
+    TIdentifier src_name = ast_cast<TacVariable>(node->src.get())->name;
+    Structure* struct_type = ast_cast<Structure>(get_variable_type(src_name));
     TLong size = frontend->struct_typedef_table[struct_type->tag]->size;
     TLong offset = 0l;
     while (size > 0l) {
@@ -1894,8 +1909,8 @@ static void generate_copy_to_offset_instructions(TacCopyToOffset* node) {
 }
 
 static void generate_copy_from_offset_structure_instructions(TacCopyFromOffset* node) {
-    TIdentifier dst_name = static_cast<TacVariable*>(node->dst.get())->name;
-    Structure* struct_type = static_cast<Structure*>(frontend->symbol_table[dst_name]->type_t.get());
+    TIdentifier dst_name = ast_cast<TacVariable>(node->dst.get())->name;
+    Structure* struct_type = ast_cast<Structure>(get_variable_type(dst_name));
     TLong size = frontend->struct_typedef_table[struct_type->tag]->size;
     TLong offset = 0l;
     while (size > 0l) {
@@ -1947,6 +1962,79 @@ static void generate_copy_from_offset_instructions(TacCopyFromOffset* node) {
     }
 }
 
+static void generate_zero_fill_rep_stos_instructions(TacZeroFill* node, TLong size) {
+    {
+        std::shared_ptr<AsmOperand> src;
+        {
+            TIdentifier dst_name = node->dst_name;
+            TLong offset = node->offset;
+            src = std::make_shared<AsmPseudoMem>(std::move(dst_name), std::move(offset));
+        }
+        std::shared_ptr<AsmOperand> dst = generate_register(REGISTER_KIND::Di);
+        push_instruction(std::make_unique<AsmLea>(std::move(src), std::move(dst)));
+    }
+    {
+        std::shared_ptr<AsmOperand> src;
+        {
+            TLong count = size / 8l;
+            bool is_byte = count <= 255l;
+            bool is_quad = count > 2147483647l;
+            TIdentifier value = make_identifier(std::to_string(count));
+            src = std::make_shared<AsmImm>(std::move(is_byte), std::move(is_quad), std::move(value));
+        }
+        std::shared_ptr<AsmOperand> dst = generate_register(REGISTER_KIND::Cx);
+        std::shared_ptr<AssemblyType> assembly_type_src = std::make_shared<QuadWord>();
+        push_instruction(std::make_unique<AsmMov>(std::move(assembly_type_src), std::move(src), std::move(dst)));
+    }
+    {
+        std::shared_ptr<AsmOperand> src = std::make_shared<AsmImm>(true, false, make_identifier("0"));
+        std::shared_ptr<AsmOperand> dst = generate_register(REGISTER_KIND::Ax);
+        std::shared_ptr<AssemblyType> assembly_type_src = std::make_shared<QuadWord>();
+        push_instruction(std::make_unique<AsmMov>(std::move(assembly_type_src), std::move(src), std::move(dst)));
+    }
+    {
+        std::shared_ptr<AssemblyType> assembly_type = std::make_shared<QuadWord>();
+        push_instruction(std::make_unique<AsmRepStos>(std::move(assembly_type)));
+    }
+}
+
+// Large ranges are cleared in bulk with rep stosq, and whatever is left is cleared with unrolled moves
+static void generate_zero_fill_instructions(TacZeroFill* node) {
+    TLong size = node->byte;
+    TLong offset = 0l;
+    if (size >= 64l) {
+        generate_zero_fill_rep_stos_instructions(node, size);
+        offset = size & ~7l;
+        size &= 7l;
+    }
+    while (size > 0l) {
+        std::shared_ptr<AsmOperand> src = std::make_shared<AsmImm>(true, false, make_identifier("0"));
+        std::shared_ptr<AsmOperand> dst;
+        {
+            TIdentifier dst_name = node->dst_name;
+            TLong to_offset = offset + node->offset;
+            dst = std::make_shared<AsmPseudoMem>(std::move(dst_name), std::move(to_offset));
+        }
+        std::shared_ptr<AssemblyType> assembly_type_src;
+        if (size >= 8l) {
+            assembly_type_src = std::make_shared<QuadWord>();
+            size -= 8l;
+            offset += 8l;
+        }
+        else if (size >= 4l) {
+            assembly_type_src = std::make_shared<LongWord>();
+            size -= 4l;
+            offset += 4l;
+        }
+        else {
+            assembly_type_src = std::make_shared<Byte>();
+            size--;
+            offset++;
+        }
+        push_instruction(std::make_unique<AsmMov>(std::move(assembly_type_src), std::move(src), std::move(dst)));
+    }
+}
+
 static void generate_jump_instructions(TacJump* node) {
     TIdentifier target = node->target;
     push_instruction(std::make_unique<AsmJmp>(std::move(target)));
@@ -1954,7 +2042,7 @@ static void generate_jump_instructions(TacJump* node) {
 
 static void generate_jump_if_zero_integer_instructions(TacJumpIfZero* node) {
     {
-        std::shared_ptr<AsmOperand> imm_zero = std::make_shared<AsmImm>(true, false, "0");
+        std::shared_ptr<AsmOperand> imm_zero = std::make_shared<AsmImm>(true, false, make_identifier("0"));
         std::shared_ptr<AsmOperand> condition = generate_operand(node->condition.get());
         std::shared_ptr<AssemblyType> assembly_type_cond = generate_assembly_type(node->condition.get());
         push_instruction(
@@ -1994,7 +2082,7 @@ static void generate_jump_if_zero_instructions(TacJumpIfZero* node) {
 
 static void generate_jump_if_not_zero_integer_instructions(TacJumpIfNotZero* node) {
     {
-        std::shared_ptr<AsmOperand> imm_zero = std::make_shared<AsmImm>(true, false, "0");
+        std::shared_ptr<AsmOperand> imm_zero = std::make_shared<AsmImm>(true, false, make_identifier("0"));
         std::shared_ptr<AsmOperand> condition = generate_operand(node->condition.get());
         std::shared_ptr<AssemblyType> assembly_type_cond = generate_assembly_type(node->condition.get());
         push_instruction(
@@ -2040,70 +2128,73 @@ static void generate_label_instructions(TacLabel* node) {
 static void generate_instructions(TacInstruction* node) {
     switch (node->type()) {
         case AST_T::TacReturn_t:
-            generate_return_instructions(static_cast<TacReturn*>(node));
+            generate_return_instructions(ast_cast<TacReturn>(node));
             break;
         case AST_T::TacSignExtend_t:
-            generate_sign_extend_instructions(static_cast<TacSignExtend*>(node));
+            generate_sign_extend_instructions(ast_cast<TacSignExtend>(node));
             break;
         case AST_T::TacTruncate_t:
-            generate_truncate_instructions(static_cast<TacTruncate*>(node));
+            generate_truncate_instructions(ast_cast<TacTruncate>(node));
             break;
         case AST_T::TacZeroExtend_t:
-            generate_zero_extend_instructions(static_cast<TacZeroExtend*>(node));
+            generate_zero_extend_instructions(ast_cast<TacZeroExtend>(node));
             break;
         case AST_T::TacDoubleToInt_t:
-            generate_double_to_signed_instructions(static_cast<TacDoubleToInt*>(node));
+            generate_double_to_signed_instructions(ast_cast<TacDoubleToInt>(node));
             break;
         case AST_T::TacDoubleToUInt_t:
-            generate_double_to_unsigned_instructions(static_cast<TacDoubleToUInt*>(node));
+            generate_double_to_unsigned_instructions(ast_cast<TacDoubleToUInt>(node));
             break;
         case AST_T::TacIntToDouble_t:
-            generate_signed_to_double_instructions(static_cast<TacIntToDouble*>(node));
+            generate_signed_to_double_instructions(ast_cast<TacIntToDouble>(node));
             break;
         case AST_T::TacUIntToDouble_t:
-            generate_unsigned_to_double_instructions(static_cast<TacUIntToDouble*>(node));
+            generate_unsigned_to_double_instructions(ast_cast<TacUIntToDouble>(node));
             break;
         case AST_T::TacFunCall_t:
-            generate_fun_call_instructions(static_cast<TacFunCall*>(node));
+            generate_fun_call_instructions(ast_cast<TacFunCall>(node));
             break;
         case AST_T::TacUnary_t:
-            generate_unary_instructions(static_cast<TacUnary*>(node));
+            generate_unary_instructions(ast_cast<TacUnary>(node));
             break;
         case AST_T::TacBinary_t:
-            generate_binary_instructions(static_cast<TacBinary*>(node));
+            generate_binary_instructions(ast_cast<TacBinary>(node));
             break;
         case AST_T::TacCopy_t:
-            generate_copy_instructions(static_cast<TacCopy*>(node));
+            generate_copy_instructions(ast_cast<TacCopy>(node));
             break;
         case AST_T::TacGetAddress_t:
-            generate_get_address_instructions(static_cast<TacGetAddress*>(node));
+            generate_get_address_instructions(ast_cast<TacGetAddress>(node));
             break;
         case AST_T::TacLoad_t:
-            generate_load_instructions(static_cast<TacLoad*>(node));
+            generate_load_instructions(ast_cast<TacLoad>(node));
             break;
         case AST_T::TacStore_t:
-            generate_store_instructions(static_cast<TacStore*>(node));
+            generate_store_instructions(ast_cast<TacStore>(node));
             break;
         case AST_T::TacAddPtr_t:
-            generate_add_ptr_instructions(static_cast<TacAddPtr*>(node));
+            generate_add_ptr_instructions(ast_cast<TacAddPtr>(node));
             break;
         case AST_T::TacCopyToOffset_t:
-            generate_copy_to_offset_instructions(static_cast<TacCopyToOffset*>(node));
+            generate_copy_to_offset_instructions(ast_cast<TacCopyToOffset>(node));
             break;
         case AST_T::TacCopyFromOffset_t:
-            generate_copy_from_offset_instructions(static_cast<TacCopyFromOffset*>(node));
+            generate_copy_from_offset_instructions(ast_cast<TacCopyFromOffset>(node));
+            break;
+        case AST_T::TacZeroFill_t:
+            generate_zero_fill_instructions(ast_cast<TacZeroFill>(node));
             break;
         case AST_T::TacJump_t:
-            generate_jump_instructions(static_cast<TacJump*>(node));
+            generate_jump_instructions(ast_cast<TacJump>(node));
             break;
         case AST_T::TacJumpIfZero_t:
-            generate_jump_if_zero_instructions(static_cast<TacJumpIfZero*>(node));
+            generate_jump_if_zero_instructions(ast_cast<TacJumpIfZero>(node));
             break;
         case AST_T::TacJumpIfNotZero_t:
-            generate_jump_if_not_zero_instructions(static_cast<TacJumpIfNotZero*>(node));
+            generate_jump_if_not_zero_instructions(ast_cast<TacJumpIfNotZero>(node));
             break;
         case AST_T::TacLabel_t:
-            generate_label_instructions(static_cast<TacLabel*>(node));
+            generate_label_instructions(ast_cast<TacLabel>(node));
             break;
         default:
             RAISE_INTERNAL_ERROR;
@@ -2115,46 +2206,46 @@ static void generate_instructions(TacInstruction* node) {
 //             | Cvttsd2si(assembly_type, operand, operand) | Cvtsi2sd(assembly_type, operand, operand)
 //             | Unary(unary_operator, assembly_type, operand) | Binary(binary_operator, assembly_type, operand,
 //             operand) | Cmp(assembly_type, operand, operand) | Idiv(assembly_type, operand) | Div(assembly_type,
-//             operand) | Cdq(assembly_type) | Jmp(identifier) | JmpCC(cond_code, identifier) | SetCC(cond_code,
-//             operand) | Label(identifier) | Push(operand) | Call(identifier) | Ret
+//             operand) | Cdq(assembly_type) | RepStos(assembly_type) | Jmp(identifier) | JmpCC(cond_code,
+//             identifier) | SetCC(cond_code, operand) | Label(identifier) | Push(operand) | Call(identifier) | Ret
 static void generate_list_instructions(const std::vector<std::unique_ptr<TacInstruction>>& list_node) {
     for (const auto& instruction : list_node) {
         generate_instructions(instruction.get());
     }
 }
 
-static void generate_reg_param_function_instructions(const TIdentifier& name, REGISTER_KIND arg_register) {
+static void generate_reg_param_function_instructions(TIdentifier name, REGISTER_KIND arg_register) {
     std::shared_ptr<AsmOperand> src = generate_register(arg_register);
     std::shared_ptr<AsmOperand> dst;
     {
         TIdentifier dst_name = name;
         dst = std::make_shared<AsmPseudo>(std::move(dst_name));
     }
-    std::shared_ptr<AssemblyType> assembly_type_dst = convert_backend_assembly_type(name);
+    std::shared_ptr<AssemblyType> assembly_type_dst = convert_backend_assembly_type(get_variable_type(name));
     push_instruction(std::make_unique<AsmMov>(std::move(assembly_type_dst), std::move(src), std::move(dst)));
 }
 
-static void generate_stack_param_function_instructions(const TIdentifier& name, TLong stack_bytes) {
+static void generate_stack_param_function_instructions(TIdentifier name, TLong stack_bytes) {
     std::shared_ptr<AsmOperand> src = generate_memory(REGISTER_KIND::Bp, stack_bytes);
     std::shared_ptr<AsmOperand> dst;
     {
         TIdentifier dst_name = name;
         dst = std::make_shared<AsmPseudo>(std::move(dst_name));
     }
-    std::shared_ptr<AssemblyType> assembly_type_dst = convert_backend_assembly_type(name);
+    std::shared_ptr<AssemblyType> assembly_type_dst = convert_backend_assembly_type(get_variable_type(name));
     push_instruction(std::make_unique<AsmMov>(std::move(assembly_type_dst), std::move(src), std::move(dst)));
 }
 
 static void generate_8byte_reg_param_function_instructions(
-    const TIdentifier& name, TLong offset, Structure* struct_type, REGISTER_KIND arg_register) {
+    TIdentifier name, TLong offset, Structure* struct_type, REGISTER_KIND arg_register) {
     generate_8byte_return_fun_call_instructions(name, offset, struct_type, arg_register);
 }
 
 static void generate_8byte_stack_param_function_instructions(
-    const TIdentifier& name, TLong stack_bytes, TLong offset, Structure* struct_type) {
+    TIdentifier name, TLong stack_bytes, TLong offset, Structure* struct_type) {
     std::shared_ptr<AssemblyType> assembly_type_dst = generate_8byte_assembly_type(struct_type, offset);
     if (assembly_type_dst->type() == AST_T::ByteArray_t) {
-        TLong size = static_cast<ByteArray*>(assembly_type_dst.get())->size;
+        TLong size = ast_cast<ByteArray>(assembly_type_dst.get())->size;
         while (size > 0l) {
             std::shared_ptr<AsmOperand> src = generate_memory(REGISTER_KIND::Bp, stack_bytes);
             std::shared_ptr<AsmOperand> dst = std::make_shared<AsmPseudoMem>(name, offset);
@@ -2190,7 +2281,7 @@ static void generate_param_function_top_level(TacFunction* node, bool is_return_
     size_t sse_size = 0;
     TLong stack_bytes = 16l;
     for (const auto& param : node->params) {
-        if (frontend->symbol_table[param]->type_t->type() == AST_T::Double_t) {
+        if (get_variable_type(param)->type() == AST_T::Double_t) {
             if (sse_size < 8) {
                 generate_reg_param_function_instructions(param, context->ARG_SSE_REGISTERS[sse_size]);
                 sse_size++;
@@ -2200,7 +2291,7 @@ static void generate_param_function_top_level(TacFunction* node, bool is_return_
                 stack_bytes += 8l;
             }
         }
-        else if (frontend->symbol_table[param]->type_t->type() != AST_T::Structure_t) {
+        else if (get_variable_type(param)->type() != AST_T::Structure_t) {
             if (reg_size < 6) {
                 generate_reg_param_function_instructions(param, context->ARG_REGISTERS[reg_size]);
                 reg_size++;
@@ -2213,7 +2304,7 @@ static void generate_param_function_top_level(TacFunction* node, bool is_return_
         else {
             size_t struct_reg_size = 7;
             size_t struct_sse_size = 9;
-            Structure* struct_type = static_cast<Structure*>(frontend->symbol_table[param]->type_t.get());
+            Structure* struct_type = ast_cast<Structure>(get_variable_type(param));
             generate_structure_type_classes(struct_type);
             if (context->struct_8b_cls_map[struct_type->tag][0] != STRUCT_8B_CLS::MEMORY) {
                 struct_reg_size = 0;
@@ -2261,12 +2352,15 @@ static std::unique_ptr<AsmFunction> generate_function_top_level(TacFunction* nod
     bool is_return_memory = false;
 
     std::vector<std::unique_ptr<AsmInstruction>> body;
+    std::vector<std::shared_ptr<AssemblyType>> temp_types;
     {
+        std::vector<std::shared_ptr<Type>> tac_temp_types = std::move(node->temp_types);
         context->p_instructions = &body;
+        context->p_temp_types = &tac_temp_types;
 
-        FunType* fun_type = static_cast<FunType*>(frontend->symbol_table[node->name]->type_t.get());
+        FunType* fun_type = ast_cast<FunType>(frontend->symbol_table[node->name]->type_t.get());
         if (fun_type->ret_type->type() == AST_T::Structure_t) {
-            Structure* struct_type = static_cast<Structure*>(fun_type->ret_type.get());
+            Structure* struct_type = ast_cast<Structure>(fun_type->ret_type.get());
             generate_structure_type_classes(struct_type);
             if (context->struct_8b_cls_map[struct_type->tag][0] == STRUCT_8B_CLS::MEMORY) {
                 is_return_memory = true;
@@ -2283,10 +2377,16 @@ static std::unique_ptr<AsmFunction> generate_function_top_level(TacFunction* nod
 
         generate_list_instructions(node->body);
         context->p_instructions = nullptr;
+
+        temp_types.reserve(tac_temp_types.size());
+        for (const auto& temp_type : tac_temp_types) {
+            temp_types.push_back(convert_backend_assembly_type(temp_type.get()));
+        }
+        context->p_temp_types = nullptr;
     }
 
-    return std::make_unique<AsmFunction>(
-        std::move(name), std::move(is_global), std::move(is_return_memory), std::move(body));
+    return std::make_unique<AsmFunction>(std::move(name), std::move(is_global), std::move(is_return_memory),
+        std::move(body), std::move(temp_types));
 }
 
 static std::unique_ptr<AsmStaticVariable> generate_static_variable_top_level(TacStaticVariable* node) {
@@ -2303,7 +2403,7 @@ static void push_static_constant_top_levels(std::unique_ptr<AsmTopLevel>&& stati
 }
 
 static void generate_double_static_constant_top_level(
-    const TIdentifier& identifier, TDouble value, TULong binary, TInt byte) {
+    TIdentifier identifier, TDouble value, TULong binary, TInt byte) {
     TIdentifier name = identifier;
     TInt alignment = byte;
     std::shared_ptr<StaticInit> static_init = std::make_shared<DoubleInit>(value, binary);
@@ -2318,16 +2418,17 @@ static std::unique_ptr<AsmStaticConstant> generate_static_constant_top_level(Tac
     return std::make_unique<AsmStaticConstant>(std::move(name), std::move(alignment), std::move(static_init));
 }
 
-// top_level = Function(identifier, bool, bool, instruction*) | StaticVariable(identifier, bool, int, static_init*)
+// top_level = Function(identifier, bool, bool, instruction*, assembly_type*)
+//           | StaticVariable(identifier, bool, int, static_init*)
 //           | StaticConstant(identifier, int, static_init)
 static std::unique_ptr<AsmTopLevel> generate_top_level(TacTopLevel* node) {
     switch (node->type()) {
         case AST_T::TacFunction_t:
-            return generate_function_top_level(static_cast<TacFunction*>(node));
+            return generate_function_top_level(ast_cast<TacFunction>(node));
         case AST_T::TacStaticVariable_t:
-            return generate_static_variable_top_level(static_cast<TacStaticVariable*>(node));
+            return generate_static_variable_top_level(ast_cast<TacStaticVariable>(node));
         case AST_T::TacStaticConstant_t:
-            return generate_static_constant_top_level(static_cast<TacStaticConstant*>(node));
+            return generate_static_constant_top_level(ast_cast<TacStaticConstant>(node));
         default:
             RAISE_INTERNAL_ERROR;
     }
@@ -76,7 +76,7 @@ static void allocate_offset_pseudo_register(AssemblyType* assembly_type) {
 static void allocate_offset_pseudo_mem_register(AssemblyType* assembly_type) {
     switch (assembly_type->type()) {
         case AST_T::ByteArray_t: {
-            ByteArray* p_assembly_type = static_cast<ByteArray*>(assembly_type);
+            ByteArray* p_assembly_type = ast_cast<ByteArray>(assembly_type);
             align_offset_pseudo_register(p_assembly_type->size, p_assembly_type->alignment);
             break;
         }
@@ -85,10 +85,39 @@ static void allocate_offset_pseudo_mem_register(AssemblyType* assembly_type) {
     }
 }
 
+// Function temporaries are never static, and are allocated through a dense table indexed by temporary identifier
+static TLong allocate_temp_pseudo_register(TIdentifier name) {
+    size_t i = GET_TEMP_IDENTIFIER_INDEX(name);
+    if (context->temp_stack_bytes[i] == 0l) {
+        AssemblyType* assembly_type = (*context->p_temp_types)[i].get();
+        if (assembly_type->type() == AST_T::ByteArray_t) {
+            allocate_offset_pseudo_mem_register(assembly_type);
+        }
+        else {
+            allocate_offset_pseudo_register(assembly_type);
+        }
+        context->temp_stack_bytes[i] = context->stack_bytes;
+    }
+    return context->temp_stack_bytes[i];
+}
+
+static std::shared_ptr<AsmMemory> replace_temp_pseudo_register_memory(AsmPseudo* node) {
+    TLong value = -1l * allocate_temp_pseudo_register(node->name);
+    return generate_memory(REGISTER_KIND::Bp, std::move(value));
+}
+
+static std::shared_ptr<AsmMemory> replace_temp_pseudo_mem_register_memory(AsmPseudoMem* node) {
+    TLong value = -1l * (allocate_temp_pseudo_register(node->name) - node->offset);
+    return generate_memory(REGISTER_KIND::Bp, std::move(value));
+}
+
 static std::shared_ptr<AsmOperand> replace_operand_pseudo_register(AsmPseudo* node) {
+    if (IS_TEMP_IDENTIFIER(node->name)) {
+        return replace_temp_pseudo_register_memory(node);
+    }
     if (context->pseudo_stack_bytes_map.find(node->name) == context->pseudo_stack_bytes_map.end()) {
 
-        BackendObj* backend_obj = static_cast<BackendObj*>(backend->backend_symbol_table[node->name].get());
+        BackendObj* backend_obj = ast_cast<BackendObj>(backend->backend_symbol_table[node->name].get());
         if (backend_obj->is_static) {
             return replace_pseudo_register_data(node);
         }
@@ -102,9 +131,12 @@ static std::shared_ptr<AsmOperand> replace_operand_pseudo_register(AsmPseudo* no
 }
 
 static std::shared_ptr<AsmOperand> replace_operand_pseudo_mem_register(AsmPseudoMem* node) {
+    if (IS_TEMP_IDENTIFIER(node->name)) {
+        return replace_temp_pseudo_mem_register_memory(node);
+    }
     if (context->pseudo_stack_bytes_map.find(node->name) == context->pseudo_stack_bytes_map.end()) {
 
-        BackendObj* backend_obj = static_cast<BackendObj*>(backend->backend_symbol_table[node->name].get());
+        BackendObj* backend_obj = ast_cast<BackendObj>(backend->backend_symbol_table[node->name].get());
         if (backend_obj->is_static) {
             return replace_pseudo_mem_register_data(node);
         }
@@ -120,11 +152,11 @@ static std::shared_ptr<AsmOperand> replace_operand_pseudo_mem_register(AsmPseudo
 static void replace_mov_pseudo_registers(AsmMov* node) {
     switch (node->src->type()) {
         case AST_T::AsmPseudo_t: {
-            node->src = replace_operand_pseudo_register(static_cast<AsmPseudo*>(node->src.get()));
+            node->src = replace_operand_pseudo_register(ast_cast<AsmPseudo>(node->src.get()));
             break;
         }
         case AST_T::AsmPseudoMem_t: {
-            node->src = replace_operand_pseudo_mem_register(static_cast<AsmPseudoMem*>(node->src.get()));
+            node->src = replace_operand_pseudo_mem_register(ast_cast<AsmPseudoMem>(node->src.get()));
             break;
         }
         default:
@@ -132,11 +164,11 @@ static void replace_mov_pseudo_registers(AsmMov* node) {
     }
     switch (node->dst->type()) {
         case AST_T::AsmPseudo_t: {
-            node->dst = replace_operand_pseudo_register(static_cast<AsmPseudo*>(node->dst.get()));
+            node->dst = replace_operand_pseudo_register(ast_cast<AsmPseudo>(node->dst.get()));
             break;
         }
         case AST_T::AsmPseudoMem_t: {
-            node->dst = replace_operand_pseudo_mem_register(static_cast<AsmPseudoMem*>(node->dst.get()));
+            node->dst = replace_operand_pseudo_mem_register(ast_cast<AsmPseudoMem>(node->dst.get()));
             break;
         }
         default:
@@ -147,11 +179,11 @@ static void replace_mov_pseudo_registers(AsmMov* node) {
 static void replace_mov_sx_pseudo_registers(AsmMovSx* node) {
     switch (node->src->type()) {
         case AST_T::AsmPseudo_t: {
-            node->src = replace_operand_pseudo_register(static_cast<AsmPseudo*>(node->src.get()));
+            node->src = replace_operand_pseudo_register(ast_cast<AsmPseudo>(node->src.get()));
             break;
         }
         case AST_T::AsmPseudoMem_t: {
-            node->src = replace_operand_pseudo_mem_register(static_cast<AsmPseudoMem*>(node->src.get()));
+            node->src = replace_operand_pseudo_mem_register(ast_cast<AsmPseudoMem>(node->src.get()));
             break;
         }
         default:
@@ -159,11 +191,11 @@ static void replace_mov_sx_pseudo_registers(AsmMovSx* node) {
     }
     switch (node->dst->type()) {
         case AST_T::AsmPseudo_t: {
-            node->dst = replace_operand_pseudo_register(static_cast<AsmPseudo*>(node->dst.get()));
+            node->dst = replace_operand_pseudo_register(ast_cast<AsmPseudo>(node->dst.get()));
             break;
         }
         case AST_T::AsmPseudoMem_t: {
-            node->dst = replace_operand_pseudo_mem_register(static_cast<AsmPseudoMem*>(node->dst.get()));
+            node->dst = replace_operand_pseudo_mem_register(ast_cast<AsmPseudoMem>(node->dst.get()));
             break;
         }
         default:
@@ -174,11 +206,11 @@ static void replace_mov_sx_pseudo_registers(AsmMovSx* node) {
 static void replace_mov_zero_extend_pseudo_registers(AsmMovZeroExtend* node) {
     switch (node->src->type()) {
         case AST_T::AsmPseudo_t: {
-            node->src = replace_operand_pseudo_register(static_cast<AsmPseudo*>(node->src.get()));
+            node->src = replace_operand_pseudo_register(ast_cast<AsmPseudo>(node->src.get()));
             break;
         }
         case AST_T::AsmPseudoMem_t: {
-            node->src = replace_operand_pseudo_mem_register(static_cast<AsmPseudoMem*>(node->src.get()));
+            node->src = replace_operand_pseudo_mem_register(ast_cast<AsmPseudoMem>(node->src.get()));
             break;
         }
         default:
@@ -186,11 +218,11 @@ static void replace_mov_zero_extend_pseudo_registers(AsmMovZeroExtend* node) {
     }
     switch (node->dst->type()) {
         case AST_T::AsmPseudo_t: {
-            node->dst = replace_operand_pseudo_register(static_cast<AsmPseudo*>(node->dst.get()));
+            node->dst = replace_operand_pseudo_register(ast_cast<AsmPseudo>(node->dst.get()));
             break;
         }
         case AST_T::AsmPseudoMem_t: {
-            node->dst = replace_operand_pseudo_mem_register(static_cast<AsmPseudoMem*>(node->dst.get()));
+            node->dst = replace_operand_pseudo_mem_register(ast_cast<AsmPseudoMem>(node->dst.get()));
             break;
         }
         default:
@@ -201,11 +233,11 @@ static void replace_mov_zero_extend_pseudo_registers(AsmMovZeroExtend* node) {
 static void replace_lea_pseudo_registers(AsmLea* node) {
     switch (node->src->type()) {
         case AST_T::AsmPseudo_t: {
-            node->src = replace_operand_pseudo_register(static_cast<AsmPseudo*>(node->src.get()));
+            node->src = replace_operand_pseudo_register(ast_cast<AsmPseudo>(node->src.get()));
             break;
         }
         case AST_T::AsmPseudoMem_t: {
-            node->src = replace_operand_pseudo_mem_register(static_cast<AsmPseudoMem*>(node->src.get()));
+            node->src = replace_operand_pseudo_mem_register(ast_cast<AsmPseudoMem>(node->src.get()));
             break;
         }
         default:
@@ -213,11 +245,11 @@ static void replace_lea_pseudo_registers(AsmLea* node) {
     }
     switch (node->dst->type()) {
         case AST_T::AsmPseudo_t: {
-            node->dst = replace_operand_pseudo_register(static_cast<AsmPseudo*>(node->dst.get()));
+            node->dst = replace_operand_pseudo_register(ast_cast<AsmPseudo>(node->dst.get()));
             break;
         }
         case AST_T::AsmPseudoMem_t: {
-            node->dst = replace_operand_pseudo_mem_register(static_cast<AsmPseudoMem*>(node->dst.get()));
+            node->dst = replace_operand_pseudo_mem_register(ast_cast<AsmPseudoMem>(node->dst.get()));
             break;
         }
         default:
@@ -228,11 +260,11 @@ static void replace_lea_pseudo_registers(AsmLea* node) {
 static void replace_cvttsd2si_pseudo_registers(AsmCvttsd2si* node) {
     switch (node->src->type()) {
         case AST_T::AsmPseudo_t: {
-            node->src = replace_operand_pseudo_register(static_cast<AsmPseudo*>(node->src.get()));
+            node->src = replace_operand_pseudo_register(ast_cast<AsmPseudo>(node->src.get()));
             break;
         }
         case AST_T::AsmPseudoMem_t: {
-            node->src = replace_operand_pseudo_mem_register(static_cast<AsmPseudoMem*>(node->src.get()));
+            node->src = replace_operand_pseudo_mem_register(ast_cast<AsmPseudoMem>(node->src.get()));
             break;
         }
         default:
@@ -240,11 +272,11 @@ static void replace_cvttsd2si_pseudo_registers(AsmCvttsd2si* node) {
     }
     switch (node->dst->type()) {
         case AST_T::AsmPseudo_t: {
-            node->dst = replace_operand_pseudo_register(static_cast<AsmPseudo*>(node->dst.get()));
+            node->dst = replace_operand_pseudo_register(ast_cast<AsmPseudo>(node->dst.get()));
             break;
         }
         case AST_T::AsmPseudoMem_t: {
-            node->dst = replace_operand_pseudo_mem_register(static_cast<AsmPseudoMem*>(node->dst.get()));
+            node->dst = replace_operand_pseudo_mem_register(ast_cast<AsmPseudoMem>(node->dst.get()));
             break;
         }
         default:
@@ -255,11 +287,11 @@ static void replace_cvttsd2si_pseudo_registers(AsmCvttsd2si* node) {
 static void replace_cvtsi2sd_pseudo_registers(AsmCvtsi2sd* node) {
     switch (node->src->type()) {
         case AST_T::AsmPseudo_t: {
-            node->src = replace_operand_pseudo_register(static_cast<AsmPseudo*>(node->src.get()));
+            node->src = replace_operand_pseudo_register(ast_cast<AsmPseudo>(node->src.get()));
             break;
         }
         case AST_T::AsmPseudoMem_t: {
-            node->src = replace_operand_pseudo_mem_register(static_cast<AsmPseudoMem*>(node->src.get()));
+            node->src = replace_operand_pseudo_mem_register(ast_cast<AsmPseudoMem>(node->src.get()));
             break;
         }
         default:
@@ -267,11 +299,11 @@ static void replace_cvtsi2sd_pseudo_registers(AsmCvtsi2sd* node) {
     }
     switch (node->dst->type()) {
         case AST_T::AsmPseudo_t: {
-            node->dst = replace_operand_pseudo_register(static_cast<AsmPseudo*>(node->dst.get()));
+            node->dst = replace_operand_pseudo_register(ast_cast<AsmPseudo>(node->dst.get()));
             break;
         }
         case AST_T::AsmPseudoMem_t: {
-            node->dst = replace_operand_pseudo_mem_register(static_cast<AsmPseudoMem*>(node->dst.get()));
+            node->dst = replace_operand_pseudo_mem_register(ast_cast<AsmPseudoMem>(node->dst.get()));
             break;
         }
         default:
@@ -282,11 +314,11 @@ static void replace_cvtsi2sd_pseudo_registers(AsmCvtsi2sd* node) {
 static void replace_unary_pseudo_registers(AsmUnary* node) {
     switch (node->dst->type()) {
         case AST_T::AsmPseudo_t: {
-            node->dst = replace_operand_pseudo_register(static_cast<AsmPseudo*>(node->dst.get()));
+            node->dst = replace_operand_pseudo_register(ast_cast<AsmPseudo>(node->dst.get()));
             break;
         }
         case AST_T::AsmPseudoMem_t: {
-            node->dst = replace_operand_pseudo_mem_register(static_cast<AsmPseudoMem*>(node->dst.get()));
+            node->dst = replace_operand_pseudo_mem_register(ast_cast<AsmPseudoMem>(node->dst.get()));
             break;
         }
         default:
@@ -297,11 +329,11 @@ static void replace_unary_pseudo_registers(AsmUnary* node) {
 static void replace_binary_pseudo_registers(AsmBinary* node) {
     switch (node->src->type()) {
         case AST_T::AsmPseudo_t: {
-            node->src = replace_operand_pseudo_register(static_cast<AsmPseudo*>(node->src.get()));
+            node->src = replace_operand_pseudo_register(ast_cast<AsmPseudo>(node->src.get()));
             break;
         }
         case AST_T::AsmPseudoMem_t: {
-            node->src = replace_operand_pseudo_mem_register(static_cast<AsmPseudoMem*>(node->src.get()));
+            node->src = replace_operand_pseudo_mem_register(ast_cast<AsmPseudoMem>(node->src.get()));
             break;
         }
         default:
@@ -309,11 +341,11 @@ static void replace_binary_pseudo_registers(AsmBinary* node) {
     }
     switch (node->dst->type()) {
         case AST_T::AsmPseudo_t: {
-            node->dst = replace_operand_pseudo_register(static_cast<AsmPseudo*>(node->dst.get()));
+            node->dst = replace_operand_pseudo_register(ast_cast<AsmPseudo>(node->dst.get()));
             break;
         }
         case AST_T::AsmPseudoMem_t: {
-            node->dst = replace_operand_pseudo_mem_register(static_cast<AsmPseudoMem*>(node->dst.get()));
+            node->dst = replace_operand_pseudo_mem_register(ast_cast<AsmPseudoMem>(node->dst.get()));
             break;
         }
         default:
@@ -324,11 +356,11 @@ static void replace_binary_pseudo_registers(AsmBinary* node) {
 static void replace_cmp_pseudo_registers(AsmCmp* node) {
     switch (node->src->type()) {
         case AST_T::AsmPseudo_t: {
-            node->src = replace_operand_pseudo_register(static_cast<AsmPseudo*>(node->src.get()));
+            node->src = replace_operand_pseudo_register(ast_cast<AsmPseudo>(node->src.get()));
             break;
         }
         case AST_T::AsmPseudoMem_t: {
-            node->src = replace_operand_pseudo_mem_register(static_cast<AsmPseudoMem*>(node->src.get()));
+            node->src = replace_operand_pseudo_mem_register(ast_cast<AsmPseudoMem>(node->src.get()));
             break;
         }
         default:
@@ -336,11 +368,11 @@ static void replace_cmp_pseudo_registers(AsmCmp* node) {
     }
     switch (node->dst->type()) {
         case AST_T::AsmPseudo_t: {
-            node->dst = replace_operand_pseudo_register(static_cast<AsmPseudo*>(node->dst.get()));
+            node->dst = replace_operand_pseudo_register(ast_cast<AsmPseudo>(node->dst.get()));
             break;
         }
         case AST_T::AsmPseudoMem_t: {
-            node->dst = replace_operand_pseudo_mem_register(static_cast<AsmPseudoMem*>(node->dst.get()));
+            node->dst = replace_operand_pseudo_mem_register(ast_cast<AsmPseudoMem>(node->dst.get()));
             break;
         }
         default:
@@ -351,11 +383,11 @@ static void replace_cmp_pseudo_registers(AsmCmp* node) {
 static void replace_idiv_pseudo_registers(AsmIdiv* node) {
     switch (node->src->type()) {
         case AST_T::AsmPseudo_t: {
-            node->src = replace_operand_pseudo_register(static_cast<AsmPseudo*>(node->src.get()));
+            node->src = replace_operand_pseudo_register(ast_cast<AsmPseudo>(node->src.get()));
             break;
         }
         case AST_T::AsmPseudoMem_t: {
-            node->src = replace_operand_pseudo_mem_register(static_cast<AsmPseudoMem*>(node->src.get()));
+            node->src = replace_operand_pseudo_mem_register(ast_cast<AsmPseudoMem>(node->src.get()));
             break;
         }
         default:
@@ -366,11 +398,11 @@ static void replace_idiv_pseudo_registers(AsmIdiv* node) {
 static void replace_div_pseudo_registers(AsmDiv* node) {
     switch (node->src->type()) {
         case AST_T::AsmPseudo_t: {
-            node->src = replace_operand_pseudo_register(static_cast<AsmPseudo*>(node->src.get()));
+            node->src = replace_operand_pseudo_register(ast_cast<AsmPseudo>(node->src.get()));
             break;
         }
         case AST_T::AsmPseudoMem_t: {
-            node->src = replace_operand_pseudo_mem_register(static_cast<AsmPseudoMem*>(node->src.get()));
+            node->src = replace_operand_pseudo_mem_register(ast_cast<AsmPseudoMem>(node->src.get()));
             break;
         }
         default:
@@ -381,11 +413,11 @@ static void replace_div_pseudo_registers(AsmDiv* node) {
 static void replace_set_cc_pseudo_registers(AsmSetCC* node) {
     switch (node->dst->type()) {
         case AST_T::AsmPseudo_t: {
-            node->dst = replace_operand_pseudo_register(static_cast<AsmPseudo*>(node->dst.get()));
+            node->dst = replace_operand_pseudo_register(ast_cast<AsmPseudo>(node->dst.get()));
             break;
         }
         case AST_T::AsmPseudoMem_t: {
-            node->dst = replace_operand_pseudo_mem_register(static_cast<AsmPseudoMem*>(node->dst.get()));
+            node->dst = replace_operand_pseudo_mem_register(ast_cast<AsmPseudoMem>(node->dst.get()));
             break;
         }
         default:
@@ -396,11 +428,11 @@ static void replace_set_cc_pseudo_registers(AsmSetCC* node) {
 static void replace_push_pseudo_registers(AsmPush* node) {
     switch (node->src->type()) {
         case AST_T::AsmPseudo_t: {
-            node->src = replace_operand_pseudo_register(static_cast<AsmPseudo*>(node->src.get()));
+            node->src = replace_operand_pseudo_register(ast_cast<AsmPseudo>(node->src.get()));
             break;
         }
         case AST_T::AsmPseudoMem_t: {
-            node->src = replace_operand_pseudo_mem_register(static_cast<AsmPseudoMem*>(node->src.get()));
+            node->src = replace_operand_pseudo_mem_register(ast_cast<AsmPseudoMem>(node->src.get()));
             break;
         }
         default:
@@ -411,43 +443,43 @@ static void replace_push_pseudo_registers(AsmPush* node) {
 static void replace_pseudo_registers(AsmInstruction* node) {
     switch (node->type()) {
         case AST_T::AsmMov_t:
-            replace_mov_pseudo_registers(static_cast<AsmMov*>(node));
+            replace_mov_pseudo_registers(ast_cast<AsmMov>(node));
             break;
         case AST_T::AsmMovSx_t:
-            replace_mov_sx_pseudo_registers(static_cast<AsmMovSx*>(node));
+            replace_mov_sx_pseudo_registers(ast_cast<AsmMovSx>(node));
             break;
         case AST_T::AsmMovZeroExtend_t:
-            replace_mov_zero_extend_pseudo_registers(static_cast<AsmMovZeroExtend*>(node));
+            replace_mov_zero_extend_pseudo_registers(ast_cast<AsmMovZeroExtend>(node));
             break;
         case AST_T::AsmLea_t:
-            replace_lea_pseudo_registers(static_cast<AsmLea*>(node));
+            replace_lea_pseudo_registers(ast_cast<AsmLea>(node));
             break;
         case AST_T::AsmCvttsd2si_t:
-            replace_cvttsd2si_pseudo_registers(static_cast<AsmCvttsd2si*>(node));
+            replace_cvttsd2si_pseudo_registers(ast_cast<AsmCvttsd2si>(node));
             break;
         case AST_T::AsmCvtsi2sd_t:
-            replace_cvtsi2sd_pseudo_registers(static_cast<AsmCvtsi2sd*>(node));
+            replace_cvtsi2sd_pseudo_registers(ast_cast<AsmCvtsi2sd>(node));
             break;
         case AST_T::AsmUnary_t:
-            replace_unary_pseudo_registers(static_cast<AsmUnary*>(node));
+            replace_unary_pseudo_registers(ast_cast<AsmUnary>(node));
             break;
         case AST_T::AsmBinary_t:
-            replace_binary_pseudo_registers(static_cast<AsmBinary*>(node));
+            replace_binary_pseudo_registers(ast_cast<AsmBinary>(node));
             break;
         case AST_T::AsmCmp_t:
-            replace_cmp_pseudo_registers(static_cast<AsmCmp*>(node));
+            replace_cmp_pseudo_registers(ast_cast<AsmCmp>(node));
             break;
         case AST_T::AsmIdiv_t:
-            replace_idiv_pseudo_registers(static_cast<AsmIdiv*>(node));
+            replace_idiv_pseudo_registers(ast_cast<AsmIdiv>(node));
             break;
         case AST_T::AsmDiv_t:
-            replace_div_pseudo_registers(static_cast<AsmDiv*>(node));
+            replace_div_pseudo_registers(ast_cast<AsmDiv>(node));
             break;
         case AST_T::AsmSetCC_t:
-            replace_set_cc_pseudo_registers(static_cast<AsmSetCC*>(node));
+            replace_set_cc_pseudo_registers(ast_cast<AsmSetCC>(node));
             break;
         case AST_T::AsmPush_t:
-            replace_push_pseudo_registers(static_cast<AsmPush*>(node));
+            replace_push_pseudo_registers(ast_cast<AsmPush>(node));
             break;
         default:
             break;
@@ -465,7 +497,7 @@ std::unique_ptr<AsmBinary> allocate_stack_bytes(TLong byte) {
     {
         bool is_byte = byte <= 255l;
         bool is_quad = byte > 2147483647l;
-        TIdentifier value = std::to_string(byte);
+        TIdentifier value = make_identifier(std::to_string(byte));
         src = std::make_shared<AsmImm>(std::move(is_byte), std::move(is_quad), std::move(value));
     }
     std::shared_ptr<AsmOperand> dst = generate_register(REGISTER_KIND::Sp);
@@ -479,7 +511,7 @@ std::unique_ptr<AsmBinary> deallocate_stack_bytes(TLong byte) {
     {
         bool is_byte = byte <= 255l;
         bool is_quad = byte > 2147483647l;
-        TIdentifier value = std::to_string(byte);
+        TIdentifier value = make_identifier(std::to_string(byte));
         src = std::make_shared<AsmImm>(std::move(is_byte), std::move(is_quad), std::move(value));
     }
     std::shared_ptr<AsmOperand> dst = generate_register(REGISTER_KIND::Sp);
@@ -549,7 +581,7 @@ static void fix_mov_instruction(AsmMov* node) {
         }
     }
     else {
-        if (is_type_imm(node->src.get()) && static_cast<AsmImm*>(node->src.get())->is_quad) {
+        if (is_type_imm(node->src.get()) && ast_cast<AsmImm>(node->src.get())->is_quad) {
             fix_mov_from_quad_word_imm_to_any_instruction(node);
         }
         if (is_type_addr(node->src.get()) && is_type_addr(node->dst.get())) {
@@ -628,7 +660,7 @@ static void fix_mov_zero_extend_instruction(AsmMovZeroExtend* node) {
     }
     else {
         fix_mov_zero_extend_from_any_to_any_instruction(node);
-        AsmMov* node_2 = static_cast<AsmMov*>(context->p_fix_instructions->back().get());
+        AsmMov* node_2 = ast_cast<AsmMov>(context->p_fix_instructions->back().get());
         if (is_type_addr(node_2->dst.get())) {
             fix_mov_zero_extend_from_any_to_addr_instruction(node_2);
         }
@@ -749,7 +781,7 @@ static void fix_binary_instruction(AsmBinary* node) {
             case AST_T::AsmBitAnd_t:
             case AST_T::AsmBitOr_t:
             case AST_T::AsmBitXor_t: {
-                if (is_type_imm(node->src.get()) && static_cast<AsmImm*>(node->src.get())->is_quad) {
+                if (is_type_imm(node->src.get()) && ast_cast<AsmImm>(node->src.get())->is_quad) {
                     fix_binary_from_quad_word_imm_to_any_instruction(node);
                 }
                 if (is_type_addr(node->src.get()) && is_type_addr(node->dst.get())) {
@@ -758,7 +790,7 @@ static void fix_binary_instruction(AsmBinary* node) {
                 break;
             }
             case AST_T::AsmMult_t: {
-                if (is_type_imm(node->src.get()) && static_cast<AsmImm*>(node->src.get())->is_quad) {
+                if (is_type_imm(node->src.get()) && ast_cast<AsmImm>(node->src.get())->is_quad) {
                     fix_binary_from_quad_word_imm_to_any_instruction(node);
                 }
                 if (is_type_addr(node->dst.get())) {
@@ -769,7 +801,7 @@ static void fix_binary_instruction(AsmBinary* node) {
             case AST_T::AsmBitShiftLeft_t:
             case AST_T::AsmBitShiftRight_t:
             case AST_T::AsmBitShrArithmetic_t: {
-                if (is_type_imm(node->src.get()) && static_cast<AsmImm*>(node->src.get())->is_quad) {
+                if (is_type_imm(node->src.get()) && ast_cast<AsmImm>(node->src.get())->is_quad) {
                     fix_binary_from_quad_word_imm_to_any_instruction(node);
                 }
                 if (is_type_addr(node->src.get()) && is_type_addr(node->dst.get())) {
@@ -826,7 +858,7 @@ static void fix_cmp_instruction(AsmCmp* node) {
         }
     }
     else {
-        if (is_type_imm(node->src.get()) && static_cast<AsmImm*>(node->src.get())->is_quad) {
+        if (is_type_imm(node->src.get()) && ast_cast<AsmImm>(node->src.get())->is_quad) {
             fix_cmp_from_quad_word_imm_to_any_instruction(node);
         }
         if (is_type_addr(node->src.get()) && is_type_addr(node->dst.get())) {
@@ -888,7 +920,7 @@ static void fix_push_instruction(AsmPush* node) {
     // // pushq %xmm0
     // if src is register and src->reg is
     // fix_double_push_from_xmm_reg_to_any_instruction(node);
-    if (is_type_imm(node->src.get()) && static_cast<AsmImm*>(node->src.get())->is_quad) {
+    if (is_type_imm(node->src.get()) && ast_cast<AsmImm>(node->src.get())->is_quad) {
         fix_push_from_quad_word_imm_to_any_instruction(node);
     }
 }
@@ -896,37 +928,37 @@ static void fix_push_instruction(AsmPush* node) {
 static void fix_instruction(AsmInstruction* node) {
     switch (node->type()) {
         case AST_T::AsmMov_t:
-            fix_mov_instruction(static_cast<AsmMov*>(node));
+            fix_mov_instruction(ast_cast<AsmMov>(node));
             break;
         case AST_T::AsmMovSx_t:
-            fix_mov_sx_instruction(static_cast<AsmMovSx*>(node));
+            fix_mov_sx_instruction(ast_cast<AsmMovSx>(node));
             break;
         case AST_T::AsmMovZeroExtend_t:
-            fix_mov_zero_extend_instruction(static_cast<AsmMovZeroExtend*>(node));
+            fix_mov_zero_extend_instruction(ast_cast<AsmMovZeroExtend>(node));
             break;
         case AST_T::AsmLea_t:
-            fix_lea_instruction(static_cast<AsmLea*>(node));
+            fix_lea_instruction(ast_cast<AsmLea>(node));
             break;
         case AST_T::AsmCvttsd2si_t:
-            fix_cvttsd2si_instruction(static_cast<AsmCvttsd2si*>(node));
+            fix_cvttsd2si_instruction(ast_cast<AsmCvttsd2si>(node));
             break;
         case AST_T::AsmCvtsi2sd_t:
-            fix_cvtsi2sd_instruction(static_cast<AsmCvtsi2sd*>(node));
+            fix_cvtsi2sd_instruction(ast_cast<AsmCvtsi2sd>(node));
             break;
         case AST_T::AsmBinary_t:
-            fix_binary_instruction(static_cast<AsmBinary*>(node));
+            fix_binary_instruction(ast_cast<AsmBinary>(node));
             break;
         case AST_T::AsmCmp_t:
-            fix_cmp_instruction(static_cast<AsmCmp*>(node));
+            fix_cmp_instruction(ast_cast<AsmCmp>(node));
             break;
         case AST_T::AsmIdiv_t:
-            fix_idiv_instruction(static_cast<AsmIdiv*>(node));
+            fix_idiv_instruction(ast_cast<AsmIdiv>(node));
             break;
         case AST_T::AsmDiv_t:
-            fix_div_instruction(static_cast<AsmDiv*>(node));
+            fix_div_instruction(ast_cast<AsmDiv>(node));
             break;
         case AST_T::AsmPush_t:
-            fix_push_instruction(static_cast<AsmPush*>(node));
+            fix_push_instruction(ast_cast<AsmPush>(node));
             break;
         default:
             break;
@@ -941,8 +973,12 @@ static void fix_function_top_level(AsmFunction* node) {
     context->p_fix_instructions = &node->instructions;
     context->p_fix_instructions->emplace_back();
 
+    std::vector<std::shared_ptr<AssemblyType>> temp_types = std::move(node->temp_types);
+    context->p_temp_types = &temp_types;
+
     context->stack_bytes = node->is_return_memory ? 8l : 0l;
     context->pseudo_stack_bytes_map.clear();
+    context->temp_stack_bytes.assign(temp_types.size(), 0l);
     for (size_t i = 0; i < instructions.size(); ++i) {
         push_fix_instruction(std::move(instructions[i]));
 
@@ -951,12 +987,13 @@ static void fix_function_top_level(AsmFunction* node) {
     }
     fix_allocate_stack_bytes();
     context->p_fix_instructions = nullptr;
+    context->p_temp_types = nullptr;
 }
 
 static void fix_top_level(AsmTopLevel* node) {
     switch (node->type()) {
         case AST_T::AsmFunction_t:
-            fix_function_top_level(static_cast<AsmFunction*>(node));
+            fix_function_top_level(ast_cast<AsmFunction>(node));
             break;
         case AST_T::AsmStaticVariable_t:
             break;
@@ -15,46 +15,11 @@ static std::unique_ptr<SymtCvtContext> context;
 
 // Symbol table conversion
 
-TInt generate_scalar_type_alignment(Type* type) {
-    switch (type->type()) {
-        case AST_T::Char_t:
-        case AST_T::SChar_t:
-        case AST_T::UChar_t:
-            return 1;
-        case AST_T::Int_t:
-        case AST_T::UInt_t:
-            return 4;
-        case AST_T::Long_t:
-        case AST_T::Double_t:
-        case AST_T::ULong_t:
-        case AST_T::Pointer_t:
-            return 8;
-        default:
-            RAISE_INTERNAL_ERROR;
-    }
-}
-
-TInt generate_type_alignment(Type* type);
-
 static TInt generate_array_aggregate_type_alignment(Array* arr_type, TLong& size) {
-    size = arr_type->size;
-    while (arr_type->elem_type->type() == AST_T::Array_t) {
-        arr_type = static_cast<Array*>(arr_type->elem_type.get());
-        size *= arr_type->size;
-    }
-    TInt alignment;
-    {
-        alignment = generate_type_alignment(arr_type->elem_type.get());
-        if (arr_type->elem_type->type() == AST_T::Structure_t) {
-            Structure* struct_type = static_cast<Structure*>(arr_type->elem_type.get());
-            size *= frontend->struct_typedef_table[struct_type->tag]->size;
-        }
-        else {
-            size *= alignment;
-        }
-        if (size >= 16l) {
-            alignment = 16;
-        }
+    size = get_type_scale(arr_type);
+    TInt alignment = get_type_alignment(arr_type);
+    if (size >= 16l) {
+        alignment = 16;
     }
     return alignment;
 }
@@ -64,18 +29,12 @@ static TInt generate_array_aggregate_type_alignment(Array* arr_type) {
     return generate_array_aggregate_type_alignment(arr_type, size);
 }
 
-static TInt generate_structure_aggregate_type_alignment(Structure* struct_type) {
-    return frontend->struct_typedef_table[struct_type->tag]->alignment;
-}
-
 TInt generate_type_alignment(Type* type) {
     switch (type->type()) {
         case AST_T::Array_t:
-            return generate_array_aggregate_type_alignment(static_cast<Array*>(type));
-        case AST_T::Structure_t:
-            return generate_structure_aggregate_type_alignment(static_cast<Structure*>(type));
+            return generate_array_aggregate_type_alignment(ast_cast<Array>(type));
         default:
-            return generate_scalar_type_alignment(type);
+            return get_type_alignment(type);
     }
 }
 
@@ -99,8 +58,8 @@ static std::shared_ptr<ByteArray> convert_structure_aggregate_assembly_type(Stru
     return std::make_shared<ByteArray>(std::move(size), std::move(alignment));
 }
 
-std::shared_ptr<AssemblyType> convert_backend_assembly_type(const TIdentifier& name) {
-    switch (frontend->symbol_table[name]->type_t->type()) {
+std::shared_ptr<AssemblyType> convert_backend_assembly_type(Type* type) {
+    switch (type->type()) {
         case AST_T::Char_t:
         case AST_T::SChar_t:
         case AST_T::UChar_t:
@@ -115,11 +74,9 @@ std::shared_ptr<AssemblyType> convert_backend_assembly_type(const TIdentifier& n
         case AST_T::Double_t:
             return std::make_shared<BackendDouble>();
         case AST_T::Array_t:
-            return convert_array_aggregate_assembly_type(
-                static_cast<Array*>(frontend->symbol_table[name]->type_t.get()));
+            return convert_array_aggregate_assembly_type(ast_cast<Array>(type));
         case AST_T::Structure_t:
-            return convert_structure_aggregate_assembly_type(
-                static_cast<Structure*>(frontend->symbol_table[name]->type_t.get()));
+            return convert_structure_aggregate_assembly_type(ast_cast<Structure>(type));
         default:
             RAISE_INTERNAL_ERROR;
     }
@@ -146,7 +103,7 @@ static void convert_static_constant_top_level(AsmStaticConstant* node) {
             convert_double_static_constant();
             break;
         case AST_T::StringInit_t:
-            convert_string_static_constant(static_cast<Array*>(frontend->symbol_table[node->name]->type_t.get()));
+            convert_string_static_constant(ast_cast<Array>(frontend->symbol_table[node->name]->type_t.get()));
             break;
         default:
             RAISE_INTERNAL_ERROR;
@@ -156,7 +113,7 @@ static void convert_static_constant_top_level(AsmStaticConstant* node) {
 static void convert_top_level(AsmTopLevel* node) {
     switch (node->type()) {
         case AST_T::AsmStaticConstant_t:
-            convert_static_constant_top_level(static_cast<AsmStaticConstant*>(node));
+            convert_static_constant_top_level(ast_cast<AsmStaticConstant>(node));
             break;
         default:
             RAISE_INTERNAL_ERROR;
@@ -168,10 +125,10 @@ static void convert_fun_type(FunAttr* node) {
     convert_backend_symbol(std::make_unique<BackendFun>(std::move(is_defined)));
 }
 
-static void convert_obj_type(IdentifierAttr* node) {
-    if (node->type() != AST_T::ConstantAttr_t) {
-        std::shared_ptr<AssemblyType> assembly_type = convert_backend_assembly_type(*context->p_symbol);
-        bool is_static = node->type() == AST_T::StaticAttr_t;
+static void convert_obj_type(Symbol* node) {
+    if (node->attrs->type() != AST_T::ConstantAttr_t) {
+        std::shared_ptr<AssemblyType> assembly_type = convert_backend_assembly_type(node->type_t.get());
+        bool is_static = node->attrs->type() == AST_T::StaticAttr_t;
         convert_backend_symbol(std::make_unique<BackendObj>(std::move(is_static), false, std::move(assembly_type)));
     }
 }
@@ -181,10 +138,10 @@ static void convert_program(AsmProgram* node) {
     for (const auto& symbol : frontend->symbol_table) {
         context->p_symbol = &symbol.first;
         if (symbol.second->type_t->type() == AST_T::FunType_t) {
-            convert_fun_type(static_cast<FunAttr*>(symbol.second->attrs.get()));
+            convert_fun_type(ast_cast<FunAttr>(symbol.second->attrs.get()));
         }
         else {
-            convert_obj_type(symbol.second->attrs.get());
+            convert_obj_type(symbol.second.get());
         }
     }
 
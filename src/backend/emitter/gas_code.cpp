@@ -16,10 +16,10 @@
 // Gnu assembler code emission
 
 // identifier -> $ identifier
-static const std::string& emit_identifier(const TIdentifier& identifier) { return identifier; }
+static const std::string& emit_identifier(TIdentifier identifier) { return get_identifier_name(identifier); }
 
 // string -> $ string
-static const std::string& emit_string(const TIdentifier& string_constant) { return string_constant; }
+static const std::string& emit_string(TIdentifier string_constant) { return get_identifier_name(string_constant); }
 
 // char -> $ char
 static std::string emit_char(TChar value) { return std::to_string(value); }
@@ -242,7 +242,7 @@ static TInt emit_type_alignment_bytes(AssemblyType* node) {
         case AST_T::BackendDouble_t:
             return 8;
         case AST_T::ByteArray_t:
-            return static_cast<ByteArray*>(node)->alignment;
+            return ast_cast<ByteArray>(node)->alignment;
         default:
             RAISE_INTERNAL_ERROR;
     }
@@ -307,9 +307,9 @@ static std::string emit_memory_operand(AsmMemory* node) {
 
 static std::string emit_data_operand(AsmData* node) {
     std::string value = emit_identifier(node->name);
-    if (backend->backend_symbol_table.find(value) != backend->backend_symbol_table.end()
-        && backend->backend_symbol_table[value]->type() == AST_T::BackendObj_t
-        && static_cast<BackendObj*>(backend->backend_symbol_table[value].get())->is_constant) {
+    if (backend->backend_symbol_table.find(node->name) != backend->backend_symbol_table.end()
+        && backend->backend_symbol_table[node->name]->type() == AST_T::BackendObj_t
+        && ast_cast<BackendObj>(backend->backend_symbol_table[node->name].get())->is_constant) {
         value = ".L" + value;
     }
     if (node->offset != 0l) {
@@ -336,15 +336,15 @@ static std::string emit_indexed_operand(AsmIndexed* node) {
 static std::string emit_operand(AsmOperand* node, TInt byte) {
     switch (node->type()) {
         case AST_T::AsmImm_t:
-            return emit_imm_operand(static_cast<AsmImm*>(node));
+            return emit_imm_operand(ast_cast<AsmImm>(node));
         case AST_T::AsmRegister_t:
-            return emit_register_operand(static_cast<AsmRegister*>(node), byte);
+            return emit_register_operand(ast_cast<AsmRegister>(node), byte);
         case AST_T::AsmMemory_t:
-            return emit_memory_operand(static_cast<AsmMemory*>(node));
+            return emit_memory_operand(ast_cast<AsmMemory>(node));
         case AST_T::AsmData_t:
-            return emit_data_operand(static_cast<AsmData*>(node));
+            return emit_data_operand(ast_cast<AsmData>(node));
         case AST_T::AsmIndexed_t:
-            return emit_indexed_operand(static_cast<AsmIndexed*>(node));
+            return emit_indexed_operand(ast_cast<AsmIndexed>(node));
         default:
             RAISE_INTERNAL_ERROR;
     }
@@ -519,6 +519,11 @@ static void emit_cdq_instructions(AsmCdq* node) {
     }
 }
 
+static void emit_rep_stos_instructions(AsmRepStos* node) {
+    std::string t = emit_type_instruction_suffix(node->assembly_type.get());
+    emit("rep stos" + t, 2);
+}
+
 static void emit_jmp_instructions(AsmJmp* node) {
     std::string label = emit_identifier(node->target);
     emit("jmp .L" + label, 2);
@@ -583,58 +588,61 @@ static void emit_ret_instructions() {
 static void emit_instructions(AsmInstruction* node) {
     switch (node->type()) {
         case AST_T::AsmMov_t:
-            emit_mov_instructions(static_cast<AsmMov*>(node));
+            emit_mov_instructions(ast_cast<AsmMov>(node));
             break;
         case AST_T::AsmMovSx_t:
-            emit_mov_sx_instructions(static_cast<AsmMovSx*>(node));
+            emit_mov_sx_instructions(ast_cast<AsmMovSx>(node));
             break;
         case AST_T::AsmMovZeroExtend_t:
-            emit_mov_zero_extend_instructions(static_cast<AsmMovZeroExtend*>(node));
+            emit_mov_zero_extend_instructions(ast_cast<AsmMovZeroExtend>(node));
             break;
         case AST_T::AsmLea_t:
-            emit_lea_instructions(static_cast<AsmLea*>(node));
+            emit_lea_instructions(ast_cast<AsmLea>(node));
             break;
         case AST_T::AsmCvttsd2si_t:
-            emit_cvttsd2si_instructions(static_cast<AsmCvttsd2si*>(node));
+            emit_cvttsd2si_instructions(ast_cast<AsmCvttsd2si>(node));
             break;
         case AST_T::AsmCvtsi2sd_t:
-            emit_cvtsi2sd_instructions(static_cast<AsmCvtsi2sd*>(node));
+            emit_cvtsi2sd_instructions(ast_cast<AsmCvtsi2sd>(node));
             break;
         case AST_T::AsmUnary_t:
-            emit_unary_instructions(static_cast<AsmUnary*>(node));
+            emit_unary_instructions(ast_cast<AsmUnary>(node));
             break;
         case AST_T::AsmBinary_t:
-            emit_binary_instructions(static_cast<AsmBinary*>(node));
+            emit_binary_instructions(ast_cast<AsmBinary>(node));
             break;
         case AST_T::AsmCmp_t:
-            emit_cmp_instructions(static_cast<AsmCmp*>(node));
+            emit_cmp_instructions(ast_cast<AsmCmp>(node));
             break;
         case AST_T::AsmIdiv_t:
-            emit_idiv_instructions(static_cast<AsmIdiv*>(node));
+            emit_idiv_instructions(ast_cast<AsmIdiv>(node));
             break;
         case AST_T::AsmDiv_t:
-            emit_div_instructions(static_cast<AsmDiv*>(node));
+            emit_div_instructions(ast_cast<AsmDiv>(node));
             break;
         case AST_T::AsmCdq_t:
-            emit_cdq_instructions(static_cast<AsmCdq*>(node));
+            emit_cdq_instructions(ast_cast<AsmCdq>(node));
+            break;
+        case AST_T::AsmRepStos_t:
+            emit_rep_stos_instructions(ast_cast<AsmRepStos>(node));
             break;
         case AST_T::AsmJmp_t:
-            emit_jmp_instructions(static_cast<AsmJmp*>(node));
+            emit_jmp_instructions(ast_cast<AsmJmp>(node));
             break;
         case AST_T::AsmJmpCC_t:
-            emit_jmp_cc_instructions(static_cast<AsmJmpCC*>(node));
+            emit_jmp_cc_instructions(ast_cast<AsmJmpCC>(node));
             break;
         case AST_T::AsmSetCC_t:
-            emit_set_cc_instructions(static_cast<AsmSetCC*>(node));
+            emit_set_cc_instructions(ast_cast<AsmSetCC>(node));
             break;
         case AST_T::AsmLabel_t:
-            emit_label_instructions(static_cast<AsmLabel*>(node));
+            emit_label_instructions(ast_cast<AsmLabel>(node));
             break;
         case AST_T::AsmPush_t:
-            emit_push_instructions(static_cast<AsmPush*>(node));
+            emit_push_instructions(ast_cast<AsmPush>(node));
             break;
         case AST_T::AsmCall_t:
-            emit_call_instructions(static_cast<AsmCall*>(node));
+            emit_call_instructions(ast_cast<AsmCall>(node));
             break;
         case AST_T::AsmRet_t:
             emit_ret_instructions();
@@ -681,6 +689,34 @@ static void emit_function_top_level(AsmFunction* node) {
     emit_list_instructions(node->instructions);
 }
 
+// BytesInit(b*) -> $ .quad <b[0..8]>, ... for every 8 bytes, at most 8 per line
+//               -> $ .byte <b>, ...      for the bytes left
+static void emit_bytes_init_static_variable_top_level(BytesInit* node) {
+    size_t i = 0;
+    while (i + 8 <= node->bytes.size()) {
+        std::string values;
+        for (size_t j = 0; j < 8 && i + 8 <= node->bytes.size(); ++j) {
+            TULong value = 0ul;
+            for (size_t k = 8; k-- > 0;) {
+                value = (value << 8ul) | static_cast<TULong>(node->bytes[i + k]);
+            }
+            i += 8;
+            if (j > 0) {
+                values += ", ";
+            }
+            values += emit_ulong(value);
+        }
+        emit(".quad " + values, 2);
+    }
+    if (i < node->bytes.size()) {
+        std::string values = emit_uchar(node->bytes[i]);
+        for (++i; i < node->bytes.size(); ++i) {
+            values += ", " + emit_uchar(node->bytes[i]);
+        }
+        emit(".byte " + values, 2);
+    }
+}
+
 // CharInit(i)                         -> .byte <i>
 // IntInit(i)                          -> .long <i>
 // LongInit(i)                         -> .quad <i>
@@ -688,60 +724,64 @@ static void emit_function_top_level(AsmFunction* node) {
 // UIntInit(i)                         -> .long <i>
 // ULongInit(i)                        -> .quad <i>
 // ZeroInit(n)                         -> .zero <n>
+// BytesInit(b*)                       -> <bytes>
 // StringInit(s, b) if null terminated -> .asciz "<s>"
 //                                else -> .ascii "<s>"
 // PointerInit(label)                  -> .quad .L<label>
 static void emit_init_static_variable_top_level(StaticInit* node) {
     switch (node->type()) {
         case AST_T::CharInit_t: {
-            std::string value = emit_char(static_cast<CharInit*>(node)->value);
+            std::string value = emit_char(ast_cast<CharInit>(node)->value);
             emit(".byte " + value, 2);
             break;
         }
         case AST_T::IntInit_t: {
-            std::string value = emit_int(static_cast<IntInit*>(node)->value);
+            std::string value = emit_int(ast_cast<IntInit>(node)->value);
             emit(".long " + value, 2);
             break;
         }
         case AST_T::LongInit_t: {
-            std::string value = emit_long(static_cast<LongInit*>(node)->value);
+            std::string value = emit_long(ast_cast<LongInit>(node)->value);
             emit(".quad " + value, 2);
             break;
         }
         case AST_T::DoubleInit_t: {
-            std::string value = emit_double(static_cast<DoubleInit*>(node)->binary);
+            std::string value = emit_double(ast_cast<DoubleInit>(node)->binary);
             emit(".quad " + value, 2);
             break;
         }
         case AST_T::UCharInit_t: {
-            std::string value = emit_uchar(static_cast<UCharInit*>(node)->value);
+            std::string value = emit_uchar(ast_cast<UCharInit>(node)->value);
             emit(".byte " + value, 2);
             break;
         }
         case AST_T::UIntInit_t: {
-            std::string value = emit_uint(static_cast<UIntInit*>(node)->value);
+            std::string value = emit_uint(ast_cast<UIntInit>(node)->value);
             emit(".long " + value, 2);
             break;
         }
         case AST_T::ULongInit_t: {
-            std::string value = emit_ulong(static_cast<ULongInit*>(node)->value);
+            std::string value = emit_ulong(ast_cast<ULongInit>(node)->value);
             emit(".quad " + value, 2);
             break;
         }
         case AST_T::ZeroInit_t: {
-            std::string byte = emit_long(static_cast<ZeroInit*>(node)->byte);
+            std::string byte = emit_long(ast_cast<ZeroInit>(node)->byte);
             emit(".zero " + byte, 2);
             break;
         }
+        case AST_T::BytesInit_t:
+            emit_bytes_init_static_variable_top_level(ast_cast<BytesInit>(node));
+            break;
         case AST_T::StringInit_t: {
-            StringInit* p_node = static_cast<StringInit*>(node);
+            StringInit* p_node = ast_cast<StringInit>(node);
             std::string term = p_node->is_null_terminated ? "z" : "i";
             std::string value = emit_string(p_node->string_constant);
             emit(".asci" + term + " \"" + value + "\"", 2);
             break;
         }
         case AST_T::PointerInit_t: {
-            std::string name = emit_identifier(static_cast<PointerInit*>(node)->name);
+            std::string name = emit_identifier(ast_cast<PointerInit>(node)->name);
             emit(".quad .L" + name, 2);
             break;
         }
@@ -796,13 +836,13 @@ static void emit_top_level(AsmTopLevel* node) {
     emit("", 0);
     switch (node->type()) {
         case AST_T::AsmFunction_t:
-            emit_function_top_level(static_cast<AsmFunction*>(node));
+            emit_function_top_level(ast_cast<AsmFunction>(node));
             break;
         case AST_T::AsmStaticVariable_t:
-            emit_static_variable_top_level(static_cast<AsmStaticVariable*>(node));
+            emit_static_variable_top_level(ast_cast<AsmStaticVariable>(node));
             break;
         case AST_T::AsmStaticConstant_t:
-            emit_static_constant_top_level(static_cast<AsmStaticConstant*>(node));
+            emit_static_constant_top_level(ast_cast<AsmStaticConstant>(node));
             break;
         default:
             RAISE_INTERNAL_ERROR;
@@ -3,7 +3,6 @@
 #include "util/throw.hpp"
 
 #include "ast/ast.hpp"
-#include "ast/front_ast.hpp"
 #include "ast/front_symt.hpp"
 
 #include "frontend/intermediate/names.hpp"
@@ -12,26 +11,26 @@
 
 // Names
 
-TIdentifier resolve_label_identifier(const TIdentifier& label) {
-    TIdentifier name = label + "." + std::to_string(frontend->label_counter);
+TIdentifier resolve_label_identifier(TIdentifier label) {
+    std::string name = get_identifier_name(label) + "." + std::to_string(frontend->label_counter);
     frontend->label_counter++;
-    return name;
+    return make_identifier(name);
 }
 
-TIdentifier resolve_variable_identifier(const TIdentifier& variable) {
-    TIdentifier name = variable + "." + std::to_string(frontend->variable_counter);
+TIdentifier resolve_variable_identifier(TIdentifier variable) {
+    std::string name = get_identifier_name(variable) + "." + std::to_string(frontend->variable_counter);
     frontend->variable_counter++;
-    return name;
+    return make_identifier(name);
 }
 
-TIdentifier resolve_structure_tag(const TIdentifier& structure) {
-    TIdentifier name = structure + "." + std::to_string(frontend->structure_counter);
+TIdentifier resolve_structure_tag(TIdentifier structure) {
+    std::string name = get_identifier_name(structure) + "." + std::to_string(frontend->structure_counter);
     frontend->structure_counter++;
-    return name;
+    return make_identifier(name);
 }
 
 TIdentifier represent_label_identifier(LABEL_KIND label_kind) {
-    TIdentifier name;
+    std::string name;
     switch (label_kind) {
         case LABEL_KIND::Land_false: {
             name = "and_false";
@@ -119,73 +118,5 @@ TIdentifier represent_label_identifier(LABEL_KIND label_kind) {
 
     name += "." + std::to_string(frontend->label_counter);
     frontend->label_counter++;
-    return name;
-}
-
-TIdentifier represent_variable_identifier(CExp* node) {
-    TIdentifier name;
-    switch (node->type()) {
-        case AST_T::CConstant_t: {
-            name = "const";
-            break;
-        }
-        case AST_T::CString_t: {
-            name = "string";
-            break;
-        }
-        case AST_T::CVar_t: {
-            name = "var";
-            break;
-        }
-        case AST_T::CCast_t: {
-            name = "cast";
-            break;
-        }
-        case AST_T::CUnary_t: {
-            name = "unop";
-            break;
-        }
-        case AST_T::CBinary_t: {
-            name = "binop";
-            break;
-        }
-        case AST_T::CAssignment_t: {
-            name = "assign";
-            break;
-        }
-        case AST_T::CConditional_t: {
-            name = "ternop";
-            break;
-        }
-        case AST_T::CFunctionCall_t: {
-            name = "call";
-            break;
-        }
-        case AST_T::CDereference_t: {
-            name = "deref";
-            break;
-        }
-        case AST_T::CAddrOf_t: {
-            name = "addr";
-            break;
-        }
-        case AST_T::CSubscript_t: {
-            name = "subscr";
-            break;
-        }
-        case AST_T::CDot_t: {
-            name = "smem";
-            break;
-        }
-        case AST_T::CArrow_t: {
-            name = "sptr";
-            break;
-        }
-        default:
-            RAISE_INTERNAL_ERROR;
-    }
-
-    name += "." + std::to_string(frontend->variable_counter);
-    frontend->variable_counter++;
-    return name;
+    return make_identifier(name);
 }
@@ -37,18 +37,39 @@ static bool is_array_same_type(Array* arr_type_1, Array* arr_type_2) {
 }
 
 static bool is_structure_same_type(Structure* struct_type_1, Structure* struct_type_2) {
-    return struct_type_1->tag.compare(struct_type_2->tag) == 0;
+    return struct_type_1->tag == struct_type_2->tag;
 }
 
+static bool is_type_fun_contained(Type* type) {
+    switch (type->type()) {
+        case AST_T::Pointer_t:
+            return is_type_fun_contained(ast_cast<Pointer>(type)->ref_type.get());
+        case AST_T::Array_t:
+            return is_type_fun_contained(ast_cast<Array>(type)->elem_type.get());
+        case AST_T::FunType_t:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Interned types are the same only if they are the same node, types which contain a function type are not interned and
+// are compared by structure
 static bool is_same_type(Type* type_1, Type* type_2) {
-    if (type_1->type() == type_2->type()) {
+    if (type_1 == type_2) {
+        return true;
+    }
+    else if (!is_type_fun_contained(type_1) || !is_type_fun_contained(type_2)) {
+        return false;
+    }
+    else if (type_1->type() == type_2->type()) {
         switch (type_1->type()) {
             case AST_T::Pointer_t:
-                return is_pointer_same_type(static_cast<Pointer*>(type_1), static_cast<Pointer*>(type_2));
+                return is_pointer_same_type(ast_cast<Pointer>(type_1), ast_cast<Pointer>(type_2));
             case AST_T::Array_t:
-                return is_array_same_type(static_cast<Array*>(type_1), static_cast<Array*>(type_2));
+                return is_array_same_type(ast_cast<Array>(type_1), ast_cast<Array>(type_2));
             case AST_T::Structure_t:
-                return is_structure_same_type(static_cast<Structure*>(type_1), static_cast<Structure*>(type_2));
+                return is_structure_same_type(ast_cast<Structure>(type_1), ast_cast<Structure>(type_2));
             case AST_T::FunType_t:
                 RAISE_INTERNAL_ERROR;
             default:
@@ -154,7 +175,7 @@ static bool is_type_complete(Type* type) {
         case AST_T::Void_t:
             return false;
         case AST_T::Structure_t:
-            return is_struct_type_complete(static_cast<Structure*>(type));
+            return is_struct_type_complete(ast_cast<Structure>(type));
         default:
             return true;
     }
@@ -176,10 +197,10 @@ static void is_array_valid_type(Array* arr_type) {
 static void is_valid_type(Type* type) {
     switch (type->type()) {
         case AST_T::Pointer_t:
-            is_pointer_valid_type(static_cast<Pointer*>(type));
+            is_pointer_valid_type(ast_cast<Pointer>(type));
             break;
         case AST_T::Array_t:
-            is_array_valid_type(static_cast<Array*>(type));
+            is_array_valid_type(ast_cast<Array>(type));
             break;
         case AST_T::FunType_t:
             RAISE_INTERNAL_ERROR;
@@ -201,7 +222,7 @@ static bool is_exp_lvalue(CExp* node) {
         case AST_T::CArrow_t:
             return true;
         case AST_T::CDot_t:
-            return is_dot_exp_lvalue(static_cast<CDot*>(node));
+            return is_dot_exp_lvalue(ast_cast<CDot>(node));
         default:
             return false;
     }
@@ -210,101 +231,29 @@ static bool is_exp_lvalue(CExp* node) {
 static bool is_constant_null_pointer(CConstant* node) {
     switch (node->constant->type()) {
         case AST_T::CConstInt_t:
-            return static_cast<CConstInt*>(node->constant.get())->value == 0;
+            return ast_cast<CConstInt>(node->constant.get())->value == 0;
         case AST_T::CConstLong_t:
-            return static_cast<CConstLong*>(node->constant.get())->value == 0l;
+            return ast_cast<CConstLong>(node->constant.get())->value == 0l;
         case AST_T::CConstUInt_t:
-            return static_cast<CConstUInt*>(node->constant.get())->value == 0u;
+            return ast_cast<CConstUInt>(node->constant.get())->value == 0u;
         case AST_T::CConstULong_t:
-            return static_cast<CConstULong*>(node->constant.get())->value == 0ul;
+            return ast_cast<CConstULong>(node->constant.get())->value == 0ul;
         default:
             return false;
     }
 }
 
-static TInt get_scalar_type_size(Type* type) {
-    switch (type->type()) {
-        case AST_T::Char_t:
-        case AST_T::SChar_t:
-        case AST_T::UChar_t:
-            return 1;
-        case AST_T::Int_t:
-        case AST_T::UInt_t:
-            return 4;
-        case AST_T::Long_t:
-        case AST_T::Double_t:
-        case AST_T::ULong_t:
-        case AST_T::Pointer_t:
-            return 8;
-        default:
-            RAISE_INTERNAL_ERROR;
-    }
-}
-
-static TLong get_type_scale(Type* type);
-
-static TLong get_array_aggregate_type_scale(Array* arr_type) {
-    TLong size = arr_type->size;
-    while (arr_type->elem_type->type() == AST_T::Array_t) {
-        arr_type = static_cast<Array*>(arr_type->elem_type.get());
-        size *= arr_type->size;
-    }
-    return get_type_scale(arr_type->elem_type.get()) * size;
-}
-
-static TLong get_structure_aggregate_type_scale(Structure* struct_type) {
-    if (frontend->struct_typedef_table.find(struct_type->tag) == frontend->struct_typedef_table.end()) {
-        RAISE_INTERNAL_ERROR;
-    }
-    return frontend->struct_typedef_table[struct_type->tag]->size;
-}
-
-static TLong get_type_scale(Type* type) {
-    switch (type->type()) {
-        case AST_T::Array_t:
-            return get_array_aggregate_type_scale(static_cast<Array*>(type));
-        case AST_T::Structure_t:
-            return get_structure_aggregate_type_scale(static_cast<Structure*>(type));
-        default:
-            return get_scalar_type_size(type);
-    }
-}
-
-static TInt get_type_alignment(Type* type);
-
-static TInt get_array_aggregate_type_alignment(Array* arr_type) {
-    return get_type_alignment(arr_type->elem_type.get());
-}
-
-static TInt get_structure_aggregate_type_alignment(Structure* struct_type) {
-    if (frontend->struct_typedef_table.find(struct_type->tag) == frontend->struct_typedef_table.end()) {
-        RAISE_INTERNAL_ERROR;
-    }
-    return frontend->struct_typedef_table[struct_type->tag]->alignment;
-}
-
-static TInt get_type_alignment(Type* type) {
-    switch (type->type()) {
-        case AST_T::Array_t:
-            return get_array_aggregate_type_alignment(static_cast<Array*>(type));
-        case AST_T::Structure_t:
-            return get_structure_aggregate_type_alignment(static_cast<Structure*>(type));
-        default:
-            return get_scalar_type_size(type);
-    }
-}
-
 static std::shared_ptr<Type> get_joint_type(CExp* node_1, CExp* node_2) {
     if (is_type_character(node_1->exp_type.get())) {
         std::shared_ptr<Type> exp_type = std::move(node_1->exp_type);
-        node_1->exp_type = std::make_shared<Int>();
+        node_1->exp_type = get_scalar_type(AST_T::Int_t);
         std::shared_ptr<Type> joint_type = get_joint_type(node_1, node_2);
         node_1->exp_type = std::move(exp_type);
         return joint_type;
     }
     else if (is_type_character(node_2->exp_type.get())) {
         std::shared_ptr<Type> exp_type_2 = std::move(node_2->exp_type);
-        node_2->exp_type = std::make_shared<Int>();
+        node_2->exp_type = get_scalar_type(AST_T::Int_t);
         std::shared_ptr<Type> joint_type = get_joint_type(node_1, node_2);
         node_2->exp_type = std::move(exp_type_2);
         return joint_type;
@@ -313,7 +262,7 @@ static std::shared_ptr<Type> get_joint_type(CExp* node_1, CExp* node_2) {
         return node_1->exp_type;
     }
     else if (node_1->exp_type->type() == AST_T::Double_t || node_2->exp_type->type() == AST_T::Double_t) {
-        return std::make_shared<Double>();
+        return get_scalar_type(AST_T::Double_t);
     }
 
     TInt type_size_1 = get_scalar_type_size(node_1->exp_type.get());
@@ -338,19 +287,19 @@ static std::shared_ptr<Type> get_joint_pointer_type(CExp* node_1, CExp* node_2)
     if (is_same_type(node_1->exp_type.get(), node_2->exp_type.get())) {
         return node_1->exp_type;
     }
-    else if (node_1->type() == AST_T::CConstant_t && is_constant_null_pointer(static_cast<CConstant*>(node_1))) {
+    else if (node_1->type() == AST_T::CConstant_t && is_constant_null_pointer(ast_cast<CConstant>(node_1))) {
         return node_2->exp_type;
     }
-    else if (node_2->type() == AST_T::CConstant_t && is_constant_null_pointer(static_cast<CConstant*>(node_2))) {
+    else if (node_2->type() == AST_T::CConstant_t && is_constant_null_pointer(ast_cast<CConstant>(node_2))) {
         return node_1->exp_type;
     }
     else if (node_1->exp_type->type() == AST_T::Pointer_t
-             && static_cast<Pointer*>(node_1->exp_type.get())->ref_type->type() == AST_T::Void_t
+             && ast_cast<Pointer>(node_1->exp_type.get())->ref_type->type() == AST_T::Void_t
              && node_2->exp_type->type() == AST_T::Pointer_t) {
         return node_1->exp_type;
     }
     else if (node_2->exp_type->type() == AST_T::Pointer_t
-             && static_cast<Pointer*>(node_2->exp_type.get())->ref_type->type() == AST_T::Void_t
+             && ast_cast<Pointer>(node_2->exp_type.get())->ref_type->type() == AST_T::Void_t
              && node_1->exp_type->type() == AST_T::Pointer_t) {
         return node_2->exp_type;
     }
@@ -366,13 +315,13 @@ static size_t get_compound_init_line(CInitializer* node) {
         RAISE_INTERNAL_ERROR;
     }
     do {
-        node = static_cast<CCompoundInit*>(node)->initializers[0].get();
+        node = ast_cast<CCompoundInit>(node)->initializers[0].get();
     }
     while (node->type() == AST_T::CCompoundInit_t);
     if (node->type() != AST_T::CSingleInit_t) {
         RAISE_INTERNAL_ERROR;
     }
-    return static_cast<CSingleInit*>(node)->exp->line;
+    return ast_cast<CSingleInit>(node)->exp->line;
 }
 
 static void resolve_struct_type(Type* type);
@@ -380,25 +329,25 @@ static void resolve_struct_type(Type* type);
 static void checktype_constant_expression(CConstant* node) {
     switch (node->constant->type()) {
         case AST_T::CConstChar_t:
-            node->exp_type = std::make_shared<Char>();
+            node->exp_type = get_scalar_type(AST_T::Char_t);
             break;
         case AST_T::CConstInt_t:
-            node->exp_type = std::make_shared<Int>();
+            node->exp_type = get_scalar_type(AST_T::Int_t);
             break;
         case AST_T::CConstLong_t:
-            node->exp_type = std::make_shared<Long>();
+            node->exp_type = get_scalar_type(AST_T::Long_t);
             break;
         case AST_T::CConstDouble_t:
-            node->exp_type = std::make_shared<Double>();
+            node->exp_type = get_scalar_type(AST_T::Double_t);
             break;
         case AST_T::CConstUChar_t:
-            node->exp_type = std::make_shared<UChar>();
+            node->exp_type = get_scalar_type(AST_T::UChar_t);
             break;
         case AST_T::CConstUInt_t:
-            node->exp_type = std::make_shared<UInt>();
+            node->exp_type = get_scalar_type(AST_T::UInt_t);
             break;
         case AST_T::CConstULong_t:
-            node->exp_type = std::make_shared<ULong>();
+            node->exp_type = get_scalar_type(AST_T::ULong_t);
             break;
         default:
             RAISE_INTERNAL_ERROR;
@@ -407,8 +356,8 @@ static void checktype_constant_expression(CConstant* node) {
 
 static void checktype_string_expression(CString* node) {
     TLong size = static_cast<TLong>(node->literal->value.size()) + 1l;
-    std::shared_ptr<Type> elem_type = std::make_shared<Char>();
-    node->exp_type = std::make_shared<Array>(std::move(size), std::move(elem_type));
+    std::shared_ptr<Type> elem_type = get_scalar_type(AST_T::Char_t);
+    node->exp_type = get_array_type(std::move(size), std::move(elem_type));
 }
 
 static void checktype_var_expression(CVar* node) {
@@ -422,6 +371,7 @@ static void checktype_var_expression(CVar* node) {
 static void checktype_cast_expression(CCast* node) {
     errors->line_buffer = node->line;
     resolve_struct_type(node->target_type.get());
+    intern_type(node->target_type);
     if (node->target_type->type() != AST_T::Void_t
         && ((node->exp->exp_type->type() == AST_T::Double_t && node->target_type->type() == AST_T::Pointer_t)
             || (node->exp->exp_type->type() == AST_T::Pointer_t && node->target_type->type() == AST_T::Double_t)
@@ -446,16 +396,16 @@ static std::unique_ptr<CCast> cast_by_assignment(std::unique_ptr<CExp> node, std
         return cast_expression(std::move(node), exp_type);
     }
     else if (node->type() == AST_T::CConstant_t && exp_type->type() == AST_T::Pointer_t
-             && is_constant_null_pointer(static_cast<CConstant*>(node.get()))) {
+             && is_constant_null_pointer(ast_cast<CConstant>(node.get()))) {
         return cast_expression(std::move(node), exp_type);
     }
     else if (exp_type->type() == AST_T::Pointer_t
-             && static_cast<Pointer*>(exp_type.get())->ref_type->type() == AST_T::Void_t
+             && ast_cast<Pointer>(exp_type.get())->ref_type->type() == AST_T::Void_t
              && node->exp_type->type() == AST_T::Pointer_t) {
         return cast_expression(std::move(node), exp_type);
     }
     else if (node->exp_type->type() == AST_T::Pointer_t
-             && static_cast<Pointer*>(node->exp_type.get())->ref_type->type() == AST_T::Void_t
+             && ast_cast<Pointer>(node->exp_type.get())->ref_type->type() == AST_T::Void_t
              && exp_type->type() == AST_T::Pointer_t) {
         return cast_expression(std::move(node), exp_type);
     }
@@ -473,7 +423,7 @@ static void checktype_unary_not_expression(CUnary* node) {
             node->line);
     }
 
-    node->exp_type = std::make_shared<Int>();
+    node->exp_type = get_scalar_type(AST_T::Int_t);
 }
 
 static void checktype_unary_complement_expression(CUnary* node) {
@@ -492,7 +442,7 @@ static void checktype_unary_complement_expression(CUnary* node) {
         case AST_T::Char_t:
         case AST_T::SChar_t:
         case AST_T::UChar_t: {
-            std::shared_ptr<Type> promote_type = std::make_shared<Int>();
+            std::shared_ptr<Type> promote_type = get_scalar_type(AST_T::Int_t);
             node->exp = cast_expression(std::move(node->exp), promote_type);
             break;
         }
@@ -513,7 +463,7 @@ static void checktype_unary_negate_expression(CUnary* node) {
         case AST_T::Char_t:
         case AST_T::SChar_t:
         case AST_T::UChar_t: {
-            std::shared_ptr<Type> promote_type = std::make_shared<Int>();
+            std::shared_ptr<Type> promote_type = get_scalar_type(AST_T::Int_t);
             node->exp = cast_expression(std::move(node->exp), promote_type);
             break;
         }
@@ -545,9 +495,9 @@ static void checktype_binary_arithmetic_add_expression(CBinary* node) {
         common_type = get_joint_type(node->exp_left.get(), node->exp_right.get());
     }
     else if (node->exp_left->exp_type->type() == AST_T::Pointer_t
-             && is_type_complete(static_cast<Pointer*>(node->exp_left->exp_type.get())->ref_type.get())
+             && is_type_complete(ast_cast<Pointer>(node->exp_left->exp_type.get())->ref_type.get())
              && is_type_integer(node->exp_right->exp_type.get())) {
-        common_type = std::make_shared<Long>();
+        common_type = get_scalar_type(AST_T::Long_t);
         if (!is_same_type(node->exp_right->exp_type.get(), common_type.get())) {
             node->exp_right = cast_expression(std::move(node->exp_right), common_type);
         }
@@ -555,8 +505,8 @@ static void checktype_binary_arithmetic_add_expression(CBinary* node) {
         return;
     }
     else if (is_type_integer(node->exp_left->exp_type.get()) && node->exp_right->exp_type->type() == AST_T::Pointer_t
-             && is_type_complete(static_cast<Pointer*>(node->exp_right->exp_type.get())->ref_type.get())) {
-        common_type = std::make_shared<Long>();
+             && is_type_complete(ast_cast<Pointer>(node->exp_right->exp_type.get())->ref_type.get())) {
+        common_type = get_scalar_type(AST_T::Long_t);
         if (!is_same_type(node->exp_left->exp_type.get(), common_type.get())) {
             node->exp_left = cast_expression(std::move(node->exp_left), common_type);
         }
@@ -586,9 +536,9 @@ static void checktype_binary_arithmetic_subtract_expression(CBinary* node) {
         common_type = get_joint_type(node->exp_left.get(), node->exp_right.get());
     }
     else if (node->exp_left->exp_type->type() == AST_T::Pointer_t
-             && is_type_complete(static_cast<Pointer*>(node->exp_left->exp_type.get())->ref_type.get())) {
+             && is_type_complete(ast_cast<Pointer>(node->exp_left->exp_type.get())->ref_type.get())) {
         if (is_type_integer(node->exp_right->exp_type.get())) {
-            common_type = std::make_shared<Long>();
+            common_type = get_scalar_type(AST_T::Long_t);
             if (!is_same_type(node->exp_right->exp_type.get(), common_type.get())) {
                 node->exp_right = cast_expression(std::move(node->exp_right), common_type);
             }
@@ -597,8 +547,8 @@ static void checktype_binary_arithmetic_subtract_expression(CBinary* node) {
         }
         else if (is_same_type(node->exp_left->exp_type.get(), node->exp_right->exp_type.get())
                  && !(node->exp_left->type() == AST_T::CConstant_t
-                      && is_constant_null_pointer(static_cast<CConstant*>(node->exp_left.get())))) {
-            common_type = std::make_shared<Long>();
+                      && is_constant_null_pointer(ast_cast<CConstant>(node->exp_left.get())))) {
+            common_type = get_scalar_type(AST_T::Long_t);
             node->exp_type = std::move(common_type);
             return;
         }
@@ -680,7 +630,7 @@ static void checktype_binary_arithmetic_bitshift_expression(CBinary* node) {
     }
 
     else if (is_type_character(node->exp_left->exp_type.get())) {
-        std::shared_ptr<Type> left_type = std::make_shared<Int>();
+        std::shared_ptr<Type> left_type = get_scalar_type(AST_T::Int_t);
         node->exp_left = cast_expression(std::move(node->exp_left), left_type);
     }
     if (!is_same_type(node->exp_left->exp_type.get(), node->exp_right->exp_type.get())) {
@@ -710,7 +660,7 @@ static void checktype_binary_logical_expression(CBinary* node) {
             node->line);
     }
 
-    node->exp_type = std::make_shared<Int>();
+    node->exp_type = get_scalar_type(AST_T::Int_t);
 }
 
 static void checktype_binary_comparison_equality_expression(CBinary* node) {
@@ -736,7 +686,7 @@ static void checktype_binary_comparison_equality_expression(CBinary* node) {
     if (!is_same_type(node->exp_right->exp_type.get(), common_type.get())) {
         node->exp_right = cast_expression(std::move(node->exp_right), common_type);
     }
-    node->exp_type = std::make_shared<Int>();
+    node->exp_type = get_scalar_type(AST_T::Int_t);
 }
 
 static void checktype_binary_comparison_relational_expression(CBinary* node) {
@@ -744,9 +694,9 @@ static void checktype_binary_comparison_relational_expression(CBinary* node) {
         || (node->exp_left->exp_type->type() == AST_T::Pointer_t
             && (!is_same_type(node->exp_left->exp_type.get(), node->exp_right->exp_type.get())
                 || (node->exp_left->type() == AST_T::CConstant_t
-                    && is_constant_null_pointer(static_cast<CConstant*>(node->exp_left.get())))
+                    && is_constant_null_pointer(ast_cast<CConstant>(node->exp_left.get())))
                 || (node->exp_right->type() == AST_T::CConstant_t
-                    && is_constant_null_pointer(static_cast<CConstant*>(node->exp_right.get())))))) {
+                    && is_constant_null_pointer(ast_cast<CConstant>(node->exp_right.get())))))) {
         RAISE_RUNTIME_ERROR_AT_LINE(
             GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::binary_on_invalid_operand_types,
                 get_binary_op_hr(node->binary_op.get()), get_type_hr(node->exp_left->exp_type.get()),
@@ -761,7 +711,7 @@ static void checktype_binary_comparison_relational_expression(CBinary* node) {
     if (!is_same_type(node->exp_right->exp_type.get(), common_type.get())) {
         node->exp_right = cast_expression(std::move(node->exp_right), common_type);
     }
-    node->exp_type = std::make_shared<Int>();
+    node->exp_type = get_scalar_type(AST_T::Int_t);
 }
 
 static void checktype_binary_expression(CBinary* node) {
@@ -826,14 +776,14 @@ static void checktype_assignment_expression(CAssignment* node) {
         if (node->exp_right->type() != AST_T::CBinary_t) {
             RAISE_INTERNAL_ERROR;
         }
-        CExp* exp_left = static_cast<CBinary*>(node->exp_right.get())->exp_left.get();
+        CExp* exp_left = ast_cast<CBinary>(node->exp_right.get())->exp_left.get();
         if (exp_left->type() == AST_T::CCast_t) {
-            exp_left = static_cast<CCast*>(exp_left)->exp.get();
+            exp_left = ast_cast<CCast>(exp_left)->exp.get();
         }
         if (!is_exp_lvalue(exp_left)) {
             RAISE_RUNTIME_ERROR_AT_LINE(
                 GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::assignment_to_rvalue,
-                    get_assignment_hr(static_cast<CBinary*>(node->exp_right.get())->binary_op.get())),
+                    get_assignment_hr(ast_cast<CBinary>(node->exp_right.get())->binary_op.get())),
                 node->line);
         }
         else if (!is_same_type(node->exp_right->exp_type.get(), exp_left->exp_type.get())) {
@@ -894,7 +844,7 @@ static void checktype_function_call_expression(CFunctionCall* node) {
         RAISE_RUNTIME_ERROR_AT_LINE(
             GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::variable_used_as_function, get_name_hr(node->name)), node->line);
     }
-    FunType* fun_type = static_cast<FunType*>(frontend->symbol_table[node->name]->type_t.get());
+    FunType* fun_type = ast_cast<FunType>(frontend->symbol_table[node->name]->type_t.get());
     if (fun_type->param_types.size() != node->args.size()) {
         RAISE_RUNTIME_ERROR_AT_LINE(
             GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::function_called_with_wrong_number_of_arguments,
@@ -916,7 +866,7 @@ static void checktype_dereference_expression(CDereference* node) {
             GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::dereference_non_pointer, get_type_hr(node->exp->exp_type.get())),
             node->line);
     }
-    node->exp_type = static_cast<Pointer*>(node->exp->exp_type.get())->ref_type;
+    node->exp_type = ast_cast<Pointer>(node->exp->exp_type.get())->ref_type;
 }
 
 static void checktype_addrof_expression(CAddrOf* node) {
@@ -924,28 +874,28 @@ static void checktype_addrof_expression(CAddrOf* node) {
         RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::address_of_rvalue), node->line);
     }
     std::shared_ptr<Type> ref_type = node->exp->exp_type;
-    node->exp_type = std::make_shared<Pointer>(std::move(ref_type));
+    node->exp_type = get_pointer_type(std::move(ref_type));
 }
 
 static void checktype_subscript_expression(CSubscript* node) {
     std::shared_ptr<Type> ref_type;
     if (node->primary_exp->exp_type->type() == AST_T::Pointer_t
-        && is_type_complete(static_cast<Pointer*>(node->primary_exp->exp_type.get())->ref_type.get())
+        && is_type_complete(ast_cast<Pointer>(node->primary_exp->exp_type.get())->ref_type.get())
         && is_type_integer(node->subscript_exp->exp_type.get())) {
-        std::shared_ptr<Type> subscript_type = std::make_shared<Long>();
+        std::shared_ptr<Type> subscript_type = get_scalar_type(AST_T::Long_t);
         if (!is_same_type(node->subscript_exp->exp_type.get(), subscript_type.get())) {
             node->subscript_exp = cast_expression(std::move(node->subscript_exp), subscript_type);
         }
-        ref_type = static_cast<Pointer*>(node->primary_exp->exp_type.get())->ref_type;
+        ref_type = ast_cast<Pointer>(node->primary_exp->exp_type.get())->ref_type;
     }
     else if (is_type_integer(node->primary_exp->exp_type.get())
              && node->subscript_exp->exp_type->type() == AST_T::Pointer_t
-             && is_type_complete(static_cast<Pointer*>(node->subscript_exp->exp_type.get())->ref_type.get())) {
-        std::shared_ptr<Type> primary_type = std::make_shared<Long>();
+             && is_type_complete(ast_cast<Pointer>(node->subscript_exp->exp_type.get())->ref_type.get())) {
+        std::shared_ptr<Type> primary_type = get_scalar_type(AST_T::Long_t);
         if (!is_same_type(node->primary_exp->exp_type.get(), primary_type.get())) {
             node->primary_exp = cast_expression(std::move(node->primary_exp), primary_type);
         }
-        ref_type = static_cast<Pointer*>(node->subscript_exp->exp_type.get())->ref_type;
+        ref_type = ast_cast<Pointer>(node->subscript_exp->exp_type.get())->ref_type;
     }
     else {
         RAISE_RUNTIME_ERROR_AT_LINE(
@@ -962,19 +912,20 @@ static void checktype_sizeof_expression(CSizeOf* node) {
                                         get_type_hr(node->exp->exp_type.get())),
             node->line);
     }
-    node->exp_type = std::make_shared<ULong>();
+    node->exp_type = get_scalar_type(AST_T::ULong_t);
 }
 
 static void checktype_sizeoft_expression(CSizeOfT* node) {
     errors->line_buffer = node->line;
     resolve_struct_type(node->target_type.get());
+    intern_type(node->target_type);
     if (!is_type_complete(node->target_type.get())) {
         RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::get_size_of_incomplete_type,
                                         get_type_hr(node->target_type.get())),
             node->line);
     }
     is_valid_type(node->target_type.get());
-    node->exp_type = std::make_shared<ULong>();
+    node->exp_type = get_scalar_type(AST_T::ULong_t);
 }
 
 static void checktype_dot_expression(CDot* node) {
@@ -983,14 +934,15 @@ static void checktype_dot_expression(CDot* node) {
                                         get_name_hr(node->member), get_type_hr(node->structure->exp_type.get())),
             node->line);
     }
-    Structure* struct_type = static_cast<Structure*>(node->structure->exp_type.get());
-    if (frontend->struct_typedef_table[struct_type->tag]->members.find(node->member)
-        == frontend->struct_typedef_table[struct_type->tag]->members.end()) {
+    Structure* struct_type = ast_cast<Structure>(node->structure->exp_type.get());
+    StructMember* member =
+        get_struct_typedef_member(frontend->struct_typedef_table[struct_type->tag].get(), node->member);
+    if (!member) {
         RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::member_not_in_structure_type,
                                         get_type_hr(struct_type), get_name_hr(node->member)),
             node->line);
     }
-    node->exp_type = frontend->struct_typedef_table[struct_type->tag]->members[node->member]->member_type;
+    node->exp_type = member->member_type;
 }
 
 static void checktype_arrow_expression(CArrow* node) {
@@ -999,25 +951,26 @@ static void checktype_arrow_expression(CArrow* node) {
                                         get_name_hr(node->member), get_type_hr(node->pointer->exp_type.get())),
             node->line);
     }
-    Pointer* ptr_type = static_cast<Pointer*>(node->pointer->exp_type.get());
+    Pointer* ptr_type = ast_cast<Pointer>(node->pointer->exp_type.get());
     if (ptr_type->ref_type->type() != AST_T::Structure_t) {
         RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::arrow_on_non_pointer_to_structure_type,
                                         get_name_hr(node->member), get_type_hr(node->pointer->exp_type.get())),
             node->line);
     }
-    Structure* struct_type = static_cast<Structure*>(ptr_type->ref_type.get());
-    if (frontend->struct_typedef_table.find(struct_type->tag) == frontend->struct_typedef_table.end()) {
+    Structure* struct_type = ast_cast<Structure>(ptr_type->ref_type.get());
+    auto struct_typedef = frontend->struct_typedef_table.find(struct_type->tag);
+    if (struct_typedef == frontend->struct_typedef_table.end()) {
         RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::arrow_on_incomplete_structure_type,
                                         get_name_hr(node->member), get_type_hr(struct_type)),
             node->line);
     }
-    else if (frontend->struct_typedef_table[struct_type->tag]->members.find(node->member)
-             == frontend->struct_typedef_table[struct_type->tag]->members.end()) {
+    StructMember* member = get_struct_typedef_member(struct_typedef->second.get(), node->member);
+    if (!member) {
         RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::member_not_in_structure_type,
                                         get_type_hr(struct_type), get_name_hr(node->member)),
             node->line);
     }
-    node->exp_type = frontend->struct_typedef_table[struct_type->tag]->members[node->member]->member_type;
+    node->exp_type = member->member_type;
 }
 
 static std::unique_ptr<CExp> checktype_scalar_typed_expression(std::unique_ptr<CExp>&& node) {
@@ -1027,8 +980,8 @@ static std::unique_ptr<CExp> checktype_scalar_typed_expression(std::unique_ptr<C
 
 static std::unique_ptr<CAddrOf> checktype_array_aggregate_typed_expression(std::unique_ptr<CExp>&& node) {
     {
-        std::shared_ptr<Type> ref_type = static_cast<Array*>(node->exp_type.get())->elem_type;
-        node->exp_type = std::make_shared<Pointer>(std::move(ref_type));
+        std::shared_ptr<Type> ref_type = ast_cast<Array>(node->exp_type.get())->elem_type;
+        node->exp_type = get_pointer_type(std::move(ref_type));
     }
     size_t line = node->line;
     std::unique_ptr<CAddrOf> addrof = std::make_unique<CAddrOf>(std::move(node), std::move(line));
@@ -1037,7 +990,7 @@ static std::unique_ptr<CAddrOf> checktype_array_aggregate_typed_expression(std::
 }
 
 static std::unique_ptr<CExp> checktype_structure_aggregate_typed_expression(std::unique_ptr<CExp>&& node) {
-    if (!is_struct_type_complete(static_cast<Structure*>(node->exp_type.get()))) {
+    if (!is_struct_type_complete(ast_cast<Structure>(node->exp_type.get()))) {
         RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::incomplete_structure_type_in_expression,
                                         get_type_hr(node->exp_type.get())),
             node->line);
@@ -1059,7 +1012,7 @@ static std::unique_ptr<CExp> checktype_typed_expression(std::unique_ptr<CExp>&&
 }
 
 static void checktype_return_statement(CReturn* node) {
-    FunType* fun_type = static_cast<FunType*>(frontend->symbol_table[context->function_definition_name]->type_t.get());
+    FunType* fun_type = ast_cast<FunType>(frontend->symbol_table[context->function_definition_name]->type_t.get());
     if (fun_type->ret_type->type() == AST_T::Void_t) {
         if (node->exp) {
             RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::return_value_in_void_function,
@@ -1139,84 +1092,6 @@ static void checktype_array_single_init_string_initializer(CSingleInit* node, st
     node->init_type = init_type;
 }
 
-static std::unique_ptr<CInitializer> checktype_zero_initializer(Type* init_type);
-
-static std::unique_ptr<CSingleInit> checktype_single_init_zero_initializer(Type* elem_type) {
-    std::unique_ptr<CExp> exp;
-    {
-        std::shared_ptr<CConst> constant;
-        switch (elem_type->type()) {
-            case AST_T::Char_t:
-            case AST_T::SChar_t: {
-                constant = std::make_shared<CConstChar>(0);
-                break;
-            }
-            case AST_T::Int_t: {
-                constant = std::make_shared<CConstInt>(0);
-                break;
-            }
-            case AST_T::Long_t: {
-                constant = std::make_shared<CConstLong>(0l);
-                break;
-            }
-            case AST_T::Double_t: {
-                constant = std::make_shared<CConstDouble>(0.0);
-                break;
-            }
-            case AST_T::UChar_t: {
-                constant = std::make_shared<CConstUChar>(0u);
-                break;
-            }
-            case AST_T::UInt_t: {
-                constant = std::make_shared<CConstUInt>(0u);
-                break;
-            }
-            case AST_T::ULong_t:
-            case AST_T::Pointer_t: {
-                constant = std::make_shared<CConstULong>(0ul);
-                break;
-            }
-            default:
-                RAISE_INTERNAL_ERROR;
-        }
-        exp = std::make_unique<CConstant>(std::move(constant), 0);
-    }
-    return std::make_unique<CSingleInit>(std::move(exp));
-}
-
-static std::unique_ptr<CCompoundInit> checktype_array_compound_init_zero_initializer(Array* arr_type) {
-    std::vector<std::unique_ptr<CInitializer>> zero_initializers;
-    size_t arr_type_size = static_cast<size_t>(arr_type->size);
-    zero_initializers.reserve(arr_type_size);
-    for (size_t i = 0; i < arr_type_size; ++i) {
-        std::unique_ptr<CInitializer> initializer = checktype_zero_initializer(arr_type->elem_type.get());
-        zero_initializers.push_back(std::move(initializer));
-    }
-    return std::make_unique<CCompoundInit>(std::move(zero_initializers));
-}
-
-static std::unique_ptr<CCompoundInit> checktype_structure_compound_init_zero_initializer(Structure* struct_type) {
-    std::vector<std::unique_ptr<CInitializer>> zero_initializers;
-    zero_initializers.reserve(frontend->struct_typedef_table[struct_type->tag]->member_names.size());
-    for (const auto& member_name : frontend->struct_typedef_table[struct_type->tag]->member_names) {
-        const auto& member = frontend->struct_typedef_table[struct_type->tag]->members[member_name];
-        std::unique_ptr<CInitializer> initializer = checktype_zero_initializer(member->member_type.get());
-        zero_initializers.push_back(std::move(initializer));
-    }
-    return std::make_unique<CCompoundInit>(std::move(zero_initializers));
-}
-
-static std::unique_ptr<CInitializer> checktype_zero_initializer(Type* init_type) {
-    switch (init_type->type()) {
-        case AST_T::Array_t:
-            return checktype_array_compound_init_zero_initializer(static_cast<Array*>(init_type));
-        case AST_T::Structure_t:
-            return checktype_structure_compound_init_zero_initializer(static_cast<Structure*>(init_type));
-        default:
-            return checktype_single_init_zero_initializer(init_type);
-    }
-}
-
 static void checktype_bound_array_compound_init_initializer(CCompoundInit* node, Array* arr_type) {
     if (node->initializers.size() > static_cast<size_t>(arr_type->size)) {
         RAISE_RUNTIME_ERROR_AT_LINE(
@@ -1238,28 +1113,29 @@ static void checktype_bound_structure_compound_init_initializer(CCompoundInit* n
 
 static void checktype_array_compound_init_initializer(
     CCompoundInit* node, Array* arr_type, std::shared_ptr<Type>& init_type) {
-    while (node->initializers.size() < static_cast<size_t>(arr_type->size)) {
-        std::unique_ptr<CInitializer> zero_initializer = checktype_zero_initializer(arr_type->elem_type.get());
-        node->initializers.push_back(std::move(zero_initializer));
+    if (node->initializers.size() < static_cast<size_t>(arr_type->size)) {
+        TLong byte = get_type_scale(arr_type->elem_type.get())
+                     * (arr_type->size - static_cast<TLong>(node->initializers.size()));
+        node->initializers.push_back(std::make_unique<CZeroInit>(std::move(byte)));
     }
     node->init_type = init_type;
 }
 
 static void checktype_structure_compound_init_initializer(
     CCompoundInit* node, Structure* struct_type, std::shared_ptr<Type>& init_type) {
-    for (size_t i = node->initializers.size(); i < frontend->struct_typedef_table[struct_type->tag]->members.size();
-         ++i) {
-        const auto& member = GET_STRUCT_TYPEDEF_MEMBER(struct_type->tag, i);
-        std::unique_ptr<CInitializer> zero_initializer = checktype_zero_initializer(member->member_type.get());
-        node->initializers.push_back(std::move(zero_initializer));
+    if (node->initializers.size() < frontend->struct_typedef_table[struct_type->tag]->members.size()) {
+        const auto& member = GET_STRUCT_TYPEDEF_MEMBER(struct_type->tag, node->initializers.size());
+        TLong byte = frontend->struct_typedef_table[struct_type->tag]->size - member->offset;
+        node->initializers.push_back(std::make_unique<CZeroInit>(std::move(byte)));
     }
     node->init_type = init_type;
 }
 
 static void checktype_return_function_declaration(CFunctionDeclaration* node) {
-    FunType* fun_type = static_cast<FunType*>(node->fun_type.get());
+    FunType* fun_type = ast_cast<FunType>(node->fun_type.get());
     errors->line_buffer = node->line;
     resolve_struct_type(fun_type->ret_type.get());
+    intern_type(fun_type->ret_type);
     is_valid_type(fun_type->ret_type.get());
 
     switch (fun_type->ret_type->type()) {
@@ -1268,7 +1144,7 @@ static void checktype_return_function_declaration(CFunctionDeclaration* node) {
                                             get_name_hr(node->name), get_type_hr(fun_type->ret_type.get())),
                 node->line);
         case AST_T::Structure_t: {
-            if (node->body && !is_struct_type_complete(static_cast<Structure*>(fun_type->ret_type.get()))) {
+            if (node->body && !is_struct_type_complete(ast_cast<Structure>(fun_type->ret_type.get()))) {
                 RAISE_RUNTIME_ERROR_AT_LINE(
                     GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::function_returns_incomplete_structure_type,
                         get_name_hr(node->name), get_type_hr(fun_type->ret_type.get())),
@@ -1282,10 +1158,11 @@ static void checktype_return_function_declaration(CFunctionDeclaration* node) {
 }
 
 static void checktype_params_function_declaration(CFunctionDeclaration* node) {
-    FunType* fun_type = static_cast<FunType*>(node->fun_type.get());
+    FunType* fun_type = ast_cast<FunType>(node->fun_type.get());
     for (size_t i = 0; i < node->params.size(); ++i) {
         errors->line_buffer = node->line;
         resolve_struct_type(fun_type->param_types[i].get());
+        intern_type(fun_type->param_types[i]);
         if (fun_type->param_types[i]->type() == AST_T::Void_t) {
             RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::parameter_with_type_void,
                                             get_name_hr(node->name), get_name_hr(node->params[i])),
@@ -1293,13 +1170,13 @@ static void checktype_params_function_declaration(CFunctionDeclaration* node) {
         }
         is_valid_type(fun_type->param_types[i].get());
         if (fun_type->param_types[i]->type() == AST_T::Array_t) {
-            std::shared_ptr<Type> ref_type = static_cast<Array*>(fun_type->param_types[i].get())->elem_type;
-            fun_type->param_types[i] = std::make_shared<Pointer>(std::move(ref_type));
+            std::shared_ptr<Type> ref_type = ast_cast<Array>(fun_type->param_types[i].get())->elem_type;
+            fun_type->param_types[i] = get_pointer_type(std::move(ref_type));
         }
 
         if (node->body) {
             if (fun_type->param_types[i]->type() == AST_T::Structure_t
-                && !is_struct_type_complete(static_cast<Structure*>(fun_type->param_types[i].get()))) {
+                && !is_struct_type_complete(ast_cast<Structure>(fun_type->param_types[i].get()))) {
                 RAISE_RUNTIME_ERROR_AT_LINE(
                     GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::parameter_with_incomplete_structure_type,
                         get_name_hr(node->name), get_name_hr(node->params[i]),
@@ -1323,10 +1200,10 @@ static void checktype_function_declaration(CFunctionDeclaration* node) {
     bool is_global = !(node->storage_class && node->storage_class->type() == AST_T::CStatic_t);
 
     if (frontend->symbol_table.find(node->name) != frontend->symbol_table.end()) {
-        FunType* fun_type = static_cast<FunType*>(frontend->symbol_table[node->name]->type_t.get());
+        FunType* fun_type = ast_cast<FunType>(frontend->symbol_table[node->name]->type_t.get());
         if (!(frontend->symbol_table[node->name]->type_t->type() == AST_T::FunType_t
                 && fun_type->param_types.size() == node->params.size()
-                && is_same_fun_type(static_cast<FunType*>(node->fun_type.get()), fun_type))) {
+                && is_same_fun_type(ast_cast<FunType>(node->fun_type.get()), fun_type))) {
             RAISE_RUNTIME_ERROR_AT_LINE(
                 GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::function_redeclared_with_conflicting_type,
                     get_name_hr(node->name), get_type_hr(node->fun_type.get()), get_type_hr(fun_type)),
@@ -1338,7 +1215,7 @@ static void checktype_function_declaration(CFunctionDeclaration* node) {
                 node->line);
         }
 
-        FunAttr* fun_attrs = static_cast<FunAttr*>(frontend->symbol_table[node->name]->attrs.get());
+        FunAttr* fun_attrs = ast_cast<FunAttr>(frontend->symbol_table[node->name]->attrs.get());
         if (!is_global && fun_attrs->is_global) {
             RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::non_static_function_redeclared_static,
                                             get_name_hr(node->name)),
@@ -1358,19 +1235,40 @@ static void checktype_function_declaration(CFunctionDeclaration* node) {
     frontend->symbol_table[node->name] = std::make_unique<Symbol>(std::move(fun_type), std::move(fun_attrs));
 }
 
+constexpr TLong STATIC_INIT_ZERO_RUN_MIN = 16l;
+
 static void push_static_init(std::shared_ptr<StaticInit>&& static_init) {
     context->p_static_inits->push_back(std::move(static_init));
 }
 
 static void push_zero_init_static_init(TLong&& byte) {
     if (!context->p_static_inits->empty() && context->p_static_inits->back()->type() == AST_T::ZeroInit_t) {
-        static_cast<ZeroInit*>(context->p_static_inits->back().get())->byte += byte;
+        ast_cast<ZeroInit>(context->p_static_inits->back().get())->byte += byte;
     }
     else {
         push_static_init(std::make_shared<ZeroInit>(std::move(byte)));
     }
 }
 
+// Scalars are packed little-endian into a byte image, and zero runs too short to be worth a .zero are packed with them
+static void push_bytes_static_init(TULong value, TLong byte) {
+    std::vector<std::shared_ptr<StaticInit>>& static_inits = *context->p_static_inits;
+    TLong zero_byte = 0l;
+    if (!static_inits.empty() && static_inits.back()->type() == AST_T::ZeroInit_t
+        && ast_cast<ZeroInit>(static_inits.back().get())->byte < STATIC_INIT_ZERO_RUN_MIN) {
+        zero_byte = ast_cast<ZeroInit>(static_inits.back().get())->byte;
+        static_inits.pop_back();
+    }
+    if (static_inits.empty() || static_inits.back()->type() != AST_T::BytesInit_t) {
+        push_static_init(std::make_shared<BytesInit>(std::vector<TUChar>()));
+    }
+    std::vector<TUChar>& bytes = ast_cast<BytesInit>(static_inits.back().get())->bytes;
+    bytes.resize(bytes.size() + static_cast<size_t>(zero_byte), 0);
+    for (TLong i = 0l; i < byte; ++i) {
+        bytes.push_back(static_cast<TUChar>(value >> (i * 8l)));
+    }
+}
+
 static void checktype_initializer_static_init(CInitializer* node, Type* static_init_type);
 
 static void checktype_no_initializer_static_init(Type* static_init_type, TLong size) {
@@ -1395,31 +1293,31 @@ static void checktype_constant_initializer_static_init(CConstant* node, Type* st
             TChar value;
             switch (node->constant->type()) {
                 case AST_T::CConstChar_t: {
-                    value = static_cast<CConstChar*>(node->constant.get())->value;
+                    value = ast_cast<CConstChar>(node->constant.get())->value;
                     break;
                 }
                 case AST_T::CConstInt_t: {
-                    value = static_cast<TChar>(static_cast<CConstInt*>(node->constant.get())->value);
+                    value = static_cast<TChar>(ast_cast<CConstInt>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstLong_t: {
-                    value = static_cast<TChar>(static_cast<CConstLong*>(node->constant.get())->value);
+                    value = static_cast<TChar>(ast_cast<CConstLong>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstDouble_t: {
-                    value = static_cast<TChar>(static_cast<CConstDouble*>(node->constant.get())->value);
+                    value = static_cast<TChar>(ast_cast<CConstDouble>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstUChar_t: {
-                    value = static_cast<TChar>(static_cast<CConstUChar*>(node->constant.get())->value);
+                    value = static_cast<TChar>(ast_cast<CConstUChar>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstUInt_t: {
-                    value = static_cast<TChar>(static_cast<CConstUInt*>(node->constant.get())->value);
+                    value = static_cast<TChar>(ast_cast<CConstUInt>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstULong_t: {
-                    value = static_cast<TChar>(static_cast<CConstULong*>(node->constant.get())->value);
+                    value = static_cast<TChar>(ast_cast<CConstULong>(node->constant.get())->value);
                     break;
                 }
                 default:
@@ -1429,7 +1327,7 @@ static void checktype_constant_initializer_static_init(CConstant* node, Type* st
                 push_zero_init_static_init(1l);
             }
             else {
-                push_static_init(std::make_shared<CharInit>(std::move(value)));
+                push_bytes_static_init(static_cast<TULong>(value), 1l);
             }
             break;
         }
@@ -1437,31 +1335,31 @@ static void checktype_constant_initializer_static_init(CConstant* node, Type* st
             TInt value;
             switch (node->constant->type()) {
                 case AST_T::CConstChar_t: {
-                    value = static_cast<TInt>(static_cast<CConstChar*>(node->constant.get())->value);
+                    value = static_cast<TInt>(ast_cast<CConstChar>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstInt_t: {
-                    value = static_cast<CConstInt*>(node->constant.get())->value;
+                    value = ast_cast<CConstInt>(node->constant.get())->value;
                     break;
                 }
                 case AST_T::CConstLong_t: {
-                    value = static_cast<TInt>(static_cast<CConstLong*>(node->constant.get())->value);
+                    value = static_cast<TInt>(ast_cast<CConstLong>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstDouble_t: {
-                    value = static_cast<TInt>(static_cast<CConstDouble*>(node->constant.get())->value);
+                    value = static_cast<TInt>(ast_cast<CConstDouble>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstUChar_t: {
-                    value = static_cast<TInt>(static_cast<CConstUChar*>(node->constant.get())->value);
+                    value = static_cast<TInt>(ast_cast<CConstUChar>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstUInt_t: {
-                    value = static_cast<TInt>(static_cast<CConstUInt*>(node->constant.get())->value);
+                    value = static_cast<TInt>(ast_cast<CConstUInt>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstULong_t: {
-                    value = static_cast<TInt>(static_cast<CConstULong*>(node->constant.get())->value);
+                    value = static_cast<TInt>(ast_cast<CConstULong>(node->constant.get())->value);
                     break;
                 }
                 default:
@@ -1471,7 +1369,7 @@ static void checktype_constant_initializer_static_init(CConstant* node, Type* st
                 push_zero_init_static_init(4l);
             }
             else {
-                push_static_init(std::make_shared<IntInit>(std::move(value)));
+                push_bytes_static_init(static_cast<TULong>(value), 4l);
             }
             break;
         }
@@ -1479,31 +1377,31 @@ static void checktype_constant_initializer_static_init(CConstant* node, Type* st
             TLong value;
             switch (node->constant->type()) {
                 case AST_T::CConstChar_t: {
-                    value = static_cast<TLong>(static_cast<CConstChar*>(node->constant.get())->value);
+                    value = static_cast<TLong>(ast_cast<CConstChar>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstInt_t: {
-                    value = static_cast<TLong>(static_cast<CConstInt*>(node->constant.get())->value);
+                    value = static_cast<TLong>(ast_cast<CConstInt>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstLong_t: {
-                    value = static_cast<CConstLong*>(node->constant.get())->value;
+                    value = ast_cast<CConstLong>(node->constant.get())->value;
                     break;
                 }
                 case AST_T::CConstDouble_t: {
-                    value = static_cast<TLong>(static_cast<CConstDouble*>(node->constant.get())->value);
+                    value = static_cast<TLong>(ast_cast<CConstDouble>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstUChar_t: {
-                    value = static_cast<TLong>(static_cast<CConstUChar*>(node->constant.get())->value);
+                    value = static_cast<TLong>(ast_cast<CConstUChar>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstUInt_t: {
-                    value = static_cast<TLong>(static_cast<CConstUInt*>(node->constant.get())->value);
+                    value = static_cast<TLong>(ast_cast<CConstUInt>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstULong_t: {
-                    value = static_cast<TLong>(static_cast<CConstULong*>(node->constant.get())->value);
+                    value = static_cast<TLong>(ast_cast<CConstULong>(node->constant.get())->value);
                     break;
                 }
                 default:
@@ -1513,7 +1411,7 @@ static void checktype_constant_initializer_static_init(CConstant* node, Type* st
                 push_zero_init_static_init(8l);
             }
             else {
-                push_static_init(std::make_shared<LongInit>(std::move(value)));
+                push_bytes_static_init(static_cast<TULong>(value), 8l);
             }
             break;
         }
@@ -1521,31 +1419,31 @@ static void checktype_constant_initializer_static_init(CConstant* node, Type* st
             TDouble value;
             switch (node->constant->type()) {
                 case AST_T::CConstChar_t: {
-                    value = static_cast<TDouble>(static_cast<CConstChar*>(node->constant.get())->value);
+                    value = static_cast<TDouble>(ast_cast<CConstChar>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstInt_t: {
-                    value = static_cast<TDouble>(static_cast<CConstInt*>(node->constant.get())->value);
+                    value = static_cast<TDouble>(ast_cast<CConstInt>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstLong_t: {
-                    value = static_cast<TDouble>(static_cast<CConstLong*>(node->constant.get())->value);
+                    value = static_cast<TDouble>(ast_cast<CConstLong>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstDouble_t: {
-                    value = static_cast<CConstDouble*>(node->constant.get())->value;
+                    value = ast_cast<CConstDouble>(node->constant.get())->value;
                     break;
                 }
                 case AST_T::CConstUChar_t: {
-                    value = static_cast<TDouble>(static_cast<CConstUChar*>(node->constant.get())->value);
+                    value = static_cast<TDouble>(ast_cast<CConstUChar>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstUInt_t: {
-                    value = static_cast<TDouble>(static_cast<CConstUInt*>(node->constant.get())->value);
+                    value = static_cast<TDouble>(ast_cast<CConstUInt>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstULong_t: {
-                    value = static_cast<TDouble>(static_cast<CConstULong*>(node->constant.get())->value);
+                    value = static_cast<TDouble>(ast_cast<CConstULong>(node->constant.get())->value);
                     break;
                 }
                 default:
@@ -1556,7 +1454,7 @@ static void checktype_constant_initializer_static_init(CConstant* node, Type* st
                 push_zero_init_static_init(8l);
             }
             else {
-                push_static_init(std::make_shared<DoubleInit>(std::move(value), std::move(binary)));
+                push_bytes_static_init(binary, 8l);
             }
             break;
         }
@@ -1564,31 +1462,31 @@ static void checktype_constant_initializer_static_init(CConstant* node, Type* st
             TUChar value;
             switch (node->constant->type()) {
                 case AST_T::CConstChar_t: {
-                    value = static_cast<TUChar>(static_cast<CConstChar*>(node->constant.get())->value);
+                    value = static_cast<TUChar>(ast_cast<CConstChar>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstInt_t: {
-                    value = static_cast<TUChar>(static_cast<CConstInt*>(node->constant.get())->value);
+                    value = static_cast<TUChar>(ast_cast<CConstInt>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstLong_t: {
-                    value = static_cast<TUChar>(static_cast<CConstLong*>(node->constant.get())->value);
+                    value = static_cast<TUChar>(ast_cast<CConstLong>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstDouble_t: {
-                    value = static_cast<TUChar>(static_cast<CConstDouble*>(node->constant.get())->value);
+                    value = static_cast<TUChar>(ast_cast<CConstDouble>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstUChar_t: {
-                    value = static_cast<CConstUChar*>(node->constant.get())->value;
+                    value = ast_cast<CConstUChar>(node->constant.get())->value;
                     break;
                 }
                 case AST_T::CConstUInt_t: {
-                    value = static_cast<TUChar>(static_cast<CConstUInt*>(node->constant.get())->value);
+                    value = static_cast<TUChar>(ast_cast<CConstUInt>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstULong_t: {
-                    value = static_cast<TUChar>(static_cast<CConstULong*>(node->constant.get())->value);
+                    value = static_cast<TUChar>(ast_cast<CConstULong>(node->constant.get())->value);
                     break;
                 }
                 default:
@@ -1598,7 +1496,7 @@ static void checktype_constant_initializer_static_init(CConstant* node, Type* st
                 push_zero_init_static_init(1l);
             }
             else {
-                push_static_init(std::make_shared<UCharInit>(std::move(value)));
+                push_bytes_static_init(static_cast<TULong>(value), 1l);
             }
             break;
         }
@@ -1606,31 +1504,31 @@ static void checktype_constant_initializer_static_init(CConstant* node, Type* st
             TUInt value;
             switch (node->constant->type()) {
                 case AST_T::CConstChar_t: {
-                    value = static_cast<TUInt>(static_cast<CConstChar*>(node->constant.get())->value);
+                    value = static_cast<TUInt>(ast_cast<CConstChar>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstInt_t: {
-                    value = static_cast<TUInt>(static_cast<CConstInt*>(node->constant.get())->value);
+                    value = static_cast<TUInt>(ast_cast<CConstInt>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstLong_t: {
-                    value = static_cast<TUInt>(static_cast<CConstLong*>(node->constant.get())->value);
+                    value = static_cast<TUInt>(ast_cast<CConstLong>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstDouble_t: {
-                    value = static_cast<TUInt>(static_cast<CConstDouble*>(node->constant.get())->value);
+                    value = static_cast<TUInt>(ast_cast<CConstDouble>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstUChar_t: {
-                    value = static_cast<TUInt>(static_cast<CConstUChar*>(node->constant.get())->value);
+                    value = static_cast<TUInt>(ast_cast<CConstUChar>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstUInt_t: {
-                    value = static_cast<CConstUInt*>(node->constant.get())->value;
+                    value = ast_cast<CConstUInt>(node->constant.get())->value;
                     break;
                 }
                 case AST_T::CConstULong_t: {
-                    value = static_cast<TUInt>(static_cast<CConstULong*>(node->constant.get())->value);
+                    value = static_cast<TUInt>(ast_cast<CConstULong>(node->constant.get())->value);
                     break;
                 }
                 default:
@@ -1640,7 +1538,7 @@ static void checktype_constant_initializer_static_init(CConstant* node, Type* st
                 push_zero_init_static_init(4l);
             }
             else {
-                push_static_init(std::make_shared<UIntInit>(std::move(value)));
+                push_bytes_static_init(static_cast<TULong>(value), 4l);
             }
             break;
         }
@@ -1648,31 +1546,31 @@ static void checktype_constant_initializer_static_init(CConstant* node, Type* st
             TULong value;
             switch (node->constant->type()) {
                 case AST_T::CConstChar_t: {
-                    value = static_cast<TULong>(static_cast<CConstChar*>(node->constant.get())->value);
+                    value = static_cast<TULong>(ast_cast<CConstChar>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstInt_t: {
-                    value = static_cast<TULong>(static_cast<CConstInt*>(node->constant.get())->value);
+                    value = static_cast<TULong>(ast_cast<CConstInt>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstLong_t: {
-                    value = static_cast<TULong>(static_cast<CConstLong*>(node->constant.get())->value);
+                    value = static_cast<TULong>(ast_cast<CConstLong>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstDouble_t: {
-                    value = static_cast<TULong>(static_cast<CConstDouble*>(node->constant.get())->value);
+                    value = static_cast<TULong>(ast_cast<CConstDouble>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstUChar_t: {
-                    value = static_cast<TULong>(static_cast<CConstUChar*>(node->constant.get())->value);
+                    value = static_cast<TULong>(ast_cast<CConstUChar>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstUInt_t: {
-                    value = static_cast<TULong>(static_cast<CConstUInt*>(node->constant.get())->value);
+                    value = static_cast<TULong>(ast_cast<CConstUInt>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstULong_t: {
-                    value = static_cast<CConstULong*>(node->constant.get())->value;
+                    value = ast_cast<CConstULong>(node->constant.get())->value;
                     break;
                 }
                 default:
@@ -1682,7 +1580,7 @@ static void checktype_constant_initializer_static_init(CConstant* node, Type* st
                 push_zero_init_static_init(8l);
             }
             else {
-                push_static_init(std::make_shared<ULongInit>(std::move(value)));
+                push_bytes_static_init(static_cast<TULong>(value), 8l);
             }
             break;
         }
@@ -1690,19 +1588,19 @@ static void checktype_constant_initializer_static_init(CConstant* node, Type* st
             TULong value;
             switch (node->constant->type()) {
                 case AST_T::CConstInt_t: {
-                    value = static_cast<TULong>(static_cast<CConstInt*>(node->constant.get())->value);
+                    value = static_cast<TULong>(ast_cast<CConstInt>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstLong_t: {
-                    value = static_cast<TULong>(static_cast<CConstLong*>(node->constant.get())->value);
+                    value = static_cast<TULong>(ast_cast<CConstLong>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstUInt_t: {
-                    value = static_cast<TULong>(static_cast<CConstUInt*>(node->constant.get())->value);
+                    value = static_cast<TULong>(ast_cast<CConstUInt>(node->constant.get())->value);
                     break;
                 }
                 case AST_T::CConstULong_t: {
-                    value = static_cast<CConstULong*>(node->constant.get())->value;
+                    value = ast_cast<CConstULong>(node->constant.get())->value;
                     break;
                 }
                 case AST_T::CConstChar_t:
@@ -1742,27 +1640,25 @@ static void checktype_string_initializer_pointer_static_init(CString* node, Poin
 
     TIdentifier static_constant_label;
     {
-        TIdentifier string_constant = string_literal_to_string_constant(node->literal->value);
-        TIdentifier static_constant_hash = std::to_string(std::hash<std::string> {}(string_constant));
-        if (frontend->static_constant_table.find(static_constant_hash) != frontend->static_constant_table.end()) {
-            static_constant_label = frontend->static_constant_table[static_constant_hash];
+        TIdentifier string_constant = make_identifier(string_literal_to_string_constant(node->literal->value));
+        if (frontend->static_constant_table.find(string_constant) != frontend->static_constant_table.end()) {
+            static_constant_label = frontend->static_constant_table[string_constant];
         }
         else {
             static_constant_label = represent_label_identifier(LABEL_KIND::Lstring);
-            frontend->static_constant_table[static_constant_hash] = static_constant_label;
+            frontend->static_constant_table[string_constant] = static_constant_label;
             std::shared_ptr<Type> constant_type;
             {
                 TLong size = static_cast<TLong>(node->literal->value.size()) + 1l;
-                std::shared_ptr<Type> elem_type = std::make_shared<Char>();
-                constant_type = std::make_shared<Array>(std::move(size), std::move(elem_type));
+                std::shared_ptr<Type> elem_type = get_scalar_type(AST_T::Char_t);
+                constant_type = get_array_type(std::move(size), std::move(elem_type));
             }
             std::unique_ptr<IdentifierAttr> constant_attrs;
             {
                 std::shared_ptr<StaticInit> static_init;
                 {
-                    TIdentifier string_constant = string_literal_to_string_constant(node->literal->value);
                     std::shared_ptr<CStringLiteral> literal = node->literal;
-                    static_init = std::make_shared<StringInit>(true, std::move(string_constant), std::move(literal));
+                    static_init = std::make_shared<StringInit>(true, string_constant, std::move(literal));
                 }
                 constant_attrs = std::make_unique<ConstantAttr>(std::move(static_init));
             }
@@ -1778,7 +1674,7 @@ static void checktype_string_initializer_array_static_init(CString* node, Array*
     TLong byte = static_arr_type->size - static_cast<TLong>(node->literal->value.size()) - 1l;
     {
         bool is_null_terminated = byte >= 0l;
-        TIdentifier string_constant = string_literal_to_string_constant(node->literal->value);
+        TIdentifier string_constant = make_identifier(string_literal_to_string_constant(node->literal->value));
         std::shared_ptr<CStringLiteral> literal = node->literal;
         push_static_init(std::make_shared<StringInit>(
             std::move(is_null_terminated), std::move(string_constant), std::move(literal)));
@@ -1791,10 +1687,10 @@ static void checktype_string_initializer_array_static_init(CString* node, Array*
 static void checktype_string_initializer_static_init(CString* node, Type* static_init_type) {
     switch (static_init_type->type()) {
         case AST_T::Pointer_t:
-            checktype_string_initializer_pointer_static_init(node, static_cast<Pointer*>(static_init_type));
+            checktype_string_initializer_pointer_static_init(node, ast_cast<Pointer>(static_init_type));
             break;
         case AST_T::Array_t:
-            checktype_string_initializer_array_static_init(node, static_cast<Array*>(static_init_type));
+            checktype_string_initializer_array_static_init(node, ast_cast<Array>(static_init_type));
             break;
         default:
             RAISE_INTERNAL_ERROR;
@@ -1804,10 +1700,10 @@ static void checktype_string_initializer_static_init(CString* node, Type* static
 static void checktype_single_init_initializer_static_init(CSingleInit* node, Type* static_init_type) {
     switch (node->exp->type()) {
         case AST_T::CConstant_t:
-            checktype_constant_initializer_static_init(static_cast<CConstant*>(node->exp.get()), static_init_type);
+            checktype_constant_initializer_static_init(ast_cast<CConstant>(node->exp.get()), static_init_type);
             break;
         case AST_T::CString_t:
-            checktype_string_initializer_static_init(static_cast<CString*>(node->exp.get()), static_init_type);
+            checktype_string_initializer_static_init(ast_cast<CString>(node->exp.get()), static_init_type);
             break;
         default:
             RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::static_initialized_with_non_constant,
@@ -1830,9 +1726,10 @@ static void checktype_array_compound_init_initializer_static_init(CCompoundInit*
 static void checktype_structure_compound_init_initializer_static_init(CCompoundInit* node, Structure* struct_type) {
     checktype_bound_structure_compound_init_initializer(node, struct_type);
 
+    StructTypedef* struct_typedef = frontend->struct_typedef_table[struct_type->tag].get();
     TLong size = 0l;
     for (size_t i = 0; i < node->initializers.size(); ++i) {
-        const auto& member = GET_STRUCT_TYPEDEF_MEMBER(struct_type->tag, i);
+        StructMember* member = &struct_typedef->members[i];
         if (member->offset != size) {
             checktype_no_initializer_static_init(nullptr, member->offset - size);
             size = member->offset;
@@ -1840,18 +1737,18 @@ static void checktype_structure_compound_init_initializer_static_init(CCompoundI
         checktype_initializer_static_init(node->initializers[i].get(), member->member_type.get());
         size += get_type_scale(member->member_type.get());
     }
-    if (frontend->struct_typedef_table[struct_type->tag]->size != size) {
-        checktype_no_initializer_static_init(nullptr, frontend->struct_typedef_table[struct_type->tag]->size - size);
+    if (struct_typedef->size != size) {
+        checktype_no_initializer_static_init(nullptr, struct_typedef->size - size);
     }
 }
 
 static void checktype_compound_init_initializer_static_init(CCompoundInit* node, Type* static_init_type) {
     switch (static_init_type->type()) {
         case AST_T::Array_t:
-            checktype_array_compound_init_initializer_static_init(node, static_cast<Array*>(static_init_type));
+            checktype_array_compound_init_initializer_static_init(node, ast_cast<Array>(static_init_type));
             break;
         case AST_T::Structure_t:
-            checktype_structure_compound_init_initializer_static_init(node, static_cast<Structure*>(static_init_type));
+            checktype_structure_compound_init_initializer_static_init(node, ast_cast<Structure>(static_init_type));
             break;
         default:
             RAISE_RUNTIME_ERROR_AT_LINE(
@@ -1864,10 +1761,10 @@ static void checktype_compound_init_initializer_static_init(CCompoundInit* node,
 static void checktype_initializer_static_init(CInitializer* node, Type* static_init_type) {
     switch (node->type()) {
         case AST_T::CSingleInit_t:
-            checktype_single_init_initializer_static_init(static_cast<CSingleInit*>(node), static_init_type);
+            checktype_single_init_initializer_static_init(ast_cast<CSingleInit>(node), static_init_type);
             break;
         case AST_T::CCompoundInit_t:
-            checktype_compound_init_initializer_static_init(static_cast<CCompoundInit*>(node), static_init_type);
+            checktype_compound_init_initializer_static_init(ast_cast<CCompoundInit>(node), static_init_type);
             break;
         default:
             RAISE_INTERNAL_ERROR;
@@ -1887,6 +1784,7 @@ static std::shared_ptr<Initial> checktype_initializer_initial(CInitializer* node
 static void checktype_file_scope_variable_declaration(CVariableDeclaration* node) {
     errors->line_buffer = node->line;
     resolve_struct_type(node->var_type.get());
+    intern_type(node->var_type);
     if (node->var_type->type() == AST_T::Void_t) {
         RAISE_RUNTIME_ERROR_AT_LINE(
             GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::variable_declared_with_type_void, get_name_hr(node->name)),
@@ -1899,7 +1797,7 @@ static void checktype_file_scope_variable_declaration(CVariableDeclaration* node
 
     if (node->init) {
         if (node->var_type->type() == AST_T::Structure_t
-            && !is_struct_type_complete(static_cast<Structure*>(node->var_type.get()))) {
+            && !is_struct_type_complete(ast_cast<Structure>(node->var_type.get()))) {
             RAISE_RUNTIME_ERROR_AT_LINE(
                 GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::variable_declared_with_incomplete_structure_type,
                     get_name_hr(node->name), get_type_hr(node->var_type.get())),
@@ -1913,7 +1811,7 @@ static void checktype_file_scope_variable_declaration(CVariableDeclaration* node
         }
         else {
             if (node->var_type->type() == AST_T::Structure_t
-                && !is_struct_type_complete(static_cast<Structure*>(node->var_type.get()))) {
+                && !is_struct_type_complete(ast_cast<Structure>(node->var_type.get()))) {
                 RAISE_RUNTIME_ERROR_AT_LINE(
                     GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::variable_declared_with_incomplete_structure_type,
                         get_name_hr(node->name), get_type_hr(node->var_type.get())),
@@ -1932,7 +1830,7 @@ static void checktype_file_scope_variable_declaration(CVariableDeclaration* node
                 node->line);
         }
 
-        StaticAttr* global_var_attrs = static_cast<StaticAttr*>(frontend->symbol_table[node->name]->attrs.get());
+        StaticAttr* global_var_attrs = ast_cast<StaticAttr>(frontend->symbol_table[node->name]->attrs.get());
         if (node->storage_class && node->storage_class->type() == AST_T::CExtern_t) {
             is_global = global_var_attrs->is_global;
         }
@@ -1991,7 +1889,7 @@ static void checktype_extern_block_scope_variable_declaration(CVariableDeclarati
 
 static void checktype_static_block_scope_variable_declaration(CVariableDeclaration* node) {
     if (node->var_type->type() == AST_T::Structure_t
-        && !is_struct_type_complete(static_cast<Structure*>(node->var_type.get()))) {
+        && !is_struct_type_complete(ast_cast<Structure>(node->var_type.get()))) {
         RAISE_INTERNAL_ERROR;
     }
 
@@ -2011,7 +1909,7 @@ static void checktype_static_block_scope_variable_declaration(CVariableDeclarati
 
 static void checktype_automatic_block_scope_variable_declaration(CVariableDeclaration* node) {
     if (node->var_type->type() == AST_T::Structure_t
-        && !is_struct_type_complete(static_cast<Structure*>(node->var_type.get()))) {
+        && !is_struct_type_complete(ast_cast<Structure>(node->var_type.get()))) {
         RAISE_RUNTIME_ERROR_AT_LINE(
             GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::variable_declared_with_incomplete_structure_type,
                 get_name_hr(node->name), get_type_hr(node->var_type.get())),
@@ -2027,6 +1925,7 @@ static void checktype_automatic_block_scope_variable_declaration(CVariableDeclar
 static void checktype_block_scope_variable_declaration(CVariableDeclaration* node) {
     errors->line_buffer = node->line;
     resolve_struct_type(node->var_type.get());
+    intern_type(node->var_type);
     if (node->var_type->type() == AST_T::Void_t) {
         RAISE_RUNTIME_ERROR_AT_LINE(
             GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::variable_declared_with_type_void, get_name_hr(node->name)),
@@ -2054,7 +1953,7 @@ static void checktype_block_scope_variable_declaration(CVariableDeclaration* nod
 static void checktype_members_structure_declaration(CStructDeclaration* node) {
     for (size_t i = 0; i < node->members.size(); ++i) {
         for (size_t j = i + 1; j < node->members.size(); ++j) {
-            if (node->members[i]->member_name.compare(node->members[j]->member_name) == 0) {
+            if (node->members[i]->member_name == node->members[j]->member_name) {
                 RAISE_RUNTIME_ERROR_AT_LINE(
                     GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::structure_declared_with_duplicate_member,
                         get_struct_name_hr(node->tag), get_name_hr(node->members[i]->member_name)),
@@ -2066,6 +1965,7 @@ static void checktype_members_structure_declaration(CStructDeclaration* node) {
         }
         errors->line_buffer = node->members[i]->line;
         resolve_struct_type(node->members[i].get()->member_type.get());
+        intern_type(node->members[i].get()->member_type);
         if (!is_type_complete(node->members[i].get()->member_type.get())) {
             RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::member_declared_with_incomplete_type,
                                             get_struct_name_hr(node->tag), get_name_hr(node->members[i]->member_name),
@@ -2084,24 +1984,19 @@ static void checktype_structure_declaration(CStructDeclaration* node) {
     }
     TInt alignment = 0;
     TLong size = 0l;
-    std::vector<TIdentifier> member_names;
-    std::unordered_map<TIdentifier, std::unique_ptr<StructMember>> members;
-    member_names.reserve(node->members.size());
+    std::vector<StructMember> members;
     members.reserve(node->members.size());
     for (const auto& member : node->members) {
-        {
-            TIdentifier name = member->member_name;
-            member_names.push_back(std::move(name));
-        }
         TInt member_alignment = get_type_alignment(member->member_type.get());
         {
+            TIdentifier name = member->member_name;
             TLong offset = size % member_alignment;
             if (offset != 0l) {
                 size += member_alignment - offset;
             }
             offset = size;
             std::shared_ptr<Type> member_type = member->member_type;
-            members[member_names.back()] = std::make_unique<StructMember>(std::move(offset), std::move(member_type));
+            members.emplace_back(std::move(name), std::move(offset), std::move(member_type));
         }
         if (alignment < member_alignment) {
             alignment = member_alignment;
@@ -2114,8 +2009,8 @@ static void checktype_structure_declaration(CStructDeclaration* node) {
             size += alignment - offset;
         }
     }
-    frontend->struct_typedef_table[node->tag] = std::make_unique<StructTypedef>(
-        std::move(alignment), std::move(size), std::move(member_names), std::move(members));
+    frontend->struct_typedef_table[node->tag] =
+        std::make_unique<StructTypedef>(std::move(alignment), std::move(size), std::move(members));
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2157,24 +2052,56 @@ static void deannotate_loop() { context->loop_labels.pop_back(); }
 
 // Identifier resolution
 
-static size_t current_scope_depth() { return context->scoped_identifier_maps.size(); }
+static size_t current_scope_depth() { return context->scoped_identifier_logs.size(); }
 
 static bool is_file_scope() { return current_scope_depth() == 1; }
 
+static ScopedIdentifier* get_scoped_identifier(
+    std::unordered_map<TIdentifier, std::vector<ScopedIdentifier>>& scoped_map, TIdentifier name) {
+    auto scoped_identifiers = scoped_map.find(name);
+    if (scoped_identifiers == scoped_map.end() || scoped_identifiers->second.empty()) {
+        return nullptr;
+    }
+    return &scoped_identifiers->second.back();
+}
+
+static bool is_scoped_identifier_in_scope(
+    std::unordered_map<TIdentifier, std::vector<ScopedIdentifier>>& scoped_map, TIdentifier name) {
+    ScopedIdentifier* scoped_identifier = get_scoped_identifier(scoped_map, name);
+    return scoped_identifier && scoped_identifier->scope_depth == current_scope_depth();
+}
+
+static void set_scoped_identifier(std::unordered_map<TIdentifier, std::vector<ScopedIdentifier>>& scoped_map,
+    std::vector<TIdentifier>& scoped_log, TIdentifier name, TIdentifier scoped_name) {
+    std::vector<ScopedIdentifier>& scoped_identifiers = scoped_map[name];
+    if (!scoped_identifiers.empty() && scoped_identifiers.back().scope_depth == current_scope_depth()) {
+        scoped_identifiers.back().name = scoped_name;
+    }
+    else {
+        scoped_identifiers.push_back({current_scope_depth(), scoped_name});
+        scoped_log.push_back(name);
+    }
+}
+
 static void enter_scope() {
-    context->scoped_identifier_maps.emplace_back();
-    context->scoped_structure_tag_maps.emplace_back();
+    context->scoped_identifier_logs.emplace_back();
+    context->scoped_structure_tag_logs.emplace_back();
 }
 
 static void exit_scope() {
-    for (const auto& identifier : context->scoped_identifier_maps.back()) {
-        if (context->external_linkage_scope_map.find(identifier.first) != context->external_linkage_scope_map.end()
-            && context->external_linkage_scope_map[identifier.first] == current_scope_depth()) {
-            context->external_linkage_scope_map.erase(identifier.first);
+    for (TIdentifier name : context->scoped_identifier_logs.back()) {
+        auto external_linkage_scope = context->external_linkage_scope_map.find(name);
+        if (external_linkage_scope != context->external_linkage_scope_map.end()
+            && external_linkage_scope->second == current_scope_depth()) {
+            context->external_linkage_scope_map.erase(external_linkage_scope);
         }
+        context->scoped_identifier_map[name].pop_back();
     }
-    context->scoped_identifier_maps.pop_back();
-    context->scoped_structure_tag_maps.pop_back();
+    for (TIdentifier tag : context->scoped_structure_tag_logs.back()) {
+        context->scoped_structure_tag_map[tag].pop_back();
+    }
+    context->scoped_identifier_logs.pop_back();
+    context->scoped_structure_tag_logs.pop_back();
 }
 
 static void resolve_label(CFunctionDeclaration* node) {
@@ -2195,12 +2122,10 @@ static void resolve_structure_struct_type(Structure* struct_type) {
     if (context->structure_definition_set.find(struct_type->tag) != context->structure_definition_set.end()) {
         return;
     }
-    for (size_t i = current_scope_depth(); i-- > 0;) {
-        if (context->scoped_structure_tag_maps[i].find(struct_type->tag)
-            != context->scoped_structure_tag_maps[i].end()) {
-            struct_type->tag = context->scoped_structure_tag_maps[i][struct_type->tag];
-            return;
-        }
+    ScopedIdentifier* scoped_tag = get_scoped_identifier(context->scoped_structure_tag_map, struct_type->tag);
+    if (scoped_tag) {
+        struct_type->tag = scoped_tag->name;
+        return;
     }
     RAISE_RUNTIME_ERROR_AT_LINE(
         GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::structure_not_defined_in_scope, get_type_hr(struct_type)),
@@ -2210,13 +2135,13 @@ static void resolve_structure_struct_type(Structure* struct_type) {
 static void resolve_struct_type(Type* type) {
     switch (type->type()) {
         case AST_T::Pointer_t:
-            resolve_pointer_struct_type(static_cast<Pointer*>(type));
+            resolve_pointer_struct_type(ast_cast<Pointer>(type));
             break;
         case AST_T::Array_t:
-            resolve_array_struct_type(static_cast<Array*>(type));
+            resolve_array_struct_type(ast_cast<Array>(type));
             break;
         case AST_T::Structure_t:
-            resolve_structure_struct_type(static_cast<Structure*>(type));
+            resolve_structure_struct_type(ast_cast<Structure>(type));
             break;
         case AST_T::FunType_t:
             RAISE_INTERNAL_ERROR;
@@ -2233,16 +2158,13 @@ static void resolve_constant_expression(CConstant* node) { checktype_constant_ex
 static void resolve_string_expression(CString* node) { checktype_string_expression(node); }
 
 static void resolve_var_expression(CVar* node) {
-    for (size_t i = current_scope_depth(); i-- > 0;) {
-        if (context->scoped_identifier_maps[i].find(node->name) != context->scoped_identifier_maps[i].end()) {
-            node->name = context->scoped_identifier_maps[i][node->name];
-            goto Lelse;
-        }
+    ScopedIdentifier* scoped_identifier = get_scoped_identifier(context->scoped_identifier_map, node->name);
+    if (!scoped_identifier) {
+        RAISE_RUNTIME_ERROR_AT_LINE(
+            GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::variable_not_declared_in_scope, get_name_hr(node->name)),
+            node->line);
     }
-    RAISE_RUNTIME_ERROR_AT_LINE(
-        GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::variable_not_declared_in_scope, get_name_hr(node->name)), node->line);
-Lelse:
-
+    node->name = scoped_identifier->name;
     checktype_var_expression(node);
 }
 
@@ -2278,15 +2200,13 @@ static void resolve_conditional_expression(CConditional* node) {
 }
 
 static void resolve_function_call_expression(CFunctionCall* node) {
-    for (size_t i = current_scope_depth(); i-- > 0;) {
-        if (context->scoped_identifier_maps[i].find(node->name) != context->scoped_identifier_maps[i].end()) {
-            node->name = context->scoped_identifier_maps[i][node->name];
-            goto Lelse;
-        }
+    ScopedIdentifier* scoped_identifier = get_scoped_identifier(context->scoped_identifier_map, node->name);
+    if (!scoped_identifier) {
+        RAISE_RUNTIME_ERROR_AT_LINE(
+            GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::function_not_declared_in_scope, get_name_hr(node->name)),
+            node->line);
     }
-    RAISE_RUNTIME_ERROR_AT_LINE(
-        GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::function_not_declared_in_scope, get_name_hr(node->name)), node->line);
-Lelse:
+    node->name = scoped_identifier->name;
 
     for (size_t i = 0; i < node->args.size(); ++i) {
         node->args[i] = resolve_typed_expression(std::move(node->args[i]));
@@ -2330,52 +2250,52 @@ static void resolve_arrow_expression(CArrow* node) {
 static void resolve_expression(CExp* node) {
     switch (node->type()) {
         case AST_T::CConstant_t:
-            resolve_constant_expression(static_cast<CConstant*>(node));
+            resolve_constant_expression(ast_cast<CConstant>(node));
             break;
         case AST_T::CString_t:
-            resolve_string_expression(static_cast<CString*>(node));
+            resolve_string_expression(ast_cast<CString>(node));
             break;
         case AST_T::CVar_t:
-            resolve_var_expression(static_cast<CVar*>(node));
+            resolve_var_expression(ast_cast<CVar>(node));
             break;
         case AST_T::CCast_t:
-            resolve_cast_expression(static_cast<CCast*>(node));
+            resolve_cast_expression(ast_cast<CCast>(node));
             break;
         case AST_T::CUnary_t:
-            resolve_unary_expression(static_cast<CUnary*>(node));
+            resolve_unary_expression(ast_cast<CUnary>(node));
             break;
         case AST_T::CBinary_t:
-            resolve_binary_expression(static_cast<CBinary*>(node));
+            resolve_binary_expression(ast_cast<CBinary>(node));
             break;
         case AST_T::CAssignment_t:
-            resolve_assignment_expression(static_cast<CAssignment*>(node));
+            resolve_assignment_expression(ast_cast<CAssignment>(node));
             break;
         case AST_T::CConditional_t:
-            resolve_conditional_expression(static_cast<CConditional*>(node));
+            resolve_conditional_expression(ast_cast<CConditional>(node));
             break;
         case AST_T::CFunctionCall_t:
-            resolve_function_call_expression(static_cast<CFunctionCall*>(node));
+            resolve_function_call_expression(ast_cast<CFunctionCall>(node));
             break;
         case AST_T::CDereference_t:
-            resolve_dereference_expression(static_cast<CDereference*>(node));
+            resolve_dereference_expression(ast_cast<CDereference>(node));
             break;
         case AST_T::CAddrOf_t:
-            resolve_addrof_expression(static_cast<CAddrOf*>(node));
+            resolve_addrof_expression(ast_cast<CAddrOf>(node));
             break;
         case AST_T::CSubscript_t:
-            resolve_subscript_expression(static_cast<CSubscript*>(node));
+            resolve_subscript_expression(ast_cast<CSubscript>(node));
             break;
         case AST_T::CSizeOf_t:
-            resolve_sizeof_expression(static_cast<CSizeOf*>(node));
+            resolve_sizeof_expression(ast_cast<CSizeOf>(node));
             break;
         case AST_T::CSizeOfT_t:
-            resolve_sizeoft_expression(static_cast<CSizeOfT*>(node));
+            resolve_sizeoft_expression(ast_cast<CSizeOfT>(node));
             break;
         case AST_T::CDot_t:
-            resolve_dot_expression(static_cast<CDot*>(node));
+            resolve_dot_expression(ast_cast<CDot>(node));
             break;
         case AST_T::CArrow_t:
-            resolve_arrow_expression(static_cast<CArrow*>(node));
+            resolve_arrow_expression(ast_cast<CArrow>(node));
             break;
         default:
             RAISE_INTERNAL_ERROR;
@@ -2411,10 +2331,10 @@ static void resolve_init_exp_for_init(CInitExp* node) {
 static void resolve_for_init(CForInit* node) {
     switch (node->type()) {
         case AST_T::CInitDecl_t:
-            resolve_init_decl_for_init(static_cast<CInitDecl*>(node));
+            resolve_init_decl_for_init(ast_cast<CInitDecl>(node));
             break;
         case AST_T::CInitExp_t: {
-            resolve_init_exp_for_init(static_cast<CInitExp*>(node));
+            resolve_init_exp_for_init(ast_cast<CInitExp>(node));
             break;
         }
         default:
@@ -2514,37 +2434,37 @@ static void resolve_continue_statement(CContinue* node) { annotate_continue_loop
 static void resolve_statement(CStatement* node) {
     switch (node->type()) {
         case AST_T::CReturn_t:
-            resolve_return_statement(static_cast<CReturn*>(node));
+            resolve_return_statement(ast_cast<CReturn>(node));
             break;
         case AST_T::CExpression_t:
-            resolve_expression_statement(static_cast<CExpression*>(node));
+            resolve_expression_statement(ast_cast<CExpression>(node));
             break;
         case AST_T::CIf_t:
-            resolve_if_statement(static_cast<CIf*>(node));
+            resolve_if_statement(ast_cast<CIf>(node));
             break;
         case AST_T::CGoto_t:
-            resolve_goto_statement(static_cast<CGoto*>(node));
+            resolve_goto_statement(ast_cast<CGoto>(node));
             break;
         case AST_T::CLabel_t:
-            resolve_label_statement(static_cast<CLabel*>(node));
+            resolve_label_statement(ast_cast<CLabel>(node));
             break;
         case AST_T::CCompound_t:
-            resolve_compound_statement(static_cast<CCompound*>(node));
+            resolve_compound_statement(ast_cast<CCompound>(node));
             break;
         case AST_T::CWhile_t:
-            resolve_while_statement(static_cast<CWhile*>(node));
+            resolve_while_statement(ast_cast<CWhile>(node));
             break;
         case AST_T::CDoWhile_t:
-            resolve_do_while_statement(static_cast<CDoWhile*>(node));
+            resolve_do_while_statement(ast_cast<CDoWhile>(node));
             break;
         case AST_T::CFor_t:
-            resolve_for_statement(static_cast<CFor*>(node));
+            resolve_for_statement(ast_cast<CFor>(node));
             break;
         case AST_T::CBreak_t:
-            resolve_break_statement(static_cast<CBreak*>(node));
+            resolve_break_statement(ast_cast<CBreak>(node));
             break;
         case AST_T::CContinue_t:
-            resolve_continue_statement(static_cast<CContinue*>(node));
+            resolve_continue_statement(ast_cast<CContinue>(node));
             break;
         case AST_T::CNull_t:
             break;
@@ -2559,10 +2479,10 @@ static void resolve_block_items(const std::vector<std::unique_ptr<CBlockItem>>&
     for (const auto& block_item : list_node) {
         switch (block_item->type()) {
             case AST_T::CS_t:
-                resolve_statement(static_cast<CS*>(block_item.get())->statement.get());
+                resolve_statement(ast_cast<CS>(block_item.get())->statement.get());
                 break;
             case AST_T::CD_t:
-                resolve_declaration(static_cast<CD*>(block_item.get())->declaration.get());
+                resolve_declaration(ast_cast<CD>(block_item.get())->declaration.get());
                 break;
             default:
                 RAISE_INTERNAL_ERROR;
@@ -2573,7 +2493,7 @@ static void resolve_block_items(const std::vector<std::unique_ptr<CBlockItem>>&
 static void resolve_block(CBlock* node) {
     switch (node->type()) {
         case AST_T::CB_t:
-            resolve_block_items(static_cast<CB*>(node)->block_items);
+            resolve_block_items(ast_cast<CB>(node)->block_items);
             break;
         default:
             RAISE_INTERNAL_ERROR;
@@ -2585,7 +2505,7 @@ static void resolve_initializer(CInitializer* node, std::shared_ptr<Type>& init_
 static void resolve_single_init_initializer(CSingleInit* node, std::shared_ptr<Type>& init_type) {
     if (node->exp->type() == AST_T::CString_t && init_type->type() == AST_T::Array_t) {
         checktype_bound_array_single_init_string_initializer(
-            static_cast<CString*>(node->exp.get()), static_cast<Array*>(init_type.get()));
+            ast_cast<CString>(node->exp.get()), ast_cast<Array>(init_type.get()));
         checktype_array_single_init_string_initializer(node, init_type);
     }
     else {
@@ -2608,9 +2528,9 @@ static void resolve_structure_compound_init_initializer(
     CCompoundInit* node, Structure* struct_type, std::shared_ptr<Type>& init_type) {
     checktype_bound_structure_compound_init_initializer(node, struct_type);
 
+    StructTypedef* struct_typedef = frontend->struct_typedef_table[struct_type->tag].get();
     for (size_t i = 0; i < node->initializers.size(); ++i) {
-        const auto& member = GET_STRUCT_TYPEDEF_MEMBER(struct_type->tag, i);
-        resolve_initializer(node->initializers[i].get(), member->member_type);
+        resolve_initializer(node->initializers[i].get(), struct_typedef->members[i].member_type);
     }
     checktype_structure_compound_init_initializer(node, struct_type, init_type);
 }
@@ -2618,10 +2538,10 @@ static void resolve_structure_compound_init_initializer(
 static void resolve_compound_init_initializer(CCompoundInit* node, std::shared_ptr<Type>& init_type) {
     switch (init_type->type()) {
         case AST_T::Array_t:
-            resolve_array_compound_init_initializer(node, static_cast<Array*>(init_type.get()), init_type);
+            resolve_array_compound_init_initializer(node, ast_cast<Array>(init_type.get()), init_type);
             break;
         case AST_T::Structure_t:
-            resolve_structure_compound_init_initializer(node, static_cast<Structure*>(init_type.get()), init_type);
+            resolve_structure_compound_init_initializer(node, ast_cast<Structure>(init_type.get()), init_type);
             break;
         default:
             RAISE_RUNTIME_ERROR_AT_LINE(
@@ -2634,10 +2554,10 @@ static void resolve_compound_init_initializer(CCompoundInit* node, std::shared_p
 static void resolve_initializer(CInitializer* node, std::shared_ptr<Type>& init_type) {
     switch (node->type()) {
         case AST_T::CSingleInit_t:
-            resolve_single_init_initializer(static_cast<CSingleInit*>(node), init_type);
+            resolve_single_init_initializer(ast_cast<CSingleInit>(node), init_type);
             break;
         case AST_T::CCompoundInit_t:
-            resolve_compound_init_initializer(static_cast<CCompoundInit*>(node), init_type);
+            resolve_compound_init_initializer(ast_cast<CCompoundInit>(node), init_type);
             break;
         default:
             RAISE_INTERNAL_ERROR;
@@ -2646,13 +2566,14 @@ static void resolve_initializer(CInitializer* node, std::shared_ptr<Type>& init_
 
 static void resolve_params_function_declaration(CFunctionDeclaration* node) {
     for (auto& param : node->params) {
-        if (context->scoped_identifier_maps.back().find(param) != context->scoped_identifier_maps.back().end()) {
+        if (is_scoped_identifier_in_scope(context->scoped_identifier_map, param)) {
             RAISE_RUNTIME_ERROR_AT_LINE(
                 GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::variable_redeclared_in_scope, get_name_hr(param)),
                 node->line);
         }
-        context->scoped_identifier_maps.back()[param] = resolve_variable_identifier(param);
-        param = context->scoped_identifier_maps.back()[param];
+        TIdentifier name = resolve_variable_identifier(param);
+        set_scoped_identifier(context->scoped_identifier_map, context->scoped_identifier_logs.back(), param, name);
+        param = name;
     }
     checktype_params_function_declaration(node);
 }
@@ -2672,7 +2593,7 @@ static void resolve_function_declaration(CFunctionDeclaration* node) {
     }
 
     if (context->external_linkage_scope_map.find(node->name) == context->external_linkage_scope_map.end()) {
-        if (context->scoped_identifier_maps.back().find(node->name) != context->scoped_identifier_maps.back().end()) {
+        if (is_scoped_identifier_in_scope(context->scoped_identifier_map, node->name)) {
             RAISE_RUNTIME_ERROR_AT_LINE(
                 GET_ERROR_MESSAGE(ERROR_MESSAGE_SEMANTIC::function_redeclared_in_scope, get_name_hr(node->name)),
                 node->line);
@@ -2680,7 +2601,8 @@ static void resolve_function_declaration(CFunctionDeclaration* node) {
         context->external_linkage_scope_map[node->name] = current_scope_depth();
     }
 
-    context->scoped_identifier_maps.back()[node->name] = node->name;
+    set_scoped_identifier(
+        context->scoped_identifier_map, context->scoped_identifier_logs.back(), node->name, node->name);
     checktype_return_function_declaration(node);
 
     enter_scope();
@@ -2700,7 +2622,8 @@ static void resolve_file_scope_variable_declaration(CVariableDeclaration* node)
         context->external_linkage_scope_map[node->name] = current_scope_depth();
     }
 
-    context->scoped_identifier_maps.back()[node->name] = node->name;
+    set_scoped_identifier(
+        context->scoped_identifier_map, context->scoped_identifier_logs.back(), node->name, node->name);
     if (is_file_scope()) {
         checktype_file_scope_variable_declaration(node);
     }
@@ -2710,7 +2633,7 @@ static void resolve_file_scope_variable_declaration(CVariableDeclaration* node)
 }
 
 static void resolve_block_scope_variable_declaration(CVariableDeclaration* node) {
-    if (context->scoped_identifier_maps.back().find(node->name) != context->scoped_identifier_maps.back().end()
+    if (is_scoped_identifier_in_scope(context->scoped_identifier_map, node->name)
         && !(context->external_linkage_scope_map.find(node->name) != context->external_linkage_scope_map.end()
              && (node->storage_class && node->storage_class->type() == AST_T::CExtern_t))) {
         RAISE_RUNTIME_ERROR_AT_LINE(
@@ -2722,8 +2645,11 @@ static void resolve_block_scope_variable_declaration(CVariableDeclaration* node)
         return;
     }
 
-    context->scoped_identifier_maps.back()[node->name] = resolve_variable_identifier(node->name);
-    node->name = context->scoped_identifier_maps.back()[node->name];
+    {
+        TIdentifier name = resolve_variable_identifier(node->name);
+        set_scoped_identifier(context->scoped_identifier_map, context->scoped_identifier_logs.back(), node->name, name);
+        node->name = name;
+    }
     checktype_block_scope_variable_declaration(node);
 
     if (node->init && !node->storage_class) {
@@ -2736,12 +2662,14 @@ static void resolve_members_structure_declaration(CStructDeclaration* node) {
 }
 
 static void resolve_structure_declaration(CStructDeclaration* node) {
-    if (context->scoped_structure_tag_maps.back().find(node->tag) != context->scoped_structure_tag_maps.back().end()) {
-        node->tag = context->scoped_structure_tag_maps.back()[node->tag];
+    if (is_scoped_identifier_in_scope(context->scoped_structure_tag_map, node->tag)) {
+        node->tag = get_scoped_identifier(context->scoped_structure_tag_map, node->tag)->name;
     }
     else {
-        context->scoped_structure_tag_maps.back()[node->tag] = resolve_structure_tag(node->tag);
-        node->tag = context->scoped_structure_tag_maps.back()[node->tag];
+        TIdentifier tag = resolve_structure_tag(node->tag);
+        set_scoped_identifier(
+            context->scoped_structure_tag_map, context->scoped_structure_tag_logs.back(), node->tag, tag);
+        node->tag = tag;
         context->structure_definition_set.insert(node->tag);
     }
     if (!node->members.empty()) {
@@ -2778,13 +2706,13 @@ static void resolve_struct_decl_declaration(CStructDecl* node) {
 static void resolve_declaration(CDeclaration* node) {
     switch (node->type()) {
         case AST_T::CFunDecl_t:
-            resolve_fun_decl_declaration(static_cast<CFunDecl*>(node));
+            resolve_fun_decl_declaration(ast_cast<CFunDecl>(node));
             break;
         case AST_T::CVarDecl_t:
-            resolve_var_decl_declaration(static_cast<CVarDecl*>(node));
+            resolve_var_decl_declaration(ast_cast<CVarDecl>(node));
             break;
         case AST_T::CStructDecl_t:
-            resolve_struct_decl_declaration(static_cast<CStructDecl*>(node));
+            resolve_struct_decl_declaration(ast_cast<CStructDecl>(node));
             break;
         default:
             RAISE_INTERNAL_ERROR;
@@ -88,30 +88,33 @@ static std::shared_ptr<TacVariable> represent_variable_value(CVar* node) {
     return std::make_shared<TacVariable>(std::move(name));
 }
 
-static std::shared_ptr<TacVariable> represent_inner_exp_value(CExp* node, std::shared_ptr<Type>&& inner_type) {
-    TIdentifier inner_name = represent_variable_identifier(node);
-    std::unique_ptr<IdentifierAttr> inner_attrs = std::make_unique<LocalAttr>();
-    frontend->symbol_table[inner_name] = std::make_unique<Symbol>(std::move(inner_type), std::move(inner_attrs));
+// Temporaries are local to the function, a rewound temporary counter names the same temporaries again
+static std::shared_ptr<TacVariable> represent_inner_exp_value(std::shared_ptr<Type>&& inner_type) {
+    TIdentifier inner_name = make_temp_identifier(context->temp_counter);
+    if (context->temp_counter == context->p_temp_types->size()) {
+        context->p_temp_types->push_back(std::move(inner_type));
+    }
+    context->temp_counter++;
     return std::make_shared<TacVariable>(std::move(inner_name));
 }
 
 static std::shared_ptr<TacValue> represent_plain_inner_value(CExp* node) {
     std::shared_ptr<Type> inner_type = node->exp_type;
-    return represent_inner_exp_value(node, std::move(inner_type));
+    return represent_inner_exp_value(std::move(inner_type));
 }
 
-static std::shared_ptr<TacValue> represent_pointer_inner_value(CExp* node) {
-    std::shared_ptr<Type> inner_type = std::make_shared<Long>();
-    return represent_inner_exp_value(node, std::move(inner_type));
+static std::shared_ptr<TacValue> represent_pointer_inner_value() {
+    std::shared_ptr<Type> inner_type = get_scalar_type(AST_T::Long_t);
+    return represent_inner_exp_value(std::move(inner_type));
 }
 
 // val = Constant(int) | Var(identifier)
 static std::shared_ptr<TacValue> represent_value(CExp* node) {
     switch (node->type()) {
         case AST_T::CConstant_t:
-            return represent_constant_value(static_cast<CConstant*>(node));
+            return represent_constant_value(ast_cast<CConstant>(node));
         case AST_T::CVar_t:
-            return represent_variable_value(static_cast<CVar*>(node));
+            return represent_variable_value(ast_cast<CVar>(node));
         default:
             RAISE_INTERNAL_ERROR;
     }
@@ -132,27 +135,25 @@ static std::unique_ptr<TacPlainOperand> represent_exp_result_constant_instructio
 static std::unique_ptr<TacPlainOperand> represent_exp_result_string_instructions(CString* node) {
     TIdentifier static_constant_label;
     {
-        TIdentifier string_constant = string_literal_to_string_constant(node->literal->value);
-        TIdentifier static_constant_hash = std::to_string(std::hash<std::string> {}(string_constant));
-        if (frontend->static_constant_table.find(static_constant_hash) != frontend->static_constant_table.end()) {
-            static_constant_label = frontend->static_constant_table[static_constant_hash];
+        TIdentifier string_constant = make_identifier(string_literal_to_string_constant(node->literal->value));
+        if (frontend->static_constant_table.find(string_constant) != frontend->static_constant_table.end()) {
+            static_constant_label = frontend->static_constant_table[string_constant];
         }
         else {
             static_constant_label = represent_label_identifier(LABEL_KIND::Lstring);
-            frontend->static_constant_table[static_constant_hash] = static_constant_label;
+            frontend->static_constant_table[string_constant] = static_constant_label;
             std::shared_ptr<Type> constant_type;
             {
                 TLong size = static_cast<TLong>(node->literal->value.size()) + 1l;
-                std::shared_ptr<Type> elem_type = std::make_shared<Char>();
-                constant_type = std::make_shared<Array>(std::move(size), std::move(elem_type));
+                std::shared_ptr<Type> elem_type = get_scalar_type(AST_T::Char_t);
+                constant_type = get_array_type(std::move(size), std::move(elem_type));
             }
             std::unique_ptr<IdentifierAttr> constant_attrs;
             {
                 std::shared_ptr<StaticInit> static_init;
                 {
-                    TIdentifier string_constant = string_literal_to_string_constant(node->literal->value);
                     std::shared_ptr<CStringLiteral> literal = node->literal;
-                    static_init = std::make_shared<StringInit>(true, std::move(string_constant), std::move(literal));
+                    static_init = std::make_shared<StringInit>(true, string_constant, std::move(literal));
                 }
                 constant_attrs = std::make_unique<ConstantAttr>(std::move(static_init));
             }
@@ -182,51 +183,6 @@ static bool is_type_signed(Type* type) {
     }
 }
 
-static TInt get_scalar_type_size(Type* type) {
-    switch (type->type()) {
-        case AST_T::Char_t:
-        case AST_T::SChar_t:
-        case AST_T::UChar_t:
-            return 1;
-        case AST_T::Int_t:
-        case AST_T::UInt_t:
-            return 4;
-        case AST_T::Long_t:
-        case AST_T::Double_t:
-        case AST_T::ULong_t:
-        case AST_T::Pointer_t:
-            return 8;
-        default:
-            RAISE_INTERNAL_ERROR;
-    }
-}
-
-static TLong get_type_scale(Type* type);
-
-static TLong get_array_aggregate_type_scale(Array* arr_type) {
-    TLong size = arr_type->size;
-    while (arr_type->elem_type->type() == AST_T::Array_t) {
-        arr_type = static_cast<Array*>(arr_type->elem_type.get());
-        size *= arr_type->size;
-    }
-    return get_type_scale(arr_type->elem_type.get()) * size;
-}
-
-static TLong get_structure_aggregate_type_scale(Structure* struct_type) {
-    return frontend->struct_typedef_table[struct_type->tag]->size;
-}
-
-static TLong get_type_scale(Type* type) {
-    switch (type->type()) {
-        case AST_T::Array_t:
-            return get_array_aggregate_type_scale(static_cast<Array*>(type));
-        case AST_T::Structure_t:
-            return get_structure_aggregate_type_scale(static_cast<Structure*>(type));
-        default:
-            return get_scalar_type_size(type);
-    }
-}
-
 static std::unique_ptr<TacPlainOperand> represent_complete_exp_result_cast_instructions(CCast* node) {
     std::shared_ptr<TacValue> src = represent_exp_instructions(node->exp.get());
     if (node->target_type->type() == node->exp->exp_type->type()) {
@@ -300,16 +256,16 @@ static std::unique_ptr<TacPlainOperand> represent_exp_result_from_to_pointer_bin
     std::shared_ptr<TacValue> src_ptr;
     std::shared_ptr<TacValue> index;
     if (node->exp_left->exp_type->type() == AST_T::Pointer_t) {
-        scale = get_type_scale(static_cast<Pointer*>(node->exp_left->exp_type.get())->ref_type.get());
+        scale = get_type_scale(ast_cast<Pointer>(node->exp_left->exp_type.get())->ref_type.get());
         src_ptr = represent_exp_instructions(node->exp_left.get());
         index = represent_exp_instructions(node->exp_right.get());
     }
     else {
-        scale = get_type_scale(static_cast<Pointer*>(node->exp_right->exp_type.get())->ref_type.get());
+        scale = get_type_scale(ast_cast<Pointer>(node->exp_right->exp_type.get())->ref_type.get());
         src_ptr = represent_exp_instructions(node->exp_right.get());
         index = represent_exp_instructions(node->exp_left.get());
     }
-    std::shared_ptr<TacValue> dst = represent_pointer_inner_value(node);
+    std::shared_ptr<TacValue> dst = represent_pointer_inner_value();
     push_instruction(std::make_unique<TacAddPtr>(std::move(scale), std::move(src_ptr), std::move(index), dst));
     return std::make_unique<TacPlainOperand>(std::move(dst));
 }
@@ -324,7 +280,7 @@ static std::unique_ptr<TacPlainOperand> represent_exp_result_binary_add_instruct
 }
 
 static std::unique_ptr<TacPlainOperand> represent_exp_result_to_pointer_binary_subtract_instructions(CBinary* node) {
-    TLong scale = get_type_scale(static_cast<Pointer*>(node->exp_left->exp_type.get())->ref_type.get());
+    TLong scale = get_type_scale(ast_cast<Pointer>(node->exp_left->exp_type.get())->ref_type.get());
     std::shared_ptr<TacValue> src_ptr = represent_exp_instructions(node->exp_left.get());
     std::shared_ptr<TacValue> index;
     {
@@ -334,7 +290,7 @@ static std::unique_ptr<TacPlainOperand> represent_exp_result_to_pointer_binary_s
         push_instruction(std::make_unique<TacUnary>(std::move(unary_op), std::move(index), dst));
         index = std::move(dst);
     }
-    std::shared_ptr<TacValue> dst = represent_pointer_inner_value(node);
+    std::shared_ptr<TacValue> dst = represent_pointer_inner_value();
     push_instruction(std::make_unique<TacAddPtr>(std::move(scale), std::move(src_ptr), std::move(index), dst));
     return std::make_unique<TacPlainOperand>(std::move(dst));
 }
@@ -351,7 +307,7 @@ static std::unique_ptr<TacPlainOperand> represent_exp_result_pointer_binary_subt
     }
     std::shared_ptr<TacValue> src_2;
     {
-        TLong value = get_type_scale(static_cast<Pointer*>(node->exp_left->exp_type.get())->ref_type.get());
+        TLong value = get_type_scale(ast_cast<Pointer>(node->exp_left->exp_type.get())->ref_type.get());
         std::shared_ptr<CConst> constant = std::make_shared<CConstLong>(std::move(value));
         src_2 = std::make_shared<TacConstant>(std::move(constant));
     }
@@ -485,27 +441,27 @@ static std::unique_ptr<TacExpResult> represent_exp_result_assignment_instruction
     }
     else {
         uint32_t label_counter_1 = frontend->label_counter;
-        uint32_t variable_counter_1 = frontend->variable_counter;
+        size_t temp_counter_1 = context->temp_counter;
         uint32_t structure_counter_1 = frontend->structure_counter;
 
         src = represent_exp_instructions(node->exp_right.get());
 
         uint32_t label_counter_2 = frontend->label_counter;
-        uint32_t variable_counter_2 = frontend->variable_counter;
+        size_t temp_counter_2 = context->temp_counter;
         uint32_t structure_counter_2 = frontend->structure_counter;
 
         frontend->label_counter = label_counter_1;
-        frontend->variable_counter = variable_counter_1;
+        context->temp_counter = temp_counter_1;
         frontend->structure_counter = structure_counter_1;
 
         {
             CExp* exp_left = node->exp_right.get();
             if (exp_left->type() == AST_T::CCast_t) {
-                exp_left = static_cast<CCast*>(exp_left)->exp.get();
+                exp_left = ast_cast<CCast>(exp_left)->exp.get();
             }
-            exp_left = static_cast<CBinary*>(exp_left)->exp_left.get();
+            exp_left = ast_cast<CBinary>(exp_left)->exp_left.get();
             if (exp_left->type() == AST_T::CCast_t) {
-                exp_left = static_cast<CCast*>(exp_left)->exp.get();
+                exp_left = ast_cast<CCast>(exp_left)->exp.get();
             }
 
             std::vector<std::unique_ptr<TacInstruction>> noeval_instructions;
@@ -516,22 +472,22 @@ static std::unique_ptr<TacExpResult> represent_exp_result_assignment_instruction
         }
 
         frontend->label_counter = label_counter_2;
-        frontend->variable_counter = variable_counter_2;
+        context->temp_counter = temp_counter_2;
         frontend->structure_counter = structure_counter_2;
     }
     switch (res->type()) {
         case AST_T::TacPlainOperand_t:
             represent_exp_result_plain_operand_assignment_instructions(
-                static_cast<TacPlainOperand*>(res.get()), std::move(src));
+                ast_cast<TacPlainOperand>(res.get()), std::move(src));
             break;
         case AST_T::TacDereferencedPointer_t: {
             res = represent_exp_result_dereference_pointer_assignment_instructions(
-                static_cast<TacDereferencedPointer*>(res.get()), std::move(src));
+                ast_cast<TacDereferencedPointer>(res.get()), std::move(src));
             break;
         }
         case AST_T::TacSubObject_t: {
             res = represent_exp_result_sub_object_assignment_instructions(
-                static_cast<TacSubObject*>(res.get()), std::move(src));
+                ast_cast<TacSubObject>(res.get()), std::move(src));
             break;
         }
         default:
@@ -608,9 +564,9 @@ static std::unique_ptr<TacDereferencedPointer> represent_exp_result_dereference_
     return std::make_unique<TacDereferencedPointer>(std::move(val));
 }
 
-static void represent_exp_result_plain_operand_addrof_instructions(TacPlainOperand* res, CAddrOf* node) {
+static void represent_exp_result_plain_operand_addrof_instructions(TacPlainOperand* res) {
     std::shared_ptr<TacValue> src = std::move(res->val);
-    std::shared_ptr<TacValue> dst = represent_pointer_inner_value(node);
+    std::shared_ptr<TacValue> dst = represent_pointer_inner_value();
     push_instruction(std::make_unique<TacGetAddress>(std::move(src), dst));
     res->val = std::move(dst);
 }
@@ -621,9 +577,8 @@ static std::unique_ptr<TacPlainOperand> represent_exp_result_dereference_pointer
     return std::make_unique<TacPlainOperand>(std::move(val));
 }
 
-static std::unique_ptr<TacPlainOperand> represent_exp_result_sub_object_addrof_instructions(
-    TacSubObject* res, CAddrOf* node) {
-    std::shared_ptr<TacValue> dst = represent_pointer_inner_value(node);
+static std::unique_ptr<TacPlainOperand> represent_exp_result_sub_object_addrof_instructions(TacSubObject* res) {
+    std::shared_ptr<TacValue> dst = represent_pointer_inner_value();
     {
         TIdentifier name = std::move(res->base_name);
         std::shared_ptr<TacValue> src = std::make_shared<TacVariable>(std::move(name));
@@ -645,15 +600,15 @@ static std::unique_ptr<TacExpResult> represent_exp_result_addrof_instructions(CA
     std::unique_ptr<TacExpResult> res = represent_exp_result_instructions(node->exp.get());
     switch (res->type()) {
         case AST_T::TacPlainOperand_t:
-            represent_exp_result_plain_operand_addrof_instructions(static_cast<TacPlainOperand*>(res.get()), node);
+            represent_exp_result_plain_operand_addrof_instructions(ast_cast<TacPlainOperand>(res.get()));
             break;
         case AST_T::TacDereferencedPointer_t: {
             res = represent_exp_result_dereference_pointer_addrof_instructions(
-                static_cast<TacDereferencedPointer*>(res.get()));
+                ast_cast<TacDereferencedPointer>(res.get()));
             break;
         }
         case AST_T::TacSubObject_t: {
-            res = represent_exp_result_sub_object_addrof_instructions(static_cast<TacSubObject*>(res.get()), node);
+            res = represent_exp_result_sub_object_addrof_instructions(ast_cast<TacSubObject>(res.get()));
             break;
         }
         default:
@@ -667,16 +622,16 @@ static std::unique_ptr<TacDereferencedPointer> represent_exp_result_subscript_in
     std::shared_ptr<TacValue> src_ptr;
     std::shared_ptr<TacValue> index;
     if (node->primary_exp->exp_type->type() == AST_T::Pointer_t) {
-        scale = get_type_scale(static_cast<Pointer*>(node->primary_exp->exp_type.get())->ref_type.get());
+        scale = get_type_scale(ast_cast<Pointer>(node->primary_exp->exp_type.get())->ref_type.get());
         src_ptr = represent_exp_instructions(node->primary_exp.get());
         index = represent_exp_instructions(node->subscript_exp.get());
     }
     else {
-        scale = get_type_scale(static_cast<Pointer*>(node->subscript_exp->exp_type.get())->ref_type.get());
+        scale = get_type_scale(ast_cast<Pointer>(node->subscript_exp->exp_type.get())->ref_type.get());
         src_ptr = represent_exp_instructions(node->subscript_exp.get());
         index = represent_exp_instructions(node->primary_exp.get());
     }
-    std::shared_ptr<TacValue> dst = represent_pointer_inner_value(node);
+    std::shared_ptr<TacValue> dst = represent_pointer_inner_value();
     push_instruction(std::make_unique<TacAddPtr>(std::move(scale), std::move(src_ptr), std::move(index), dst));
     return std::make_unique<TacDereferencedPointer>(std::move(dst));
 }
@@ -706,13 +661,13 @@ static std::unique_ptr<TacSubObject> represent_exp_result_plain_operand_dot_inst
     if (res->val->type() != AST_T::TacVariable_t) {
         RAISE_INTERNAL_ERROR;
     }
-    TIdentifier base_name = static_cast<TacVariable*>(res->val.get())->name;
+    TIdentifier base_name = ast_cast<TacVariable>(res->val.get())->name;
     TLong offset = member_offset;
     return std::make_unique<TacSubObject>(std::move(base_name), std::move(offset));
 }
 
 static void represent_exp_result_dereference_pointer_dot_instructions(
-    TacDereferencedPointer* res, CDot* node, TLong member_offset) {
+    TacDereferencedPointer* res, TLong member_offset) {
     if (member_offset > 0l) {
         std::shared_ptr<TacValue> src_ptr = std::move(res->val);
         std::shared_ptr<TacValue> index;
@@ -721,7 +676,7 @@ static void represent_exp_result_dereference_pointer_dot_instructions(
             std::shared_ptr<CConst> constant = std::make_shared<CConstLong>(std::move(offset));
             index = std::make_shared<TacConstant>(std::move(constant));
         }
-        std::shared_ptr<TacValue> dst = represent_pointer_inner_value(node);
+        std::shared_ptr<TacValue> dst = represent_pointer_inner_value();
         push_instruction(std::make_unique<TacAddPtr>(1l, std::move(src_ptr), std::move(index), dst));
         res->val = std::move(dst);
     }
@@ -736,21 +691,22 @@ static std::unique_ptr<TacExpResult> represent_exp_result_dot_instructions(CDot*
     if (node->structure->exp_type->type() != AST_T::Structure_t) {
         RAISE_INTERNAL_ERROR;
     }
-    Structure* struct_type = static_cast<Structure*>(node->structure->exp_type.get());
-    TLong member_offset = frontend->struct_typedef_table[struct_type->tag]->members[node->member]->offset;
+    Structure* struct_type = ast_cast<Structure>(node->structure->exp_type.get());
+    TLong member_offset =
+        get_struct_typedef_member(frontend->struct_typedef_table[struct_type->tag].get(), node->member)->offset;
     std::unique_ptr<TacExpResult> res = represent_exp_result_instructions(node->structure.get());
     switch (res->type()) {
         case AST_T::TacPlainOperand_t: {
             res = represent_exp_result_plain_operand_dot_instructions(
-                static_cast<TacPlainOperand*>(res.get()), member_offset);
+                ast_cast<TacPlainOperand>(res.get()), member_offset);
             break;
         }
         case AST_T::TacDereferencedPointer_t:
             represent_exp_result_dereference_pointer_dot_instructions(
-                static_cast<TacDereferencedPointer*>(res.get()), node, member_offset);
+                ast_cast<TacDereferencedPointer>(res.get()), member_offset);
             break;
         case AST_T::TacSubObject_t:
-            represent_exp_result_sub_object_dot_instructions(static_cast<TacSubObject*>(res.get()), member_offset);
+            represent_exp_result_sub_object_dot_instructions(ast_cast<TacSubObject>(res.get()), member_offset);
             break;
         default:
             RAISE_INTERNAL_ERROR;
@@ -762,12 +718,13 @@ static std::unique_ptr<TacDereferencedPointer> represent_exp_result_arrow_instru
     if (node->pointer->exp_type->type() != AST_T::Pointer_t) {
         RAISE_INTERNAL_ERROR;
     }
-    Pointer* ptr_type = static_cast<Pointer*>(node->pointer->exp_type.get());
+    Pointer* ptr_type = ast_cast<Pointer>(node->pointer->exp_type.get());
     if (ptr_type->ref_type->type() != AST_T::Structure_t) {
         RAISE_INTERNAL_ERROR;
     }
-    Structure* struct_type = static_cast<Structure*>(ptr_type->ref_type.get());
-    TLong member_offset = frontend->struct_typedef_table[struct_type->tag]->members[node->member]->offset;
+    Structure* struct_type = ast_cast<Structure>(ptr_type->ref_type.get());
+    TLong member_offset =
+        get_struct_typedef_member(frontend->struct_typedef_table[struct_type->tag].get(), node->member)->offset;
     std::shared_ptr<TacValue> val = represent_exp_instructions(node->pointer.get());
     if (member_offset > 0l) {
         std::shared_ptr<TacValue> index;
@@ -776,7 +733,7 @@ static std::unique_ptr<TacDereferencedPointer> represent_exp_result_arrow_instru
             std::shared_ptr<CConst> constant = std::make_shared<CConstLong>(std::move(offset));
             index = std::make_shared<TacConstant>(std::move(constant));
         }
-        std::shared_ptr<TacValue> dst = represent_pointer_inner_value(node);
+        std::shared_ptr<TacValue> dst = represent_pointer_inner_value();
         push_instruction(std::make_unique<TacAddPtr>(1l, std::move(val), std::move(index), dst));
         val = std::move(dst);
     }
@@ -786,37 +743,37 @@ static std::unique_ptr<TacDereferencedPointer> represent_exp_result_arrow_instru
 static std::unique_ptr<TacExpResult> represent_exp_result_instructions(CExp* node) {
     switch (node->type()) {
         case AST_T::CConstant_t:
-            return represent_exp_result_constant_instructions(static_cast<CConstant*>(node));
+            return represent_exp_result_constant_instructions(ast_cast<CConstant>(node));
         case AST_T::CString_t:
-            return represent_exp_result_string_instructions(static_cast<CString*>(node));
+            return represent_exp_result_string_instructions(ast_cast<CString>(node));
         case AST_T::CVar_t:
-            return represent_exp_result_var_instructions(static_cast<CVar*>(node));
+            return represent_exp_result_var_instructions(ast_cast<CVar>(node));
         case AST_T::CCast_t:
-            return represent_exp_result_cast_instructions(static_cast<CCast*>(node));
+            return represent_exp_result_cast_instructions(ast_cast<CCast>(node));
         case AST_T::CUnary_t:
-            return represent_exp_result_unary_instructions(static_cast<CUnary*>(node));
+            return represent_exp_result_unary_instructions(ast_cast<CUnary>(node));
         case AST_T::CBinary_t:
-            return represent_exp_result_binary_instructions(static_cast<CBinary*>(node));
+            return represent_exp_result_binary_instructions(ast_cast<CBinary>(node));
         case AST_T::CAssignment_t:
-            return represent_exp_result_assignment_instructions(static_cast<CAssignment*>(node));
+            return represent_exp_result_assignment_instructions(ast_cast<CAssignment>(node));
         case AST_T::CConditional_t:
-            return represent_exp_result_conditional_instructions(static_cast<CConditional*>(node));
+            return represent_exp_result_conditional_instructions(ast_cast<CConditional>(node));
         case AST_T::CFunctionCall_t:
-            return represent_exp_result_fun_call_instructions(static_cast<CFunctionCall*>(node));
+            return represent_exp_result_fun_call_instructions(ast_cast<CFunctionCall>(node));
         case AST_T::CDereference_t:
-            return represent_exp_result_dereference_instructions(static_cast<CDereference*>(node));
+            return represent_exp_result_dereference_instructions(ast_cast<CDereference>(node));
         case AST_T::CAddrOf_t:
-            return represent_exp_result_addrof_instructions(static_cast<CAddrOf*>(node));
+            return represent_exp_result_addrof_instructions(ast_cast<CAddrOf>(node));
         case AST_T::CSubscript_t:
-            return represent_exp_result_subscript_instructions(static_cast<CSubscript*>(node));
+            return represent_exp_result_subscript_instructions(ast_cast<CSubscript>(node));
         case AST_T::CSizeOf_t:
-            return represent_exp_result_sizeof_instructions(static_cast<CSizeOf*>(node));
+            return represent_exp_result_sizeof_instructions(ast_cast<CSizeOf>(node));
         case AST_T::CSizeOfT_t:
-            return represent_exp_result_sizeoft_instructions(static_cast<CSizeOfT*>(node));
+            return represent_exp_result_sizeoft_instructions(ast_cast<CSizeOfT>(node));
         case AST_T::CDot_t:
-            return represent_exp_result_dot_instructions(static_cast<CDot*>(node));
+            return represent_exp_result_dot_instructions(ast_cast<CDot>(node));
         case AST_T::CArrow_t:
-            return represent_exp_result_arrow_instructions(static_cast<CArrow*>(node));
+            return represent_exp_result_arrow_instructions(ast_cast<CArrow>(node));
         default:
             RAISE_INTERNAL_ERROR;
     }
@@ -848,12 +805,12 @@ static std::shared_ptr<TacValue> represent_exp_instructions(CExp* node) {
     std::unique_ptr<TacExpResult> res = represent_exp_result_instructions(node);
     switch (res->type()) {
         case AST_T::TacPlainOperand_t:
-            return represent_exp_plain_operand_instructions(static_cast<TacPlainOperand*>(res.get()));
+            return represent_exp_plain_operand_instructions(ast_cast<TacPlainOperand>(res.get()));
         case AST_T::TacDereferencedPointer_t:
             return represent_exp_dereferenced_pointer_instructions(
-                static_cast<TacDereferencedPointer*>(res.get()), node);
+                ast_cast<TacDereferencedPointer>(res.get()), node);
         case AST_T::TacSubObject_t:
-            return represent_exp_sub_object_instructions(static_cast<TacSubObject*>(res.get()), node);
+            return represent_exp_sub_object_instructions(ast_cast<TacSubObject>(res.get()), node);
         default:
             RAISE_INTERNAL_ERROR;
     }
@@ -923,8 +880,8 @@ static void represent_statement_label_instructions(CLabel* node) {
 static void represent_statement_compound_instructions(CCompound* node) { represent_block(node->block.get()); }
 
 static void represent_statement_while_instructions(CWhile* node) {
-    TIdentifier target_continue = "continue_" + node->target;
-    TIdentifier target_break = "break_" + node->target;
+    TIdentifier target_continue = make_identifier("continue_" + get_identifier_name(node->target));
+    TIdentifier target_break = make_identifier("break_" + get_identifier_name(node->target));
     push_instruction(std::make_unique<TacLabel>(target_continue));
     {
         std::shared_ptr<TacValue> condition = represent_exp_instructions(node->condition.get());
@@ -937,8 +894,8 @@ static void represent_statement_while_instructions(CWhile* node) {
 
 static void represent_statement_do_while_instructions(CDoWhile* node) {
     TIdentifier target_do_while_start = represent_label_identifier(LABEL_KIND::Ldo_while_start);
-    TIdentifier target_continue = "continue_" + node->target;
-    TIdentifier target_break = "break_" + node->target;
+    TIdentifier target_continue = make_identifier("continue_" + get_identifier_name(node->target));
+    TIdentifier target_break = make_identifier("break_" + get_identifier_name(node->target));
     push_instruction(std::make_unique<TacLabel>(target_do_while_start));
     represent_statement_instructions(node->body.get());
     push_instruction(std::make_unique<TacLabel>(std::move(target_continue)));
@@ -962,10 +919,10 @@ static void represent_for_init_exp_instructions(CInitExp* node) {
 static void represent_statement_for_init_instructions(CForInit* node) {
     switch (node->type()) {
         case AST_T::CInitDecl_t:
-            represent_for_init_decl_instructions(static_cast<CInitDecl*>(node));
+            represent_for_init_decl_instructions(ast_cast<CInitDecl>(node));
             break;
         case AST_T::CInitExp_t:
-            represent_for_init_exp_instructions(static_cast<CInitExp*>(node));
+            represent_for_init_exp_instructions(ast_cast<CInitExp>(node));
             break;
         default:
             RAISE_INTERNAL_ERROR;
@@ -974,8 +931,8 @@ static void represent_statement_for_init_instructions(CForInit* node) {
 
 static void represent_statement_for_instructions(CFor* node) {
     TIdentifier target_for_start = represent_label_identifier(LABEL_KIND::Lfor_start);
-    TIdentifier target_break = "break_" + node->target;
-    TIdentifier target_continue = "continue_" + node->target;
+    TIdentifier target_break = make_identifier("break_" + get_identifier_name(node->target));
+    TIdentifier target_continue = make_identifier("continue_" + get_identifier_name(node->target));
     represent_statement_for_init_instructions(node->init.get());
     push_instruction(std::make_unique<TacLabel>(target_for_start));
     if (node->condition) {
@@ -992,49 +949,49 @@ static void represent_statement_for_instructions(CFor* node) {
 }
 
 static void represent_statement_break_instructions(CBreak* node) {
-    TIdentifier target_break = "break_" + node->target;
+    TIdentifier target_break = make_identifier("break_" + get_identifier_name(node->target));
     push_instruction(std::make_unique<TacJump>(std::move(target_break)));
 }
 
 static void represent_statement_continue_instructions(CContinue* node) {
-    TIdentifier target_continue = "continue_" + node->target;
+    TIdentifier target_continue = make_identifier("continue_" + get_identifier_name(node->target));
     push_instruction(std::make_unique<TacJump>(std::move(target_continue)));
 }
 
 static void represent_statement_instructions(CStatement* node) {
     switch (node->type()) {
         case AST_T::CReturn_t:
-            represent_statement_return_instructions(static_cast<CReturn*>(node));
+            represent_statement_return_instructions(ast_cast<CReturn>(node));
             break;
         case AST_T::CExpression_t:
-            represent_statement_expression_instructions(static_cast<CExpression*>(node));
+            represent_statement_expression_instructions(ast_cast<CExpression>(node));
             break;
         case AST_T::CIf_t:
-            represent_statement_if_instructions(static_cast<CIf*>(node));
+            represent_statement_if_instructions(ast_cast<CIf>(node));
             break;
         case AST_T::CGoto_t:
-            represent_statement_goto_instructions(static_cast<CGoto*>(node));
+            represent_statement_goto_instructions(ast_cast<CGoto>(node));
             break;
         case AST_T::CLabel_t:
-            represent_statement_label_instructions(static_cast<CLabel*>(node));
+            represent_statement_label_instructions(ast_cast<CLabel>(node));
             break;
         case AST_T::CCompound_t:
-            represent_statement_compound_instructions(static_cast<CCompound*>(node));
+            represent_statement_compound_instructions(ast_cast<CCompound>(node));
             break;
         case AST_T::CWhile_t:
-            represent_statement_while_instructions(static_cast<CWhile*>(node));
+            represent_statement_while_instructions(ast_cast<CWhile>(node));
             break;
         case AST_T::CDoWhile_t:
-            represent_statement_do_while_instructions(static_cast<CDoWhile*>(node));
+            represent_statement_do_while_instructions(ast_cast<CDoWhile>(node));
             break;
         case AST_T::CFor_t:
-            represent_statement_for_instructions(static_cast<CFor*>(node));
+            represent_statement_for_instructions(ast_cast<CFor>(node));
             break;
         case AST_T::CBreak_t:
-            represent_statement_break_instructions(static_cast<CBreak*>(node));
+            represent_statement_break_instructions(ast_cast<CBreak>(node));
             break;
         case AST_T::CContinue_t:
-            represent_statement_continue_instructions(static_cast<CContinue*>(node));
+            represent_statement_continue_instructions(ast_cast<CContinue>(node));
             break;
         case AST_T::CNull_t:
             break;
@@ -1044,10 +1001,10 @@ static void represent_statement_instructions(CStatement* node) {
 }
 
 static void represent_compound_init_instructions(
-    CInitializer* node, Type* init_type, const TIdentifier& symbol, TLong& size);
+    CInitializer* node, Type* init_type, TIdentifier symbol, TLong& size);
 
 static void represent_array_single_init_string_instructions(
-    CString* node, Array* arr_type, const TIdentifier& symbol, TLong size) {
+    CString* node, Array* arr_type, TIdentifier symbol, TLong size) {
     size_t byte_at = 0;
 
     size_t bytes_size = static_cast<size_t>(arr_type->size);
@@ -1083,37 +1040,18 @@ static void represent_array_single_init_string_instructions(
         push_instruction(std::make_unique<TacCopyToOffset>(std::move(dst_name), std::move(offset), std::move(src)));
     }
 
-    while (byte_at < bytes_size) {
+    if (byte_at < bytes_size) {
         TIdentifier dst_name = symbol;
         TLong offset = size + static_cast<TLong>(byte_at);
-        std::shared_ptr<TacValue> src;
-        {
-            std::shared_ptr<CConst> constant;
-            {
-                size_t bytes_left = bytes_size - byte_at;
-                if (bytes_left < 4) {
-                    constant = std::make_shared<CConstChar>(0);
-                    byte_at++;
-                }
-                else if (bytes_left < 8) {
-                    constant = std::make_shared<CConstInt>(0);
-                    byte_at += 4;
-                }
-                else {
-                    constant = std::make_shared<CConstLong>(0l);
-                    byte_at += 8;
-                }
-            }
-            src = std::make_shared<TacConstant>(std::move(constant));
-        }
-        push_instruction(std::make_unique<TacCopyToOffset>(std::move(dst_name), std::move(offset), std::move(src)));
+        TLong byte = static_cast<TLong>(bytes_size - byte_at);
+        push_instruction(std::make_unique<TacZeroFill>(std::move(dst_name), std::move(offset), std::move(byte)));
     }
 }
 
-static void represent_single_init_instructions(CSingleInit* node, Type* init_type, const TIdentifier& symbol) {
+static void represent_single_init_instructions(CSingleInit* node, Type* init_type, TIdentifier symbol) {
     if (node->exp->type() == AST_T::CString_t && init_type->type() == AST_T::Array_t) {
         represent_array_single_init_string_instructions(
-            static_cast<CString*>(node->exp.get()), static_cast<Array*>(init_type), symbol, 0l);
+            ast_cast<CString>(node->exp.get()), ast_cast<Array>(init_type), symbol, 0l);
     }
     else {
         std::shared_ptr<TacValue> src = represent_exp_instructions(node->exp.get());
@@ -1128,10 +1066,10 @@ static void represent_single_init_instructions(CSingleInit* node, Type* init_typ
 }
 
 static void represent_scalar_compound_init_instructions(
-    CSingleInit* node, Type* init_type, const TIdentifier& symbol, TLong& size) {
+    CSingleInit* node, Type* init_type, TIdentifier symbol, TLong& size) {
     if (node->exp->type() == AST_T::CString_t && init_type->type() == AST_T::Array_t) {
         represent_array_single_init_string_instructions(
-            static_cast<CString*>(node->exp.get()), static_cast<Array*>(init_type), symbol, size);
+            ast_cast<CString>(node->exp.get()), ast_cast<Array>(init_type), symbol, size);
     }
     else {
         TIdentifier dst_name = symbol;
@@ -1141,8 +1079,16 @@ static void represent_scalar_compound_init_instructions(
     }
 }
 
+static void represent_zero_compound_init_instructions(CZeroInit* node, TIdentifier symbol, TLong& size) {
+    TIdentifier dst_name = symbol;
+    TLong offset = size;
+    TLong byte = node->byte;
+    push_instruction(std::make_unique<TacZeroFill>(std::move(dst_name), std::move(offset), std::move(byte)));
+    size += node->byte;
+}
+
 static void represent_array_compound_init_instructions(
-    CCompoundInit* node, Array* arr_type, const TIdentifier& symbol, TLong& size) {
+    CCompoundInit* node, Array* arr_type, TIdentifier symbol, TLong& size) {
     for (const auto& initializer : node->initializers) {
         represent_compound_init_instructions(initializer.get(), arr_type->elem_type.get(), symbol, size);
         if (initializer->type() == AST_T::CSingleInit_t) {
@@ -1152,9 +1098,10 @@ static void represent_array_compound_init_instructions(
 }
 
 static void represent_structure_compound_init_instructions(
-    CCompoundInit* node, Structure* struct_type, const TIdentifier& symbol, TLong& size) {
+    CCompoundInit* node, Structure* struct_type, TIdentifier symbol, TLong& size) {
+    StructTypedef* struct_typedef = frontend->struct_typedef_table[struct_type->tag].get();
     for (size_t i = 0; i < node->initializers.size(); ++i) {
-        const auto& member = GET_STRUCT_TYPEDEF_MEMBER(struct_type->tag, i);
+        StructMember* member = &struct_typedef->members[i];
         TLong offset = size + member->offset;
         represent_compound_init_instructions(node->initializers[i].get(), member->member_type.get(), symbol, offset);
     }
@@ -1162,13 +1109,13 @@ static void represent_structure_compound_init_instructions(
 }
 
 static void represent_aggregate_compound_init_instructions(
-    CCompoundInit* node, Type* init_type, const TIdentifier& symbol, TLong& size) {
+    CCompoundInit* node, Type* init_type, TIdentifier symbol, TLong& size) {
     switch (init_type->type()) {
         case AST_T::Array_t:
-            represent_array_compound_init_instructions(node, static_cast<Array*>(init_type), symbol, size);
+            represent_array_compound_init_instructions(node, ast_cast<Array>(init_type), symbol, size);
             break;
         case AST_T::Structure_t:
-            represent_structure_compound_init_instructions(node, static_cast<Structure*>(init_type), symbol, size);
+            represent_structure_compound_init_instructions(node, ast_cast<Structure>(init_type), symbol, size);
             break;
         default:
             RAISE_INTERNAL_ERROR;
@@ -1176,13 +1123,16 @@ static void represent_aggregate_compound_init_instructions(
 }
 
 static void represent_compound_init_instructions(
-    CInitializer* node, Type* init_type, const TIdentifier& symbol, TLong& size) {
+    CInitializer* node, Type* init_type, TIdentifier symbol, TLong& size) {
     switch (node->type()) {
         case AST_T::CSingleInit_t:
-            represent_scalar_compound_init_instructions(static_cast<CSingleInit*>(node), init_type, symbol, size);
+            represent_scalar_compound_init_instructions(ast_cast<CSingleInit>(node), init_type, symbol, size);
             break;
         case AST_T::CCompoundInit_t:
-            represent_aggregate_compound_init_instructions(static_cast<CCompoundInit*>(node), init_type, symbol, size);
+            represent_aggregate_compound_init_instructions(ast_cast<CCompoundInit>(node), init_type, symbol, size);
+            break;
+        case AST_T::CZeroInit_t:
+            represent_zero_compound_init_instructions(ast_cast<CZeroInit>(node), symbol, size);
             break;
         default:
             RAISE_INTERNAL_ERROR;
@@ -1192,12 +1142,12 @@ static void represent_compound_init_instructions(
 static void represent_variable_declaration_instructions(CVariableDeclaration* node) {
     switch (node->init->type()) {
         case AST_T::CSingleInit_t:
-            represent_single_init_instructions(static_cast<CSingleInit*>(node->init.get()),
+            represent_single_init_instructions(ast_cast<CSingleInit>(node->init.get()),
                 frontend->symbol_table[node->name]->type_t.get(), node->name);
             break;
         case AST_T::CCompoundInit_t: {
             TLong size = 0l;
-            represent_aggregate_compound_init_instructions(static_cast<CCompoundInit*>(node->init.get()),
+            represent_aggregate_compound_init_instructions(ast_cast<CCompoundInit>(node->init.get()),
                 frontend->symbol_table[node->name]->type_t.get(), node->name, size);
             break;
         }
@@ -1221,7 +1171,7 @@ static void represent_declaration_instructions(CDeclaration* node) {
         case AST_T::CStructDecl_t:
             break;
         case AST_T::CVarDecl_t:
-            represent_declaration_var_decl_instructions(static_cast<CVarDecl*>(node));
+            represent_declaration_var_decl_instructions(ast_cast<CVarDecl>(node));
             break;
         default:
             RAISE_INTERNAL_ERROR;
@@ -1233,16 +1183,16 @@ static void represent_declaration_instructions(CDeclaration* node) {
 //             | TacUIntToDouble(val, val) | FunCall(identifier, val*, val?) | Unary(unary_operator, val, val)
 //             | Binary(binary_operator, val, val, val) | Copy(val, val) | GetAddress(val, val) | Load(val, val)
 //             | Store(val, val) | AddPtr(int, val, val, val) | CopyToOffset(identifier, int, val)
-//             | CopyFromOffset(identifier, int, val) | Jump(identifier) | JumpIfZero(val, identifier)
-//             | JumpIfNotZero(val, identifier) | Label(identifier)
+//             | CopyFromOffset(identifier, int, val) | ZeroFill(identifier, int, int) | Jump(identifier)
+//             | JumpIfZero(val, identifier) | JumpIfNotZero(val, identifier) | Label(identifier)
 static void represent_list_instructions(const std::vector<std::unique_ptr<CBlockItem>>& list_node) {
     for (const auto& block_item : list_node) {
         switch (block_item->type()) {
             case AST_T::CS_t:
-                represent_statement_instructions(static_cast<CS*>(block_item.get())->statement.get());
+                represent_statement_instructions(ast_cast<CS>(block_item.get())->statement.get());
                 break;
             case AST_T::CD_t:
-                represent_declaration_instructions(static_cast<CD*>(block_item.get())->declaration.get());
+                represent_declaration_instructions(ast_cast<CD>(block_item.get())->declaration.get());
                 break;
             default:
                 RAISE_INTERNAL_ERROR;
@@ -1253,7 +1203,7 @@ static void represent_list_instructions(const std::vector<std::unique_ptr<CBlock
 static void represent_block(CBlock* node) {
     switch (node->type()) {
         case AST_T::CB_t:
-            represent_list_instructions(static_cast<CB*>(node)->block_items);
+            represent_list_instructions(ast_cast<CB>(node)->block_items);
             break;
         default:
             RAISE_INTERNAL_ERROR;
@@ -1262,13 +1212,16 @@ static void represent_block(CBlock* node) {
 
 static std::unique_ptr<TacFunction> represent_function_top_level(CFunctionDeclaration* node) {
     TIdentifier name = node->name;
-    bool is_global = static_cast<FunAttr*>(frontend->symbol_table[node->name]->attrs.get())->is_global;
+    bool is_global = ast_cast<FunAttr>(frontend->symbol_table[node->name]->attrs.get())->is_global;
 
     std::vector<TIdentifier> params(node->params.begin(), node->params.end());
 
     std::vector<std::unique_ptr<TacInstruction>> body;
+    std::vector<std::shared_ptr<Type>> temp_types;
     {
         context->p_instructions = &body;
+        context->p_temp_types = &temp_types;
+        context->temp_counter = 0;
         represent_block(node->body.get());
         {
             std::shared_ptr<CConst> constant = std::make_shared<CConstInt>(0);
@@ -1276,9 +1229,11 @@ static std::unique_ptr<TacFunction> represent_function_top_level(CFunctionDeclar
             push_instruction(std::make_unique<TacReturn>(std::move(val)));
         }
         context->p_instructions = nullptr;
+        context->p_temp_types = nullptr;
     }
 
-    return std::make_unique<TacFunction>(std::move(name), std::move(is_global), std::move(params), std::move(body));
+    return std::make_unique<TacFunction>(
+        std::move(name), std::move(is_global), std::move(params), std::move(body), std::move(temp_types));
 }
 
 static void push_top_level(std::unique_ptr<TacTopLevel>&& top_level) {
@@ -1291,11 +1246,11 @@ static void represent_fun_decl_top_level(CFunDecl* node) {
     }
 }
 
-// (function) top_level = Function(identifier, bool, identifier*, instruction*)
+// (function) top_level = Function(identifier, bool, identifier*, instruction*, type*)
 static void represent_declaration_top_level(CDeclaration* node) {
     switch (node->type()) {
         case AST_T::CFunDecl_t:
-            represent_fun_decl_top_level(static_cast<CFunDecl*>(node));
+            represent_fun_decl_top_level(ast_cast<CFunDecl>(node));
             break;
         case AST_T::CVarDecl_t:
         case AST_T::CStructDecl_t:
@@ -1320,8 +1275,8 @@ static std::vector<std::shared_ptr<StaticInit>> represent_initial_static_variabl
     return static_inits;
 }
 
-static void represent_static_variable_top_level(Symbol* node, const TIdentifier& symbol) {
-    StaticAttr* static_attr = static_cast<StaticAttr*>(node->attrs.get());
+static void represent_static_variable_top_level(Symbol* node, TIdentifier symbol) {
+    StaticAttr* static_attr = ast_cast<StaticAttr>(node->attrs.get());
     if (static_attr->init->type() == AST_T::NoInitializer_t) {
         return;
     }
@@ -1335,7 +1290,7 @@ static void represent_static_variable_top_level(Symbol* node, const TIdentifier&
             static_inits = represent_tentative_static_variable_top_level(static_init_type.get());
             break;
         case AST_T::Initial_t:
-            static_inits = represent_initial_static_variable_top_level(static_cast<Initial*>(static_attr->init.get()));
+            static_inits = represent_initial_static_variable_top_level(ast_cast<Initial>(static_attr->init.get()));
             break;
         default:
             RAISE_INTERNAL_ERROR;
@@ -1349,17 +1304,17 @@ static void push_static_constant_top_levels(std::unique_ptr<TacTopLevel>&& stati
     context->p_static_constant_top_levels->push_back(std::move(static_constant_top_levels));
 }
 
-static void represent_static_constant_top_level(Symbol* node, const TIdentifier& symbol) {
+static void represent_static_constant_top_level(Symbol* node, TIdentifier symbol) {
     TIdentifier name = symbol;
     std::shared_ptr<Type> static_init_type = node->type_t;
-    std::shared_ptr<StaticInit> static_init = static_cast<ConstantAttr*>(node->attrs.get())->static_init;
+    std::shared_ptr<StaticInit> static_init = ast_cast<ConstantAttr>(node->attrs.get())->static_init;
     push_static_constant_top_levels(
         std::make_unique<TacStaticConstant>(std::move(name), std::move(static_init_type), std::move(static_init)));
 }
 
 // (static variable) top_level = StaticVariable(identifier, bool, type, static_init*)
 // (static constant) top_level = StaticConstant(identifier, type, static_init)
-static void represent_symbol_top_level(Symbol* node, const TIdentifier& symbol) {
+static void represent_symbol_top_level(Symbol* node, TIdentifier symbol) {
     switch (node->attrs->type()) {
         case AST_T::StaticAttr_t:
             represent_static_variable_top_level(node, symbol);
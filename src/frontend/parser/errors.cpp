@@ -162,9 +162,12 @@ std::string get_token_kind_hr(TOKEN_KIND token_kind) {
     }
 }
 
-std::string get_name_hr(const TIdentifier& name) { return name.substr(0, name.find('.')); }
+std::string get_name_hr(TIdentifier name) {
+    const std::string& name_hr = get_identifier_name(name);
+    return name_hr.substr(0, name_hr.find('.'));
+}
 
-std::string get_struct_name_hr(const TIdentifier& name) {
+std::string get_struct_name_hr(TIdentifier name) {
     std::string type_hr = get_name_hr(name);
     return "struct " + type_hr;
 }
@@ -187,7 +190,7 @@ static std::string get_function_type_hr(FunType* fun_type) {
 static std::string get_pointer_type_hr(Pointer* ptr_type) {
     std::string ptr_type_hr = "*";
     while (ptr_type->ref_type->type() == Pointer_t) {
-        ptr_type = static_cast<Pointer*>(ptr_type->ref_type.get());
+        ptr_type = ast_cast<Pointer>(ptr_type->ref_type.get());
         ptr_type_hr += "*";
     }
     std::string type_hr = get_type_hr(ptr_type->ref_type.get());
@@ -197,7 +200,7 @@ static std::string get_pointer_type_hr(Pointer* ptr_type) {
 static std::string get_array_type_hr(Array* arr_type) {
     std::string array_type_hr = "[" + std::to_string(arr_type->size) + "]";
     while (arr_type->elem_type->type() == Array_t) {
-        arr_type = static_cast<Array*>(arr_type->elem_type.get());
+        arr_type = ast_cast<Array>(arr_type->elem_type.get());
         array_type_hr += "[" + std::to_string(arr_type->size) + "]";
     }
     std::string type_hr = get_type_hr(arr_type->elem_type.get());
@@ -227,13 +230,13 @@ std::string get_type_hr(Type* type) {
         case AST_T::Void_t:
             return "void";
         case AST_T::FunType_t:
-            return get_function_type_hr(static_cast<FunType*>(type));
+            return get_function_type_hr(ast_cast<FunType>(type));
         case AST_T::Pointer_t:
-            return get_pointer_type_hr(static_cast<Pointer*>(type));
+            return get_pointer_type_hr(ast_cast<Pointer>(type));
         case AST_T::Array_t:
-            return get_array_type_hr(static_cast<Array*>(type));
+            return get_array_type_hr(ast_cast<Array>(type));
         case AST_T::Structure_t:
-            return get_structure_type_hr(static_cast<Structure*>(type));
+            return get_structure_type_hr(ast_cast<Structure>(type));
         default:
             RAISE_INTERNAL_ERROR;
     }
@@ -369,10 +372,20 @@ std::string get_what_message(ERROR_MESSAGE_ARGUMENT message) {
             return "no debug code passed in first argument";
         case ERROR_MESSAGE_ARGUMENT::invalid_debug_code_in_argument:
             return "invalid debug code %s passed in first argument";
+        case ERROR_MESSAGE_ARGUMENT::no_lexer_code_in_argument:
+            return "no lexer code passed in second argument";
+        case ERROR_MESSAGE_ARGUMENT::invalid_lexer_code_in_argument:
+            return "invalid lexer code %s passed in second argument";
+        case ERROR_MESSAGE_ARGUMENT::no_cache_directory_in_argument:
+            return "no token cache directory passed after lexer code";
+        case ERROR_MESSAGE_ARGUMENT::no_optim_code_in_argument:
+            return "no optimization code passed after lexer code";
+        case ERROR_MESSAGE_ARGUMENT::invalid_optim_code_in_argument:
+            return "invalid optimization code %s passed after lexer code";
         case ERROR_MESSAGE_ARGUMENT::no_input_files_in_argument:
-            return "no input file passed in second argument";
+            return "no input file passed after optimization code";
         case ERROR_MESSAGE_ARGUMENT::no_include_directories_in_argument:
-            return "no include directories passed in third argument";
+            return "no include directories passed after input file";
         default:
             RAISE_INTERNAL_ERROR;
     }
@@ -401,6 +414,38 @@ std::string get_what_message(ERROR_MESSAGE_LEXER message) {
             return "found invalid token %s";
         case ERROR_MESSAGE_LEXER::failed_to_include_header_file:
             return "cannot find %s header file in " + em("include") + " directive search";
+        case ERROR_MESSAGE_LEXER::include_nested_too_deeply:
+            return "cannot include %s header file, " + em("include") + " directives are nested too deeply";
+        case ERROR_MESSAGE_LEXER::invalid_preprocessor_directive:
+            return "found invalid preprocessor directive %s";
+        case ERROR_MESSAGE_LEXER::error_directive:
+            return "found " + em("error") + " directive %s";
+        case ERROR_MESSAGE_LEXER::invalid_macro_name:
+            return "found token %s, but expected macro name in %s directive";
+        case ERROR_MESSAGE_LEXER::invalid_macro_parameter_list:
+            return "found token %s, but expected macro parameter in definition of macro %s";
+        case ERROR_MESSAGE_LEXER::stringify_without_macro_parameter:
+            return "found operator " + em("#") + ", but expected macro parameter next in definition of macro %s";
+        case ERROR_MESSAGE_LEXER::token_paste_at_macro_boundary:
+            return "found operator " + em("##") + " at either end of definition of macro %s";
+        case ERROR_MESSAGE_LEXER::invalid_token_paste:
+            return "pasting %s and %s does not give a valid token";
+        case ERROR_MESSAGE_LEXER::unterminated_macro_argument_list:
+            return "unterminated argument list invoking macro %s";
+        case ERROR_MESSAGE_LEXER::wrong_number_of_macro_arguments:
+            return "macro %s requires %s arguments, but %s were given";
+        case ERROR_MESSAGE_LEXER::invalid_conditional_expression:
+            return "found token %s, but expected constant expression in %s directive";
+        case ERROR_MESSAGE_LEXER::division_by_zero_in_conditional_expression:
+            return "division by zero in %s directive";
+        case ERROR_MESSAGE_LEXER::unmatched_conditional_directive:
+            return "found %s directive without matching " + em("if") + " directive";
+        case ERROR_MESSAGE_LEXER::unterminated_conditional_directive:
+            return "unterminated %s directive";
+        case ERROR_MESSAGE_LEXER::warning_directive:
+            return "found " + em("warning") + " directive %s";
+        case ERROR_MESSAGE_LEXER::invalid_line_directive:
+            return "found token %s, but expected line number and optional file name in " + em("line") + " directive";
         default:
             RAISE_INTERNAL_ERROR;
     }
@@ -687,6 +732,9 @@ std::string get_what_message(ERROR_MESSAGE_SEMANTIC message) {
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 size_t handle_error_at_line(size_t total_line_number) {
+    if (errors->p_token_ring) {
+        join_lexing(*errors->p_token_ring, true);
+    }
     for (size_t i = 0; i < errors->file_open_lines.size() - 1; ++i) {
         if (total_line_number < errors->file_open_lines[i + 1].total_line_number) {
             set_filename(errors->file_open_lines[i].filename);
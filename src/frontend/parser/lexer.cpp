@@ -1,6 +1,13 @@
 #include "boost/regex.hpp"
+#include <algorithm>
+#include <cstring>
+#include <inttypes.h>
+#include <iterator>
 #include <memory>
+#include <stdio.h>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <vector>
 
 #include "util/fileio.hpp"
@@ -11,12 +18,17 @@
 
 static std::unique_ptr<LexerContext> context;
 
-LexerContext::LexerContext(std::vector<Token>* p_tokens, std::vector<std::string>* p_includedirs) :
-    total_line_number(0), p_tokens(p_tokens), p_includedirs(p_includedirs), stdlibdirs({
+LexerContext::LexerContext(Tokens* p_tokens, std::vector<std::string>* p_includedirs, std::string&& cachedir,
+    bool is_regex_lexer, bool is_preprocessor) :
+    is_comment(false), is_space(false),
+    is_regex_lexer(is_regex_lexer), is_preprocessor(is_preprocessor), total_line_number(0), p_tokens(p_tokens),
+    p_token_ring(nullptr), p_includedirs(p_includedirs),
+    cachedir(std::move(cachedir)),
+    stdlibdirs({
 #ifdef __GNUC__
-                                                                                "/usr/include/", "/usr/local/include/"
+        "/usr/include/", "/usr/local/include/"
 #endif
-                                                                            }),
+    }),
     TOKEN_REGEXPS({
         R"(<<=)", // assignment_bitshiftleft
         R"(>>=)", // assignment_bitshiftright
@@ -70,7 +82,7 @@ LexerContext::LexerContext(std::vector<Token>* p_tokens, std::vector<std::string
         R"(\.(?![0-9]+))", // structop_member
 
         R"(^\s*#\s*include\b\s*(<[^/]+(/[^/]+)*\.h>|"[^/]+(/[^/]+)*\.h"))", // include_directive
-        R"(^\s*#\s*[_acdefgilmnoprstuwx]+\b)",                              // preprocessor_directive
+        R"(^\s*#\s*(?:[_acdefgilmnoprstuwx]+\b|(?=//|/\*)|$))",            // preprocessor_directive
 
         R"(char\b)",     // key_char
         R"(int\b)",      // key_int
@@ -105,81 +117,1955 @@ LexerContext::LexerContext(std::vector<Token>* p_tokens, std::vector<std::string
         R"([ \n\r\t\f\v])", // skip
         R"(.)"              // error
     }) {
+    SCAN_CHARS.fill(SCAN_CHAR::scan_other);
+    for (unsigned char c : std::string(" \t\v")) {
+        SCAN_CHARS[c] = SCAN_CHAR::scan_space;
+    }
+    for (unsigned char c : std::string("\n\r\f")) {
+        SCAN_CHARS[c] = SCAN_CHAR::scan_separator;
+    }
+    for (unsigned char c = '0'; c <= '9'; ++c) {
+        SCAN_CHARS[c] = SCAN_CHAR::scan_digit;
+    }
+    for (unsigned char c = 'a'; c <= 'z'; ++c) {
+        SCAN_CHARS[c] = SCAN_CHAR::scan_alpha;
+        SCAN_CHARS[c - 'a' + 'A'] = SCAN_CHAR::scan_alpha;
+    }
+    SCAN_CHARS['_'] = SCAN_CHAR::scan_alpha;
+    for (unsigned char c : std::string("<>-&|*/=!+%^.()[]{};~?:,\"'")) {
+        SCAN_CHARS[c] = SCAN_CHAR::scan_punct;
+    }
+}
+
+TokenRing::TokenRing() :
+    is_done(false), is_discard(false), head(0), tail(0), last_line(0), token_kinds(TOKEN_RING_SIZE),
+    lines(TOKEN_RING_SIZE), spellings(TOKEN_RING_SIZE) {}
+
+// The lexer thread is stopped before the ring is freed, also when parsing unwinds on an error
+TokenRing::~TokenRing() {
+    if (lexer_thread.joinable()) {
+        is_discard.store(true, std::memory_order_relaxed);
+        lexer_thread.join();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Lexer
+
+static void tokenize_header(std::string include_match, size_t tokenize_header);
+
+static std::string_view get_spelling(const Tokens& tokens, uint32_t spelling_id) {
+    uint32_t spelling_offset = tokens.spelling_offsets[spelling_id];
+    std::string_view spelling(tokens.spellings);
+    return spelling.substr(spelling_offset, tokens.spelling_offsets[spelling_id + 1] - spelling_offset);
+}
+
+static uint32_t push_spelling(std::string_view token) {
+    context->p_tokens->spellings += token;
+    context->p_tokens->spelling_offsets.push_back(static_cast<uint32_t>(context->p_tokens->spellings.size()));
+    return static_cast<uint32_t>(context->p_tokens->spelling_offsets.size() - 2);
+}
+
+static bool is_spelling_kind(TOKEN_KIND token_kind) {
+    switch (token_kind) {
+        case TOKEN_KIND::identifier:
+        case TOKEN_KIND::string_literal:
+        case TOKEN_KIND::char_constant:
+        case TOKEN_KIND::float_constant:
+        case TOKEN_KIND::unsigned_long_constant:
+        case TOKEN_KIND::unsigned_constant:
+        case TOKEN_KIND::long_constant:
+        case TOKEN_KIND::constant:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static uint32_t get_spelling_id(TOKEN_KIND token_kind, std::string_view token) {
+    if (is_spelling_kind(token_kind)) {
+        return push_spelling(token);
+    }
+    else {
+        return static_cast<uint32_t>(token_kind);
+    }
+}
+
+// Wait for the parser to release a slot, tokens are dropped once the parser stopped on an error
+static void push_ring_token(TOKEN_KIND token_kind, std::string_view token, size_t total_line_number) {
+    TokenRing& token_ring = *context->p_token_ring;
+    size_t head = token_ring.head.load(std::memory_order_relaxed);
+    while (head - token_ring.tail.load(std::memory_order_acquire) >= TOKEN_RING_SIZE) {
+        if (token_ring.is_discard.load(std::memory_order_relaxed)) {
+            return;
+        }
+        std::this_thread::yield();
+    }
+
+    size_t i = head & (TOKEN_RING_SIZE - 1);
+    token_ring.token_kinds[i] = token_kind;
+    if (is_spelling_kind(token_kind)) {
+        token_ring.spellings[i] = token;
+    }
+    token_ring.lines[i] = static_cast<uint32_t>(total_line_number);
+    token_ring.last_line = total_line_number;
+    token_ring.head.store(head + 1, std::memory_order_release);
+}
+
+static void push_token(TOKEN_KIND token_kind, std::string_view token, size_t total_line_number) {
+    if (context->p_token_ring) {
+        push_ring_token(token_kind, token, total_line_number);
+        return;
+    }
+    context->p_tokens->token_kinds.push_back(token_kind);
+    context->p_tokens->spelling_ids.push_back(get_spelling_id(token_kind, token));
+    context->p_tokens->lines.push_back(static_cast<uint32_t>(total_line_number));
+}
+
+static void cache_token(TOKEN_KIND token_kind, std::string_view token, size_t line_number);
+static bool is_preprocessor_skip();
+static void preprocess_token(TOKEN_KIND token_kind, std::string_view token, size_t total_line_number);
+static void preprocess_include(std::string_view token, size_t line_number);
+static void preprocess_directive(std::string_view directive, size_t line_number);
+static size_t tokenize_directive(std::string_view directive, std::string_view line, size_t line_number);
+
+static bool tokenize_token(TOKEN_KIND token_kind, std::string_view token, size_t line_number) {
+    if (context->is_comment) {
+        if (token_kind == TOKEN_KIND::comment_multilineend) {
+            context->is_comment = false;
+            context->is_space = true;
+        }
+        return true;
+    }
+    switch (token_kind) {
+        case TOKEN_KIND::error:
+        case TOKEN_KIND::comment_multilineend: {
+            if (context->is_preprocessor && is_preprocessor_skip()) {
+                return true;
+            }
+            raise_runtime_error_at_line(
+                GET_ERROR_MESSAGE(ERROR_MESSAGE_LEXER::invalid_token, std::string(token)), line_number);
+        }
+        case TOKEN_KIND::skip: {
+            context->is_space = true;
+            return true;
+        }
+        case TOKEN_KIND::comment_multilinestart: {
+            context->is_comment = true;
+            return true;
+        }
+        case TOKEN_KIND::include_directive: {
+            cache_token(token_kind, token, line_number);
+            if (context->is_preprocessor) {
+                preprocess_include(token, line_number);
+            }
+            else {
+                tokenize_header(std::string(token), line_number);
+            }
+            return true;
+        }
+        case TOKEN_KIND::comment_singleline: {
+            context->is_space = true;
+            return false;
+        }
+        case TOKEN_KIND::preprocessor_directive:
+            return false;
+        default:
+            break;
+    }
+
+    if (context->is_preprocessor && context->is_space) {
+        cache_token(TOKEN_KIND::skip, token, line_number);
+    }
+    cache_token(token_kind, token, line_number);
+    if (context->is_preprocessor) {
+        preprocess_token(token_kind, token, context->total_line_number);
+    }
+    else {
+        push_token(token_kind, token, context->total_line_number);
+    }
+    return true;
+}
+
+// Return the number of lines joined to a preprocessor directive by line continuations
+static size_t tokenize_line_regex(std::string_view line, size_t line_number) {
+    // https://stackoverflow.com/questions/13612837/how-to-check-which-matching-group-was-used-to-match-boost-regex
+    boost::cregex_iterator it_end;
+    for (boost::cregex_iterator it_begin =
+             boost::cregex_iterator(line.data(), line.data() + line.size(), *context->token_pattern);
+         it_begin != it_end; it_begin++) {
+
+        size_t last_group;
+        boost::cmatch match = *it_begin;
+        for (last_group = TOKEN_KIND_SIZE; last_group-- > 0;) {
+            if (match[context->token_groups[last_group]].matched) {
+                break;
+            }
+        }
+
+        std::string_view token(match[0].first, static_cast<size_t>(match[0].length()));
+        if (!tokenize_token(static_cast<TOKEN_KIND>(last_group), token, line_number)) {
+            if (context->is_preprocessor && last_group == TOKEN_KIND::preprocessor_directive) {
+                size_t i = static_cast<size_t>(match[0].second - line.data());
+                return tokenize_directive(token, line.substr(i), line_number);
+            }
+            break;
+        }
+    }
+    return 0;
+}
+
+static bool is_scan_word(unsigned char c) {
+    return context->SCAN_CHARS[c] == SCAN_CHAR::scan_digit || context->SCAN_CHARS[c] == SCAN_CHAR::scan_alpha;
+}
+
+static bool is_scan_space(unsigned char c) {
+    return context->SCAN_CHARS[c] == SCAN_CHAR::scan_space || context->SCAN_CHARS[c] == SCAN_CHAR::scan_separator;
+}
+
+static size_t scan_match(std::string_view line, size_t i, const char* match) {
+    size_t j = i;
+    for (; *match != '\0'; ++match) {
+        if (j >= line.size() || line[j] != *match) {
+            return i;
+        }
+        j++;
+    }
+    return j;
+}
+
+static size_t scan_spaces(std::string_view line, size_t i) {
+    while (i < line.size() && is_scan_space(line[i])) {
+        i++;
+    }
+    return i;
+}
+
+static size_t scan_digits(std::string_view line, size_t i) {
+    while (i < line.size() && context->SCAN_CHARS[static_cast<unsigned char>(line[i])] == SCAN_CHAR::scan_digit) {
+        i++;
+    }
+    return i;
+}
+
+// (?![\w.])
+static bool scan_is_number_end(std::string_view line, size_t i) {
+    return i >= line.size() || !(is_scan_word(line[i]) || line[i] == '.');
+}
+
+// ^ : start of line, or after a line separator that does not split a \r\n pair
+static bool scan_is_line_start(std::string_view line, size_t i) {
+    if (i == 0) {
+        return true;
+    }
+    return context->SCAN_CHARS[static_cast<unsigned char>(line[i - 1])] == SCAN_CHAR::scan_separator
+           && !(line[i - 1] == '\r' && line[i] == '\n');
+}
+
+// (<[^/]+(/[^/]+)*\.h>|"[^/]+(/[^/]+)*\.h"), matches the longest header name like the greedy regex
+static size_t scan_header_name(std::string_view line, size_t i) {
+    char close;
+    switch (line[i]) {
+        case '<':
+            close = '>';
+            break;
+        case '"':
+            close = '"';
+            break;
+        default:
+            return i;
+    }
+    size_t match = i;
+    for (size_t j = i + 1; j + 2 < line.size(); ++j) {
+        if (line[j] == '/') {
+            if (j == i + 1 || line[j - 1] == '/') {
+                break;
+            }
+        }
+        else if (line[j] == '.' && line[j + 1] == 'h' && line[j + 2] == close && j > i + 1 && line[j - 1] != '/') {
+            match = j + 3;
+        }
+    }
+    return match;
+}
+
+// ^\s*#\s*include\b\s*(<header>|"header") | ^\s*#\s*([_acdefgilmnoprstuwx]+\b|(?=//|/\*)|$)
+static size_t scan_directive(std::string_view line, size_t i, TOKEN_KIND& token_kind) {
+    size_t j = scan_spaces(line, i);
+    if (j >= line.size() || line[j] != '#') {
+        return i;
+    }
+    j = scan_spaces(line, j + 1);
+    // Null directive
+    if (j >= line.size() || (j + 1 < line.size() && line[j] == '/' && (line[j + 1] == '/' || line[j + 1] == '*'))) {
+        token_kind = TOKEN_KIND::preprocessor_directive;
+        return j;
+    }
+    {
+        size_t k = scan_match(line, j, "include");
+        if (k > j && (k >= line.size() || !is_scan_word(line[k]))) {
+            k = scan_spaces(line, k);
+            if (k < line.size()) {
+                size_t l = scan_header_name(line, k);
+                if (l > k) {
+                    token_kind = TOKEN_KIND::include_directive;
+                    return l;
+                }
+            }
+        }
+    }
+    size_t k = j;
+    while (k < line.size() && std::strchr("_acdefgilmnoprstuwx", line[k]) && line[k] != '\0') {
+        k++;
+    }
+    if (k > j && (k >= line.size() || !is_scan_word(line[k]))) {
+        token_kind = TOKEN_KIND::preprocessor_directive;
+        return k;
+    }
+    return i;
+}
+
+static TOKEN_KIND scan_keyword(std::string_view line, size_t i, size_t j) {
+    const char* word = &line[i];
+    switch (j - i) {
+        case 2:
+            if (std::memcmp(word, "if", 2) == 0) {
+                return TOKEN_KIND::key_if;
+            }
+            else if (std::memcmp(word, "do", 2) == 0) {
+                return TOKEN_KIND::key_do;
+            }
+            break;
+        case 3:
+            if (std::memcmp(word, "int", 3) == 0) {
+                return TOKEN_KIND::key_int;
+            }
+            else if (std::memcmp(word, "for", 3) == 0) {
+                return TOKEN_KIND::key_for;
+            }
+            break;
+        case 4:
+            if (std::memcmp(word, "char", 4) == 0) {
+                return TOKEN_KIND::key_char;
+            }
+            else if (std::memcmp(word, "long", 4) == 0) {
+                return TOKEN_KIND::key_long;
+            }
+            else if (std::memcmp(word, "void", 4) == 0) {
+                return TOKEN_KIND::key_void;
+            }
+            else if (std::memcmp(word, "else", 4) == 0) {
+                return TOKEN_KIND::key_else;
+            }
+            else if (std::memcmp(word, "goto", 4) == 0) {
+                return TOKEN_KIND::key_goto;
+            }
+            break;
+        case 5:
+            if (std::memcmp(word, "while", 5) == 0) {
+                return TOKEN_KIND::key_while;
+            }
+            else if (std::memcmp(word, "break", 5) == 0) {
+                return TOKEN_KIND::key_break;
+            }
+            break;
+        case 6:
+            if (std::memcmp(word, "double", 6) == 0) {
+                return TOKEN_KIND::key_double;
+            }
+            else if (std::memcmp(word, "signed", 6) == 0) {
+                return TOKEN_KIND::key_signed;
+            }
+            else if (std::memcmp(word, "struct", 6) == 0) {
+                return TOKEN_KIND::key_struct;
+            }
+            else if (std::memcmp(word, "sizeof", 6) == 0) {
+                return TOKEN_KIND::key_sizeof;
+            }
+            else if (std::memcmp(word, "return", 6) == 0) {
+                return TOKEN_KIND::key_return;
+            }
+            else if (std::memcmp(word, "static", 6) == 0) {
+                return TOKEN_KIND::key_static;
+            }
+            else if (std::memcmp(word, "extern", 6) == 0) {
+                return TOKEN_KIND::key_extern;
+            }
+            break;
+        case 8:
+            if (std::memcmp(word, "unsigned", 8) == 0) {
+                return TOKEN_KIND::key_unsigned;
+            }
+            else if (std::memcmp(word, "continue", 8) == 0) {
+                return TOKEN_KIND::key_continue;
+            }
+            break;
+        default:
+            break;
+    }
+    return TOKEN_KIND::identifier;
+}
+
+// [a-zA-Z_]\w*\b
+static size_t scan_identifier(std::string_view line, size_t i, TOKEN_KIND& token_kind) {
+    size_t j = i + 1;
+    while (j < line.size() && is_scan_word(line[j])) {
+        j++;
+    }
+    token_kind = scan_keyword(line, i, j);
+    return j;
+}
+
+// (([0-9]*\.[0-9]+|[0-9]+\.?)[Ee][+-]?[0-9]+|[0-9]*\.[0-9]+|[0-9]+\.)(?![\w.])
+static size_t scan_float_constant(std::string_view line, size_t i) {
+    size_t j = scan_digits(line, i);
+    bool is_mantissa = j > i;
+    bool is_dot = false;
+    if (j < line.size() && line[j] == '.') {
+        is_dot = true;
+        size_t k = scan_digits(line, j + 1);
+        is_mantissa = is_mantissa || k > j + 1;
+        j = k;
+    }
+    if (!is_mantissa) {
+        return i;
+    }
+    if (j < line.size() && (line[j] == 'E' || line[j] == 'e')) {
+        size_t k = j + 1;
+        if (k < line.size() && (line[k] == '+' || line[k] == '-')) {
+            k++;
+        }
+        size_t l = scan_digits(line, k);
+        if (l > k) {
+            j = l;
+            is_dot = true;
+        }
+    }
+    if (!is_dot || !scan_is_number_end(line, j)) {
+        return i;
+    }
+    return j;
+}
+
+// [0-9]+([lL][uU]|[uU][lL])(?![\w.]) | [0-9]+[uU](?![\w.]) | [0-9]+[lL](?![\w.]) | [0-9]+(?![\w.])
+static size_t scan_integer_constant(std::string_view line, size_t i, TOKEN_KIND& token_kind) {
+    size_t j = scan_digits(line, i);
+    if (j == i) {
+        return i;
+    }
+    bool is_long = false;
+    bool is_unsigned = false;
+    for (size_t k = 0; k < 2 && j < line.size(); ++k) {
+        if (!is_long && (line[j] == 'L' || line[j] == 'l')) {
+            is_long = true;
+        }
+        else if (!is_unsigned && (line[j] == 'U' || line[j] == 'u')) {
+            is_unsigned = true;
+        }
+        else {
+            break;
+        }
+        j++;
+    }
+    if (!scan_is_number_end(line, j)) {
+        return i;
+    }
+    if (is_unsigned) {
+        token_kind = is_long ? TOKEN_KIND::unsigned_long_constant : TOKEN_KIND::unsigned_constant;
+    }
+    else {
+        token_kind = is_long ? TOKEN_KIND::long_constant : TOKEN_KIND::constant;
+    }
+    return j;
+}
+
+static size_t scan_number(std::string_view line, size_t i, TOKEN_KIND& token_kind) {
+    size_t j = scan_float_constant(line, i);
+    if (j > i) {
+        token_kind = TOKEN_KIND::float_constant;
+        return j;
+    }
+    return scan_integer_constant(line, i, token_kind);
+}
+
+// "([^"\\\n]|\\['"\\?abfnrtv])*" | '([^'\\\n]|\\['"?\\abfnrtv])'
+static size_t scan_quoted(std::string_view line, size_t i, bool is_single) {
+    char quote = line[i];
+    size_t j = i + 1;
+    for (size_t n = 0; j < line.size(); ++n) {
+        if (line[j] == quote) {
+            return (is_single && n != 1) ? i : j + 1;
+        }
+        else if (is_single && n == 1) {
+            return i;
+        }
+        switch (line[j]) {
+            case '\n':
+                return i;
+            case '\\': {
+                if (j + 1 >= line.size() || !std::strchr("'\"?\\abfnrtv", line[j + 1]) || line[j + 1] == '\0') {
+                    return i;
+                }
+                j += 2;
+                break;
+            }
+            default:
+                j++;
+                break;
+        }
+    }
+    return i;
+}
+
+static size_t scan_punctuator(std::string_view line, size_t i, TOKEN_KIND& token_kind) {
+    char next = i + 1 < line.size() ? line[i + 1] : '\0';
+    switch (line[i]) {
+        case '<': {
+            if (next == '<') {
+                if (i + 2 < line.size() && line[i + 2] == '=') {
+                    token_kind = TOKEN_KIND::assignment_bitshiftleft;
+                    return i + 3;
+                }
+                token_kind = TOKEN_KIND::binop_bitshiftleft;
+                return i + 2;
+            }
+            else if (next == '=') {
+                token_kind = TOKEN_KIND::binop_lessthanorequal;
+                return i + 2;
+            }
+            token_kind = TOKEN_KIND::binop_lessthan;
+            return i + 1;
+        }
+        case '>': {
+            if (next == '>') {
+                if (i + 2 < line.size() && line[i + 2] == '=') {
+                    token_kind = TOKEN_KIND::assignment_bitshiftright;
+                    return i + 3;
+                }
+                token_kind = TOKEN_KIND::binop_bitshiftright;
+                return i + 2;
+            }
+            else if (next == '=') {
+                token_kind = TOKEN_KIND::binop_greaterthanorequal;
+                return i + 2;
+            }
+            token_kind = TOKEN_KIND::binop_greaterthan;
+            return i + 1;
+        }
+        case '-': {
+            switch (next) {
+                case '-':
+                    token_kind = TOKEN_KIND::unop_decrement;
+                    return i + 2;
+                case '=':
+                    token_kind = TOKEN_KIND::assignment_difference;
+                    return i + 2;
+                case '>':
+                    token_kind = TOKEN_KIND::structop_pointer;
+                    return i + 2;
+                default:
+                    token_kind = TOKEN_KIND::unop_negation;
+                    return i + 1;
+            }
+        }
+        case '&': {
+            switch (next) {
+                case '&':
+                    token_kind = TOKEN_KIND::binop_and;
+                    return i + 2;
+                case '=':
+                    token_kind = TOKEN_KIND::assignment_bitand;
+                    return i + 2;
+                default:
+                    token_kind = TOKEN_KIND::binop_bitand;
+                    return i + 1;
+            }
+        }
+        case '|': {
+            switch (next) {
+                case '|':
+                    token_kind = TOKEN_KIND::binop_or;
+                    return i + 2;
+                case '=':
+                    token_kind = TOKEN_KIND::assignment_bitor;
+                    return i + 2;
+                default:
+                    token_kind = TOKEN_KIND::binop_bitor;
+                    return i + 1;
+            }
+        }
+        case '*': {
+            switch (next) {
+                case '=':
+                    token_kind = TOKEN_KIND::assignment_product;
+                    return i + 2;
+                case '/':
+                    token_kind = TOKEN_KIND::comment_multilineend;
+                    return i + 2;
+                default:
+                    token_kind = TOKEN_KIND::binop_multiplication;
+                    return i + 1;
+            }
+        }
+        case '/': {
+            switch (next) {
+                case '=':
+                    token_kind = TOKEN_KIND::assignment_quotient;
+                    return i + 2;
+                case '/':
+                    token_kind = TOKEN_KIND::comment_singleline;
+                    return i + 2;
+                case '*':
+                    token_kind = TOKEN_KIND::comment_multilinestart;
+                    return i + 2;
+                default:
+                    token_kind = TOKEN_KIND::binop_division;
+                    return i + 1;
+            }
+        }
+        case '=': {
+            if (next == '=') {
+                token_kind = TOKEN_KIND::binop_equalto;
+                return i + 2;
+            }
+            token_kind = TOKEN_KIND::assignment_simple;
+            return i + 1;
+        }
+        case '!': {
+            if (next == '=') {
+                token_kind = TOKEN_KIND::binop_notequal;
+                return i + 2;
+            }
+            token_kind = TOKEN_KIND::unop_not;
+            return i + 1;
+        }
+        case '+': {
+            if (next == '=') {
+                token_kind = TOKEN_KIND::assignment_plus;
+                return i + 2;
+            }
+            token_kind = TOKEN_KIND::binop_addition;
+            return i + 1;
+        }
+        case '%': {
+            if (next == '=') {
+                token_kind = TOKEN_KIND::assignment_remainder;
+                return i + 2;
+            }
+            token_kind = TOKEN_KIND::binop_remainder;
+            return i + 1;
+        }
+        case '^': {
+            if (next == '=') {
+                token_kind = TOKEN_KIND::assignment_bitxor;
+                return i + 2;
+            }
+            token_kind = TOKEN_KIND::binop_bitxor;
+            return i + 1;
+        }
+        case '.': {
+            if (context->SCAN_CHARS[static_cast<unsigned char>(next)] == SCAN_CHAR::scan_digit) {
+                return scan_number(line, i, token_kind);
+            }
+            token_kind = TOKEN_KIND::structop_member;
+            return i + 1;
+        }
+        case '(':
+            token_kind = TOKEN_KIND::parenthesis_open;
+            return i + 1;
+        case ')':
+            token_kind = TOKEN_KIND::parenthesis_close;
+            return i + 1;
+        case '{':
+            token_kind = TOKEN_KIND::brace_open;
+            return i + 1;
+        case '}':
+            token_kind = TOKEN_KIND::brace_close;
+            return i + 1;
+        case '[':
+            token_kind = TOKEN_KIND::brackets_open;
+            return i + 1;
+        case ']':
+            token_kind = TOKEN_KIND::brackets_close;
+            return i + 1;
+        case ';':
+            token_kind = TOKEN_KIND::semicolon;
+            return i + 1;
+        case '~':
+            token_kind = TOKEN_KIND::unop_complement;
+            return i + 1;
+        case '?':
+            token_kind = TOKEN_KIND::ternary_if;
+            return i + 1;
+        case ':':
+            token_kind = TOKEN_KIND::ternary_else;
+            return i + 1;
+        case ',':
+            token_kind = TOKEN_KIND::separator_comma;
+            return i + 1;
+        case '"': {
+            token_kind = TOKEN_KIND::string_literal;
+            return scan_quoted(line, i, false);
+        }
+        case '\'': {
+            token_kind = TOKEN_KIND::char_constant;
+            return scan_quoted(line, i, true);
+        }
+        default:
+            return i;
+    }
+}
+
+// Match the same token as the regex alternation would, one byte class dispatch per token
+static size_t scan_token(std::string_view line, size_t i, TOKEN_KIND& token_kind) {
+    size_t j;
+    if (scan_is_line_start(line, i)) {
+        j = scan_directive(line, i, token_kind);
+        if (j > i) {
+            return j;
+        }
+    }
+    switch (context->SCAN_CHARS[static_cast<unsigned char>(line[i])]) {
+        case SCAN_CHAR::scan_space:
+        case SCAN_CHAR::scan_separator: {
+            token_kind = TOKEN_KIND::skip;
+            return i + 1;
+        }
+        case SCAN_CHAR::scan_alpha:
+            return scan_identifier(line, i, token_kind);
+        case SCAN_CHAR::scan_digit: {
+            j = scan_number(line, i, token_kind);
+            break;
+        }
+        case SCAN_CHAR::scan_punct: {
+            j = scan_punctuator(line, i, token_kind);
+            break;
+        }
+        default: {
+            j = i;
+            break;
+        }
+    }
+    if (j == i) {
+        token_kind = TOKEN_KIND::error;
+        return i + 1;
+    }
+    return j;
+}
+
+static size_t tokenize_line_scan(std::string_view line, size_t line_number) {
+    TOKEN_KIND token_kind;
+    for (size_t i = 0; i < line.size();) {
+        size_t j = scan_token(line, i, token_kind);
+        if (!tokenize_token(token_kind, line.substr(i, j - i), line_number)) {
+            if (context->is_preprocessor && token_kind == TOKEN_KIND::preprocessor_directive) {
+                return tokenize_directive(line.substr(i, j - i), line.substr(j), line_number);
+            }
+            break;
+        }
+        i = j;
+    }
+    return 0;
+}
+
+static size_t tokenize_file() {
+    std::string_view line;
+    size_t line_number = 1;
+    context->is_comment = false;
+    for (; read_line(line); ++line_number) {
+        context->total_line_number++;
+        if (context->is_regex_lexer) {
+            line_number += tokenize_line_regex(line, line_number);
+        }
+        else {
+            line_number += tokenize_line_scan(line, line_number);
+        }
+    }
+    // Headers are only included outside of comments
+    context->is_comment = false;
+    return line_number - 1;
+}
+
+// Preprocessor
+
+// Conditional directives are always tracked, while other directives and tokens are dropped in skipped groups. Kept
+// tokens are macro expanded at once when the next directive, include directive or end of file is reached
+constexpr size_t INCLUDE_DEPTH_MAX = 200;
+
+static bool is_preprocessor_skip() {
+    return !context->conditional_groups.empty() && !context->conditional_groups.back().is_active;
+}
+
+static bool is_macro_name(TOKEN_KIND token_kind) {
+    return token_kind == TOKEN_KIND::identifier
+           || (token_kind >= TOKEN_KIND::key_char && token_kind <= TOKEN_KIND::key_extern);
+}
+
+static bool is_macro_operator(const PreprocessorToken& token, const char* op) {
+    return token.token_kind == TOKEN_KIND::error && token.token == op;
+}
+
+static PreprocessorToken make_preprocessor_token(
+    TOKEN_KIND token_kind, std::string_view token, size_t total_line_number, bool is_space) {
+    PreprocessorToken preprocessor_token = {token_kind, is_space, total_line_number, std::string(token), {}};
+    if (preprocessor_token.token.empty()) {
+        preprocessor_token.token = std::string(get_spelling(*context->p_tokens, token_kind));
+    }
+    return preprocessor_token;
+}
+
+// Directive and header name patterns only match at the start of a source line, never inside a directive
+static size_t scan_preprocessor_token(std::string_view line, size_t i, TOKEN_KIND& token_kind) {
+    switch (context->SCAN_CHARS[static_cast<unsigned char>(line[i])]) {
+        case SCAN_CHAR::scan_space:
+        case SCAN_CHAR::scan_separator: {
+            token_kind = TOKEN_KIND::skip;
+            return i + 1;
+        }
+        default:
+            break;
+    }
+    if (line[i] == '#') {
+        token_kind = TOKEN_KIND::error;
+        return i + 1;
+    }
+    return scan_token(line, i, token_kind);
+}
+
+static void lex_preprocessor_tokens(
+    std::string_view line, size_t total_line_number, std::vector<PreprocessorToken>& tokens) {
+    TOKEN_KIND token_kind;
+    bool is_space = false;
+    for (size_t i = 0; i < line.size();) {
+        size_t j = scan_preprocessor_token(line, i, token_kind);
+        if (token_kind == TOKEN_KIND::skip) {
+            is_space = true;
+        }
+        else {
+            tokens.push_back(make_preprocessor_token(token_kind, line.substr(i, j - i), total_line_number, is_space));
+            is_space = false;
+        }
+        i = j;
+    }
+}
+
+static void touch_include_guard() {
+    if (context->include_guards.back().state != INCLUDE_GUARD::guard_inside) {
+        context->include_guards.back().state = INCLUDE_GUARD::guard_none;
+    }
+}
+
+static bool is_hide_set(const std::vector<std::string>& hide_set, const std::string& name) {
+    return std::find(hide_set.begin(), hide_set.end(), name) != hide_set.end();
+}
+
+static void expand_macros(std::vector<PreprocessorToken>& tokens);
+
+static size_t get_macro_param(const Macro& macro, const PreprocessorToken& token) {
+    if (macro.is_function && is_macro_name(token.token_kind)) {
+        for (size_t i = 0; i < macro.params.size(); ++i) {
+            if (macro.params[i] == token.token) {
+                return i;
+            }
+        }
+    }
+    return macro.params.size();
+}
+
+// Each run of whitespace between argument tokens becomes a single space, leading and trailing whitespace is dropped
+static PreprocessorToken stringify_macro_argument(
+    const std::vector<PreprocessorToken>& argument, const PreprocessorToken& token) {
+    std::string string_literal = "\"";
+    for (size_t i = 0; i < argument.size(); ++i) {
+        if (i > 0 && argument[i].is_space) {
+            string_literal += ' ';
+        }
+        bool is_quoted = argument[i].token_kind == TOKEN_KIND::string_literal
+                         || argument[i].token_kind == TOKEN_KIND::char_constant;
+        for (char c : argument[i].token) {
+            if (is_quoted && (c == '"' || c == '\\')) {
+                string_literal += '\\';
+            }
+            string_literal += c;
+        }
+    }
+    string_literal += '"';
+    return make_preprocessor_token(TOKEN_KIND::string_literal, string_literal, token.line, token.is_space);
+}
+
+// An empty operand of ## is a placemarker, which is replaced by the other operand
+static void paste_macro_tokens(PreprocessorToken& token_left, const PreprocessorToken& token_right) {
+    if (token_left.token_kind == TOKEN_KIND::skip) {
+        bool is_space = token_left.is_space;
+        token_left = token_right;
+        token_left.is_space = is_space;
+        return;
+    }
+    std::string token = token_left.token + token_right.token;
+    TOKEN_KIND token_kind;
+    size_t i = scan_preprocessor_token(token, 0, token_kind);
+    switch (token_kind) {
+        case TOKEN_KIND::comment_singleline:
+        case TOKEN_KIND::comment_multilinestart:
+        case TOKEN_KIND::comment_multilineend:
+        case TOKEN_KIND::include_directive:
+        case TOKEN_KIND::preprocessor_directive:
+        case TOKEN_KIND::skip:
+        case TOKEN_KIND::error: {
+            i = 0;
+            break;
+        }
+        default:
+            break;
+    }
+    if (i != token.size()) {
+        RAISE_RUNTIME_ERROR_AT_LINE(
+            GET_ERROR_MESSAGE(ERROR_MESSAGE_LEXER::invalid_token_paste, token_left.token, token_right.token),
+            token_left.line);
+    }
+    token_left.token_kind = token_kind;
+    token_left.token = std::move(token);
+}
+
+static void append_macro_argument(const std::vector<PreprocessorToken>& argument, const PreprocessorToken& token,
+    std::vector<PreprocessorToken>& tokens) {
+    if (argument.empty()) {
+        return;
+    }
+    tokens.insert(tokens.end(), argument.begin(), argument.end());
+    tokens[tokens.size() - argument.size()].is_space = token.is_space;
+}
+
+static void substitute_macro(const Macro& macro, const std::vector<std::vector<PreprocessorToken>>& arguments,
+    std::vector<PreprocessorToken>& tokens) {
+    std::vector<std::vector<PreprocessorToken>> expanded_arguments(arguments.size());
+    std::vector<bool> is_expanded(arguments.size(), false);
+    for (size_t i = 0; i < macro.tokens.size(); ++i) {
+        const PreprocessorToken& token = macro.tokens[i];
+        if (macro.is_function && is_macro_operator(token, "#")) {
+            i++;
+            tokens.push_back(stringify_macro_argument(arguments[get_macro_param(macro, macro.tokens[i])], token));
+            continue;
+        }
+        else if (is_macro_operator(token, "##")) {
+            i++;
+            size_t param = get_macro_param(macro, macro.tokens[i]);
+            if (param == arguments.size()) {
+                paste_macro_tokens(tokens.back(), macro.tokens[i]);
+            }
+            else if (!arguments[param].empty()) {
+                paste_macro_tokens(tokens.back(), arguments[param][0]);
+                tokens.insert(tokens.end(), arguments[param].begin() + 1, arguments[param].end());
+            }
+            continue;
+        }
+
+        size_t param = get_macro_param(macro, token);
+        if (param == arguments.size()) {
+            tokens.push_back(token);
+        }
+        // Operands of ## are not expanded
+        else if (i + 1 < macro.tokens.size() && is_macro_operator(macro.tokens[i + 1], "##")) {
+            if (arguments[param].empty()) {
+                tokens.push_back(make_preprocessor_token(TOKEN_KIND::skip, " ", token.line, token.is_space));
+            }
+            else {
+                append_macro_argument(arguments[param], token, tokens);
+            }
+        }
+        else {
+            if (!is_expanded[param]) {
+                expanded_arguments[param] = arguments[param];
+                expand_macros(expanded_arguments[param]);
+                is_expanded[param] = true;
+            }
+            append_macro_argument(expanded_arguments[param], token, tokens);
+        }
+    }
+    tokens.erase(std::remove_if(tokens.begin(), tokens.end(),
+                     [](const PreprocessorToken& token) { return token.token_kind == TOKEN_KIND::skip; }),
+        tokens.end());
+}
+
+static std::vector<std::string> read_macro_arguments(const Macro& macro, const PreprocessorToken& token,
+    std::vector<PreprocessorToken>& stack, std::vector<std::vector<PreprocessorToken>>& arguments) {
+    std::vector<std::string> hide_set;
+    stack.pop_back();
+    arguments.emplace_back();
+    for (size_t depth = 0;;) {
+        if (stack.empty()) {
+            RAISE_RUNTIME_ERROR_AT_LINE(
+                GET_ERROR_MESSAGE(ERROR_MESSAGE_LEXER::unterminated_macro_argument_list, token.token), token.line);
+        }
+        PreprocessorToken argument_token = std::move(stack.back());
+        stack.pop_back();
+        if (depth == 0 && argument_token.token_kind == TOKEN_KIND::parenthesis_close) {
+            hide_set = std::move(argument_token.hide_set);
+            break;
+        }
+        else if (depth == 0 && argument_token.token_kind == TOKEN_KIND::separator_comma
+                 && !(macro.is_variadic && arguments.size() == macro.params.size())) {
+            arguments.emplace_back();
+            continue;
+        }
+        else if (argument_token.token_kind == TOKEN_KIND::parenthesis_open) {
+            depth++;
+        }
+        else if (argument_token.token_kind == TOKEN_KIND::parenthesis_close) {
+            depth--;
+        }
+        arguments.back().push_back(std::move(argument_token));
+    }
+
+    if (macro.params.empty() && arguments.size() == 1 && arguments[0].empty()) {
+        arguments.clear();
+    }
+    else if (macro.is_variadic && arguments.size() + 1 == macro.params.size()) {
+        arguments.emplace_back();
+    }
+    if (arguments.size() != macro.params.size()) {
+        RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_LEXER::wrong_number_of_macro_arguments,
+                                        token.token, std::to_string(macro.params.size()),
+                                        std::to_string(arguments.size())),
+            token.line);
+    }
+    return hide_set;
+}
+
+// A token is not expanded again by a macro in its hide set, the hide set of a function-like macro expansion is the
+// intersection of the hide sets of the macro name and the closing parenthesis
+static void expand_macros(std::vector<PreprocessorToken>& tokens) {
+    std::vector<PreprocessorToken> stack;
+    stack.reserve(tokens.size());
+    std::move(tokens.rbegin(), tokens.rend(), std::back_inserter(stack));
+    tokens.clear();
+    while (!stack.empty()) {
+        PreprocessorToken token = std::move(stack.back());
+        stack.pop_back();
+        if (!is_macro_name(token.token_kind) || is_hide_set(token.hide_set, token.token)) {
+            tokens.push_back(std::move(token));
+            continue;
+        }
+        auto macro = context->macros.find(token.token);
+        if (macro == context->macros.end()
+            || (macro->second.is_function
+                && (stack.empty() || stack.back().token_kind != TOKEN_KIND::parenthesis_open))) {
+            tokens.push_back(std::move(token));
+            continue;
+        }
+
+        std::vector<std::string> hide_set;
+        std::vector<std::vector<PreprocessorToken>> arguments;
+        if (macro->second.is_function) {
+            std::vector<std::string> hide_set_close = read_macro_arguments(macro->second, token, stack, arguments);
+            for (auto& name : token.hide_set) {
+                if (is_hide_set(hide_set_close, name)) {
+                    hide_set.push_back(std::move(name));
+                }
+            }
+        }
+        else {
+            hide_set = std::move(token.hide_set);
+        }
+        hide_set.push_back(token.token);
+
+        std::vector<PreprocessorToken> expansion;
+        substitute_macro(macro->second, arguments, expansion);
+        for (size_t i = expansion.size(); i-- > 0;) {
+            expansion[i].line = token.line;
+            for (const auto& name : hide_set) {
+                if (!is_hide_set(expansion[i].hide_set, name)) {
+                    expansion[i].hide_set.push_back(name);
+                }
+            }
+            stack.push_back(std::move(expansion[i]));
+        }
+        if (!expansion.empty()) {
+            stack.back().is_space = token.is_space;
+        }
+    }
+}
+
+static void flush_preprocessor_tokens() {
+    if (context->preprocessor_tokens.empty()) {
+        return;
+    }
+    expand_macros(context->preprocessor_tokens);
+    for (const auto& token : context->preprocessor_tokens) {
+        if (token.token_kind == TOKEN_KIND::error) {
+            RAISE_RUNTIME_ERROR_AT_LINE(
+                GET_ERROR_MESSAGE(ERROR_MESSAGE_LEXER::invalid_token, token.token), token.line);
+        }
+        push_token(token.token_kind, token.token, token.line);
+    }
+    context->preprocessor_tokens.clear();
+}
+
+// Whitespace and comments before a source token are kept as its is_space flag, for the spelling of # and of macros
+static void preprocess_token(TOKEN_KIND token_kind, std::string_view token, size_t total_line_number) {
+    bool is_space = context->is_space;
+    context->is_space = false;
+    if (is_preprocessor_skip()) {
+        return;
+    }
+    touch_include_guard();
+    context->preprocessor_tokens.push_back(make_preprocessor_token(token_kind, token, total_line_number, is_space));
+}
+
+static void preprocess_include(std::string_view token, size_t line_number) {
+    if (is_preprocessor_skip()) {
+        return;
+    }
+    touch_include_guard();
+    flush_preprocessor_tokens();
+    tokenize_header(std::string(token), line_number);
+}
+
+static const std::string& get_macro_name(
+    const std::vector<PreprocessorToken>& tokens, size_t i, const std::string& directive, size_t line_number) {
+    if (i >= tokens.size() || !is_macro_name(tokens[i].token_kind) || tokens[i].token == "defined") {
+        raise_runtime_error_at_line(GET_ERROR_MESSAGE(ERROR_MESSAGE_LEXER::invalid_macro_name,
+                                        i < tokens.size() ? tokens[i].token : directive, directive),
+            line_number);
+    }
+    return tokens[i].token;
+}
+
+static void preprocess_define(std::vector<PreprocessorToken>& tokens, size_t line_number) {
+    const std::string& name = get_macro_name(tokens, 1, tokens[0].token, line_number);
+    Macro macro = {false, false, {}, {}};
+    size_t i = 2;
+    if (i < tokens.size() && tokens[i].token_kind == TOKEN_KIND::parenthesis_open && !tokens[i].is_space) {
+        macro.is_function = true;
+        i++;
+        if (i < tokens.size() && tokens[i].token_kind == TOKEN_KIND::parenthesis_close) {
+            i++;
+        }
+        else {
+            while (true) {
+                if (i + 2 < tokens.size() && tokens[i].token_kind == TOKEN_KIND::structop_member
+                    && tokens[i + 1].token_kind == TOKEN_KIND::structop_member && !tokens[i + 1].is_space
+                    && tokens[i + 2].token_kind == TOKEN_KIND::structop_member && !tokens[i + 2].is_space) {
+                    macro.is_variadic = true;
+                    macro.params.push_back("__VA_ARGS__");
+                    i += 3;
+                }
+                else if (i < tokens.size() && is_macro_name(tokens[i].token_kind)) {
+                    macro.params.push_back(tokens[i].token);
+                    i++;
+                }
+                else {
+                    raise_runtime_error_at_line(GET_ERROR_MESSAGE(ERROR_MESSAGE_LEXER::invalid_macro_parameter_list,
+                                                    i < tokens.size() ? tokens[i].token : name, name),
+                        line_number);
+                }
+                if (i < tokens.size() && tokens[i].token_kind == TOKEN_KIND::parenthesis_close) {
+                    i++;
+                    break;
+                }
+                else if (macro.is_variadic || i >= tokens.size()
+                         || tokens[i].token_kind != TOKEN_KIND::separator_comma) {
+                    raise_runtime_error_at_line(GET_ERROR_MESSAGE(ERROR_MESSAGE_LEXER::invalid_macro_parameter_list,
+                                                    i < tokens.size() ? tokens[i].token : name, name),
+                        line_number);
+                }
+                i++;
+            }
+        }
+    }
+
+    for (; i < tokens.size(); ++i) {
+        if (is_macro_operator(tokens[i], "#") && !macro.tokens.empty() && is_macro_operator(macro.tokens.back(), "#")
+            && !tokens[i].is_space) {
+            macro.tokens.back().token = "##";
+            continue;
+        }
+        macro.tokens.push_back(std::move(tokens[i]));
+    }
+    if (!macro.tokens.empty()
+        && (is_macro_operator(macro.tokens[0], "##") || is_macro_operator(macro.tokens.back(), "##"))) {
+        raise_runtime_error_at_line(
+            GET_ERROR_MESSAGE(ERROR_MESSAGE_LEXER::token_paste_at_macro_boundary, name), line_number);
+    }
+    if (macro.is_function) {
+        for (i = 0; i < macro.tokens.size(); ++i) {
+            if (is_macro_operator(macro.tokens[i], "#")
+                && (i + 1 >= macro.tokens.size()
+                    || get_macro_param(macro, macro.tokens[i + 1]) == macro.params.size())) {
+                raise_runtime_error_at_line(
+                    GET_ERROR_MESSAGE(ERROR_MESSAGE_LEXER::stringify_without_macro_parameter, name), line_number);
+            }
+        }
+    }
+    context->macros[name] = std::move(macro);
 }
 
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static ConditionValue evaluate_condition(const std::vector<PreprocessorToken>& tokens, size_t& i,
+    const std::string& directive, size_t line_number, int32_t min_precedence, bool is_evaluated);
 
-// Lexer
+[[noreturn]] static void raise_condition_error(
+    const std::vector<PreprocessorToken>& tokens, size_t i, const std::string& directive, size_t line_number) {
+    raise_runtime_error_at_line(GET_ERROR_MESSAGE(ERROR_MESSAGE_LEXER::invalid_conditional_expression,
+                                    i < tokens.size() ? tokens[i].token : directive, directive),
+        line_number);
+}
 
-static void tokenize_header(std::string include_match, size_t tokenize_header);
+static int64_t evaluate_char_constant(const std::string& token) {
+    if (token[1] != '\\') {
+        return static_cast<int64_t>(static_cast<signed char>(token[1]));
+    }
+    switch (token[2]) {
+        case 'a':
+            return 7;
+        case 'b':
+            return 8;
+        case 'f':
+            return 12;
+        case 'n':
+            return 10;
+        case 'r':
+            return 13;
+        case 't':
+            return 9;
+        case 'v':
+            return 11;
+        default:
+            return static_cast<int64_t>(static_cast<signed char>(token[2]));
+    }
+}
 
-static void tokenize_file() {
-    // https://stackoverflow.com/questions/13612837/how-to-check-which-matching-group-was-used-to-match-boost-regex
-    std::string line;
-    bool is_comment = false;
-    for (size_t line_number = 1; read_line(line); ++line_number) {
-        context->total_line_number++;
+static ConditionValue make_condition_value(bool is_unsigned, uint64_t value) { return {is_unsigned, value}; }
 
-        boost::sregex_iterator it_end;
-        for (boost::sregex_iterator it_begin =
-                 boost::sregex_iterator(line.begin(), line.end(), *context->token_pattern);
-             it_begin != it_end; it_begin++) {
+// Decimal constants too large for intmax_t are taken as uintmax_t, as gcc does
+static ConditionValue evaluate_constant_condition(const PreprocessorToken& token) {
+    uint64_t value = strtoull(token.token.c_str(), nullptr, 10);
+    bool is_unsigned = token.token_kind == TOKEN_KIND::unsigned_long_constant
+                       || token.token_kind == TOKEN_KIND::unsigned_constant || value > INT64_MAX;
+    return make_condition_value(is_unsigned, value);
+}
 
-            size_t last_group;
-            boost::smatch match = *it_begin;
-            for (last_group = TOKEN_KIND_SIZE; last_group-- > 0;) {
-                if (match[context->token_groups[last_group]].matched) {
-                    break;
+static ConditionValue evaluate_unary_condition(const std::vector<PreprocessorToken>& tokens, size_t& i,
+    const std::string& directive, size_t line_number, bool is_evaluated) {
+    if (i >= tokens.size()) {
+        raise_condition_error(tokens, i, directive, line_number);
+    }
+    switch (tokens[i++].token_kind) {
+        case TOKEN_KIND::char_constant:
+            return make_condition_value(false, static_cast<uint64_t>(evaluate_char_constant(tokens[i - 1].token)));
+        case TOKEN_KIND::unsigned_long_constant:
+        case TOKEN_KIND::unsigned_constant:
+        case TOKEN_KIND::long_constant:
+        case TOKEN_KIND::constant:
+            return evaluate_constant_condition(tokens[i - 1]);
+        case TOKEN_KIND::binop_addition:
+            return evaluate_unary_condition(tokens, i, directive, line_number, is_evaluated);
+        case TOKEN_KIND::unop_negation: {
+            ConditionValue value = evaluate_unary_condition(tokens, i, directive, line_number, is_evaluated);
+            value.value = 0ull - value.value;
+            return value;
+        }
+        case TOKEN_KIND::unop_complement: {
+            ConditionValue value = evaluate_unary_condition(tokens, i, directive, line_number, is_evaluated);
+            value.value = ~value.value;
+            return value;
+        }
+        case TOKEN_KIND::unop_not:
+            return make_condition_value(
+                false, evaluate_unary_condition(tokens, i, directive, line_number, is_evaluated).value == 0 ? 1 : 0);
+        case TOKEN_KIND::parenthesis_open: {
+            ConditionValue value = evaluate_condition(tokens, i, directive, line_number, 0, is_evaluated);
+            if (i >= tokens.size() || tokens[i].token_kind != TOKEN_KIND::parenthesis_close) {
+                raise_condition_error(tokens, i, directive, line_number);
+            }
+            i++;
+            return value;
+        }
+        default:
+            raise_condition_error(tokens, i - 1, directive, line_number);
+    }
+}
+
+static int32_t evaluate_condition_precedence(const std::vector<PreprocessorToken>& tokens, size_t i) {
+    if (i >= tokens.size()) {
+        return -1;
+    }
+    switch (tokens[i].token_kind) {
+        case TOKEN_KIND::binop_multiplication:
+        case TOKEN_KIND::binop_division:
+        case TOKEN_KIND::binop_remainder:
+            return 50;
+        case TOKEN_KIND::unop_negation:
+        case TOKEN_KIND::binop_addition:
+            return 45;
+        case TOKEN_KIND::binop_bitshiftleft:
+        case TOKEN_KIND::binop_bitshiftright:
+            return 40;
+        case TOKEN_KIND::binop_lessthan:
+        case TOKEN_KIND::binop_lessthanorequal:
+        case TOKEN_KIND::binop_greaterthan:
+        case TOKEN_KIND::binop_greaterthanorequal:
+            return 35;
+        case TOKEN_KIND::binop_equalto:
+        case TOKEN_KIND::binop_notequal:
+            return 30;
+        case TOKEN_KIND::binop_bitand:
+            return 25;
+        case TOKEN_KIND::binop_bitxor:
+            return 20;
+        case TOKEN_KIND::binop_bitor:
+            return 15;
+        case TOKEN_KIND::binop_and:
+            return 10;
+        case TOKEN_KIND::binop_or:
+            return 5;
+        case TOKEN_KIND::ternary_if:
+            return 3;
+        default:
+            return -1;
+    }
+}
+
+static bool is_condition_less_than(uint64_t left, uint64_t right, bool is_unsigned) {
+    return is_unsigned ? left < right : static_cast<int64_t>(left) < static_cast<int64_t>(right);
+}
+
+// Division by zero is an error only in evaluated operands
+static uint64_t evaluate_division_condition(TOKEN_KIND token_kind, uint64_t left, uint64_t right, bool is_unsigned,
+    bool is_evaluated, const std::string& directive, size_t line_number) {
+    bool is_division = token_kind == TOKEN_KIND::binop_division;
+    if (right == 0ull) {
+        if (is_evaluated) {
+            raise_runtime_error_at_line(
+                GET_ERROR_MESSAGE(ERROR_MESSAGE_LEXER::division_by_zero_in_conditional_expression, directive),
+                line_number);
+        }
+        return 0ull;
+    }
+    else if (is_unsigned) {
+        return is_division ? left / right : left % right;
+    }
+    else if (right == ~0ull) {
+        return is_division ? 0ull - left : 0ull;
+    }
+    int64_t signed_left = static_cast<int64_t>(left);
+    int64_t signed_right = static_cast<int64_t>(right);
+    return static_cast<uint64_t>(is_division ? signed_left / signed_right : signed_left % signed_right);
+}
+
+// Binary operands are converted to uintmax_t when either is unsigned, while a shift has the type of its left operand
+// and comparisons and logical operators have the type intmax_t. The right operand of && || and the unselected
+// operand of ?: are parsed but not evaluated
+static ConditionValue evaluate_condition(const std::vector<PreprocessorToken>& tokens, size_t& i,
+    const std::string& directive, size_t line_number, int32_t min_precedence, bool is_evaluated) {
+    ConditionValue value_left = evaluate_unary_condition(tokens, i, directive, line_number, is_evaluated);
+    while (true) {
+        int32_t precedence = evaluate_condition_precedence(tokens, i);
+        if (precedence < min_precedence) {
+            break;
+        }
+        TOKEN_KIND token_kind = tokens[i++].token_kind;
+        bool is_true = value_left.value != 0ull;
+        if (token_kind == TOKEN_KIND::ternary_if) {
+            ConditionValue value_middle =
+                evaluate_condition(tokens, i, directive, line_number, 0, is_evaluated && is_true);
+            if (i >= tokens.size() || tokens[i].token_kind != TOKEN_KIND::ternary_else) {
+                raise_condition_error(tokens, i, directive, line_number);
+            }
+            i++;
+            ConditionValue value_right =
+                evaluate_condition(tokens, i, directive, line_number, precedence, is_evaluated && !is_true);
+            value_left = make_condition_value(value_middle.is_unsigned || value_right.is_unsigned,
+                is_true ? value_middle.value : value_right.value);
+            continue;
+        }
+        else if (token_kind == TOKEN_KIND::binop_and || token_kind == TOKEN_KIND::binop_or) {
+            bool is_short_circuit = token_kind == TOKEN_KIND::binop_and ? !is_true : is_true;
+            ConditionValue value_right = evaluate_condition(
+                tokens, i, directive, line_number, precedence + 1, is_evaluated && !is_short_circuit);
+            value_left =
+                make_condition_value(false, is_short_circuit ? (is_true ? 1 : 0) : (value_right.value != 0ull ? 1 : 0));
+            continue;
+        }
+
+        ConditionValue value_right =
+            evaluate_condition(tokens, i, directive, line_number, precedence + 1, is_evaluated);
+        bool is_unsigned = value_left.is_unsigned || value_right.is_unsigned;
+        uint64_t left = value_left.value;
+        uint64_t right = value_right.value;
+        switch (token_kind) {
+            case TOKEN_KIND::binop_multiplication:
+                value_left = make_condition_value(is_unsigned, left * right);
+                break;
+            case TOKEN_KIND::binop_division:
+            case TOKEN_KIND::binop_remainder:
+                value_left = make_condition_value(is_unsigned,
+                    evaluate_division_condition(token_kind, left, right, is_unsigned, is_evaluated, directive,
+                        line_number));
+                break;
+            case TOKEN_KIND::binop_addition:
+                value_left = make_condition_value(is_unsigned, left + right);
+                break;
+            case TOKEN_KIND::unop_negation:
+                value_left = make_condition_value(is_unsigned, left - right);
+                break;
+            case TOKEN_KIND::binop_bitshiftleft:
+                value_left.value = right < 64ull ? left << right : 0ull;
+                break;
+            case TOKEN_KIND::binop_bitshiftright: {
+                if (value_left.is_unsigned) {
+                    value_left.value = right < 64ull ? left >> right : 0ull;
+                }
+                else {
+                    int64_t signed_left = static_cast<int64_t>(left);
+                    value_left.value = static_cast<uint64_t>(
+                        right < 64ull ? signed_left >> right : (signed_left < 0 ? -1 : 0));
+                }
+                break;
+            }
+            case TOKEN_KIND::binop_lessthan:
+                value_left = make_condition_value(false, is_condition_less_than(left, right, is_unsigned) ? 1 : 0);
+                break;
+            case TOKEN_KIND::binop_lessthanorequal:
+                value_left = make_condition_value(false, !is_condition_less_than(right, left, is_unsigned) ? 1 : 0);
+                break;
+            case TOKEN_KIND::binop_greaterthan:
+                value_left = make_condition_value(false, is_condition_less_than(right, left, is_unsigned) ? 1 : 0);
+                break;
+            case TOKEN_KIND::binop_greaterthanorequal:
+                value_left = make_condition_value(false, !is_condition_less_than(left, right, is_unsigned) ? 1 : 0);
+                break;
+            case TOKEN_KIND::binop_equalto:
+                value_left = make_condition_value(false, left == right ? 1 : 0);
+                break;
+            case TOKEN_KIND::binop_notequal:
+                value_left = make_condition_value(false, left != right ? 1 : 0);
+                break;
+            case TOKEN_KIND::binop_bitand:
+                value_left = make_condition_value(is_unsigned, left & right);
+                break;
+            case TOKEN_KIND::binop_bitxor:
+                value_left = make_condition_value(is_unsigned, left ^ right);
+                break;
+            case TOKEN_KIND::binop_bitor:
+                value_left = make_condition_value(is_unsigned, left | right);
+                break;
+            default:
+                RAISE_INTERNAL_ERROR;
+        }
+    }
+    return value_left;
+}
+
+static bool preprocess_condition(std::vector<PreprocessorToken>& tokens, size_t line_number) {
+    const std::string& directive = tokens[0].token;
+    std::vector<PreprocessorToken> condition_tokens;
+    for (size_t i = 1; i < tokens.size(); ++i) {
+        if (tokens[i].token != "defined") {
+            condition_tokens.push_back(std::move(tokens[i]));
+            continue;
+        }
+        bool is_parenthesis = i + 1 < tokens.size() && tokens[i + 1].token_kind == TOKEN_KIND::parenthesis_open;
+        if (is_parenthesis) {
+            i++;
+        }
+        const std::string& name = get_macro_name(tokens, i + 1, directive, line_number);
+        condition_tokens.push_back(make_preprocessor_token(TOKEN_KIND::constant,
+            context->macros.find(name) != context->macros.end() ? "1" : "0", tokens[i].line, tokens[i].is_space));
+        i++;
+        if (is_parenthesis) {
+            if (i + 1 >= tokens.size() || tokens[i + 1].token_kind != TOKEN_KIND::parenthesis_close) {
+                raise_condition_error(tokens, i + 1, directive, line_number);
+            }
+            i++;
+        }
+    }
+    expand_macros(condition_tokens);
+    for (auto& token : condition_tokens) {
+        if (is_macro_name(token.token_kind)) {
+            token.token_kind = TOKEN_KIND::constant;
+            token.token = "0";
+        }
+    }
+
+    size_t i = 0;
+    bool is_condition = evaluate_condition(condition_tokens, i, directive, line_number, 0, true).value != 0ull;
+    if (i < condition_tokens.size()) {
+        raise_condition_error(condition_tokens, i, directive, line_number);
+    }
+    return is_condition;
+}
+
+static void preprocess_if(std::vector<PreprocessorToken>& tokens, size_t line_number) {
+    ConditionalGroup conditional_group = {false, true, false, line_number};
+    if (!is_preprocessor_skip()) {
+        IncludeGuard& include_guard = context->include_guards.back();
+        if (tokens[0].token == "if") {
+            conditional_group.is_active = preprocess_condition(tokens, line_number);
+            touch_include_guard();
+        }
+        else {
+            const std::string& name = get_macro_name(tokens, 1, tokens[0].token, line_number);
+            conditional_group.is_active = context->macros.find(name) != context->macros.end();
+            if (tokens[0].token == "ifndef") {
+                conditional_group.is_active = !conditional_group.is_active;
+                // #ifndef first in the file, with the matching #endif last, is an include guard
+                if (include_guard.state == INCLUDE_GUARD::guard_start
+                    && context->conditional_groups.size() == include_guard.depth) {
+                    include_guard.state = INCLUDE_GUARD::guard_inside;
+                    include_guard.macro_name = name;
+                }
+                else {
+                    touch_include_guard();
                 }
             }
+            else {
+                touch_include_guard();
+            }
+        }
+        conditional_group.is_taken = conditional_group.is_active;
+    }
+    context->conditional_groups.push_back(conditional_group);
+}
+
+static void preprocess_else(std::vector<PreprocessorToken>& tokens, size_t line_number) {
+    IncludeGuard& include_guard = context->include_guards.back();
+    if (context->conditional_groups.size() <= include_guard.depth || context->conditional_groups.back().is_else) {
+        raise_runtime_error_at_line(
+            GET_ERROR_MESSAGE(ERROR_MESSAGE_LEXER::unmatched_conditional_directive, tokens[0].token), line_number);
+    }
+    if (include_guard.state == INCLUDE_GUARD::guard_inside
+        && context->conditional_groups.size() == include_guard.depth + 1) {
+        include_guard.state = INCLUDE_GUARD::guard_none;
+    }
+
+    ConditionalGroup& conditional_group = context->conditional_groups.back();
+    if (conditional_group.is_taken) {
+        conditional_group.is_active = false;
+    }
+    else if (tokens[0].token == "elif") {
+        conditional_group.is_active = preprocess_condition(tokens, line_number);
+        conditional_group.is_taken = conditional_group.is_active;
+    }
+    else {
+        conditional_group.is_active = true;
+        conditional_group.is_taken = true;
+    }
+    if (tokens[0].token == "else") {
+        conditional_group.is_else = true;
+    }
+}
+
+static void preprocess_endif(std::vector<PreprocessorToken>& tokens, size_t line_number) {
+    IncludeGuard& include_guard = context->include_guards.back();
+    if (context->conditional_groups.size() <= include_guard.depth) {
+        raise_runtime_error_at_line(
+            GET_ERROR_MESSAGE(ERROR_MESSAGE_LEXER::unmatched_conditional_directive, tokens[0].token), line_number);
+    }
+    context->conditional_groups.pop_back();
+    if (include_guard.state == INCLUDE_GUARD::guard_inside
+        && context->conditional_groups.size() == include_guard.depth) {
+        include_guard.state = INCLUDE_GUARD::guard_end;
+    }
+}
+
+// The lines after a line directive are numbered from its line number in diagnostics, and take its file name if any
+static void preprocess_line(std::vector<PreprocessorToken>& tokens, size_t line_number) {
+    std::vector<PreprocessorToken> line_tokens(
+        std::make_move_iterator(tokens.begin() + 1), std::make_move_iterator(tokens.end()));
+    expand_macros(line_tokens);
+    size_t i = 0;
+    if (i < line_tokens.size() && line_tokens[i].token_kind == TOKEN_KIND::constant) {
+        i++;
+        if (i < line_tokens.size() && line_tokens[i].token_kind == TOKEN_KIND::string_literal) {
+            i++;
+        }
+    }
+    if (i == 0 || i < line_tokens.size()) {
+        raise_runtime_error_at_line(GET_ERROR_MESSAGE(ERROR_MESSAGE_LEXER::invalid_line_directive,
+                                        i < line_tokens.size() ? line_tokens[i].token : tokens[0].token),
+            line_number);
+    }
+
+    FileOpenLine file_open_line = {static_cast<size_t>(strtoull(line_tokens[0].token.c_str(), nullptr, 10)),
+        context->total_line_number + 1, errors->file_open_lines.back().filename};
+    if (line_tokens.size() == 2) {
+        file_open_line.filename = line_tokens[1].token.substr(1, line_tokens[1].token.size() - 2);
+    }
+    errors->file_open_lines.emplace_back(std::move(file_open_line));
+}
+
+static void preprocess_directive(std::string_view directive, size_t line_number) {
+    std::vector<PreprocessorToken> tokens;
+    lex_preprocessor_tokens(directive, context->total_line_number, tokens);
+    if (tokens.empty()) {
+        return;
+    }
+    const std::string& name = tokens[0].token;
+    if (name == "if" || name == "ifdef" || name == "ifndef") {
+        preprocess_if(tokens, line_number);
+        return;
+    }
+    else if (name == "elif" || name == "else") {
+        preprocess_else(tokens, line_number);
+        return;
+    }
+    else if (name == "endif") {
+        preprocess_endif(tokens, line_number);
+        return;
+    }
+    else if (is_preprocessor_skip()) {
+        return;
+    }
+
+    touch_include_guard();
+    flush_preprocessor_tokens();
+    if (name == "define") {
+        preprocess_define(tokens, line_number);
+    }
+    else if (name == "undef") {
+        context->macros.erase(get_macro_name(tokens, 1, name, line_number));
+    }
+    else if (name == "pragma") {
+        if (tokens.size() == 2 && tokens[1].token == "once") {
+            context->pragma_once_set.insert(context->include_guards.back().filename);
+        }
+    }
+    else if (name == "error") {
+        directive.remove_prefix(name.size());
+        directive.remove_prefix(std::min(directive.find_first_not_of(' '), directive.size()));
+        raise_runtime_error_at_line(
+            GET_ERROR_MESSAGE(ERROR_MESSAGE_LEXER::error_directive, std::string(directive)), line_number);
+    }
+    else if (name == "warning") {
+        directive.remove_prefix(name.size());
+        directive.remove_prefix(std::min(directive.find_first_not_of(' '), directive.size()));
+        raise_warning_at_line(
+            GET_ERROR_MESSAGE(ERROR_MESSAGE_LEXER::warning_directive, std::string(directive)), line_number);
+    }
+    else if (name == "line") {
+        preprocess_line(tokens, line_number);
+    }
+    else if (name == "include") {
+        directive.remove_prefix(name.size());
+        directive.remove_prefix(std::min(directive.find_first_not_of(' '), directive.size()));
+        raise_runtime_error_at_line(
+            GET_ERROR_MESSAGE(ERROR_MESSAGE_LEXER::failed_to_include_header_file, std::string(directive)),
+            line_number);
+    }
+    else {
+        raise_runtime_error_at_line(
+            GET_ERROR_MESSAGE(ERROR_MESSAGE_LEXER::invalid_preprocessor_directive, name), line_number);
+    }
+}
 
+// Directives are kept as a single line without comments and line continuations, so that they can be cached
+static size_t tokenize_directive(std::string_view directive, std::string_view line, size_t line_number) {
+    std::string text(directive.substr(scan_spaces(directive, directive.find('#') + 1)));
+    size_t n_lines = 0;
+    bool is_comment = false;
+    bool is_line_comment = false;
+    bool is_space = false;
+    while (true) {
+        bool is_continued = false;
+        {
+            size_t len = line.size();
+            while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r')) {
+                len--;
+            }
+            if (len > 0 && line[len - 1] == '\\') {
+                is_continued = true;
+                len--;
+            }
+            line = line.substr(0, len);
+        }
+        TOKEN_KIND token_kind;
+        // A line continuation also continues a single line comment
+        for (size_t i = 0; i < line.size() && !is_line_comment;) {
+            size_t j = scan_preprocessor_token(line, i, token_kind);
             if (is_comment) {
-                if (last_group == TOKEN_KIND::comment_multilineend) {
+                if (token_kind == TOKEN_KIND::comment_multilineend) {
                     is_comment = false;
+                    is_space = true;
                 }
-                continue;
+            }
+            else if (token_kind == TOKEN_KIND::comment_singleline) {
+                is_line_comment = true;
+                break;
+            }
+            else if (token_kind == TOKEN_KIND::comment_multilinestart) {
+                is_comment = true;
+            }
+            else if (token_kind == TOKEN_KIND::skip) {
+                is_space = true;
             }
             else {
-                switch (last_group) {
-                    case TOKEN_KIND::error:
-                    case TOKEN_KIND::comment_multilineend:
-                        raise_runtime_error_at_line(
-                            GET_ERROR_MESSAGE(ERROR_MESSAGE_LEXER::invalid_token, match.get_last_closed_paren()),
-                            line_number);
-                    case TOKEN_KIND::skip:
-                        goto Lcontinue;
-                    case TOKEN_KIND::comment_multilinestart: {
-                        is_comment = true;
-                        goto Lcontinue;
-                    }
-                    case TOKEN_KIND::include_directive:
-                        tokenize_header(match.get_last_closed_paren(), line_number);
-                        goto Lcontinue;
-                    case TOKEN_KIND::comment_singleline:
-                    case TOKEN_KIND::preprocessor_directive:
-                        goto Lbreak;
-                    default:
-                        goto Lpass;
+                if (is_space) {
+                    text += ' ';
+                    is_space = false;
+                }
+                text += line.substr(i, j - i);
+            }
+            i = j;
+        }
+        if (!is_continued || !read_line(line)) {
+            break;
+        }
+        n_lines++;
+        context->total_line_number++;
+    }
+    context->is_comment = is_comment;
+
+    cache_token(TOKEN_KIND::preprocessor_directive, text, line_number);
+    preprocess_directive(text, line_number);
+    return n_lines;
+}
+
+static bool is_preprocessor_header_skip(const std::string& filename, size_t line_number) {
+    if (context->pragma_once_set.find(filename) != context->pragma_once_set.end()) {
+        return true;
+    }
+    auto guard_macro = context->guard_macros.find(filename);
+    if (guard_macro != context->guard_macros.end()
+        && context->macros.find(guard_macro->second) != context->macros.end()) {
+        return true;
+    }
+    if (context->include_guards.size() >= INCLUDE_DEPTH_MAX) {
+        raise_runtime_error_at_line(
+            GET_ERROR_MESSAGE(ERROR_MESSAGE_LEXER::include_nested_too_deeply, filename), line_number);
+    }
+    return false;
+}
+
+static void preprocess_file_start(const std::string& filename) {
+    IncludeGuard include_guard = {INCLUDE_GUARD::guard_start, context->conditional_groups.size(), filename, ""};
+    context->include_guards.emplace_back(std::move(include_guard));
+}
+
+static void preprocess_file_end() {
+    flush_preprocessor_tokens();
+    IncludeGuard& include_guard = context->include_guards.back();
+    if (context->conditional_groups.size() > include_guard.depth) {
+        raise_runtime_error_at_line(
+            GET_ERROR_MESSAGE(ERROR_MESSAGE_LEXER::unterminated_conditional_directive, "if"),
+            context->conditional_groups.back().line);
+    }
+    if (include_guard.state == INCLUDE_GUARD::guard_end) {
+        context->guard_macros[include_guard.filename] = std::move(include_guard.macro_name);
+    }
+    context->include_guards.pop_back();
+}
+
+static void init_macros() {
+    for (const char* macro : {"__STDC__ 1", "__STDC_HOSTED__ 1", "__STDC_VERSION__ 201710L", "__x86_64__ 1"}) {
+        std::vector<PreprocessorToken> tokens;
+        lex_preprocessor_tokens(std::string("define ") + macro, 0, tokens);
+        preprocess_define(tokens, 0);
+    }
+}
+
+// Token cache
+
+// Cached header tokens are keyed by resolved path, size, modification time and content hash. The cached tokens of a
+// header hold its own tokens with file lines, and its include directives, which are tokenized again when spliced in.
+// With the preprocessor, a skip token marks whitespace before the next token
+constexpr char TOKEN_CACHE_MAGIC[] = "wheelcc tokens 3";
+
+static uint64_t hash_token_cache(std::string_view content) {
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : content) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+static void cache_uint(std::string& token_cache, uint64_t value, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+        token_cache += static_cast<char>((value >> (8 * i)) & 0xFF);
+    }
+}
+
+static bool uncache_uint(std::string_view& token_cache, uint64_t& value, size_t size) {
+    if (token_cache.size() < size) {
+        return false;
+    }
+    value = 0;
+    for (size_t i = 0; i < size; ++i) {
+        value |= static_cast<uint64_t>(static_cast<unsigned char>(token_cache[i])) << (8 * i);
+    }
+    token_cache.remove_prefix(size);
+    return true;
+}
+
+static void cache_string(std::string& token_cache, std::string_view value) {
+    cache_uint(token_cache, value.size(), 4);
+    token_cache += value;
+}
+
+static bool uncache_string(std::string_view& token_cache, std::string_view& value) {
+    uint64_t size;
+    if (!uncache_uint(token_cache, size, 4) || token_cache.size() < size) {
+        return false;
+    }
+    value = token_cache.substr(0, size);
+    token_cache.remove_prefix(size);
+    return true;
+}
+
+static bool is_cache_spelling(TOKEN_KIND token_kind) {
+    switch (token_kind) {
+        case TOKEN_KIND::include_directive:
+        case TOKEN_KIND::preprocessor_directive:
+        case TOKEN_KIND::identifier:
+        case TOKEN_KIND::string_literal:
+        case TOKEN_KIND::char_constant:
+        case TOKEN_KIND::float_constant:
+        case TOKEN_KIND::unsigned_long_constant:
+        case TOKEN_KIND::unsigned_constant:
+        case TOKEN_KIND::long_constant:
+        case TOKEN_KIND::constant:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static void cache_token(TOKEN_KIND token_kind, std::string_view token, size_t line_number) {
+    if (context->token_caches.empty()) {
+        return;
+    }
+    std::string& token_cache = context->token_caches.back();
+    cache_uint(token_cache, token_kind, 1);
+    cache_uint(token_cache, line_number, 4);
+    if (is_cache_spelling(token_kind)) {
+        cache_string(token_cache, token);
+    }
+}
+
+static void cache_key(std::string& token_cache, const std::string& filename, size_t file_size, int64_t file_mtime,
+    uint64_t file_hash) {
+    token_cache += TOKEN_CACHE_MAGIC;
+    cache_uint(token_cache, context->is_preprocessor ? 1 : 0, 1);
+    cache_uint(token_cache, context->is_regex_lexer ? 1 : 0, 1);
+    cache_string(token_cache, filename);
+    cache_uint(token_cache, file_size, 8);
+    cache_uint(token_cache, static_cast<uint64_t>(file_mtime), 8);
+    cache_uint(token_cache, file_hash, 8);
+}
+
+static bool uncache_tokens(std::string_view token_cache, std::string_view key, std::vector<Token>& tokens,
+    size_t& line_number) {
+    if (token_cache.substr(0, key.size()) != key) {
+        return false;
+    }
+    token_cache.remove_prefix(key.size());
+
+    uint64_t value;
+    if (!uncache_uint(token_cache, value, 4)) {
+        return false;
+    }
+    line_number = static_cast<size_t>(value);
+    while (!token_cache.empty()) {
+        Token token = {std::string_view(), TOKEN_KIND::error, 0};
+        if (!uncache_uint(token_cache, value, 1) || value >= TOKEN_KIND::error) {
+            return false;
+        }
+        token.token_kind = static_cast<TOKEN_KIND>(value);
+        if (!uncache_uint(token_cache, value, 4) || value == 0 || value > line_number) {
+            return false;
+        }
+        token.line = static_cast<size_t>(value);
+        if (is_cache_spelling(token.token_kind) && !uncache_string(token_cache, token.token)) {
+            return false;
+        }
+        tokens.push_back(token);
+    }
+    return true;
+}
+
+static void tokenize_cached_tokens(const std::vector<Token>& tokens, size_t line_number) {
+    size_t line_offset = context->total_line_number;
+    for (const auto& token : tokens) {
+        switch (token.token_kind) {
+            case TOKEN_KIND::include_directive: {
+                context->total_line_number = line_offset + token.line;
+                if (context->is_preprocessor) {
+                    preprocess_include(token.token, token.line);
+                }
+                else {
+                    tokenize_header(std::string(token.token), token.line);
+                }
+                line_offset = context->total_line_number - token.line;
+                break;
+            }
+            case TOKEN_KIND::preprocessor_directive: {
+                context->total_line_number = line_offset + token.line;
+                preprocess_directive(token.token, token.line);
+                break;
+            }
+            case TOKEN_KIND::skip: {
+                context->is_space = true;
+                break;
+            }
+            default: {
+                if (context->is_preprocessor) {
+                    preprocess_token(token.token_kind, token.token, line_offset + token.line);
+                }
+                else {
+                    push_token(token.token_kind, token.token, line_offset + token.line);
                 }
-            Lbreak:
                 break;
-            Lcontinue:
-                continue;
-            Lpass:;
             }
+        }
+    }
+    context->total_line_number = line_offset + line_number;
+}
 
-            Token token = {
-                match.get_last_closed_paren(), static_cast<TOKEN_KIND>(last_group), context->total_line_number};
-            context->p_tokens->emplace_back(std::move(token));
+static void tokenize_cached_file(const std::string& filename) {
+    size_t file_size;
+    int64_t file_mtime;
+    if (!stat_file(filename, file_size, file_mtime)) {
+        tokenize_file();
+        return;
+    }
+    std::string key;
+    cache_key(key, filename, file_size, file_mtime, hash_token_cache(get_file_read()));
+
+    // Each mode gets its own cache file, so that switching modes does not overwrite the cache of another mode
+    std::string cache_filename;
+    {
+        uint64_t path_hash = hash_token_cache(
+            filename + (context->is_preprocessor ? " -E" : "") + (context->is_regex_lexer ? " --regexlex" : ""));
+        char buffer[17];
+        snprintf(buffer, sizeof(buffer), "%016" PRIx64, path_hash);
+        cache_filename = context->cachedir + buffer + ".tok";
+    }
+    {
+        std::string token_cache;
+        if (read_binary_file(cache_filename, token_cache)) {
+            std::vector<Token> tokens;
+            size_t line_number;
+            if (uncache_tokens(token_cache, key, tokens, line_number)) {
+                tokenize_cached_tokens(tokens, line_number);
+                return;
+            }
         }
     }
+
+    context->token_caches.emplace_back();
+    size_t line_number = tokenize_file();
+    cache_uint(key, line_number, 4);
+    key += context->token_caches.back();
+    context->token_caches.pop_back();
+    write_binary_file(cache_filename, key);
 }
 
 static bool find_header(std::vector<std::string>& dirnames, std::string& filename) {
-    for (auto dirname : dirnames) {
-        dirname += filename;
-        if (find_file(dirname)) {
-            filename = std::move(dirname);
+    for (const auto& dirname : dirnames) {
+        if (find_dir_file(dirname, filename)) {
+            filename = dirname + filename;
             return true;
         }
     }
@@ -190,10 +2076,12 @@ static void tokenize_header(std::string filename, size_t line_number) {
     if (filename.back() == '>') {
         filename = filename.substr(filename.find('<') + 1);
         filename.pop_back();
-        if (context->filename_include_set.find(filename) != context->filename_include_set.end()) {
-            return;
+        if (!context->is_preprocessor) {
+            if (context->filename_include_set.find(filename) != context->filename_include_set.end()) {
+                return;
+            }
+            context->filename_include_set.insert(filename);
         }
-        context->filename_include_set.insert(filename);
         if (!find_header(context->stdlibdirs, filename)) {
             if (!find_header(*context->p_includedirs, filename)) {
                 raise_runtime_error_at_line(
@@ -204,31 +2092,47 @@ static void tokenize_header(std::string filename, size_t line_number) {
     else {
         filename = filename.substr(filename.find('"') + 1);
         filename.pop_back();
-        if (context->filename_include_set.find(filename) != context->filename_include_set.end()) {
-            return;
+        if (!context->is_preprocessor) {
+            if (context->filename_include_set.find(filename) != context->filename_include_set.end()) {
+                return;
+            }
+            context->filename_include_set.insert(filename);
         }
-        context->filename_include_set.insert(filename);
         if (!find_header(*context->p_includedirs, filename)) {
             raise_runtime_error_at_line(
                 GET_ERROR_MESSAGE(ERROR_MESSAGE_LEXER::failed_to_include_header_file, filename), line_number);
         }
     }
 
-    std::string include_filename = errors->file_open_lines.back().filename;
+    if (context->is_preprocessor && is_preprocessor_header_skip(filename, line_number)) {
+        return;
+    }
+
+    FileOpenLine include_file_open_line = errors->file_open_lines.back();
+    include_file_open_line.line_number += context->total_line_number + 1 - include_file_open_line.total_line_number;
     file_open_read(filename);
     {
-        FileOpenLine file_open_line = {1, context->total_line_number + 1, std::move(filename)};
+        FileOpenLine file_open_line = {1, context->total_line_number + 1, filename};
         errors->file_open_lines.emplace_back(std::move(file_open_line));
     }
-    tokenize_file();
-    file_close_read(line_number);
-    {
-        FileOpenLine file_open_line = {line_number + 1, context->total_line_number + 1, std::move(include_filename)};
-        errors->file_open_lines.emplace_back(std::move(file_open_line));
+    if (context->is_preprocessor) {
+        preprocess_file_start(filename);
     }
+    if (context->cachedir.empty()) {
+        tokenize_file();
+    }
+    else {
+        tokenize_cached_file(filename);
+    }
+    if (context->is_preprocessor) {
+        preprocess_file_end();
+    }
+    file_close_read();
+    include_file_open_line.total_line_number = context->total_line_number + 1;
+    errors->file_open_lines.emplace_back(std::move(include_file_open_line));
 }
 
-static void tokenize_source() {
+static void compile_token_pattern() {
     std::string regexp_string = "";
     for (size_t i = 0; i < TOKEN_KIND_SIZE; ++i) {
         context->token_groups[i] = std::to_string(i);
@@ -240,29 +2144,142 @@ static void tokenize_source() {
     }
     regexp_string.pop_back();
     context->token_pattern = std::make_unique<const boost::regex>(std::move(regexp_string));
+}
+
+static void tokenize_source(const std::string& filename) {
+    if (context->is_preprocessor) {
+        init_macros();
+        preprocess_file_start(filename);
+    }
+    if (context->is_regex_lexer) {
+        compile_token_pattern();
+    }
     tokenize_file();
+    if (context->is_preprocessor) {
+        preprocess_file_end();
+    }
 }
 
 static void strip_filename_extension(std::string& filename) { filename = filename.substr(0, filename.size() - 2); }
 
+static void init_spellings() {
+    context->p_tokens->spelling_offsets.push_back(0);
+    for (size_t i = 0; i < TOKEN_KIND::identifier; ++i) {
+        switch (i) {
+            case TOKEN_KIND::comment_singleline:
+            case TOKEN_KIND::comment_multilinestart:
+            case TOKEN_KIND::comment_multilineend:
+            case TOKEN_KIND::include_directive:
+            case TOKEN_KIND::preprocessor_directive:
+                push_spelling("");
+                break;
+            default:
+                push_spelling(get_token_kind_hr(static_cast<TOKEN_KIND>(i)));
+                break;
+        }
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-std::unique_ptr<std::vector<Token>> lexing(std::string& filename, std::vector<std::string>&& includedirs) {
+Token get_token(const Tokens& tokens, size_t i) {
+    return {get_spelling(tokens, tokens.spelling_ids[i]), tokens.token_kinds[i], tokens.lines[i]};
+}
+
+Token get_token(const TokenRing& token_ring, size_t i) {
+    i &= TOKEN_RING_SIZE - 1;
+    TOKEN_KIND token_kind = token_ring.token_kinds[i];
+    std::string_view token = is_spelling_kind(token_kind) ? std::string_view(token_ring.spellings[i]) :
+                                                            get_spelling(token_ring.tokens, token_kind);
+    return {token, token_kind, token_ring.lines[i]};
+}
+
+// Return false if the lexer is done before producing the i-th token
+bool wait_token(const TokenRing& token_ring, size_t i) {
+    if (i - token_ring.tail.load(std::memory_order_relaxed) >= TOKEN_RING_SIZE) {
+        RAISE_INTERNAL_ERROR;
+    }
+    while (token_ring.head.load(std::memory_order_acquire) <= i) {
+        if (token_ring.is_done.load(std::memory_order_acquire)) {
+            return token_ring.head.load(std::memory_order_acquire) > i;
+        }
+        std::this_thread::yield();
+    }
+    return true;
+}
+
+// Give the slots before the i-th token back to the lexer
+void release_tokens(TokenRing& token_ring, size_t i) { token_ring.tail.store(i, std::memory_order_release); }
+
+// Lexer errors are raised first, as the whole file is lexed before parsing it without the pipeline
+void join_lexing(TokenRing& token_ring, bool is_discard) {
+    if (!token_ring.lexer_thread.joinable() || token_ring.lexer_thread.get_id() == std::this_thread::get_id()) {
+        return;
+    }
+    token_ring.is_discard.store(is_discard, std::memory_order_relaxed);
+    token_ring.lexer_thread.join();
+    if (token_ring.lexer_error) {
+        std::rethrow_exception(token_ring.lexer_error);
+    }
+}
+
+std::unique_ptr<Tokens> lexing(std::string& filename, std::vector<std::string>&& includedirs, std::string&& cachedir,
+    bool is_regex_lexer, bool is_preprocessor) {
     file_open_read(filename);
     {
         FileOpenLine file_open_line = {1, 1, filename};
         errors->file_open_lines.emplace_back(std::move(file_open_line));
     }
 
-    std::vector<Token> tokens;
-    context = std::make_unique<LexerContext>(&tokens, &includedirs);
-    tokenize_source();
+    Tokens tokens;
+    context =
+        std::make_unique<LexerContext>(&tokens, &includedirs, std::move(cachedir), is_regex_lexer, is_preprocessor);
+    init_spellings();
+    tokenize_source(filename);
     context.reset();
 
-    file_close_read(0);
+    file_close_read();
     includedirs.clear();
     std::vector<std::string>().swap(includedirs);
     set_filename(filename);
     strip_filename_extension(filename);
-    return std::make_unique<std::vector<Token>>(std::move(tokens));
+    return std::make_unique<Tokens>(std::move(tokens));
+}
+
+static void lexing_thread(TokenRing* p_token_ring, std::string* p_filename, std::vector<std::string> includedirs,
+    std::string cachedir, bool is_regex_lexer, bool is_preprocessor) {
+    try {
+        file_open_read(*p_filename);
+        {
+            FileOpenLine file_open_line = {1, 1, *p_filename};
+            errors->file_open_lines.emplace_back(std::move(file_open_line));
+        }
+
+        context = std::make_unique<LexerContext>(
+            &p_token_ring->tokens, &includedirs, std::move(cachedir), is_regex_lexer, is_preprocessor);
+        context->p_token_ring = p_token_ring;
+        init_spellings();
+        tokenize_source(*p_filename);
+        context.reset();
+
+        file_close_read();
+        set_filename(*p_filename);
+        strip_filename_extension(*p_filename);
+    }
+    catch (...) {
+        context.reset();
+        p_token_ring->lexer_error = std::current_exception();
+    }
+    p_token_ring->is_done.store(true, std::memory_order_release);
+}
+
+std::unique_ptr<TokenRing> lexing_pipeline(std::string& filename, std::vector<std::string>&& includedirs,
+    std::string&& cachedir, bool is_regex_lexer, bool is_preprocessor) {
+    std::unique_ptr<TokenRing> token_ring = std::make_unique<TokenRing>();
+    errors->p_token_ring = token_ring.get();
+    token_ring->lexer_thread = std::thread(lexing_thread, token_ring.get(), &filename, std::move(includedirs),
+        std::move(cachedir), is_regex_lexer, is_preprocessor);
+    includedirs.clear();
+    std::vector<std::string>().swap(includedirs);
+    return token_ring;
 }
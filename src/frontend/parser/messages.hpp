@@ -8,7 +8,23 @@
 enum ERROR_MESSAGE_LEXER {
     unhandled_lexer_error = 300,
     invalid_token,
-    failed_to_include_header_file
+    failed_to_include_header_file,
+    include_nested_too_deeply,
+    invalid_preprocessor_directive,
+    error_directive,
+    invalid_macro_name,
+    invalid_macro_parameter_list,
+    stringify_without_macro_parameter,
+    token_paste_at_macro_boundary,
+    invalid_token_paste,
+    unterminated_macro_argument_list,
+    wrong_number_of_macro_arguments,
+    invalid_conditional_expression,
+    division_by_zero_in_conditional_expression,
+    unmatched_conditional_directive,
+    unterminated_conditional_directive,
+    warning_directive,
+    invalid_line_directive
 };
 
 enum ERROR_MESSAGE_PARSER {
@@ -18,7 +18,8 @@
 
 static std::unique_ptr<ParserContext> context;
 
-ParserContext::ParserContext(std::vector<Token>* p_tokens) : p_tokens(p_tokens), pop_index(0) {}
+ParserContext::ParserContext(const Tokens* p_tokens, TokenRing* p_token_ring) :
+    p_tokens(p_tokens), p_token_ring(p_token_ring), pop_index(0) {}
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -26,80 +27,112 @@ ParserContext::ParserContext(std::vector<Token>* p_tokens) : p_tokens(p_tokens),
 
 static void expect_next_is(const Token& next_token_is, TOKEN_KIND expected_token) {
     if (next_token_is.token_kind != expected_token) {
-        RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::unexpected_next_token, next_token_is.token,
-                                        get_token_kind_hr(expected_token)),
+        RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::unexpected_next_token,
+                                        std::string(next_token_is.token), get_token_kind_hr(expected_token)),
             next_token_is.line);
     }
 }
 
+// Tokens popped ahead of the cursor are skipped by index, the token arrays are never reordered
+static size_t get_pop_index(size_t i) {
+    size_t pop_index = context->pop_index + i;
+    for (size_t skip_index : context->skip_indices) {
+        if (skip_index > pop_index) {
+            break;
+        }
+        pop_index++;
+    }
+    return pop_index;
+}
+
+static bool is_pop_index(size_t pop_index) {
+    if (context->p_token_ring) {
+        return wait_token(*context->p_token_ring, pop_index);
+    }
+    return pop_index < context->p_tokens->token_kinds.size();
+}
+
+static Token get_pop_token(size_t pop_index) {
+    if (context->p_token_ring) {
+        return get_token(*context->p_token_ring, pop_index);
+    }
+    return get_token(*context->p_tokens, pop_index);
+}
+
+static size_t get_last_line() {
+    if (context->p_token_ring) {
+        return context->p_token_ring->last_line;
+    }
+    return context->p_tokens->lines.back();
+}
+
+static bool is_next_i(size_t i) { return is_pop_index(get_pop_index(i)); }
+
 static const Token& pop_next() {
-    if (context->pop_index >= context->p_tokens->size()) {
-        RAISE_RUNTIME_ERROR_AT_LINE(
-            GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::reached_end_of_file), context->p_tokens->back().line);
+    size_t pop_index = get_pop_index(0);
+    if (!is_pop_index(pop_index)) {
+        RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::reached_end_of_file), get_last_line());
     }
 
-    context->next_token = &(*context->p_tokens)[context->pop_index];
-    context->pop_index++;
-    return *context->next_token;
+    context->skip_indices.erase(
+        context->skip_indices.begin(), context->skip_indices.begin() + (pop_index - context->pop_index));
+    if (context->p_token_ring) {
+        release_tokens(*context->p_token_ring, pop_index);
+    }
+    context->next_token = get_pop_token(pop_index);
+    context->pop_index = pop_index + 1;
+    return context->next_token;
 }
 
 static const Token& pop_next_i(size_t i) {
     if (i == 0) {
         return pop_next();
     }
-    if (context->pop_index + i >= context->p_tokens->size()) {
-        RAISE_RUNTIME_ERROR_AT_LINE(
-            GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::reached_end_of_file), context->p_tokens->back().line);
+    size_t pop_index = get_pop_index(i);
+    if (!is_pop_index(pop_index)) {
+        RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::reached_end_of_file), get_last_line());
     }
 
-    if (i == 1) {
-        std::swap((*context->p_tokens)[context->pop_index], (*context->p_tokens)[context->pop_index + 1]);
-    }
-    else {
-        Token swap_token_i = std::move((*context->p_tokens)[context->pop_index + i]);
-        for (size_t j = context->pop_index + i; j-- > context->pop_index;) {
-            (*context->p_tokens)[j + 1] = std::move((*context->p_tokens)[j]);
-        }
-        (*context->p_tokens)[context->pop_index] = std::move(swap_token_i);
-    }
-    pop_next();
-    return (*context->p_tokens)[context->pop_index - 1];
+    context->skip_indices.insert(
+        std::upper_bound(context->skip_indices.begin(), context->skip_indices.end(), pop_index), pop_index);
+    context->next_token = get_pop_token(pop_index);
+    return context->next_token;
 }
 
 static const Token& peek_next() {
-    if (context->pop_index >= context->p_tokens->size()) {
-        RAISE_RUNTIME_ERROR_AT_LINE(
-            GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::reached_end_of_file), context->p_tokens->back().line);
+    size_t pop_index = get_pop_index(0);
+    if (!is_pop_index(pop_index)) {
+        RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::reached_end_of_file), get_last_line());
     }
 
-    context->peek_token = &(*context->p_tokens)[context->pop_index];
-    return *context->peek_token;
+    context->peek_token = get_pop_token(pop_index);
+    return context->peek_token;
 }
 
-static const Token& peek_next_i(size_t i) {
+static Token peek_next_i(size_t i) {
     if (i == 0) {
         return peek_next();
     }
-    if (context->pop_index + i >= context->p_tokens->size()) {
-        RAISE_RUNTIME_ERROR_AT_LINE(
-            GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::reached_end_of_file), context->p_tokens->back().line);
+    size_t pop_index = get_pop_index(i);
+    if (!is_pop_index(pop_index)) {
+        RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::reached_end_of_file), get_last_line());
     }
 
-    return (*context->p_tokens)[context->pop_index + i];
+    return get_pop_token(pop_index);
 }
 
 // <identifier> ::= ? An identifier token ?
-static void parse_identifier(TIdentifier& identifier, size_t i) { identifier = std::move(pop_next_i(i).token); }
+static void parse_identifier(TIdentifier& identifier, size_t i) { identifier = make_identifier(pop_next_i(i).token); }
 
 // string = StringLiteral(int*)
 // <string> ::= ? A string token ?
 static std::shared_ptr<CStringLiteral> parse_string_literal() {
     std::vector<TChar> value;
     {
-        string_to_string_literal(context->next_token->token, value);
+        string_to_string_literal(std::string(context->next_token.token), value);
         while (peek_next().token_kind == TOKEN_KIND::string_literal) {
             pop_next();
-            string_to_string_literal(context->next_token->token, value);
+            string_to_string_literal(std::string(context->next_token.token), value);
         }
     }
     return std::make_shared<CStringLiteral>(std::move(value));
@@ -113,7 +146,7 @@ static std::shared_ptr<CConstInt> parse_int_constant(intmax_t intmax) {
 
 // <char> ::= ? A char token ?
 static std::shared_ptr<CConstInt> parse_char_constant() {
-    TInt value = string_to_char_ascii(context->next_token->token);
+    TInt value = string_to_char_ascii(std::string(context->next_token.token));
     return std::make_shared<CConstInt>(std::move(value));
 }
 
@@ -125,7 +158,7 @@ static std::shared_ptr<CConstLong> parse_long_constant(intmax_t intmax) {
 
 // <double> ::= ? A floating-point constant token ?
 static std::shared_ptr<CConstDouble> parse_double_constant() {
-    TDouble value = string_to_double(context->next_token->token, context->next_token->line);
+    TDouble value = string_to_double(context->next_token.token, context->next_token.line);
     return std::make_shared<CConstDouble>(std::move(value));
 }
 
@@ -146,7 +179,7 @@ static std::shared_ptr<CConstULong> parse_ulong_constant(uintmax_t uintmax) {
 static std::shared_ptr<CConst> parse_constant() {
     switch (pop_next().token_kind) {
         case TOKEN_KIND::long_constant:
-            context->next_token->token.pop_back();
+            context->next_token.token.remove_suffix(1);
             break;
         case TOKEN_KIND::char_constant:
             return parse_char_constant();
@@ -156,13 +189,13 @@ static std::shared_ptr<CConst> parse_constant() {
             break;
     }
 
-    intmax_t value = string_to_intmax(context->next_token->token, context->next_token->line);
+    intmax_t value = string_to_intmax(context->next_token.token, context->next_token.line);
     if (value > 9223372036854775807ll) {
-        RAISE_RUNTIME_ERROR_AT_LINE(
-            GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::number_too_large_for_long_constant, context->next_token->token),
-            context->next_token->line);
+        RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::number_too_large_for_long_constant,
+                                        std::string(context->next_token.token)),
+            context->next_token.line);
     }
-    if (context->next_token->token_kind == TOKEN_KIND::constant && value <= 2147483647l) {
+    if (context->next_token.token_kind == TOKEN_KIND::constant && value <= 2147483647l) {
         return parse_int_constant(std::move(value));
     }
     return parse_long_constant(std::move(value));
@@ -172,17 +205,17 @@ static std::shared_ptr<CConst> parse_constant() {
 // (unsigned) const = ConstUInt(uint) | ConstULong(ulong) | ConstUChar(int)
 static std::shared_ptr<CConst> parse_unsigned_constant() {
     if (pop_next().token_kind == TOKEN_KIND::unsigned_long_constant) {
-        context->next_token->token.pop_back();
+        context->next_token.token.remove_suffix(1);
     }
-    context->next_token->token.pop_back();
+    context->next_token.token.remove_suffix(1);
 
-    uintmax_t value = string_to_uintmax(context->next_token->token, context->next_token->line);
+    uintmax_t value = string_to_uintmax(context->next_token.token, context->next_token.line);
     if (value > 18446744073709551615ull) {
         RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::number_too_large_for_unsigned_long_constant,
-                                        context->next_token->token),
-            context->next_token->line);
+                                        std::string(context->next_token.token)),
+            context->next_token.line);
     }
-    if (context->next_token->token_kind == TOKEN_KIND::unsigned_constant && value <= 4294967295ul) {
+    if (context->next_token.token_kind == TOKEN_KIND::unsigned_constant && value <= 4294967295ul) {
         return parse_uint_constant(std::move(value));
     }
     return parse_ulong_constant(std::move(value));
@@ -202,20 +235,20 @@ static TLong parse_array_size_t() {
             size = parse_unsigned_constant();
             break;
         default:
-            RAISE_RUNTIME_ERROR_AT_LINE(
-                GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::array_size_not_a_constant_integer, context->peek_token->token),
-                context->peek_token->line);
+            RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::array_size_not_a_constant_integer,
+                                            std::string(context->peek_token.token)),
+                context->peek_token.line);
     }
     expect_next_is(pop_next(), TOKEN_KIND::brackets_close);
     switch (size->type()) {
         case AST_T::CConstInt_t:
-            return static_cast<TLong>(static_cast<CConstInt*>(size.get())->value);
+            return static_cast<TLong>(ast_cast<CConstInt>(size.get())->value);
         case AST_T::CConstLong_t:
-            return static_cast<CConstLong*>(size.get())->value;
+            return ast_cast<CConstLong>(size.get())->value;
         case AST_T::CConstUInt_t:
-            return static_cast<TLong>(static_cast<CConstUInt*>(size.get())->value);
+            return static_cast<TLong>(ast_cast<CConstUInt>(size.get())->value);
         case AST_T::CConstULong_t:
-            return static_cast<TLong>(static_cast<CConstULong*>(size.get())->value);
+            return static_cast<TLong>(ast_cast<CConstULong>(size.get())->value);
         default:
             RAISE_INTERNAL_ERROR;
     }
@@ -232,9 +265,9 @@ static std::unique_ptr<CUnaryOp> parse_unary_op() {
         case TOKEN_KIND::unop_not:
             return std::make_unique<CNot>();
         default:
-            RAISE_RUNTIME_ERROR_AT_LINE(
-                GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::unexpected_unary_operator, context->next_token->token),
-                context->next_token->line);
+            RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::unexpected_unary_operator,
+                                            std::string(context->next_token.token)),
+                context->next_token.line);
     }
 }
 
@@ -292,9 +325,9 @@ static std::unique_ptr<CBinaryOp> parse_binary_op() {
         case TOKEN_KIND::binop_greaterthanorequal:
             return std::make_unique<CGreaterOrEqual>();
         default:
-            RAISE_RUNTIME_ERROR_AT_LINE(
-                GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::unexpected_binary_operator, context->next_token->token),
-                context->next_token->line);
+            RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::unexpected_binary_operator,
+                                            std::string(context->next_token.token)),
+                context->next_token.line);
     }
 }
 
@@ -324,11 +357,11 @@ static void parse_process_abstract_declarator(
     switch (node->type()) {
         case AST_T::CAbstractPointer_t:
             parse_process_pointer_abstract_declarator(
-                static_cast<CAbstractPointer*>(node), std::move(base_type), abstract_declarator);
+                ast_cast<CAbstractPointer>(node), std::move(base_type), abstract_declarator);
             break;
         case AST_T::CAbstractArray_t:
             parse_process_array_abstract_declarator(
-                static_cast<CAbstractArray*>(node), std::move(base_type), abstract_declarator);
+                ast_cast<CAbstractArray>(node), std::move(base_type), abstract_declarator);
             break;
         case AST_T::CAbstractBase_t:
             parse_process_base_abstract_declarator(std::move(base_type), abstract_declarator);
@@ -386,9 +419,9 @@ static std::unique_ptr<CAbstractDeclarator> parse_abstract_declarator() {
         case TOKEN_KIND::brackets_open:
             return parse_array_direct_abstract_declarator();
         default:
-            RAISE_RUNTIME_ERROR_AT_LINE(
-                GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::unexpected_abstract_declarator, context->peek_token->token),
-                context->peek_token->line);
+            RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::unexpected_abstract_declarator,
+                                            std::string(context->peek_token.token)),
+                context->peek_token.line);
     }
 }
 
@@ -434,33 +467,33 @@ static std::vector<std::unique_ptr<CExp>> parse_argument_list() {
 }
 
 static std::unique_ptr<CConstant> parse_constant_factor() {
-    size_t line = context->peek_token->line;
+    size_t line = context->peek_token.line;
     std::shared_ptr<CConst> constant = parse_constant();
     return std::make_unique<CConstant>(std::move(constant), std::move(line));
 }
 
 static std::unique_ptr<CConstant> parse_unsigned_constant_factor() {
-    size_t line = context->peek_token->line;
+    size_t line = context->peek_token.line;
     std::shared_ptr<CConst> constant = parse_unsigned_constant();
     return std::make_unique<CConstant>(std::move(constant), std::move(line));
 }
 
 static std::unique_ptr<CString> parse_string_literal_factor() {
-    size_t line = context->peek_token->line;
+    size_t line = context->peek_token.line;
     pop_next();
     std::shared_ptr<CStringLiteral> literal = parse_string_literal();
     return std::make_unique<CString>(std::move(literal), std::move(line));
 }
 
 static std::unique_ptr<CVar> parse_var_factor() {
-    size_t line = context->peek_token->line;
+    size_t line = context->peek_token.line;
     TIdentifier name;
     parse_identifier(name, 0);
     return std::make_unique<CVar>(std::move(name), std::move(line));
 }
 
 static std::unique_ptr<CFunctionCall> parse_function_call_factor() {
-    size_t line = context->peek_token->line;
+    size_t line = context->peek_token.line;
     TIdentifier name;
     parse_identifier(name, 0);
     pop_next();
@@ -480,7 +513,7 @@ static std::unique_ptr<CExp> parse_inner_exp_factor() {
 }
 
 static std::unique_ptr<CSubscript> parse_subscript_factor(std::unique_ptr<CExp> primary_exp) {
-    size_t line = context->peek_token->line;
+    size_t line = context->peek_token.line;
     pop_next();
     std::unique_ptr<CExp> subscript_exp = parse_exp(0);
     expect_next_is(pop_next(), TOKEN_KIND::brackets_close);
@@ -488,7 +521,7 @@ static std::unique_ptr<CSubscript> parse_subscript_factor(std::unique_ptr<CExp>
 }
 
 static std::unique_ptr<CDot> parse_dot_factor(std::unique_ptr<CExp> structure) {
-    size_t line = context->peek_token->line;
+    size_t line = context->peek_token.line;
     pop_next();
     expect_next_is(peek_next(), TOKEN_KIND::identifier);
     TIdentifier member;
@@ -497,7 +530,7 @@ static std::unique_ptr<CDot> parse_dot_factor(std::unique_ptr<CExp> structure) {
 }
 
 static std::unique_ptr<CArrow> parse_arrow_factor(std::unique_ptr<CExp> pointer) {
-    size_t line = context->peek_token->line;
+    size_t line = context->peek_token.line;
     pop_next();
     expect_next_is(peek_next(), TOKEN_KIND::identifier);
     TIdentifier member;
@@ -506,20 +539,20 @@ static std::unique_ptr<CArrow> parse_arrow_factor(std::unique_ptr<CExp> pointer)
 }
 
 static std::unique_ptr<CUnary> parse_unary_factor() {
-    size_t line = context->peek_token->line;
+    size_t line = context->peek_token.line;
     std::unique_ptr<CUnaryOp> unary_op = parse_unary_op();
     std::unique_ptr<CExp> exp = parse_cast_exp_factor();
     return std::make_unique<CUnary>(std::move(unary_op), std::move(exp), std::move(line));
 }
 
 static std::unique_ptr<CDereference> parse_dereference_factor() {
-    size_t line = context->next_token->line;
+    size_t line = context->next_token.line;
     std::unique_ptr<CExp> exp = parse_cast_exp_factor();
     return std::make_unique<CDereference>(std::move(exp), std::move(line));
 }
 
 static std::unique_ptr<CAddrOf> parse_addrof_factor() {
-    size_t line = context->next_token->line;
+    size_t line = context->next_token.line;
     std::unique_ptr<CExp> exp = parse_cast_exp_factor();
     return std::make_unique<CAddrOf>(std::move(exp), std::move(line));
 }
@@ -531,14 +564,14 @@ static std::unique_ptr<CExp> parse_pointer_unary_factor() {
         case TOKEN_KIND::binop_bitand:
             return parse_addrof_factor();
         default:
-            RAISE_RUNTIME_ERROR_AT_LINE(
-                GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::unexpected_pointer_unary_factor, context->next_token->token),
-                context->next_token->line);
+            RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::unexpected_pointer_unary_factor,
+                                            std::string(context->next_token.token)),
+                context->next_token.line);
     }
 }
 
 static std::unique_ptr<CSizeOfT> parse_sizeoft_factor() {
-    size_t line = context->peek_token->line;
+    size_t line = context->peek_token.line;
     pop_next();
     std::shared_ptr<Type> target_type = parse_type_name();
     expect_next_is(pop_next(), TOKEN_KIND::parenthesis_close);
@@ -546,7 +579,7 @@ static std::unique_ptr<CSizeOfT> parse_sizeoft_factor() {
 }
 
 static std::unique_ptr<CSizeOf> parse_sizeof_factor() {
-    size_t line = context->peek_token->line;
+    size_t line = context->peek_token.line;
     std::unique_ptr<CExp> exp = parse_unary_exp_factor();
     return std::make_unique<CSizeOf>(std::move(exp), std::move(line));
 }
@@ -572,7 +605,7 @@ static std::unique_ptr<CExp> parse_sizeof_unary_factor() {
 }
 
 static std::unique_ptr<CCast> parse_cast_factor() {
-    size_t line = context->peek_token->line;
+    size_t line = context->peek_token.line;
     pop_next();
     std::shared_ptr<Type> target_type = parse_type_name();
     expect_next_is(pop_next(), TOKEN_KIND::parenthesis_close);
@@ -603,8 +636,8 @@ static std::unique_ptr<CExp> parse_primary_exp_factor() {
             return parse_inner_exp_factor();
         default:
             RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::unexpected_primary_expression_factor,
-                                            context->peek_token->token),
-                context->peek_token->line);
+                                            std::string(context->peek_token.token)),
+                context->peek_token.line);
     }
 }
 
@@ -681,14 +714,14 @@ static std::unique_ptr<CExp> parse_cast_exp_factor() {
 }
 
 static std::unique_ptr<CAssignment> parse_assigment_exp(std::unique_ptr<CExp> exp_left, int32_t precedence) {
-    size_t line = context->peek_token->line;
+    size_t line = context->peek_token.line;
     pop_next();
     std::unique_ptr<CExp> exp_right = parse_exp(precedence);
     return std::make_unique<CAssignment>(std::move(exp_left), std::move(exp_right), std::move(line));
 }
 
 static std::unique_ptr<CAssignment> parse_assigment_compound_exp(std::unique_ptr<CExp> exp_left, int32_t precedence) {
-    size_t line = context->peek_token->line;
+    size_t line = context->peek_token.line;
     std::unique_ptr<CExp> exp_left_1;
     std::unique_ptr<CExp> exp_right_1;
     {
@@ -700,14 +733,14 @@ static std::unique_ptr<CAssignment> parse_assigment_compound_exp(std::unique_ptr
 }
 
 static std::unique_ptr<CBinary> parse_binary_exp(std::unique_ptr<CExp> exp_left, int32_t precedence) {
-    size_t line = context->peek_token->line;
+    size_t line = context->peek_token.line;
     std::unique_ptr<CBinaryOp> binary_op = parse_binary_op();
     std::unique_ptr<CExp> exp_right = parse_exp(precedence + 1);
     return std::make_unique<CBinary>(std::move(binary_op), std::move(exp_left), std::move(exp_right), std::move(line));
 }
 
 static std::unique_ptr<CConditional> parse_ternary_exp(std::unique_ptr<CExp> exp_left, int32_t precedence) {
-    size_t line = context->peek_token->line;
+    size_t line = context->peek_token.line;
     pop_next();
     std::unique_ptr<CExp> exp_middle = parse_exp(0);
     expect_next_is(pop_next(), TOKEN_KIND::ternary_else);
@@ -778,7 +811,7 @@ static std::unique_ptr<CExp> parse_exp(int32_t min_precedence) {
         if (precedence < min_precedence) {
             break;
         }
-        switch (context->peek_token->token_kind) {
+        switch (context->peek_token.token_kind) {
             case TOKEN_KIND::binop_addition:
             case TOKEN_KIND::unop_negation:
             case TOKEN_KIND::binop_multiplication:
@@ -818,9 +851,9 @@ static std::unique_ptr<CExp> parse_exp(int32_t min_precedence) {
                 exp_left = parse_ternary_exp(std::move(exp_left), precedence);
                 break;
             default:
-                RAISE_RUNTIME_ERROR_AT_LINE(
-                    GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::unexpected_expression, context->peek_token->token),
-                    context->peek_token->line);
+                RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::unexpected_expression,
+                                                std::string(context->peek_token.token)),
+                    context->peek_token.line);
         }
     }
     return exp_left;
@@ -831,7 +864,7 @@ static std::unique_ptr<CBlock> parse_block();
 static std::unique_ptr<CStatement> parse_statement();
 
 static std::unique_ptr<CReturn> parse_return_statement() {
-    size_t line = context->peek_token->line;
+    size_t line = context->peek_token.line;
     pop_next();
     std::unique_ptr<CExp> exp;
     if (peek_next().token_kind != TOKEN_KIND::semicolon) {
@@ -873,7 +906,7 @@ static std::unique_ptr<CGoto> parse_goto_statement() {
 }
 
 static std::unique_ptr<CLabel> parse_label_statement() {
-    size_t line = context->peek_token->line;
+    size_t line = context->peek_token.line;
     TIdentifier target;
     parse_identifier(target, 0);
     pop_next();
@@ -929,14 +962,14 @@ static std::unique_ptr<CFor> parse_for_statement() {
 }
 
 static std::unique_ptr<CBreak> parse_break_statement() {
-    size_t line = context->peek_token->line;
+    size_t line = context->peek_token.line;
     pop_next();
     expect_next_is(pop_next(), TOKEN_KIND::semicolon);
     return std::make_unique<CBreak>(std::move(line));
 }
 
 static std::unique_ptr<CContinue> parse_continue_statement() {
-    size_t line = context->peek_token->line;
+    size_t line = context->peek_token.line;
     pop_next();
     expect_next_is(pop_next(), TOKEN_KIND::semicolon);
     return std::make_unique<CContinue>(std::move(line));
@@ -956,7 +989,7 @@ static std::unique_ptr<CNull> parse_null_statement() {
 //           | DoWhile(statement, exp, identifier) | For(for_init, exp?, exp?, statement, identifier)
 //           | Break(identifier) | Continue(identifier) | Null
 static std::unique_ptr<CStatement> parse_statement() {
-    switch (context->peek_token->token_kind) {
+    switch (context->peek_token.token_kind) {
         case TOKEN_KIND::key_return:
             return parse_return_statement();
         case TOKEN_KIND::key_if:
@@ -998,8 +1031,9 @@ static std::unique_ptr<CInitDecl> parse_decl_for_init() {
     std::unique_ptr<CStorageClass> storage_class = parse_declarator_declaration(declarator);
     if (declarator.derived_type->type() == AST_T::FunType_t) {
         RAISE_RUNTIME_ERROR_AT_LINE(
-            GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::function_declared_in_for_initial, declarator.name),
-            context->next_token->line);
+            GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::function_declared_in_for_initial,
+                get_identifier_name(declarator.name)),
+            context->next_token.line);
     }
     std::unique_ptr<CVariableDeclaration> init =
         parse_variable_declaration(std::move(storage_class), std::move(declarator));
@@ -1050,7 +1084,7 @@ static std::unique_ptr<CD> parse_d_block_item() {
 // <block-item> ::= <statement> | <declaration>
 // block_item = S(statement) | D(declaration)
 static std::unique_ptr<CBlockItem> parse_block_item() {
-    switch (context->peek_token->token_kind) {
+    switch (context->peek_token.token_kind) {
         case TOKEN_KIND::key_char:
         case TOKEN_KIND::key_int:
         case TOKEN_KIND::key_long:
@@ -1128,8 +1162,8 @@ static std::shared_ptr<Type> parse_type_specifier() {
                 break;
             }
             default:
-                RAISE_RUNTIME_ERROR_AT_LINE(
-                    GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::unexpected_type_specifier, peek_next_i(specifier).token),
+                RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::unexpected_type_specifier,
+                                                std::string(peek_next_i(specifier).token)),
                     peek_next_i(specifier).line);
         }
     }
@@ -1238,9 +1272,9 @@ static std::unique_ptr<CStorageClass> parse_storage_class() {
         case TOKEN_KIND::key_extern:
             return std::make_unique<CExtern>();
         default:
-            RAISE_RUNTIME_ERROR_AT_LINE(
-                GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::unexpected_storage_class, context->next_token->token),
-                context->next_token->line);
+            RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::unexpected_storage_class,
+                                            std::string(context->next_token.token)),
+                context->next_token.line);
     }
 }
 
@@ -1267,7 +1301,7 @@ static std::unique_ptr<CCompoundInit> parse_compound_initializer() {
     }
     if (initializers.empty()) {
         RAISE_RUNTIME_ERROR_AT_LINE(
-            GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::empty_compound_initializer), context->peek_token->line);
+            GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::empty_compound_initializer), context->peek_token.line);
     }
     pop_next();
     return std::make_unique<CCompoundInit>(std::move(initializers));
@@ -1309,7 +1343,7 @@ static void parse_process_fun_declarator(
     CFunDeclarator* node, std::shared_ptr<Type> base_type, Declarator& declarator) {
     if (node->declarator->type() != AST_T::CIdent_t) {
         RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::type_derivation_on_function_declaration),
-            context->next_token->line);
+            context->next_token.line);
     }
 
     std::vector<TIdentifier> params;
@@ -1325,7 +1359,7 @@ static void parse_process_fun_declarator(
         params.push_back(std::move(param_declarator.name));
         param_types.push_back(std::move(param_declarator.derived_type));
     }
-    TIdentifier name = static_cast<CIdent*>(node->declarator.get())->name;
+    TIdentifier name = ast_cast<CIdent>(node->declarator.get())->name;
     std::shared_ptr<Type> derived_type = std::make_shared<FunType>(std::move(param_types), std::move(base_type));
     declarator.name = std::move(name);
     declarator.derived_type = std::move(derived_type);
@@ -1335,16 +1369,16 @@ static void parse_process_fun_declarator(
 static void parse_process_declarator(CDeclarator* node, std::shared_ptr<Type> base_type, Declarator& declarator) {
     switch (node->type()) {
         case AST_T::CIdent_t:
-            parse_process_ident_declarator(static_cast<CIdent*>(node), std::move(base_type), declarator);
+            parse_process_ident_declarator(ast_cast<CIdent>(node), std::move(base_type), declarator);
             break;
         case AST_T::CPointerDeclarator_t:
-            parse_process_pointer_declarator(static_cast<CPointerDeclarator*>(node), std::move(base_type), declarator);
+            parse_process_pointer_declarator(ast_cast<CPointerDeclarator>(node), std::move(base_type), declarator);
             break;
         case AST_T::CArrayDeclarator_t:
-            parse_process_array_declarator(static_cast<CArrayDeclarator*>(node), std::move(base_type), declarator);
+            parse_process_array_declarator(ast_cast<CArrayDeclarator>(node), std::move(base_type), declarator);
             break;
         case AST_T::CFunDeclarator_t:
-            parse_process_fun_declarator(static_cast<CFunDeclarator*>(node), std::move(base_type), declarator);
+            parse_process_fun_declarator(ast_cast<CFunDeclarator>(node), std::move(base_type), declarator);
             break;
         default:
             RAISE_INTERNAL_ERROR;
@@ -1372,9 +1406,9 @@ static std::unique_ptr<CDeclarator> parse_simple_declarator() {
         case TOKEN_KIND::parenthesis_open:
             return parse_declarator_simple_declarator();
         default:
-            RAISE_RUNTIME_ERROR_AT_LINE(
-                GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::unexpected_simple_declarator, context->peek_token->token),
-                context->peek_token->line);
+            RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::unexpected_simple_declarator,
+                                            std::string(context->peek_token.token)),
+                context->peek_token.line);
     }
 }
 
@@ -1427,9 +1461,9 @@ static std::vector<std::unique_ptr<CParam>> parse_param_list() {
             break;
         }
         default:
-            RAISE_RUNTIME_ERROR_AT_LINE(
-                GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::unexpected_parameter_list, context->peek_token->token),
-                context->peek_token->line);
+            RAISE_RUNTIME_ERROR_AT_LINE(GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::unexpected_parameter_list,
+                                            std::string(context->peek_token.token)),
+                context->peek_token.line);
     }
     expect_next_is(pop_next(), TOKEN_KIND::parenthesis_close);
     return param_list;
@@ -1488,7 +1522,7 @@ static std::unique_ptr<CDeclarator> parse_declarator() {
 // function_declaration = FunctionDeclaration(identifier, identifier*, block?, type, storage_class?)
 static std::unique_ptr<CFunctionDeclaration> parse_function_declaration(
     std::unique_ptr<CStorageClass> storage_class, Declarator&& declarator) {
-    size_t line = context->next_token->line;
+    size_t line = context->next_token.line;
     std::unique_ptr<CBlock> body;
     if (peek_next().token_kind == TOKEN_KIND::semicolon) {
         pop_next();
@@ -1505,7 +1539,7 @@ static std::unique_ptr<CFunctionDeclaration> parse_function_declaration(
 // variable_declaration = VariableDeclaration(identifier, initializer?, type, storage_class?)
 static std::unique_ptr<CVariableDeclaration> parse_variable_declaration(
     std::unique_ptr<CStorageClass> storage_class, Declarator&& declarator) {
-    size_t line = context->next_token->line;
+    size_t line = context->next_token.line;
     std::unique_ptr<CInitializer> init;
     if (peek_next().token_kind == TOKEN_KIND::assignment_simple) {
         pop_next();
@@ -1524,17 +1558,17 @@ static std::unique_ptr<CMemberDeclaration> parse_member_declaration() {
         std::unique_ptr<CStorageClass> storage_class = parse_declarator_declaration(declarator);
         if (storage_class) {
             RAISE_RUNTIME_ERROR_AT_LINE(
-                GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::member_declared_with_non_automatic_storage, declarator.name,
-                    get_storage_class_hr(storage_class.get())),
-                context->next_token->line);
+                GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::member_declared_with_non_automatic_storage,
+                    get_identifier_name(declarator.name), get_storage_class_hr(storage_class.get())),
+                context->next_token.line);
         }
     }
     if (declarator.derived_type->type() == AST_T::FunType_t) {
         RAISE_RUNTIME_ERROR_AT_LINE(
-            GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::member_declared_as_function, declarator.name),
-            context->next_token->line);
+            GET_ERROR_MESSAGE(ERROR_MESSAGE_PARSER::member_declared_as_function, get_identifier_name(declarator.name)),
+            context->next_token.line);
     }
-    size_t line = context->next_token->line;
+    size_t line = context->next_token.line;
     expect_next_is(pop_next(), TOKEN_KIND::semicolon);
     return std::make_unique<CMemberDeclaration>(
         std::move(declarator.name), std::move(declarator.derived_type), std::move(line));
@@ -1543,7 +1577,7 @@ static std::unique_ptr<CMemberDeclaration> parse_member_declaration() {
 // <struct-declaration> ::= "struct" <identifier> [ "{" { <member-declaration> }+ "}" ] ";"
 // struct_declaration = StructDeclaration(identifier, member_declaration*)
 static std::unique_ptr<CStructDeclaration> parse_structure_declaration() {
-    size_t line = context->peek_token->line;
+    size_t line = context->peek_token.line;
     pop_next();
     expect_next_is(peek_next(), TOKEN_KIND::identifier);
     TIdentifier tag;
@@ -1558,7 +1592,7 @@ static std::unique_ptr<CStructDeclaration> parse_structure_declaration() {
         pop_next();
         pop_next();
     }
-    expect_next_is(*context->next_token, TOKEN_KIND::semicolon);
+    expect_next_is(context->next_token, TOKEN_KIND::semicolon);
     return std::make_unique<CStructDeclaration>(std::move(tag), std::move(members), std::move(line));
 }
 
@@ -1623,7 +1657,7 @@ static std::unique_ptr<CDeclaration> parse_declaration() {
 // AST = Program(declaration*)
 static std::unique_ptr<CProgram> parse_program() {
     std::vector<std::unique_ptr<CDeclaration>> declarations;
-    while (context->pop_index < context->p_tokens->size()) {
+    while (is_next_i(0)) {
         std::unique_ptr<CDeclaration> declaration = parse_declaration();
         declarations.push_back(std::move(declaration));
     }
@@ -1632,10 +1666,10 @@ static std::unique_ptr<CProgram> parse_program() {
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-std::unique_ptr<CProgram> parsing(std::unique_ptr<std::vector<Token>> tokens) {
-    context = std::make_unique<ParserContext>(tokens.get());
+std::unique_ptr<CProgram> parsing(std::unique_ptr<Tokens> tokens) {
+    context = std::make_unique<ParserContext>(tokens.get(), nullptr);
     std::unique_ptr<CProgram> c_ast = parse_program();
-    if (context->pop_index != tokens->size()) {
+    if (context->pop_index != tokens->token_kinds.size()) {
         RAISE_INTERNAL_ERROR;
     }
     context.reset();
@@ -1646,3 +1680,25 @@ std::unique_ptr<CProgram> parsing(std::unique_ptr<std::vector<Token>> tokens) {
     }
     return c_ast;
 }
+
+// Errors join the lexer thread through the token ring, which is freed when parsing returns or unwinds
+struct TokenRingGuard {
+    ~TokenRingGuard() { errors->p_token_ring = nullptr; }
+};
+
+std::unique_ptr<CProgram> parsing(std::unique_ptr<TokenRing> token_ring) {
+    TokenRingGuard token_ring_guard;
+    context = std::make_unique<ParserContext>(nullptr, token_ring.get());
+    std::unique_ptr<CProgram> c_ast = parse_program();
+    join_lexing(*token_ring, false);
+    if (context->pop_index != token_ring->head.load()) {
+        RAISE_INTERNAL_ERROR;
+    }
+    context.reset();
+
+    token_ring.reset();
+    if (!c_ast) {
+        RAISE_INTERNAL_ERROR;
+    }
+    return c_ast;
+}
@@ -1,11 +1,13 @@
 #ifndef _FRONTEND_PARSER_TOKEN_HPP
 #define _FRONTEND_PARSER_TOKEN_HPP
 
+#include <inttypes.h>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // Lexer
 
-enum TOKEN_KIND {
+enum TOKEN_KIND : uint8_t {
     assignment_bitshiftleft,
     assignment_bitshiftright,
 
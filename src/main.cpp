@@ -23,6 +23,8 @@
 #include "frontend/intermediate/semantic.hpp"
 #include "frontend/intermediate/tac_repr.hpp"
 
+#include "optimization/optim_tac.hpp"
+
 #include "backend/assembly/asm_gen.hpp"
 
 #include "backend/emitter/gas_code.hpp"
@@ -42,8 +44,33 @@ static void verbose(const std::string& out, bool end) {
     }
 }
 
+static std::string get_optim_pass_name(OPTIM_PASS_KIND pass_kind) {
+    switch (pass_kind) {
+        case OPTIM_PASS_KIND::Ofold_constants:
+            return "Constant folding";
+        case OPTIM_PASS_KIND::Opropagate_copies:
+            return "Copy propagation";
+        case OPTIM_PASS_KIND::Oeliminate_unreachable_code:
+            return "Unreachable code elimination";
+        default:
+            RAISE_INTERNAL_ERROR;
+    }
+}
+
+static void verbose_optim_tac_stats(const OptimTacStats& stats) {
+    verbose("-- Fixed point ... " + std::to_string(stats.n_iterations) + " iterations in total", true);
+    for (size_t i = 0; i < OPTIM_PASS_SIZE; ++i) {
+        if (IS_OPTIM_PASS_ENABLED(context->optim_mask, i)) {
+            verbose("-- " + get_optim_pass_name(static_cast<OPTIM_PASS_KIND>(i)) + " ... "
+                        + std::to_string(stats.n_removed_instructions[i]) + " removed, "
+                        + std::to_string(stats.n_rewritten_instructions[i]) + " rewritten instructions",
+                true);
+        }
+    }
+}
+
 #ifndef __NDEBUG__
-static void debug_tokens(const std::vector<Token>& tokens) {
+static void debug_tokens(const Tokens& tokens) {
     if (context->is_verbose) {
         pretty_print_tokens(tokens);
     }
@@ -97,21 +124,36 @@ static void compile() {
 
     INIT_UTIL_CONTEXT;
 
+    INIT_IDENTIFIER_CONTEXT;
+
     INIT_ERRORS_CONTEXT;
 
-    verbose("-- Lexing ... ", false);
-    std::unique_ptr<std::vector<Token>> tokens = lexing(context->filename, std::move(context->includedirs));
-    verbose("OK", true);
-#ifndef __NDEBUG__
-    if (context->debug_code == 255) {
-        debug_tokens(*tokens);
-        return;
+    open_ast_arena();
+    std::unique_ptr<CProgram> c_ast;
+    if (context->is_pipeline && context->debug_code != 255) {
+        verbose("-- Lexing and parsing ... ", false);
+        c_ast = parsing(lexing_pipeline(context->filename, std::move(context->includedirs),
+            std::move(context->cachedir), context->is_regex_lexer, context->is_preprocessor));
+        verbose("OK", true);
+        verbose("-- Header search ... " + std::to_string(util->n_file_stats) + " file stats", true);
     }
+    else {
+        verbose("-- Lexing ... ", false);
+        std::unique_ptr<Tokens> tokens = lexing(context->filename, std::move(context->includedirs),
+            std::move(context->cachedir), context->is_regex_lexer, context->is_preprocessor);
+        verbose("OK", true);
+        verbose("-- Header search ... " + std::to_string(util->n_file_stats) + " file stats", true);
+#ifndef __NDEBUG__
+        if (context->debug_code == 255) {
+            debug_tokens(*tokens);
+            return;
+        }
 #endif
 
-    verbose("-- Parsing ... ", false);
-    std::unique_ptr<CProgram> c_ast = parsing(std::move(tokens));
-    verbose("OK", true);
+        verbose("-- Parsing ... ", false);
+        c_ast = parsing(std::move(tokens));
+        verbose("OK", true);
+    }
 #ifndef __NDEBUG__
     if (context->debug_code == 254) {
         debug_ast(c_ast.get(), "C AST");
@@ -136,9 +178,17 @@ static void compile() {
 
     FREE_ERRORS_CONTEXT;
 
+    open_ast_arena();
     verbose("-- TAC representation ... ", false);
     std::unique_ptr<TacProgram> tac_ast = three_address_code_representation(std::move(c_ast));
     verbose("OK", true);
+
+    if (context->optim_mask != 0) {
+        verbose("-- TAC optimization ... ", false);
+        OptimTacStats optim_stats = optimize_three_address_code(tac_ast.get(), context->optim_mask);
+        verbose("OK", true);
+        verbose_optim_tac_stats(optim_stats);
+    }
 #ifndef __NDEBUG__
     if (context->debug_code == 252) {
         debug_ast(tac_ast.get(), "TAC AST");
@@ -151,6 +201,7 @@ static void compile() {
 
     INIT_BACK_END_CONTEXT;
 
+    open_ast_arena();
     verbose("-- Assembly generation ... ", false);
     std::unique_ptr<AsmProgram> asm_ast = assembly_generation(std::move(tac_ast));
     verbose("OK", true);
@@ -167,6 +218,7 @@ static void compile() {
 
     FREE_FRONT_END_CONTEXT;
 
+    close_ast_arena();
     verbose("-- Code emission ... ", false);
     context->filename += ".s";
     gas_code_emission(std::move(asm_ast), std::move(context->filename));
@@ -180,6 +232,8 @@ static void compile() {
 
     FREE_BACK_END_CONTEXT;
 
+    FREE_IDENTIFIER_CONTEXT;
+
     FREE_UTIL_CONTEXT;
 }
 
@@ -212,7 +266,48 @@ static void arg_parse() {
         }
     }
 
-    context->optim_mask = 0; // TODO
+    shift_args(arg);
+    if (arg.empty()) {
+        raise_argument_error(GET_ERROR_MESSAGE(ERROR_MESSAGE_ARGUMENT::no_lexer_code_in_argument));
+    }
+    {
+        std::vector<char> buffer(arg.begin(), arg.end());
+        buffer.push_back('\0');
+        char* end_ptr = nullptr;
+        errno = 0;
+        int lexer_code = static_cast<int>(strtol(&buffer[0], &end_ptr, 10));
+
+        if (end_ptr == &buffer[0] || lexer_code < 0 || lexer_code > 15) {
+            raise_argument_error(GET_ERROR_MESSAGE(ERROR_MESSAGE_ARGUMENT::invalid_lexer_code_in_argument, arg));
+        }
+        context->is_regex_lexer = (lexer_code & 1) != 0;
+        context->is_preprocessor = (lexer_code & 4) != 0;
+        context->is_pipeline = (lexer_code & 8) != 0;
+
+        if ((lexer_code & 2) != 0) {
+            shift_args(arg);
+            if (arg.empty()) {
+                raise_argument_error(GET_ERROR_MESSAGE(ERROR_MESSAGE_ARGUMENT::no_cache_directory_in_argument));
+            }
+            context->cachedir = arg;
+        }
+    }
+
+    shift_args(arg);
+    if (arg.empty()) {
+        raise_argument_error(GET_ERROR_MESSAGE(ERROR_MESSAGE_ARGUMENT::no_optim_code_in_argument));
+    }
+    {
+        std::vector<char> buffer(arg.begin(), arg.end());
+        buffer.push_back('\0');
+        char* end_ptr = nullptr;
+        errno = 0;
+        context->optim_mask = static_cast<int>(strtol(&buffer[0], &end_ptr, 10));
+
+        if (end_ptr == &buffer[0] || context->optim_mask < 0 || context->optim_mask > OPTIM_MASK_ALL) {
+            raise_argument_error(GET_ERROR_MESSAGE(ERROR_MESSAGE_ARGUMENT::invalid_optim_code_in_argument, arg));
+        }
+    }
 
     shift_args(arg);
     if (arg.empty()) {
@@ -0,0 +1,245 @@
+#include <algorithm>
+#include <deque>
+#include <inttypes.h>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "util/throw.hpp"
+
+#include "ast/ast.hpp"
+#include "ast/interm_ast.hpp"
+
+#include "optimization/cfg.hpp"
+
+ControlFlowBlock::ControlFlowBlock(size_t instructions_front_index) :
+    instructions_front_index(instructions_front_index), instructions_back_index(instructions_front_index) {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Control flow graph
+
+static std::vector<size_t>& get_successor_ids(ControlFlowGraph& cfg, size_t block_id) {
+    return block_id == cfg.entry_id ? cfg.entry_successor_ids : cfg.blocks[block_id].successor_ids;
+}
+
+static std::vector<size_t>& get_predecessor_ids(ControlFlowGraph& cfg, size_t block_id) {
+    return block_id == cfg.exit_id ? cfg.exit_predecessor_ids : cfg.blocks[block_id].predecessor_ids;
+}
+
+static void add_control_flow_edge(ControlFlowGraph& cfg, size_t predecessor_id, size_t successor_id) {
+    std::vector<size_t>& successor_ids = get_successor_ids(cfg, predecessor_id);
+    if (std::find(successor_ids.begin(), successor_ids.end(), successor_id) == successor_ids.end()) {
+        successor_ids.push_back(successor_id);
+        get_predecessor_ids(cfg, successor_id).push_back(predecessor_id);
+    }
+}
+
+static size_t get_label_block_id(ControlFlowGraph& cfg, TIdentifier target) {
+    auto label_id_it = cfg.label_id_map.find(target);
+    if (label_id_it == cfg.label_id_map.end()) {
+        RAISE_INTERNAL_ERROR;
+    }
+    return label_id_it->second;
+}
+
+static void build_control_flow_blocks(
+    ControlFlowGraph& cfg, const std::vector<std::unique_ptr<TacInstruction>>& instructions) {
+    bool is_block_open = false;
+    for (size_t i = 0; i < instructions.size(); ++i) {
+        TacInstruction* node = instructions[i].get();
+        if (!node) {
+            continue;
+        }
+        switch (node->type()) {
+            case AST_T::TacLabel_t:
+                cfg.blocks.emplace_back(i);
+                cfg.label_id_map[ast_cast<TacLabel>(node)->name] = cfg.blocks.size() - 1;
+                is_block_open = true;
+                break;
+            case AST_T::TacReturn_t:
+            case AST_T::TacJump_t:
+            case AST_T::TacJumpIfZero_t:
+            case AST_T::TacJumpIfNotZero_t:
+                if (!is_block_open) {
+                    cfg.blocks.emplace_back(i);
+                }
+                is_block_open = false;
+                break;
+            default:
+                if (!is_block_open) {
+                    cfg.blocks.emplace_back(i);
+                    is_block_open = true;
+                }
+                break;
+        }
+        cfg.blocks.back().instructions_back_index = i;
+    }
+}
+
+static void build_control_flow_edges(
+    ControlFlowGraph& cfg, const std::vector<std::unique_ptr<TacInstruction>>& instructions) {
+    if (cfg.blocks.empty()) {
+        add_control_flow_edge(cfg, cfg.entry_id, cfg.exit_id);
+        return;
+    }
+    add_control_flow_edge(cfg, cfg.entry_id, 0);
+    for (size_t block_id = 0; block_id < cfg.blocks.size(); ++block_id) {
+        size_t next_block_id = block_id + 1 < cfg.blocks.size() ? block_id + 1 : cfg.exit_id;
+        TacInstruction* node = instructions[cfg.blocks[block_id].instructions_back_index].get();
+        switch (node->type()) {
+            case AST_T::TacReturn_t:
+                add_control_flow_edge(cfg, block_id, cfg.exit_id);
+                break;
+            case AST_T::TacJump_t:
+                add_control_flow_edge(cfg, block_id, get_label_block_id(cfg, ast_cast<TacJump>(node)->target));
+                break;
+            case AST_T::TacJumpIfZero_t:
+                add_control_flow_edge(cfg, block_id, next_block_id);
+                add_control_flow_edge(cfg, block_id, get_label_block_id(cfg, ast_cast<TacJumpIfZero>(node)->target));
+                break;
+            case AST_T::TacJumpIfNotZero_t:
+                add_control_flow_edge(cfg, block_id, next_block_id);
+                add_control_flow_edge(
+                    cfg, block_id, get_label_block_id(cfg, ast_cast<TacJumpIfNotZero>(node)->target));
+                break;
+            default:
+                add_control_flow_edge(cfg, block_id, next_block_id);
+                break;
+        }
+    }
+}
+
+// Blocks end after a jump or a return and start at a label, so that the graph is built in two linear scans
+void build_control_flow_graph(ControlFlowGraph& cfg, const std::vector<std::unique_ptr<TacInstruction>>& instructions) {
+    cfg.blocks.clear();
+    cfg.entry_successor_ids.clear();
+    cfg.exit_predecessor_ids.clear();
+    cfg.label_id_map.clear();
+
+    build_control_flow_blocks(cfg, instructions);
+    cfg.entry_id = cfg.blocks.size();
+    cfg.exit_id = cfg.blocks.size() + 1;
+    build_control_flow_edges(cfg, instructions);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Data flow analysis
+
+void init_data_flow_analysis(DataFlowAnalysis& dfa, const ControlFlowGraph& cfg, size_t n_facts) {
+    dfa.n_facts = n_facts;
+    dfa.n_words = (n_facts + 63) / 64;
+    size_t n_set_words = cfg.blocks.size() * dfa.n_words;
+    dfa.gen_sets.assign(n_set_words, 0);
+    dfa.kill_sets.assign(n_set_words, 0);
+    dfa.in_sets.assign(n_set_words, 0);
+    dfa.out_sets.assign(n_set_words, 0);
+    dfa.boundary_set.assign(dfa.n_words, 0);
+}
+
+// Blocks are visited in reverse postorder for forward analyses and in postorder for backward analyses, blocks that are
+// not reachable from the entry are left out
+static void set_data_flow_block_order(DataFlowAnalysis& dfa, const ControlFlowGraph& cfg, bool is_forward) {
+    dfa.block_order.clear();
+    dfa.block_order.reserve(cfg.blocks.size());
+    std::vector<bool> is_visited(cfg.blocks.size(), false);
+    std::vector<std::pair<size_t, size_t>> dfs_stack;
+    for (size_t entry_successor_id : cfg.entry_successor_ids) {
+        if (entry_successor_id < cfg.blocks.size() && !is_visited[entry_successor_id]) {
+            is_visited[entry_successor_id] = true;
+            dfs_stack.emplace_back(entry_successor_id, 0);
+        }
+        while (!dfs_stack.empty()) {
+            size_t block_id = dfs_stack.back().first;
+            size_t i = dfs_stack.back().second;
+            const std::vector<size_t>& successor_ids = cfg.blocks[block_id].successor_ids;
+            if (i < successor_ids.size()) {
+                dfs_stack.back().second++;
+                size_t successor_id = successor_ids[i];
+                if (successor_id < cfg.blocks.size() && !is_visited[successor_id]) {
+                    is_visited[successor_id] = true;
+                    dfs_stack.emplace_back(successor_id, 0);
+                }
+            }
+            else {
+                dfa.block_order.push_back(block_id);
+                dfs_stack.pop_back();
+            }
+        }
+    }
+    if (is_forward) {
+        std::reverse(dfa.block_order.begin(), dfa.block_order.end());
+    }
+}
+
+static void meet_data_flow_sets(DataFlowAnalysis& dfa, const ControlFlowGraph& cfg,
+    const std::vector<uint64_t>& flow_out_sets, std::vector<uint64_t>& flow_in_sets, size_t block_id,
+    const std::vector<size_t>& flow_ids, bool is_must) {
+    size_t row = block_id * dfa.n_words;
+    std::fill(flow_in_sets.begin() + row, flow_in_sets.begin() + row + dfa.n_words, is_must ? ~uint64_t(0) : 0);
+    for (size_t flow_id : flow_ids) {
+        const uint64_t* flow_out_set = flow_id < cfg.blocks.size() ? &flow_out_sets[flow_id * dfa.n_words]
+                                                                   : &dfa.boundary_set[0];
+        if (is_must) {
+            for (size_t i = 0; i < dfa.n_words; ++i) {
+                flow_in_sets[row + i] &= flow_out_set[i];
+            }
+        }
+        else {
+            for (size_t i = 0; i < dfa.n_words; ++i) {
+                flow_in_sets[row + i] |= flow_out_set[i];
+            }
+        }
+    }
+}
+
+static bool transfer_data_flow_sets(DataFlowAnalysis& dfa, const std::vector<uint64_t>& flow_in_sets,
+    std::vector<uint64_t>& flow_out_sets, size_t block_id) {
+    bool is_changed = false;
+    size_t row = block_id * dfa.n_words;
+    for (size_t i = row; i < row + dfa.n_words; ++i) {
+        uint64_t word = dfa.gen_sets[i] | (flow_in_sets[i] & ~dfa.kill_sets[i]);
+        if (word != flow_out_sets[i]) {
+            flow_out_sets[i] = word;
+            is_changed = true;
+        }
+    }
+    return is_changed;
+}
+
+// Iterates a worklist to the fixed point, where may analyses meet with union and must analyses with intersection. The
+// sets flowing out of blocks start empty for may analyses and full for must analyses
+void solve_data_flow_analysis(DataFlowAnalysis& dfa, const ControlFlowGraph& cfg, DATA_FLOW_KIND data_flow_kind) {
+    bool is_forward = data_flow_kind == DATA_FLOW_KIND::Dforward_may || data_flow_kind == DATA_FLOW_KIND::Dforward_must;
+    bool is_must = data_flow_kind == DATA_FLOW_KIND::Dforward_must || data_flow_kind == DATA_FLOW_KIND::Dbackward_must;
+    std::vector<uint64_t>& flow_in_sets = is_forward ? dfa.in_sets : dfa.out_sets;
+    std::vector<uint64_t>& flow_out_sets = is_forward ? dfa.out_sets : dfa.in_sets;
+    std::fill(flow_out_sets.begin(), flow_out_sets.end(), is_must ? ~uint64_t(0) : 0);
+
+    set_data_flow_block_order(dfa, cfg, is_forward);
+    std::deque<size_t> worklist(dfa.block_order.begin(), dfa.block_order.end());
+    std::vector<bool> is_in_worklist(cfg.blocks.size(), false);
+    for (size_t block_id : dfa.block_order) {
+        is_in_worklist[block_id] = true;
+    }
+
+    while (!worklist.empty()) {
+        size_t block_id = worklist.front();
+        worklist.pop_front();
+        is_in_worklist[block_id] = false;
+
+        const ControlFlowBlock& block = cfg.blocks[block_id];
+        meet_data_flow_sets(dfa, cfg, flow_out_sets, flow_in_sets, block_id,
+            is_forward ? block.predecessor_ids : block.successor_ids, is_must);
+        if (transfer_data_flow_sets(dfa, flow_in_sets, flow_out_sets, block_id)) {
+            for (size_t flow_id : is_forward ? block.successor_ids : block.predecessor_ids) {
+                if (flow_id < cfg.blocks.size() && !is_in_worklist[flow_id]) {
+                    is_in_worklist[flow_id] = true;
+                    worklist.push_back(flow_id);
+                }
+            }
+        }
+    }
+}
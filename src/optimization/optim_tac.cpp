@@ -0,0 +1,1159 @@
+#include <algorithm>
+#include <cmath>
+#include <inttypes.h>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#include "util/str2t.hpp"
+#include "util/throw.hpp"
+
+#include "ast/ast.hpp"
+#include "ast/front_symt.hpp"
+#include "ast/interm_ast.hpp"
+
+#include "optimization/cfg.hpp"
+#include "optimization/optim_tac.hpp"
+
+static std::unique_ptr<OptimTacContext> context;
+
+OptimTacStats::OptimTacStats() : n_iterations(0), n_removed_instructions({}), n_rewritten_instructions({}) {}
+
+OptimTacContext::OptimTacContext(int optim_mask) :
+    optim_mask(optim_mask), is_fixed_point(true), pass_kind(OPTIM_PASS_KIND::Ofold_constants),
+    p_instructions(nullptr), p_temp_types(nullptr), position(0), aliased_write_position(0) {}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Constant folding
+
+// Instructions are replaced in place and removed by leaving an empty slot
+static void set_instruction(std::unique_ptr<TacInstruction>&& instruction, size_t instruction_index) {
+    if (instruction) {
+        context->stats.n_rewritten_instructions[context->pass_kind]++;
+    }
+    else {
+        context->stats.n_removed_instructions[context->pass_kind]++;
+    }
+    (*context->p_instructions)[instruction_index] = std::move(instruction);
+    context->is_fixed_point = false;
+}
+
+static Type* get_value_type(TacValue* node) {
+    TIdentifier name = ast_cast<TacVariable>(node)->name;
+    if (IS_TEMP_IDENTIFIER(name)) {
+        return (*context->p_temp_types)[GET_TEMP_IDENTIFIER_INDEX(name)].get();
+    }
+    return frontend->symbol_table[name]->type_t.get();
+}
+
+static bool is_constant_signed(CConst* node) {
+    switch (node->type()) {
+        case AST_T::CConstChar_t:
+        case AST_T::CConstInt_t:
+        case AST_T::CConstLong_t:
+        case AST_T::CConstDouble_t:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static TULong get_constant_bit_size(CConst* node) {
+    switch (node->type()) {
+        case AST_T::CConstChar_t:
+        case AST_T::CConstUChar_t:
+            return 8ul;
+        case AST_T::CConstInt_t:
+        case AST_T::CConstUInt_t:
+            return 32ul;
+        case AST_T::CConstLong_t:
+        case AST_T::CConstULong_t:
+            return 64ul;
+        default:
+            RAISE_INTERNAL_ERROR;
+    }
+}
+
+// Integer constants are widened to 64 bits by their signedness, so that their low bits give the value of any type
+static TULong get_constant_integer_value(CConst* node) {
+    switch (node->type()) {
+        case AST_T::CConstChar_t:
+            return static_cast<TULong>(static_cast<TLong>(ast_cast<CConstChar>(node)->value));
+        case AST_T::CConstInt_t:
+            return static_cast<TULong>(static_cast<TLong>(ast_cast<CConstInt>(node)->value));
+        case AST_T::CConstLong_t:
+            return static_cast<TULong>(ast_cast<CConstLong>(node)->value);
+        case AST_T::CConstUChar_t:
+            return static_cast<TULong>(ast_cast<CConstUChar>(node)->value);
+        case AST_T::CConstUInt_t:
+            return static_cast<TULong>(ast_cast<CConstUInt>(node)->value);
+        case AST_T::CConstULong_t:
+            return ast_cast<CConstULong>(node)->value;
+        default:
+            RAISE_INTERNAL_ERROR;
+    }
+}
+
+static bool is_constant_integer_value(CConst* node, TULong value) {
+    return node->type() != AST_T::CConstDouble_t && get_constant_integer_value(node) == value;
+}
+
+static bool is_constant_zero(CConst* node) {
+    if (node->type() == AST_T::CConstDouble_t) {
+        return ast_cast<CConstDouble>(node)->value == 0.0;
+    }
+    return get_constant_integer_value(node) == 0ul;
+}
+
+// Returns null when the value can not be held by a constant of the type
+static std::shared_ptr<CConst> fold_integer_constant(Type* type, TULong value) {
+    switch (type->type()) {
+        case AST_T::Char_t:
+        case AST_T::SChar_t:
+            return std::make_shared<CConstChar>(static_cast<TChar>(value));
+        case AST_T::Int_t:
+            return std::make_shared<CConstInt>(static_cast<TInt>(value));
+        case AST_T::Long_t:
+            return std::make_shared<CConstLong>(static_cast<TLong>(value));
+        case AST_T::UChar_t:
+            return std::make_shared<CConstUChar>(static_cast<TUChar>(value));
+        case AST_T::UInt_t:
+            return std::make_shared<CConstUInt>(static_cast<TUInt>(value));
+        case AST_T::ULong_t:
+        case AST_T::Pointer_t:
+            return std::make_shared<CConstULong>(value);
+        default:
+            return nullptr;
+    }
+}
+
+static std::shared_ptr<CConst> fold_double_constant(Type* type, TDouble value) {
+    if (type->type() != AST_T::Double_t) {
+        return nullptr;
+    }
+    return std::make_shared<CConstDouble>(value);
+}
+
+// Conversions from double are undefined when the truncated value is out of range, those are left to run time
+static std::shared_ptr<CConst> fold_double_to_integer_constant(Type* type, TDouble value, bool is_signed) {
+    TDouble bit_size = static_cast<TDouble>(get_scalar_type_size(type) * 8);
+    value = std::trunc(value);
+    if (is_signed) {
+        TDouble limit = std::ldexp(1.0, static_cast<int>(bit_size) - 1);
+        if (!(value >= -limit && value < limit)) {
+            return nullptr;
+        }
+        return fold_integer_constant(type, static_cast<TULong>(static_cast<TLong>(value)));
+    }
+    else {
+        TDouble limit = std::ldexp(1.0, static_cast<int>(bit_size));
+        if (!(value >= 0.0 && value < limit)) {
+            return nullptr;
+        }
+        return fold_integer_constant(type, static_cast<TULong>(value));
+    }
+}
+
+static std::shared_ptr<CConst> fold_unary_integer_constant(TacUnaryOp* node, CConst* constant, Type* type) {
+    TULong value = get_constant_integer_value(constant);
+    switch (node->type()) {
+        case AST_T::TacComplement_t:
+            return fold_integer_constant(type, ~value);
+        case AST_T::TacNegate_t:
+            return fold_integer_constant(type, 0ul - value);
+        case AST_T::TacNot_t:
+            return fold_integer_constant(type, value == 0ul);
+        default:
+            RAISE_INTERNAL_ERROR;
+    }
+}
+
+static std::shared_ptr<CConst> fold_unary_double_constant(TacUnaryOp* node, CConst* constant, Type* type) {
+    TDouble value = ast_cast<CConstDouble>(constant)->value;
+    switch (node->type()) {
+        case AST_T::TacNegate_t:
+            return fold_double_constant(type, -value);
+        case AST_T::TacNot_t:
+            return fold_integer_constant(type, value == 0.0);
+        default:
+            return nullptr;
+    }
+}
+
+// Integer arithmetic wraps around in 64 bits and is truncated to the result type, signed division overflow and
+// out of range shift counts are undefined and left to run time. The type of a shift is the type of its left operand,
+// and a negative count is widened to a count out of range
+static std::shared_ptr<CConst> fold_binary_integer_constant(
+    TacBinaryOp* node, CConst* constant_1, CConst* constant_2, Type* type) {
+    bool is_signed = is_constant_signed(constant_1);
+    TULong bit_size = get_constant_bit_size(constant_1);
+    TULong value_1 = get_constant_integer_value(constant_1);
+    TULong value_2 = get_constant_integer_value(constant_2);
+    switch (node->type()) {
+        case AST_T::TacAdd_t:
+            return fold_integer_constant(type, value_1 + value_2);
+        case AST_T::TacSubtract_t:
+            return fold_integer_constant(type, value_1 - value_2);
+        case AST_T::TacMultiply_t:
+            return fold_integer_constant(type, value_1 * value_2);
+        case AST_T::TacDivide_t:
+        case AST_T::TacRemainder_t: {
+            if (value_2 == 0ul || (is_signed && value_2 == ~0ul && value_1 == (~0ul << (bit_size - 1ul)))) {
+                return nullptr;
+            }
+            else if (!is_signed) {
+                return fold_integer_constant(type, node->type() == AST_T::TacDivide_t ? value_1 / value_2
+                                                                                         : value_1 % value_2);
+            }
+            TLong signed_value_1 = static_cast<TLong>(value_1);
+            TLong signed_value_2 = static_cast<TLong>(value_2);
+            return fold_integer_constant(
+                type, static_cast<TULong>(node->type() == AST_T::TacDivide_t ? signed_value_1 / signed_value_2
+                                                                               : signed_value_1 % signed_value_2));
+        }
+        case AST_T::TacBitAnd_t:
+            return fold_integer_constant(type, value_1 & value_2);
+        case AST_T::TacBitOr_t:
+            return fold_integer_constant(type, value_1 | value_2);
+        case AST_T::TacBitXor_t:
+            return fold_integer_constant(type, value_1 ^ value_2);
+        case AST_T::TacBitShiftLeft_t:
+        case AST_T::TacBitShiftRight_t:
+        case AST_T::TacBitShrArithmetic_t: {
+            if (value_2 >= bit_size) {
+                return nullptr;
+            }
+            else if (node->type() == AST_T::TacBitShiftLeft_t) {
+                return fold_integer_constant(type, value_1 << value_2);
+            }
+            else if (node->type() == AST_T::TacBitShrArithmetic_t) {
+                return fold_integer_constant(type, static_cast<TULong>(static_cast<TLong>(value_1) >> value_2));
+            }
+            TULong bit_mask = bit_size == 64ul ? ~0ul : (1ul << bit_size) - 1ul;
+            return fold_integer_constant(type, (value_1 & bit_mask) >> value_2);
+        }
+        case AST_T::TacEqual_t:
+            return fold_integer_constant(type, value_1 == value_2);
+        case AST_T::TacNotEqual_t:
+            return fold_integer_constant(type, value_1 != value_2);
+        case AST_T::TacLessThan_t:
+            return fold_integer_constant(type, is_signed ? static_cast<TLong>(value_1) < static_cast<TLong>(value_2)
+                                                         : value_1 < value_2);
+        case AST_T::TacLessOrEqual_t:
+            return fold_integer_constant(type, is_signed ? static_cast<TLong>(value_1) <= static_cast<TLong>(value_2)
+                                                         : value_1 <= value_2);
+        case AST_T::TacGreaterThan_t:
+            return fold_integer_constant(type, is_signed ? static_cast<TLong>(value_1) > static_cast<TLong>(value_2)
+                                                         : value_1 > value_2);
+        case AST_T::TacGreaterOrEqual_t:
+            return fold_integer_constant(type, is_signed ? static_cast<TLong>(value_1) >= static_cast<TLong>(value_2)
+                                                         : value_1 >= value_2);
+        default:
+            RAISE_INTERNAL_ERROR;
+    }
+}
+
+// Double arithmetic follows IEEE 754 as in annex F, comparisons with NaN are false except for not equal
+static std::shared_ptr<CConst> fold_binary_double_constant(
+    TacBinaryOp* node, CConst* constant_1, CConst* constant_2, Type* type) {
+    TDouble value_1 = ast_cast<CConstDouble>(constant_1)->value;
+    TDouble value_2 = ast_cast<CConstDouble>(constant_2)->value;
+    switch (node->type()) {
+        case AST_T::TacAdd_t:
+            return fold_double_constant(type, value_1 + value_2);
+        case AST_T::TacSubtract_t:
+            return fold_double_constant(type, value_1 - value_2);
+        case AST_T::TacMultiply_t:
+            return fold_double_constant(type, value_1 * value_2);
+        case AST_T::TacDivide_t:
+            return fold_double_constant(type, value_1 / value_2);
+        case AST_T::TacEqual_t:
+            return fold_integer_constant(type, value_1 == value_2);
+        case AST_T::TacNotEqual_t:
+            return fold_integer_constant(type, value_1 != value_2);
+        case AST_T::TacLessThan_t:
+            return fold_integer_constant(type, value_1 < value_2);
+        case AST_T::TacLessOrEqual_t:
+            return fold_integer_constant(type, value_1 <= value_2);
+        case AST_T::TacGreaterThan_t:
+            return fold_integer_constant(type, value_1 > value_2);
+        case AST_T::TacGreaterOrEqual_t:
+            return fold_integer_constant(type, value_1 >= value_2);
+        default:
+            return nullptr;
+    }
+}
+
+static void fold_cast_instructions(
+    std::shared_ptr<CConst>&& constant, const std::shared_ptr<TacValue>& dst, size_t instruction_index) {
+    if (constant) {
+        std::shared_ptr<TacValue> src = std::make_shared<TacConstant>(std::move(constant));
+        set_instruction(std::make_unique<TacCopy>(std::move(src), dst), instruction_index);
+    }
+}
+
+static void fold_sign_extend_instructions(TacSignExtend* node, size_t instruction_index) {
+    if (node->src->type() == AST_T::TacConstant_t) {
+        CConst* constant = ast_cast<TacConstant>(node->src.get())->constant.get();
+        fold_cast_instructions(fold_integer_constant(get_value_type(node->dst.get()),
+                                   get_constant_integer_value(constant)),
+            node->dst, instruction_index);
+    }
+}
+
+static void fold_truncate_instructions(TacTruncate* node, size_t instruction_index) {
+    if (node->src->type() == AST_T::TacConstant_t) {
+        CConst* constant = ast_cast<TacConstant>(node->src.get())->constant.get();
+        fold_cast_instructions(fold_integer_constant(get_value_type(node->dst.get()),
+                                   get_constant_integer_value(constant)),
+            node->dst, instruction_index);
+    }
+}
+
+static void fold_zero_extend_instructions(TacZeroExtend* node, size_t instruction_index) {
+    if (node->src->type() == AST_T::TacConstant_t) {
+        CConst* constant = ast_cast<TacConstant>(node->src.get())->constant.get();
+        fold_cast_instructions(fold_integer_constant(get_value_type(node->dst.get()),
+                                   get_constant_integer_value(constant)),
+            node->dst, instruction_index);
+    }
+}
+
+static void fold_double_to_int_instructions(TacDoubleToInt* node, size_t instruction_index) {
+    if (node->src->type() == AST_T::TacConstant_t) {
+        CConst* constant = ast_cast<TacConstant>(node->src.get())->constant.get();
+        fold_cast_instructions(fold_double_to_integer_constant(get_value_type(node->dst.get()),
+                                   ast_cast<CConstDouble>(constant)->value, true),
+            node->dst, instruction_index);
+    }
+}
+
+static void fold_double_to_uint_instructions(TacDoubleToUInt* node, size_t instruction_index) {
+    if (node->src->type() == AST_T::TacConstant_t) {
+        CConst* constant = ast_cast<TacConstant>(node->src.get())->constant.get();
+        fold_cast_instructions(fold_double_to_integer_constant(get_value_type(node->dst.get()),
+                                   ast_cast<CConstDouble>(constant)->value, false),
+            node->dst, instruction_index);
+    }
+}
+
+static void fold_int_to_double_instructions(TacIntToDouble* node, size_t instruction_index) {
+    if (node->src->type() == AST_T::TacConstant_t) {
+        CConst* constant = ast_cast<TacConstant>(node->src.get())->constant.get();
+        TDouble value = static_cast<TDouble>(static_cast<TLong>(get_constant_integer_value(constant)));
+        fold_cast_instructions(
+            fold_double_constant(get_value_type(node->dst.get()), value), node->dst, instruction_index);
+    }
+}
+
+static void fold_uint_to_double_instructions(TacUIntToDouble* node, size_t instruction_index) {
+    if (node->src->type() == AST_T::TacConstant_t) {
+        CConst* constant = ast_cast<TacConstant>(node->src.get())->constant.get();
+        TDouble value = static_cast<TDouble>(get_constant_integer_value(constant));
+        fold_cast_instructions(
+            fold_double_constant(get_value_type(node->dst.get()), value), node->dst, instruction_index);
+    }
+}
+
+static void fold_unary_instructions(TacUnary* node, size_t instruction_index) {
+    if (node->src->type() == AST_T::TacConstant_t) {
+        CConst* constant = ast_cast<TacConstant>(node->src.get())->constant.get();
+        Type* dst_type = get_value_type(node->dst.get());
+        fold_cast_instructions(constant->type() == AST_T::CConstDouble_t ?
+                                   fold_unary_double_constant(node->unary_op.get(), constant, dst_type) :
+                                   fold_unary_integer_constant(node->unary_op.get(), constant, dst_type),
+            node->dst, instruction_index);
+    }
+}
+
+// Algebraic identities only apply to integers, as with doubles x + 0 flips a negative zero and x * 0 and x - x are
+// not zero for infinities and NaN
+static void simplify_binary_instructions(TacBinary* node, size_t instruction_index) {
+    std::shared_ptr<TacValue> src;
+    switch (node->binary_op->type()) {
+        case AST_T::TacAdd_t:
+        case AST_T::TacMultiply_t: {
+            TULong identity_value = node->binary_op->type() == AST_T::TacAdd_t ? 0ul : 1ul;
+            if (node->src2->type() == AST_T::TacConstant_t) {
+                CConst* constant = ast_cast<TacConstant>(node->src2.get())->constant.get();
+                if (is_constant_integer_value(constant, identity_value)) {
+                    src = node->src1;
+                }
+                else if (identity_value == 1ul && is_constant_integer_value(constant, 0ul)) {
+                    src = node->src2;
+                }
+            }
+            else if (node->src1->type() == AST_T::TacConstant_t) {
+                CConst* constant = ast_cast<TacConstant>(node->src1.get())->constant.get();
+                if (is_constant_integer_value(constant, identity_value)) {
+                    src = node->src2;
+                }
+                else if (identity_value == 1ul && is_constant_integer_value(constant, 0ul)) {
+                    src = node->src1;
+                }
+            }
+            break;
+        }
+        case AST_T::TacSubtract_t: {
+            if (node->src2->type() == AST_T::TacConstant_t) {
+                if (is_constant_integer_value(ast_cast<TacConstant>(node->src2.get())->constant.get(), 0ul)) {
+                    src = node->src1;
+                }
+            }
+            else if (node->src1->type() == AST_T::TacVariable_t
+                     && ast_cast<TacVariable>(node->src1.get())->name
+                            == ast_cast<TacVariable>(node->src2.get())->name) {
+                std::shared_ptr<CConst> constant = fold_integer_constant(get_value_type(node->dst.get()), 0ul);
+                if (constant) {
+                    src = std::make_shared<TacConstant>(std::move(constant));
+                }
+            }
+            break;
+        }
+        case AST_T::TacDivide_t: {
+            if (node->src2->type() == AST_T::TacConstant_t
+                && is_constant_integer_value(ast_cast<TacConstant>(node->src2.get())->constant.get(), 1ul)) {
+                src = node->src1;
+            }
+            break;
+        }
+        default:
+            break;
+    }
+    if (src) {
+        set_instruction(std::make_unique<TacCopy>(std::move(src), node->dst), instruction_index);
+    }
+}
+
+static void fold_binary_instructions(TacBinary* node, size_t instruction_index) {
+    if (node->src1->type() == AST_T::TacConstant_t && node->src2->type() == AST_T::TacConstant_t) {
+        CConst* constant_1 = ast_cast<TacConstant>(node->src1.get())->constant.get();
+        CConst* constant_2 = ast_cast<TacConstant>(node->src2.get())->constant.get();
+        TacBinaryOp* binary_op = node->binary_op.get();
+        if (constant_1->type() != constant_2->type() && binary_op->type() != AST_T::TacBitShiftLeft_t
+            && binary_op->type() != AST_T::TacBitShiftRight_t && binary_op->type() != AST_T::TacBitShrArithmetic_t) {
+            return;
+        }
+        Type* dst_type = get_value_type(node->dst.get());
+        fold_cast_instructions(constant_1->type() == AST_T::CConstDouble_t ?
+                                   fold_binary_double_constant(binary_op, constant_1, constant_2, dst_type) :
+                                   fold_binary_integer_constant(binary_op, constant_1, constant_2, dst_type),
+            node->dst, instruction_index);
+    }
+    else {
+        simplify_binary_instructions(node, instruction_index);
+    }
+}
+
+static void fold_jump_if_zero_instructions(TacJumpIfZero* node, size_t instruction_index) {
+    if (node->condition->type() == AST_T::TacConstant_t) {
+        if (is_constant_zero(ast_cast<TacConstant>(node->condition.get())->constant.get())) {
+            set_instruction(std::make_unique<TacJump>(node->target), instruction_index);
+        }
+        else {
+            set_instruction(nullptr, instruction_index);
+        }
+    }
+}
+
+static void fold_jump_if_not_zero_instructions(TacJumpIfNotZero* node, size_t instruction_index) {
+    if (node->condition->type() == AST_T::TacConstant_t) {
+        if (is_constant_zero(ast_cast<TacConstant>(node->condition.get())->constant.get())) {
+            set_instruction(nullptr, instruction_index);
+        }
+        else {
+            set_instruction(std::make_unique<TacJump>(node->target), instruction_index);
+        }
+    }
+}
+
+static void fold_instructions(size_t instruction_index) {
+    TacInstruction* node = (*context->p_instructions)[instruction_index].get();
+    switch (node->type()) {
+        case AST_T::TacSignExtend_t:
+            fold_sign_extend_instructions(ast_cast<TacSignExtend>(node), instruction_index);
+            break;
+        case AST_T::TacTruncate_t:
+            fold_truncate_instructions(ast_cast<TacTruncate>(node), instruction_index);
+            break;
+        case AST_T::TacZeroExtend_t:
+            fold_zero_extend_instructions(ast_cast<TacZeroExtend>(node), instruction_index);
+            break;
+        case AST_T::TacDoubleToInt_t:
+            fold_double_to_int_instructions(ast_cast<TacDoubleToInt>(node), instruction_index);
+            break;
+        case AST_T::TacDoubleToUInt_t:
+            fold_double_to_uint_instructions(ast_cast<TacDoubleToUInt>(node), instruction_index);
+            break;
+        case AST_T::TacIntToDouble_t:
+            fold_int_to_double_instructions(ast_cast<TacIntToDouble>(node), instruction_index);
+            break;
+        case AST_T::TacUIntToDouble_t:
+            fold_uint_to_double_instructions(ast_cast<TacUIntToDouble>(node), instruction_index);
+            break;
+        case AST_T::TacUnary_t:
+            fold_unary_instructions(ast_cast<TacUnary>(node), instruction_index);
+            break;
+        case AST_T::TacBinary_t:
+            fold_binary_instructions(ast_cast<TacBinary>(node), instruction_index);
+            break;
+        case AST_T::TacJumpIfZero_t:
+            fold_jump_if_zero_instructions(ast_cast<TacJumpIfZero>(node), instruction_index);
+            break;
+        case AST_T::TacJumpIfNotZero_t:
+            fold_jump_if_not_zero_instructions(ast_cast<TacJumpIfNotZero>(node), instruction_index);
+            break;
+        default:
+            break;
+    }
+}
+
+static void fold_constants() {
+    for (size_t i = 0; i < context->p_instructions->size(); ++i) {
+        if ((*context->p_instructions)[i]) {
+            fold_instructions(i);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Unreachable code elimination
+
+static void eliminate_unreachable_block(size_t block_id) {
+    const ControlFlowBlock& block = context->control_flow_graph.blocks[block_id];
+    for (size_t i = block.instructions_front_index; i <= block.instructions_back_index; ++i) {
+        if ((*context->p_instructions)[i]) {
+            set_instruction(nullptr, i);
+        }
+    }
+}
+
+// A jump is redundant when its target is the block that follows it once unreachable blocks are removed
+static void eliminate_redundant_jump(size_t block_id, size_t next_block_id) {
+    size_t instruction_index = context->control_flow_graph.blocks[block_id].instructions_back_index;
+    TacInstruction* node = (*context->p_instructions)[instruction_index].get();
+    TIdentifier target;
+    switch (node->type()) {
+        case AST_T::TacJump_t:
+            target = ast_cast<TacJump>(node)->target;
+            break;
+        case AST_T::TacJumpIfZero_t:
+            target = ast_cast<TacJumpIfZero>(node)->target;
+            break;
+        case AST_T::TacJumpIfNotZero_t:
+            target = ast_cast<TacJumpIfNotZero>(node)->target;
+            break;
+        default:
+            return;
+    }
+    if (context->control_flow_graph.label_id_map[target] == next_block_id) {
+        set_instruction(nullptr, instruction_index);
+    }
+}
+
+static void set_reachable_blocks(std::vector<bool>& is_reachable) {
+    const ControlFlowGraph& cfg = context->control_flow_graph;
+    is_reachable.assign(cfg.blocks.size(), false);
+    std::vector<size_t> block_stack;
+    for (size_t entry_successor_id : cfg.entry_successor_ids) {
+        if (entry_successor_id < cfg.blocks.size()) {
+            block_stack.push_back(entry_successor_id);
+        }
+    }
+    while (!block_stack.empty()) {
+        size_t block_id = block_stack.back();
+        block_stack.pop_back();
+        if (is_reachable[block_id]) {
+            continue;
+        }
+        is_reachable[block_id] = true;
+        for (size_t successor_id : cfg.blocks[block_id].successor_ids) {
+            if (successor_id < cfg.blocks.size() && !is_reachable[successor_id]) {
+                block_stack.push_back(successor_id);
+            }
+        }
+    }
+}
+
+static void eliminate_unused_labels() {
+    std::unordered_set<TIdentifier> jump_targets;
+    for (const auto& instruction : *context->p_instructions) {
+        if (!instruction) {
+            continue;
+        }
+        switch (instruction->type()) {
+            case AST_T::TacJump_t:
+                jump_targets.insert(ast_cast<TacJump>(instruction.get())->target);
+                break;
+            case AST_T::TacJumpIfZero_t:
+                jump_targets.insert(ast_cast<TacJumpIfZero>(instruction.get())->target);
+                break;
+            case AST_T::TacJumpIfNotZero_t:
+                jump_targets.insert(ast_cast<TacJumpIfNotZero>(instruction.get())->target);
+                break;
+            default:
+                break;
+        }
+    }
+    for (size_t i = 0; i < context->p_instructions->size(); ++i) {
+        TacInstruction* node = (*context->p_instructions)[i].get();
+        if (node && node->type() == AST_T::TacLabel_t
+            && jump_targets.find(ast_cast<TacLabel>(node)->name) == jump_targets.end()) {
+            set_instruction(nullptr, i);
+        }
+    }
+}
+
+static void eliminate_unreachable_code() {
+    build_control_flow_graph(context->control_flow_graph, *context->p_instructions);
+    std::vector<bool> is_reachable;
+    set_reachable_blocks(is_reachable);
+
+    size_t n_blocks = context->control_flow_graph.blocks.size();
+    size_t previous_block_id = n_blocks;
+    for (size_t block_id = 0; block_id < n_blocks; ++block_id) {
+        if (!is_reachable[block_id]) {
+            eliminate_unreachable_block(block_id);
+            continue;
+        }
+        else if (previous_block_id < n_blocks) {
+            eliminate_redundant_jump(previous_block_id, block_id);
+        }
+        previous_block_id = block_id;
+    }
+    eliminate_unused_labels();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Copy propagation
+
+constexpr size_t COPY_ID_NONE = static_cast<size_t>(-1);
+
+// Values are interchangeable when they have the same constant kind, so that propagated values keep the size and the
+// signedness of the operands they replace, aggregates are not propagated
+static AST_T get_type_value_kind(Type* type) {
+    switch (type->type()) {
+        case AST_T::Char_t:
+        case AST_T::SChar_t:
+            return AST_T::CConstChar_t;
+        case AST_T::Int_t:
+            return AST_T::CConstInt_t;
+        case AST_T::Long_t:
+            return AST_T::CConstLong_t;
+        case AST_T::Double_t:
+            return AST_T::CConstDouble_t;
+        case AST_T::UChar_t:
+            return AST_T::CConstUChar_t;
+        case AST_T::UInt_t:
+            return AST_T::CConstUInt_t;
+        case AST_T::ULong_t:
+        case AST_T::Pointer_t:
+            return AST_T::CConstULong_t;
+        default:
+            return AST_T::CConst_t;
+    }
+}
+
+static AST_T get_value_kind(TacValue* node) {
+    if (node->type() == AST_T::TacConstant_t) {
+        return ast_cast<TacConstant>(node)->constant->type();
+    }
+    return get_type_value_kind(get_value_type(node));
+}
+
+static bool is_same_value(TacValue* node_1, TacValue* node_2) {
+    if (node_1->type() != node_2->type()) {
+        return false;
+    }
+    else if (node_1->type() == AST_T::TacVariable_t) {
+        return ast_cast<TacVariable>(node_1)->name == ast_cast<TacVariable>(node_2)->name;
+    }
+    CConst* constant_1 = ast_cast<TacConstant>(node_1)->constant.get();
+    CConst* constant_2 = ast_cast<TacConstant>(node_2)->constant.get();
+    if (constant_1->type() != constant_2->type()) {
+        return false;
+    }
+    else if (constant_1->type() == AST_T::CConstDouble_t) {
+        return double_to_binary(ast_cast<CConstDouble>(constant_1)->value)
+               == double_to_binary(ast_cast<CConstDouble>(constant_2)->value);
+    }
+    return get_constant_integer_value(constant_1) == get_constant_integer_value(constant_2);
+}
+
+// Static variables and variables whose address is taken can be written by stores and function calls
+static bool is_variable_aliased(TIdentifier name) {
+    if (IS_TEMP_IDENTIFIER(name)) {
+        return false;
+    }
+    else if (context->address_taken_names.find(name) != context->address_taken_names.end()) {
+        return true;
+    }
+    return frontend->symbol_table[name]->attrs->type() != AST_T::LocalAttr_t;
+}
+
+static void add_copy(TacCopy* node, size_t instruction_index) {
+    TIdentifier dst_name = ast_cast<TacVariable>(node->dst.get())->name;
+    AST_T value_kind = get_value_kind(node->dst.get());
+    if (value_kind == AST_T::CConst_t || value_kind != get_value_kind(node->src.get())
+        || (node->src->type() == AST_T::TacVariable_t && ast_cast<TacVariable>(node->src.get())->name == dst_name)) {
+        return;
+    }
+    size_t copy_id = context->copy_srcs.size();
+    context->copy_dst_names.push_back(dst_name);
+    context->copy_srcs.push_back(node->src);
+    context->instruction_copy_ids[instruction_index] = copy_id;
+    context->variable_copy_ids[dst_name].push_back(copy_id);
+    if (node->src->type() == AST_T::TacVariable_t) {
+        context->variable_copy_ids[ast_cast<TacVariable>(node->src.get())->name].push_back(copy_id);
+    }
+}
+
+static void init_copies() {
+    context->copy_dst_names.clear();
+    context->copy_srcs.clear();
+    context->instruction_copy_ids.assign(context->p_instructions->size(), COPY_ID_NONE);
+    context->variable_copy_ids.clear();
+    context->address_taken_names.clear();
+    for (const auto& instruction : *context->p_instructions) {
+        if (instruction && instruction->type() == AST_T::TacGetAddress_t) {
+            TacValue* src = ast_cast<TacGetAddress>(instruction.get())->src.get();
+            if (src->type() == AST_T::TacVariable_t) {
+                context->address_taken_names.insert(ast_cast<TacVariable>(src)->name);
+            }
+        }
+    }
+    for (size_t i = 0; i < context->p_instructions->size(); ++i) {
+        TacInstruction* node = (*context->p_instructions)[i].get();
+        if (node && node->type() == AST_T::TacCopy_t) {
+            add_copy(ast_cast<TacCopy>(node), i);
+        }
+    }
+}
+
+// Variables written by many copies kill them as a bitset, so that killing them costs no more than a set of words
+static void set_copy_sets() {
+    size_t n_words = context->data_flow_analysis.n_words;
+    context->aliased_copy_set.assign(n_words, 0ul);
+    for (size_t copy_id = 0; copy_id < context->copy_srcs.size(); ++copy_id) {
+        TacValue* src = context->copy_srcs[copy_id].get();
+        if (is_variable_aliased(context->copy_dst_names[copy_id])
+            || (src->type() == AST_T::TacVariable_t && is_variable_aliased(ast_cast<TacVariable>(src)->name))) {
+            context->aliased_copy_set[copy_id >> 6] |= GET_DFA_BIT_MASK(copy_id);
+        }
+    }
+    context->variable_copy_sets.clear();
+    for (const auto& variable_copy_ids : context->variable_copy_ids) {
+        if (variable_copy_ids.second.size() > n_words) {
+            std::vector<uint64_t>& copy_set = context->variable_copy_sets[variable_copy_ids.first];
+            copy_set.assign(n_words, 0ul);
+            for (size_t copy_id : variable_copy_ids.second) {
+                copy_set[copy_id >> 6] |= GET_DFA_BIT_MASK(copy_id);
+            }
+        }
+    }
+}
+
+static bool is_copy_aliased(size_t copy_id) {
+    return (context->aliased_copy_set[copy_id >> 6] & GET_DFA_BIT_MASK(copy_id)) != 0;
+}
+
+static bool is_instruction_aliased_write(TacInstruction* node) {
+    return node->type() == AST_T::TacFunCall_t || node->type() == AST_T::TacStore_t;
+}
+
+static TIdentifier get_value_name(TacValue* node) { return ast_cast<TacVariable>(node)->name; }
+
+// Returns false when the instruction does not write a variable
+static bool get_instruction_dst_name(TacInstruction* node, TIdentifier& name) {
+    switch (node->type()) {
+        case AST_T::TacSignExtend_t:
+            name = get_value_name(ast_cast<TacSignExtend>(node)->dst.get());
+            return true;
+        case AST_T::TacTruncate_t:
+            name = get_value_name(ast_cast<TacTruncate>(node)->dst.get());
+            return true;
+        case AST_T::TacZeroExtend_t:
+            name = get_value_name(ast_cast<TacZeroExtend>(node)->dst.get());
+            return true;
+        case AST_T::TacDoubleToInt_t:
+            name = get_value_name(ast_cast<TacDoubleToInt>(node)->dst.get());
+            return true;
+        case AST_T::TacDoubleToUInt_t:
+            name = get_value_name(ast_cast<TacDoubleToUInt>(node)->dst.get());
+            return true;
+        case AST_T::TacIntToDouble_t:
+            name = get_value_name(ast_cast<TacIntToDouble>(node)->dst.get());
+            return true;
+        case AST_T::TacUIntToDouble_t:
+            name = get_value_name(ast_cast<TacUIntToDouble>(node)->dst.get());
+            return true;
+        case AST_T::TacFunCall_t: {
+            TacFunCall* fun_call = ast_cast<TacFunCall>(node);
+            if (!fun_call->dst) {
+                return false;
+            }
+            name = get_value_name(fun_call->dst.get());
+            return true;
+        }
+        case AST_T::TacUnary_t:
+            name = get_value_name(ast_cast<TacUnary>(node)->dst.get());
+            return true;
+        case AST_T::TacBinary_t:
+            name = get_value_name(ast_cast<TacBinary>(node)->dst.get());
+            return true;
+        case AST_T::TacCopy_t:
+            name = get_value_name(ast_cast<TacCopy>(node)->dst.get());
+            return true;
+        case AST_T::TacGetAddress_t:
+            name = get_value_name(ast_cast<TacGetAddress>(node)->dst.get());
+            return true;
+        case AST_T::TacLoad_t:
+            name = get_value_name(ast_cast<TacLoad>(node)->dst.get());
+            return true;
+        case AST_T::TacAddPtr_t:
+            name = get_value_name(ast_cast<TacAddPtr>(node)->dst.get());
+            return true;
+        case AST_T::TacCopyToOffset_t:
+            name = ast_cast<TacCopyToOffset>(node)->dst_name;
+            return true;
+        case AST_T::TacCopyFromOffset_t:
+            name = get_value_name(ast_cast<TacCopyFromOffset>(node)->dst.get());
+            return true;
+        case AST_T::TacZeroFill_t:
+            name = ast_cast<TacZeroFill>(node)->dst_name;
+            return true;
+        default:
+            return false;
+    }
+}
+
+static bool is_copy_killed_in_block(size_t copy_id, bool is_aliased_written) {
+    if (context->written_names.find(context->copy_dst_names[copy_id]) != context->written_names.end()
+        || (is_aliased_written && is_copy_aliased(copy_id))) {
+        return true;
+    }
+    TacValue* src = context->copy_srcs[copy_id].get();
+    return src->type() == AST_T::TacVariable_t
+           && context->written_names.find(get_value_name(src)) != context->written_names.end();
+}
+
+// The block is scanned backward, so that a copy is generated when no later instruction of the block writes its source
+// or its destination, and each variable written in the block kills its copies once
+static void set_block_gen_kill_sets(size_t block_id) {
+    const ControlFlowBlock& block = context->control_flow_graph.blocks[block_id];
+    DataFlowAnalysis& dfa = context->data_flow_analysis;
+    bool is_aliased_written = false;
+    context->written_names.clear();
+    for (size_t i = block.instructions_back_index + 1; i-- > block.instructions_front_index;) {
+        TacInstruction* node = (*context->p_instructions)[i].get();
+        if (!node) {
+            continue;
+        }
+        size_t copy_id = context->instruction_copy_ids[i];
+        if (copy_id != COPY_ID_NONE && !is_copy_killed_in_block(copy_id, is_aliased_written)) {
+            SET_DFA_BIT(dfa.gen_sets, dfa, block_id, copy_id);
+        }
+        TIdentifier name;
+        if (get_instruction_dst_name(node, name)) {
+            context->written_names.insert(name);
+        }
+        if (is_instruction_aliased_write(node)) {
+            is_aliased_written = true;
+        }
+    }
+
+    uint64_t* kill_set = &dfa.kill_sets[GET_DFA_WORD_INDEX(dfa, block_id, 0)];
+    for (TIdentifier name : context->written_names) {
+        auto variable_copy_set_it = context->variable_copy_sets.find(name);
+        if (variable_copy_set_it != context->variable_copy_sets.end()) {
+            for (size_t i = 0; i < dfa.n_words; ++i) {
+                kill_set[i] |= variable_copy_set_it->second[i];
+            }
+            continue;
+        }
+        auto variable_copy_ids_it = context->variable_copy_ids.find(name);
+        if (variable_copy_ids_it != context->variable_copy_ids.end()) {
+            for (size_t copy_id : variable_copy_ids_it->second) {
+                kill_set[copy_id >> 6] |= GET_DFA_BIT_MASK(copy_id);
+            }
+        }
+    }
+    if (is_aliased_written) {
+        for (size_t i = 0; i < dfa.n_words; ++i) {
+            kill_set[i] |= context->aliased_copy_set[i];
+        }
+    }
+}
+
+static size_t get_write_position(TIdentifier name) {
+    auto write_position_it = context->write_positions.find(name);
+    return write_position_it != context->write_positions.end() ? write_position_it->second : 0;
+}
+
+// While a block is rewritten, copies are killed lazily, a copy still holds when neither its destination nor its source
+// was written after it was met
+static bool is_copy_valid(size_t copy_id) {
+    size_t copy_position = context->copy_positions[copy_id];
+    if (get_write_position(context->copy_dst_names[copy_id]) > copy_position
+        || (is_copy_aliased(copy_id) && context->aliased_write_position > copy_position)) {
+        return false;
+    }
+    TacValue* src = context->copy_srcs[copy_id].get();
+    return src->type() != AST_T::TacVariable_t || get_write_position(get_value_name(src)) < copy_position;
+}
+
+// Returns the copy that holds for a destination, no two copies into the same destination reach the same point
+static size_t get_dst_copy_id(TIdentifier name) {
+    auto dst_copy_id_it = context->dst_copy_ids.find(name);
+    if (dst_copy_id_it == context->dst_copy_ids.end() || !is_copy_valid(dst_copy_id_it->second)) {
+        return COPY_ID_NONE;
+    }
+    return dst_copy_id_it->second;
+}
+
+static void add_dst_copy(size_t copy_id) {
+    context->copy_positions[copy_id] = ++context->position;
+    context->dst_copy_ids[context->copy_dst_names[copy_id]] = copy_id;
+}
+
+static void init_block_copies(size_t block_id) {
+    DataFlowAnalysis& dfa = context->data_flow_analysis;
+    context->position = 0;
+    context->aliased_write_position = 0;
+    context->write_positions.clear();
+    context->dst_copy_ids.clear();
+    for (size_t i = 0; i < dfa.n_words; ++i) {
+        uint64_t word = dfa.in_sets[GET_DFA_WORD_INDEX(dfa, block_id, 0) + i];
+        for (size_t copy_id = i << 6; word != 0ul; ++copy_id, word >>= 1) {
+            if ((word & 1ul) != 0ul) {
+                add_dst_copy(copy_id);
+            }
+        }
+    }
+}
+
+static void transfer_block_copies(size_t instruction_index) {
+    TacInstruction* node = (*context->p_instructions)[instruction_index].get();
+    TIdentifier name;
+    if (get_instruction_dst_name(node, name)) {
+        context->write_positions[name] = ++context->position;
+    }
+    if (is_instruction_aliased_write(node)) {
+        context->aliased_write_position = ++context->position;
+    }
+    size_t copy_id = context->instruction_copy_ids[instruction_index];
+    if (copy_id != COPY_ID_NONE) {
+        add_dst_copy(copy_id);
+    }
+}
+
+static bool propagate_copy_value(std::shared_ptr<TacValue>& value) {
+    if (value->type() != AST_T::TacVariable_t) {
+        return false;
+    }
+    size_t copy_id = get_dst_copy_id(get_value_name(value.get()));
+    if (copy_id == COPY_ID_NONE) {
+        return false;
+    }
+    value = context->copy_srcs[copy_id];
+    return true;
+}
+
+// A copy is redundant when its destination already holds its source
+static bool is_copy_redundant(TacCopy* node) {
+    TIdentifier dst_name = get_value_name(node->dst.get());
+    if (node->src->type() == AST_T::TacVariable_t && get_value_name(node->src.get()) == dst_name) {
+        return true;
+    }
+    size_t copy_id = get_dst_copy_id(dst_name);
+    return copy_id != COPY_ID_NONE && is_same_value(context->copy_srcs[copy_id].get(), node->src.get());
+}
+
+static void propagate_copies_instruction(size_t instruction_index) {
+    TacInstruction* node = (*context->p_instructions)[instruction_index].get();
+    bool is_rewritten = false;
+    switch (node->type()) {
+        case AST_T::TacReturn_t: {
+            TacReturn* ret = ast_cast<TacReturn>(node);
+            if (ret->val) {
+                is_rewritten = propagate_copy_value(ret->val);
+            }
+            break;
+        }
+        case AST_T::TacSignExtend_t:
+            is_rewritten = propagate_copy_value(ast_cast<TacSignExtend>(node)->src);
+            break;
+        case AST_T::TacTruncate_t:
+            is_rewritten = propagate_copy_value(ast_cast<TacTruncate>(node)->src);
+            break;
+        case AST_T::TacZeroExtend_t:
+            is_rewritten = propagate_copy_value(ast_cast<TacZeroExtend>(node)->src);
+            break;
+        case AST_T::TacDoubleToInt_t:
+            is_rewritten = propagate_copy_value(ast_cast<TacDoubleToInt>(node)->src);
+            break;
+        case AST_T::TacDoubleToUInt_t:
+            is_rewritten = propagate_copy_value(ast_cast<TacDoubleToUInt>(node)->src);
+            break;
+        case AST_T::TacIntToDouble_t:
+            is_rewritten = propagate_copy_value(ast_cast<TacIntToDouble>(node)->src);
+            break;
+        case AST_T::TacUIntToDouble_t:
+            is_rewritten = propagate_copy_value(ast_cast<TacUIntToDouble>(node)->src);
+            break;
+        case AST_T::TacFunCall_t: {
+            for (auto& arg : ast_cast<TacFunCall>(node)->args) {
+                is_rewritten = propagate_copy_value(arg) || is_rewritten;
+            }
+            break;
+        }
+        case AST_T::TacUnary_t:
+            is_rewritten = propagate_copy_value(ast_cast<TacUnary>(node)->src);
+            break;
+        case AST_T::TacBinary_t: {
+            TacBinary* binary = ast_cast<TacBinary>(node);
+            is_rewritten = propagate_copy_value(binary->src1);
+            is_rewritten = propagate_copy_value(binary->src2) || is_rewritten;
+            break;
+        }
+        case AST_T::TacCopy_t: {
+            TacCopy* copy = ast_cast<TacCopy>(node);
+            is_rewritten = propagate_copy_value(copy->src);
+            if (is_copy_redundant(copy)) {
+                set_instruction(nullptr, instruction_index);
+                return;
+            }
+            break;
+        }
+        case AST_T::TacLoad_t:
+            is_rewritten = propagate_copy_value(ast_cast<TacLoad>(node)->src_ptr);
+            break;
+        case AST_T::TacStore_t: {
+            TacStore* store = ast_cast<TacStore>(node);
+            is_rewritten = propagate_copy_value(store->src);
+            is_rewritten = propagate_copy_value(store->dst_ptr) || is_rewritten;
+            break;
+        }
+        case AST_T::TacAddPtr_t: {
+            TacAddPtr* add_ptr = ast_cast<TacAddPtr>(node);
+            is_rewritten = propagate_copy_value(add_ptr->src_ptr);
+            is_rewritten = propagate_copy_value(add_ptr->index) || is_rewritten;
+            break;
+        }
+        case AST_T::TacCopyToOffset_t:
+            is_rewritten = propagate_copy_value(ast_cast<TacCopyToOffset>(node)->src);
+            break;
+        case AST_T::TacJumpIfZero_t:
+            is_rewritten = propagate_copy_value(ast_cast<TacJumpIfZero>(node)->condition);
+            break;
+        case AST_T::TacJumpIfNotZero_t:
+            is_rewritten = propagate_copy_value(ast_cast<TacJumpIfNotZero>(node)->condition);
+            break;
+        default:
+            break;
+    }
+    if (is_rewritten) {
+        context->stats.n_rewritten_instructions[context->pass_kind]++;
+        context->is_fixed_point = false;
+    }
+    transfer_block_copies(instruction_index);
+}
+
+// Reaching copies is a forward must analysis over the copies of the function, its facts stay true while uses are
+// rewritten, as propagation does not change the value held by any variable
+static void propagate_copies() {
+    init_copies();
+    if (context->copy_srcs.empty()) {
+        return;
+    }
+    ControlFlowGraph& cfg = context->control_flow_graph;
+    DataFlowAnalysis& dfa = context->data_flow_analysis;
+    build_control_flow_graph(cfg, *context->p_instructions);
+    init_data_flow_analysis(dfa, cfg, context->copy_srcs.size());
+    set_copy_sets();
+    for (size_t block_id = 0; block_id < cfg.blocks.size(); ++block_id) {
+        set_block_gen_kill_sets(block_id);
+    }
+    solve_data_flow_analysis(dfa, cfg, DATA_FLOW_KIND::Dforward_must);
+
+    context->copy_positions.assign(context->copy_srcs.size(), 0);
+    for (size_t block_id = 0; block_id < cfg.blocks.size(); ++block_id) {
+        const ControlFlowBlock& block = cfg.blocks[block_id];
+        init_block_copies(block_id);
+        for (size_t i = block.instructions_front_index; i <= block.instructions_back_index; ++i) {
+            if ((*context->p_instructions)[i]) {
+                propagate_copies_instruction(i);
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Three address code optimization
+
+// Passes remove instructions by leaving an empty slot, so that instruction indices stay valid while a pass runs, and
+// the slots are compacted after each pass
+static void compact_instructions() {
+    context->p_instructions->erase(
+        std::remove(context->p_instructions->begin(), context->p_instructions->end(), nullptr),
+        context->p_instructions->end());
+}
+
+static void optimize_pass(OPTIM_PASS_KIND pass_kind) {
+    if (!IS_OPTIM_PASS_ENABLED(context->optim_mask, pass_kind)) {
+        return;
+    }
+    context->pass_kind = pass_kind;
+    switch (pass_kind) {
+        case OPTIM_PASS_KIND::Ofold_constants:
+            fold_constants();
+            break;
+        case OPTIM_PASS_KIND::Opropagate_copies:
+            propagate_copies();
+            break;
+        case OPTIM_PASS_KIND::Oeliminate_unreachable_code:
+            eliminate_unreachable_code();
+            break;
+        default:
+            break;
+    }
+    compact_instructions();
+}
+
+// Passes run in turn until none of them changes the function
+static void optimize_function_top_level(TacFunction* node) {
+    context->p_instructions = &node->body;
+    context->p_temp_types = &node->temp_types;
+    do {
+        context->is_fixed_point = true;
+        context->stats.n_iterations++;
+        optimize_pass(OPTIM_PASS_KIND::Ofold_constants);
+        optimize_pass(OPTIM_PASS_KIND::Oeliminate_unreachable_code);
+        optimize_pass(OPTIM_PASS_KIND::Opropagate_copies);
+    }
+    while (!context->is_fixed_point);
+    context->p_instructions = nullptr;
+    context->p_temp_types = nullptr;
+}
+
+static void optimize_program(TacProgram* node) {
+    for (const auto& top_level : node->function_top_levels) {
+        optimize_function_top_level(ast_cast<TacFunction>(top_level.get()));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+OptimTacStats optimize_three_address_code(TacProgram* node, int optim_mask) {
+    context = std::make_unique<OptimTacContext>(optim_mask);
+    if (optim_mask != 0) {
+        optimize_program(node);
+    }
+    OptimTacStats stats = context->stats;
+    context.reset();
+    return stats;
+}
@@ -1,7 +1,11 @@
 #include "tinydir/tinydir.h"
 #include <limits.h>
 #include <stdio.h>
+#include <string.h>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <unistd.h>
 
 #include "util/fileio.hpp"
 #include "util/throw.hpp"
@@ -15,33 +19,54 @@
 
 void set_filename(const std::string& filename) { util->filename = filename; }
 
-void file_open_read(const std::string& filename) {
-    for (size_t i = 0; i < util->file_reads.size(); ++i) {
-        if (util->file_reads[i].file_descriptor) {
-            size_t n_open_files = util->file_reads.size() - i;
-            if (n_open_files > FOPEN_MAX) {
-                RAISE_INTERNAL_ERROR;
-            }
-            else if (n_open_files == FOPEN_MAX) {
-                util->file_reads[i].len = 0;
-                free(util->file_reads[i].buffer);
-                util->file_reads[i].buffer = nullptr;
-                fclose(util->file_reads[i].file_descriptor);
-                util->file_reads[i].file_descriptor = nullptr;
-            }
-            break;
-        }
+static void free_file_read() {
+    util->file_reads.back().len = 0;
+    util->file_reads.back().offset = 0;
+    free(util->file_reads.back().buffer);
+    util->file_reads.back().buffer = nullptr;
+}
+
+// Read the whole file in one shot, lines are then read in place from the buffer
+static bool load_file_read(FILE* file_descriptor) {
+    if (fseek(file_descriptor, 0, SEEK_END) != 0) {
+        return false;
+    }
+    long len = ftell(file_descriptor);
+    if (len < 0 || fseek(file_descriptor, 0, SEEK_SET) != 0) {
+        return false;
     }
 
-    util->file_reads.emplace_back();
-    util->file_reads.back().file_descriptor = nullptr;
-    util->file_reads.back().file_descriptor = fopen(filename.c_str(), "rb");
-    if (!util->file_reads.back().file_descriptor || filename.size() >= PATH_MAX) {
-        raise_runtime_error(GET_ERROR_MESSAGE(ERROR_MESSAGE_UTIL::failed_to_read_input_file, filename));
+    util->file_reads.back().len = static_cast<size_t>(len);
+    util->file_reads.back().offset = 0;
+    util->file_reads.back().buffer = static_cast<char*>(malloc(util->file_reads.back().len + 1));
+    if (!util->file_reads.back().buffer) {
+        return false;
     }
+    util->file_reads.back().len =
+        fread(util->file_reads.back().buffer, sizeof(char), util->file_reads.back().len, file_descriptor);
+    util->file_reads.back().buffer[util->file_reads.back().len] = '\0';
+    return !ferror(file_descriptor);
+}
 
+// Parent files stay loaded on the file stack, so no file descriptor is kept open while lexing
+// File reads are owned by the thread which opened the first of them, which is the lexer thread in the pipeline
+void file_open_read(const std::string& filename) {
+    if (util->file_reads.empty()) {
+        util->file_reads_thread_id = std::this_thread::get_id();
+    }
+    util->file_reads.emplace_back();
     util->file_reads.back().len = 0;
+    util->file_reads.back().offset = 0;
     util->file_reads.back().buffer = nullptr;
+    FILE* file_descriptor = fopen(filename.c_str(), "rb");
+    bool is_read = file_descriptor && filename.size() < PATH_MAX && load_file_read(file_descriptor);
+    if (file_descriptor) {
+        fclose(file_descriptor);
+    }
+    if (!is_read) {
+        raise_runtime_error(GET_ERROR_MESSAGE(ERROR_MESSAGE_UTIL::failed_to_read_input_file, filename));
+    }
+
     util->file_reads.back().filename = filename;
 }
 
@@ -61,20 +86,112 @@ void file_open_write(const std::string& filename) {
 
 bool find_file(const std::string& filename) {
     tinydir_file file = {};
+    util->n_file_stats++;
     return tinydir_file_open(&file, filename.c_str()) != -1 && !file.is_dir;
 }
 
-bool read_line(std::string& line) {
-    if (getline(&util->file_reads.back().buffer, &util->file_reads.back().len, util->file_reads.back().file_descriptor)
-        == -1) {
-        line = "";
-        util->file_reads.back().len = 0;
-        free(util->file_reads.back().buffer);
-        util->file_reads.back().buffer = nullptr;
+// List the entry names of a directory once, without stating each entry
+static const std::unordered_set<std::string>& get_dir_index(const std::string& dirname) {
+    auto dir_index = util->dir_indexes.find(dirname);
+    if (dir_index != util->dir_indexes.end()) {
+        return dir_index->second;
+    }
+
+    std::unordered_set<std::string>& entries = util->dir_indexes[dirname];
+    tinydir_dir dir = {};
+    util->n_file_stats++;
+    if (tinydir_open(&dir, dirname.c_str()) != -1) {
+        while (dir.has_next) {
+#ifdef _MSC_VER
+            entries.insert(dir._f.cFileName);
+#else
+            entries.insert(dir._e->d_name);
+#endif
+            if (tinydir_next(&dir) == -1) {
+                break;
+            }
+        }
+    }
+    tinydir_close(&dir);
+    return entries;
+}
+
+// Look up the file in the directory index first, so that only a candidate which exists is stated
+bool find_dir_file(const std::string& dirname, const std::string& filename) {
+    std::string dir_filename = dirname + filename;
+    size_t i = dir_filename.rfind('/');
+    if (i == std::string::npos || i + 1 < dirname.size()) {
+        return find_file(dir_filename);
+    }
+    const std::unordered_set<std::string>& entries = get_dir_index(dir_filename.substr(0, i + 1));
+    if (entries.find(dir_filename.substr(i + 1)) == entries.end()) {
         return false;
     }
+    return find_file(dir_filename);
+}
 
-    line = util->file_reads.back().buffer;
+bool stat_file(const std::string& filename, size_t& file_size, int64_t& file_mtime) {
+    tinydir_file file = {};
+    util->n_file_stats++;
+    if (tinydir_file_open(&file, filename.c_str()) == -1 || file.is_dir) {
+        return false;
+    }
+    file_size = static_cast<size_t>(file._s.st_size);
+    file_mtime = static_cast<int64_t>(file._s.st_mtime);
+    return true;
+}
+
+std::string_view get_file_read() {
+    return std::string_view(util->file_reads.back().buffer, util->file_reads.back().len);
+}
+
+// Binary files are read and written at once outside of the file stack, failures are left to the caller
+bool read_binary_file(const std::string& filename, std::string& content) {
+    FILE* file_descriptor = fopen(filename.c_str(), "rb");
+    if (!file_descriptor) {
+        return false;
+    }
+    bool is_read = fseek(file_descriptor, 0, SEEK_END) == 0;
+    long len = is_read ? ftell(file_descriptor) : -1;
+    if (len < 0 || fseek(file_descriptor, 0, SEEK_SET) != 0) {
+        fclose(file_descriptor);
+        return false;
+    }
+    content.resize(static_cast<size_t>(len));
+    is_read = fread(&content[0], sizeof(char), content.size(), file_descriptor) == content.size();
+    fclose(file_descriptor);
+    return is_read;
+}
+
+bool write_binary_file(const std::string& filename, const std::string& content) {
+    std::string tmp_filename = filename + ".tmp" + std::to_string(getpid());
+    FILE* file_descriptor = fopen(tmp_filename.c_str(), "wb");
+    if (!file_descriptor) {
+        return false;
+    }
+    bool is_written = fwrite(content.c_str(), sizeof(char), content.size(), file_descriptor) == content.size();
+    is_written = fclose(file_descriptor) == 0 && is_written;
+    // Rename the complete file, so that concurrent readers never see a partial write
+    if (!is_written || rename(tmp_filename.c_str(), filename.c_str()) != 0) {
+        remove(tmp_filename.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool read_line(std::string_view& line) {
+    size_t offset = util->file_reads.back().offset;
+    if (offset >= util->file_reads.back().len) {
+        line = std::string_view();
+        free_file_read();
+        return false;
+    }
+
+    const char* line_begin = util->file_reads.back().buffer + offset;
+    const char* line_end = static_cast<const char*>(memchr(line_begin, '\n', util->file_reads.back().len - offset));
+    size_t line_size = line_end ? static_cast<size_t>(line_end - line_begin) + 1 : util->file_reads.back().len - offset;
+    util->file_reads.back().offset += line_size;
+    line = std::string_view(line_begin, line_size);
     return true;
 }
 
@@ -92,28 +209,9 @@ static void write_file(std::string&& string_stream, size_t chunk_size) {
 
 void write_line(std::string&& line) { write_file(line + "\n", 4096); }
 
-void file_close_read(size_t line_number) {
-    fclose(util->file_reads.back().file_descriptor);
-    util->file_reads.back().file_descriptor = nullptr;
+void file_close_read() {
+    free_file_read();
     util->file_reads.pop_back();
-
-    if (!util->file_reads.empty() && !util->file_reads.back().file_descriptor) {
-        if (util->file_reads.back().buffer || util->file_reads.back().len != 0) {
-            RAISE_INTERNAL_ERROR;
-        }
-        util->file_reads.back().file_descriptor = fopen(util->file_reads.back().filename.c_str(), "rb");
-        if (!util->file_reads.back().file_descriptor) {
-            raise_runtime_error(
-                GET_ERROR_MESSAGE(ERROR_MESSAGE_UTIL::failed_to_read_input_file, util->file_reads.back().filename));
-        }
-        for (size_t i = 0; i < line_number; ++i) {
-            if (getline(&util->file_reads.back().buffer, &util->file_reads.back().len,
-                    util->file_reads.back().file_descriptor)
-                == -1) {
-                RAISE_INTERNAL_ERROR;
-            }
-        }
-    }
 }
 
 void file_close_write() {
@@ -23,10 +23,11 @@
 
 static void header_string(const std::string& header) { std::cout << "+\n+\n@@ " << header << " @@"; }
 
-void pretty_print_tokens(const std::vector<Token>& tokens) {
+void pretty_print_tokens(const Tokens& tokens) {
     header_string("Tokens");
-    std::cout << "\nList[" << std::to_string(tokens.size()) << "]:";
-    for (const auto& token : tokens) {
+    std::cout << "\nList[" << std::to_string(tokens.token_kinds.size()) << "]:";
+    for (size_t i = 0; i < tokens.token_kinds.size(); ++i) {
+        Token token = get_token(tokens, i);
         std::cout << "\n  ";
         if (token.token.compare(get_token_kind_hr(token.token_kind)) == 0) {
             std::cout << token.token;
@@ -37,6 +38,13 @@ void pretty_print_tokens(const std::vector<Token>& tokens) {
     std::cout << std::endl;
 }
 
+static std::string identifier_string(TIdentifier identifier) {
+    if (IS_TEMP_IDENTIFIER(identifier)) {
+        return "tmp." + std::to_string(GET_TEMP_IDENTIFIER_INDEX(identifier));
+    }
+    return get_identifier_name(identifier);
+}
+
 static void field(const std::string& name, const std::string& value, size_t t) {
     std::cout << "\n";
     for (size_t i = 0; i < t - 1; ++i) {
@@ -60,49 +68,49 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::CConstInt_t: {
             field("CConstInt", "", ++t);
-            CConstInt* p_node = static_cast<CConstInt*>(node);
+            CConstInt* p_node = ast_cast<CConstInt>(node);
             field("TInt", std::to_string(p_node->value), t + 1);
             break;
         }
         case AST_T::CConstLong_t: {
             field("CConstLong", "", ++t);
-            CConstLong* p_node = static_cast<CConstLong*>(node);
+            CConstLong* p_node = ast_cast<CConstLong>(node);
             field("TLong", std::to_string(p_node->value), t + 1);
             break;
         }
         case AST_T::CConstUInt_t: {
             field("CConstUInt", "", ++t);
-            CConstUInt* p_node = static_cast<CConstUInt*>(node);
+            CConstUInt* p_node = ast_cast<CConstUInt>(node);
             field("TUInt", std::to_string(p_node->value), t + 1);
             break;
         }
         case AST_T::CConstULong_t: {
             field("CConstULong", "", ++t);
-            CConstULong* p_node = static_cast<CConstULong*>(node);
+            CConstULong* p_node = ast_cast<CConstULong>(node);
             field("TULong", std::to_string(p_node->value), t + 1);
             break;
         }
         case AST_T::CConstDouble_t: {
             field("CConstDouble", "", ++t);
-            CConstDouble* p_node = static_cast<CConstDouble*>(node);
+            CConstDouble* p_node = ast_cast<CConstDouble>(node);
             field("TDouble", std::to_string(p_node->value), t + 1);
             break;
         }
         case AST_T::CConstChar_t: {
             field("CConstChar", "", ++t);
-            CConstChar* p_node = static_cast<CConstChar*>(node);
+            CConstChar* p_node = ast_cast<CConstChar>(node);
             field("TChar", std::to_string(p_node->value), t + 1);
             break;
         }
         case AST_T::CConstUChar_t: {
             field("CConstUChar", "", ++t);
-            CConstUChar* p_node = static_cast<CConstUChar*>(node);
+            CConstUChar* p_node = ast_cast<CConstUChar>(node);
             field("TUChar", std::to_string(p_node->value), t + 1);
             break;
         }
         case AST_T::CStringLiteral_t: {
             field("CStringLiteral", "", ++t);
-            CStringLiteral* p_node = static_cast<CStringLiteral*>(node);
+            CStringLiteral* p_node = ast_cast<CStringLiteral>(node);
             field("List[" + std::to_string(p_node->value.size()) + "]", "", t + 1);
             for (const auto& item : p_node->value) {
                 field("TChar", std::to_string(item), t + 2);
@@ -151,7 +159,7 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::FunType_t: {
             field("FunType", "", ++t);
-            FunType* p_node = static_cast<FunType*>(node);
+            FunType* p_node = ast_cast<FunType>(node);
             field("List[" + std::to_string(p_node->param_types.size()) + "]", "", t + 1);
             for (const auto& item : p_node->param_types) {
                 print_ast(item.get(), t + 1);
@@ -161,21 +169,21 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::Pointer_t: {
             field("Pointer", "", ++t);
-            Pointer* p_node = static_cast<Pointer*>(node);
+            Pointer* p_node = ast_cast<Pointer>(node);
             print_ast(p_node->ref_type.get(), t);
             break;
         }
         case AST_T::Array_t: {
             field("Array", "", ++t);
-            Array* p_node = static_cast<Array*>(node);
+            Array* p_node = ast_cast<Array>(node);
             field("TLong", std::to_string(p_node->size), t + 1);
             print_ast(p_node->elem_type.get(), t);
             break;
         }
         case AST_T::Structure_t: {
             field("Structure", "", ++t);
-            Structure* p_node = static_cast<Structure*>(node);
-            field("TIdentifier", p_node->tag, t + 1);
+            Structure* p_node = ast_cast<Structure>(node);
+            field("TIdentifier", identifier_string(p_node->tag), t + 1);
             break;
         }
         case AST_T::StaticInit_t: {
@@ -184,65 +192,74 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::IntInit_t: {
             field("IntInit", "", ++t);
-            IntInit* p_node = static_cast<IntInit*>(node);
+            IntInit* p_node = ast_cast<IntInit>(node);
             field("TInt", std::to_string(p_node->value), t + 1);
             break;
         }
         case AST_T::LongInit_t: {
             field("LongInit", "", ++t);
-            LongInit* p_node = static_cast<LongInit*>(node);
+            LongInit* p_node = ast_cast<LongInit>(node);
             field("TLong", std::to_string(p_node->value), t + 1);
             break;
         }
         case AST_T::UIntInit_t: {
             field("UIntInit", "", ++t);
-            UIntInit* p_node = static_cast<UIntInit*>(node);
+            UIntInit* p_node = ast_cast<UIntInit>(node);
             field("TUInt", std::to_string(p_node->value), t + 1);
             break;
         }
         case AST_T::ULongInit_t: {
             field("ULongInit", "", ++t);
-            ULongInit* p_node = static_cast<ULongInit*>(node);
+            ULongInit* p_node = ast_cast<ULongInit>(node);
             field("TULong", std::to_string(p_node->value), t + 1);
             break;
         }
         case AST_T::CharInit_t: {
             field("CharInit", "", ++t);
-            CharInit* p_node = static_cast<CharInit*>(node);
+            CharInit* p_node = ast_cast<CharInit>(node);
             field("TChar", std::to_string(p_node->value), t + 1);
             break;
         }
         case AST_T::UCharInit_t: {
             field("UCharInit", "", ++t);
-            UCharInit* p_node = static_cast<UCharInit*>(node);
+            UCharInit* p_node = ast_cast<UCharInit>(node);
             field("TUChar", std::to_string(p_node->value), t + 1);
             break;
         }
         case AST_T::DoubleInit_t: {
             field("DoubleInit", "", ++t);
-            DoubleInit* p_node = static_cast<DoubleInit*>(node);
+            DoubleInit* p_node = ast_cast<DoubleInit>(node);
             field("TDouble", std::to_string(p_node->value), t + 1);
             field("TULong", std::to_string(p_node->binary), t + 1);
             break;
         }
         case AST_T::ZeroInit_t: {
             field("ZeroInit", "", ++t);
-            ZeroInit* p_node = static_cast<ZeroInit*>(node);
+            ZeroInit* p_node = ast_cast<ZeroInit>(node);
             field("TLong", std::to_string(p_node->byte), t + 1);
             break;
         }
+        case AST_T::BytesInit_t: {
+            field("BytesInit", "", ++t);
+            BytesInit* p_node = ast_cast<BytesInit>(node);
+            field("List[" + std::to_string(p_node->bytes.size()) + "]", "", t + 1);
+            for (const auto& item : p_node->bytes) {
+                field("TUChar", std::to_string(item), t + 2);
+            }
+            break;
+        }
         case AST_T::StringInit_t: {
             field("StringInit", "", ++t);
-            StringInit* p_node = static_cast<StringInit*>(node);
+            StringInit* p_node = ast_cast<StringInit>(node);
             field("Bool", std::to_string(p_node->is_null_terminated), t + 1);
-            field("TIdentifier", p_node->string_constant, t + 1);
+            field("TIdentifier", identifier_string(p_node->string_constant), t + 1);
             print_ast(p_node->literal.get(), t);
             break;
         }
         case AST_T::PointerInit_t: {
             field("PointerInit", "", ++t);
-            PointerInit* p_node = static_cast<PointerInit*>(node);
-            field("TIdentifier", p_node->name, t + 1);
+            PointerInit* p_node = ast_cast<PointerInit>(node);
+            field("TIdentifier", identifier_string(p_node->name), t + 1);
             break;
         }
         case AST_T::InitialValue_t: {
@@ -255,7 +272,7 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::Initial_t: {
             field("Initial", "", ++t);
-            Initial* p_node = static_cast<Initial*>(node);
+            Initial* p_node = ast_cast<Initial>(node);
             field("List[" + std::to_string(p_node->static_inits.size()) + "]", "", t + 1);
             for (const auto& item : p_node->static_inits) {
                 print_ast(item.get(), t + 1);
@@ -272,21 +289,21 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::FunAttr_t: {
             field("FunAttr", "", ++t);
-            FunAttr* p_node = static_cast<FunAttr*>(node);
+            FunAttr* p_node = ast_cast<FunAttr>(node);
             field("Bool", std::to_string(p_node->is_defined), t + 1);
             field("Bool", std::to_string(p_node->is_global), t + 1);
             break;
         }
         case AST_T::StaticAttr_t: {
             field("StaticAttr", "", ++t);
-            StaticAttr* p_node = static_cast<StaticAttr*>(node);
+            StaticAttr* p_node = ast_cast<StaticAttr>(node);
             field("Bool", std::to_string(p_node->is_global), t + 1);
             print_ast(p_node->init.get(), t);
             break;
         }
         case AST_T::ConstantAttr_t: {
             field("ConstantAttr", "", ++t);
-            ConstantAttr* p_node = static_cast<ConstantAttr*>(node);
+            ConstantAttr* p_node = ast_cast<ConstantAttr>(node);
             print_ast(p_node->static_init.get(), t);
             break;
         }
@@ -296,31 +313,27 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::Symbol_t: {
             field("Symbol", "", ++t);
-            Symbol* p_node = static_cast<Symbol*>(node);
+            Symbol* p_node = ast_cast<Symbol>(node);
             print_ast(p_node->type_t.get(), t);
             print_ast(p_node->attrs.get(), t);
             break;
         }
         case AST_T::StructMember_t: {
             field("StructMember", "", ++t);
-            StructMember* p_node = static_cast<StructMember*>(node);
+            StructMember* p_node = ast_cast<StructMember>(node);
+            field("TIdentifier", identifier_string(p_node->member_name), t + 1);
             field("TLong", std::to_string(p_node->offset), t + 1);
             print_ast(p_node->member_type.get(), t);
             break;
         }
         case AST_T::StructTypedef_t: {
             field("StructTypedef", "", ++t);
-            StructTypedef* p_node = static_cast<StructTypedef*>(node);
+            StructTypedef* p_node = ast_cast<StructTypedef>(node);
             field("TInt", std::to_string(p_node->alignment), t + 1);
             field("TLong", std::to_string(p_node->size), t + 1);
-            field("List[" + std::to_string(p_node->member_names.size()) + "]", "", t + 1);
-            for (const auto& item : p_node->member_names) {
-                field("TIdentifier", item, t + 2);
-            }
-            field("Dict[" + std::to_string(p_node->members.size()) + "]", "", t + 1);
-            for (const auto& item : p_node->members) {
-                field("[" + item.first + "]", "", t + 2);
-                print_ast(item.second.get(), t + 2);
+            field("List[" + std::to_string(p_node->members.size()) + "]", "", t + 1);
+            for (auto& item : p_node->members) {
+                print_ast(&item, t + 1);
             }
             break;
         }
@@ -346,7 +359,7 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::ByteArray_t: {
             field("ByteArray", "", ++t);
-            ByteArray* p_node = static_cast<ByteArray*>(node);
+            ByteArray* p_node = ast_cast<ByteArray>(node);
             field("TLong", std::to_string(p_node->size), t + 1);
             field("TInt", std::to_string(p_node->alignment), t + 1);
             break;
@@ -357,7 +370,7 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::BackendObj_t: {
             field("BackendObj", "", ++t);
-            BackendObj* p_node = static_cast<BackendObj*>(node);
+            BackendObj* p_node = ast_cast<BackendObj>(node);
             field("Bool", std::to_string(p_node->is_static), t + 1);
             field("Bool", std::to_string(p_node->is_constant), t + 1);
             print_ast(p_node->assembly_type.get(), t);
@@ -365,7 +378,7 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::BackendFun_t: {
             field("BackendFun", "", ++t);
-            BackendFun* p_node = static_cast<BackendFun*>(node);
+            BackendFun* p_node = ast_cast<BackendFun>(node);
             field("Bool", std::to_string(p_node->is_defined), t + 1);
             break;
         }
@@ -471,13 +484,13 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::CAbstractPointer_t: {
             field("CAbstractPointer", "", ++t);
-            CAbstractPointer* p_node = static_cast<CAbstractPointer*>(node);
+            CAbstractPointer* p_node = ast_cast<CAbstractPointer>(node);
             print_ast(p_node->abstract_declarator.get(), t);
             break;
         }
         case AST_T::CAbstractArray_t: {
             field("CAbstractArray", "", ++t);
-            CAbstractArray* p_node = static_cast<CAbstractArray*>(node);
+            CAbstractArray* p_node = ast_cast<CAbstractArray>(node);
             field("TLong", std::to_string(p_node->size), t + 1);
             print_ast(p_node->abstract_declarator.get(), t);
             break;
@@ -488,7 +501,7 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::CParam_t: {
             field("CParam", "", ++t);
-            CParam* p_node = static_cast<CParam*>(node);
+            CParam* p_node = ast_cast<CParam>(node);
             print_ast(p_node->declarator.get(), t);
             print_ast(p_node->param_type.get(), t);
             break;
@@ -499,26 +512,26 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::CIdent_t: {
             field("CIdent", "", ++t);
-            CIdent* p_node = static_cast<CIdent*>(node);
-            field("TIdentifier", p_node->name, t + 1);
+            CIdent* p_node = ast_cast<CIdent>(node);
+            field("TIdentifier", identifier_string(p_node->name), t + 1);
             break;
         }
         case AST_T::CPointerDeclarator_t: {
             field("CPointerDeclarator", "", ++t);
-            CPointerDeclarator* p_node = static_cast<CPointerDeclarator*>(node);
+            CPointerDeclarator* p_node = ast_cast<CPointerDeclarator>(node);
             print_ast(p_node->declarator.get(), t);
             break;
         }
         case AST_T::CArrayDeclarator_t: {
             field("CArrayDeclarator", "", ++t);
-            CArrayDeclarator* p_node = static_cast<CArrayDeclarator*>(node);
+            CArrayDeclarator* p_node = ast_cast<CArrayDeclarator>(node);
             field("TLong", std::to_string(p_node->size), t + 1);
             print_ast(p_node->declarator.get(), t);
             break;
         }
         case AST_T::CFunDeclarator_t: {
             field("CFunDeclarator", "", ++t);
-            CFunDeclarator* p_node = static_cast<CFunDeclarator*>(node);
+            CFunDeclarator* p_node = ast_cast<CFunDeclarator>(node);
             field("List[" + std::to_string(p_node->param_list.size()) + "]", "", t + 1);
             for (const auto& item : p_node->param_list) {
                 print_ast(item.get(), t + 1);
@@ -528,34 +541,34 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::CExp_t: {
             field("CExp", "", ++t);
-            CExp* p_node = static_cast<CExp*>(node);
+            CExp* p_node = ast_cast<CExp>(node);
             print_ast(p_node->exp_type.get(), t);
             break;
         }
         case AST_T::CConstant_t: {
             field("CConstant", "", ++t);
-            CConstant* p_node = static_cast<CConstant*>(node);
+            CConstant* p_node = ast_cast<CConstant>(node);
             print_ast(p_node->constant.get(), t);
             print_ast(p_node->exp_type.get(), t);
             break;
         }
         case AST_T::CString_t: {
             field("CString", "", ++t);
-            CString* p_node = static_cast<CString*>(node);
+            CString* p_node = ast_cast<CString>(node);
             print_ast(p_node->literal.get(), t);
             print_ast(p_node->exp_type.get(), t);
             break;
         }
         case AST_T::CVar_t: {
             field("CVar", "", ++t);
-            CVar* p_node = static_cast<CVar*>(node);
-            field("TIdentifier", p_node->name, t + 1);
+            CVar* p_node = ast_cast<CVar>(node);
+            field("TIdentifier", identifier_string(p_node->name), t + 1);
             print_ast(p_node->exp_type.get(), t);
             break;
         }
         case AST_T::CCast_t: {
             field("CCast", "", ++t);
-            CCast* p_node = static_cast<CCast*>(node);
+            CCast* p_node = ast_cast<CCast>(node);
             print_ast(p_node->exp.get(), t);
             print_ast(p_node->target_type.get(), t);
             print_ast(p_node->exp_type.get(), t);
@@ -563,7 +576,7 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::CUnary_t: {
             field("CUnary", "", ++t);
-            CUnary* p_node = static_cast<CUnary*>(node);
+            CUnary* p_node = ast_cast<CUnary>(node);
             print_ast(p_node->unary_op.get(), t);
             print_ast(p_node->exp.get(), t);
             print_ast(p_node->exp_type.get(), t);
@@ -571,7 +584,7 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::CBinary_t: {
             field("CBinary", "", ++t);
-            CBinary* p_node = static_cast<CBinary*>(node);
+            CBinary* p_node = ast_cast<CBinary>(node);
             print_ast(p_node->binary_op.get(), t);
             print_ast(p_node->exp_left.get(), t);
             print_ast(p_node->exp_right.get(), t);
@@ -580,7 +593,7 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::CAssignment_t: {
             field("CAssignment", "", ++t);
-            CAssignment* p_node = static_cast<CAssignment*>(node);
+            CAssignment* p_node = ast_cast<CAssignment>(node);
             print_ast(p_node->exp_left.get(), t);
             print_ast(p_node->exp_right.get(), t);
             print_ast(p_node->exp_type.get(), t);
@@ -588,7 +601,7 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::CConditional_t: {
             field("CConditional", "", ++t);
-            CConditional* p_node = static_cast<CConditional*>(node);
+            CConditional* p_node = ast_cast<CConditional>(node);
             print_ast(p_node->condition.get(), t);
             print_ast(p_node->exp_middle.get(), t);
             print_ast(p_node->exp_right.get(), t);
@@ -597,8 +610,8 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::CFunctionCall_t: {
             field("CFunctionCall", "", ++t);
-            CFunctionCall* p_node = static_cast<CFunctionCall*>(node);
-            field("TIdentifier", p_node->name, t + 1);
+            CFunctionCall* p_node = ast_cast<CFunctionCall>(node);
+            field("TIdentifier", identifier_string(p_node->name), t + 1);
             field("List[" + std::to_string(p_node->args.size()) + "]", "", t + 1);
             for (const auto& item : p_node->args) {
                 print_ast(item.get(), t + 1);
@@ -608,21 +621,21 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::CDereference_t: {
             field("CDereference", "", ++t);
-            CDereference* p_node = static_cast<CDereference*>(node);
+            CDereference* p_node = ast_cast<CDereference>(node);
             print_ast(p_node->exp.get(), t);
             print_ast(p_node->exp_type.get(), t);
             break;
         }
         case AST_T::CAddrOf_t: {
             field("CAddrOf", "", ++t);
-            CAddrOf* p_node = static_cast<CAddrOf*>(node);
+            CAddrOf* p_node = ast_cast<CAddrOf>(node);
             print_ast(p_node->exp.get(), t);
             print_ast(p_node->exp_type.get(), t);
             break;
         }
         case AST_T::CSubscript_t: {
             field("CSubscript", "", ++t);
-            CSubscript* p_node = static_cast<CSubscript*>(node);
+            CSubscript* p_node = ast_cast<CSubscript>(node);
             print_ast(p_node->primary_exp.get(), t);
             print_ast(p_node->subscript_exp.get(), t);
             print_ast(p_node->exp_type.get(), t);
@@ -630,30 +643,30 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::CSizeOf_t: {
             field("CSizeOf", "", ++t);
-            CSizeOf* p_node = static_cast<CSizeOf*>(node);
+            CSizeOf* p_node = ast_cast<CSizeOf>(node);
             print_ast(p_node->exp.get(), t);
             print_ast(p_node->exp_type.get(), t);
             break;
         }
         case AST_T::CSizeOfT_t: {
             field("CSizeOfT", "", ++t);
-            CSizeOfT* p_node = static_cast<CSizeOfT*>(node);
+            CSizeOfT* p_node = ast_cast<CSizeOfT>(node);
             print_ast(p_node->target_type.get(), t);
             print_ast(p_node->exp_type.get(), t);
             break;
         }
         case AST_T::CDot_t: {
             field("CDot", "", ++t);
-            CDot* p_node = static_cast<CDot*>(node);
-            field("TIdentifier", p_node->member, t + 1);
+            CDot* p_node = ast_cast<CDot>(node);
+            field("TIdentifier", identifier_string(p_node->member), t + 1);
             print_ast(p_node->structure.get(), t);
             print_ast(p_node->exp_type.get(), t);
             break;
         }
         case AST_T::CArrow_t: {
             field("CArrow", "", ++t);
-            CArrow* p_node = static_cast<CArrow*>(node);
-            field("TIdentifier", p_node->member, t + 1);
+            CArrow* p_node = ast_cast<CArrow>(node);
+            field("TIdentifier", identifier_string(p_node->member), t + 1);
             print_ast(p_node->pointer.get(), t);
             print_ast(p_node->exp_type.get(), t);
             break;
@@ -664,19 +677,19 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::CReturn_t: {
             field("CReturn", "", ++t);
-            CReturn* p_node = static_cast<CReturn*>(node);
+            CReturn* p_node = ast_cast<CReturn>(node);
             print_ast(p_node->exp.get(), t);
             break;
         }
         case AST_T::CExpression_t: {
             field("CExpression", "", ++t);
-            CExpression* p_node = static_cast<CExpression*>(node);
+            CExpression* p_node = ast_cast<CExpression>(node);
             print_ast(p_node->exp.get(), t);
             break;
         }
         case AST_T::CIf_t: {
             field("CIf", "", ++t);
-            CIf* p_node = static_cast<CIf*>(node);
+            CIf* p_node = ast_cast<CIf>(node);
             print_ast(p_node->condition.get(), t);
             print_ast(p_node->then.get(), t);
             print_ast(p_node->else_fi.get(), t);
@@ -684,43 +697,43 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::CGoto_t: {
             field("CGoto", "", ++t);
-            CGoto* p_node = static_cast<CGoto*>(node);
-            field("TIdentifier", p_node->target, t + 1);
+            CGoto* p_node = ast_cast<CGoto>(node);
+            field("TIdentifier", identifier_string(p_node->target), t + 1);
             break;
         }
         case AST_T::CLabel_t: {
             field("CLabel", "", ++t);
-            CLabel* p_node = static_cast<CLabel*>(node);
-            field("TIdentifier", p_node->target, t + 1);
+            CLabel* p_node = ast_cast<CLabel>(node);
+            field("TIdentifier", identifier_string(p_node->target), t + 1);
             print_ast(p_node->jump_to.get(), t);
             break;
         }
         case AST_T::CCompound_t: {
             field("CCompound", "", ++t);
-            CCompound* p_node = static_cast<CCompound*>(node);
+            CCompound* p_node = ast_cast<CCompound>(node);
             print_ast(p_node->block.get(), t);
             break;
         }
         case AST_T::CWhile_t: {
             field("CWhile", "", ++t);
-            CWhile* p_node = static_cast<CWhile*>(node);
-            field("TIdentifier", p_node->target, t + 1);
+            CWhile* p_node = ast_cast<CWhile>(node);
+            field("TIdentifier", identifier_string(p_node->target), t + 1);
             print_ast(p_node->condition.get(), t);
             print_ast(p_node->body.get(), t);
             break;
         }
         case AST_T::CDoWhile_t: {
             field("CDoWhile", "", ++t);
-            CDoWhile* p_node = static_cast<CDoWhile*>(node);
-            field("TIdentifier", p_node->target, t + 1);
+            CDoWhile* p_node = ast_cast<CDoWhile>(node);
+            field("TIdentifier", identifier_string(p_node->target), t + 1);
             print_ast(p_node->condition.get(), t);
             print_ast(p_node->body.get(), t);
             break;
         }
         case AST_T::CFor_t: {
             field("CFor", "", ++t);
-            CFor* p_node = static_cast<CFor*>(node);
-            field("TIdentifier", p_node->target, t + 1);
+            CFor* p_node = ast_cast<CFor>(node);
+            field("TIdentifier", identifier_string(p_node->target), t + 1);
             print_ast(p_node->init.get(), t);
             print_ast(p_node->condition.get(), t);
             print_ast(p_node->post.get(), t);
@@ -729,14 +742,14 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::CBreak_t: {
             field("CBreak", "", ++t);
-            CBreak* p_node = static_cast<CBreak*>(node);
-            field("TIdentifier", p_node->target, t + 1);
+            CBreak* p_node = ast_cast<CBreak>(node);
+            field("TIdentifier", identifier_string(p_node->target), t + 1);
             break;
         }
         case AST_T::CContinue_t: {
             field("CContinue", "", ++t);
-            CContinue* p_node = static_cast<CContinue*>(node);
-            field("TIdentifier", p_node->target, t + 1);
+            CContinue* p_node = ast_cast<CContinue>(node);
+            field("TIdentifier", identifier_string(p_node->target), t + 1);
             break;
         }
         case AST_T::CNull_t: {
@@ -749,13 +762,13 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::CInitDecl_t: {
             field("CInitDecl", "", ++t);
-            CInitDecl* p_node = static_cast<CInitDecl*>(node);
+            CInitDecl* p_node = ast_cast<CInitDecl>(node);
             print_ast(p_node->init.get(), t);
             break;
         }
         case AST_T::CInitExp_t: {
             field("CInitExp", "", ++t);
-            CInitExp* p_node = static_cast<CInitExp*>(node);
+            CInitExp* p_node = ast_cast<CInitExp>(node);
             print_ast(p_node->init.get(), t);
             break;
         }
@@ -765,7 +778,7 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::CB_t: {
             field("CB", "", ++t);
-            CB* p_node = static_cast<CB*>(node);
+            CB* p_node = ast_cast<CB>(node);
             field("List[" + std::to_string(p_node->block_items.size()) + "]", "", t + 1);
             for (const auto& item : p_node->block_items) {
                 print_ast(item.get(), t + 1);
@@ -778,13 +791,13 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::CS_t: {
             field("CS", "", ++t);
-            CS* p_node = static_cast<CS*>(node);
+            CS* p_node = ast_cast<CS>(node);
             print_ast(p_node->statement.get(), t);
             break;
         }
         case AST_T::CD_t: {
             field("CD", "", ++t);
-            CD* p_node = static_cast<CD*>(node);
+            CD* p_node = ast_cast<CD>(node);
             print_ast(p_node->declaration.get(), t);
             break;
         }
@@ -802,20 +815,20 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::CInitializer_t: {
             field("CInitializer", "", ++t);
-            CInitializer* p_node = static_cast<CInitializer*>(node);
+            CInitializer* p_node = ast_cast<CInitializer>(node);
             print_ast(p_node->init_type.get(), t);
             break;
         }
         case AST_T::CSingleInit_t: {
             field("CSingleInit", "", ++t);
-            CSingleInit* p_node = static_cast<CSingleInit*>(node);
+            CSingleInit* p_node = ast_cast<CSingleInit>(node);
             print_ast(p_node->exp.get(), t);
             print_ast(p_node->init_type.get(), t);
             break;
         }
         case AST_T::CCompoundInit_t: {
             field("CCompoundInit", "", ++t);
-            CCompoundInit* p_node = static_cast<CCompoundInit*>(node);
+            CCompoundInit* p_node = ast_cast<CCompoundInit>(node);
             field("List[" + std::to_string(p_node->initializers.size()) + "]", "", t + 1);
             for (const auto& item : p_node->initializers) {
                 print_ast(item.get(), t + 1);
@@ -823,17 +836,24 @@ static void print_ast(Ast* node, size_t t) {
             print_ast(p_node->init_type.get(), t);
             break;
         }
+        case AST_T::CZeroInit_t: {
+            field("CZeroInit", "", ++t);
+            CZeroInit* p_node = ast_cast<CZeroInit>(node);
+            field("TLong", std::to_string(p_node->byte), t + 1);
+            print_ast(p_node->init_type.get(), t);
+            break;
+        }
         case AST_T::CMemberDeclaration_t: {
             field("CMemberDeclaration", "", ++t);
-            CMemberDeclaration* p_node = static_cast<CMemberDeclaration*>(node);
-            field("TIdentifier", p_node->member_name, t + 1);
+            CMemberDeclaration* p_node = ast_cast<CMemberDeclaration>(node);
+            field("TIdentifier", identifier_string(p_node->member_name), t + 1);
             print_ast(p_node->member_type.get(), t);
             break;
         }
         case AST_T::CStructDeclaration_t: {
             field("CStructDeclaration", "", ++t);
-            CStructDeclaration* p_node = static_cast<CStructDeclaration*>(node);
-            field("TIdentifier", p_node->tag, t + 1);
+            CStructDeclaration* p_node = ast_cast<CStructDeclaration>(node);
+            field("TIdentifier", identifier_string(p_node->tag), t + 1);
             field("List[" + std::to_string(p_node->members.size()) + "]", "", t + 1);
             for (const auto& item : p_node->members) {
                 print_ast(item.get(), t + 1);
@@ -842,11 +862,11 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::CFunctionDeclaration_t: {
             field("CFunctionDeclaration", "", ++t);
-            CFunctionDeclaration* p_node = static_cast<CFunctionDeclaration*>(node);
-            field("TIdentifier", p_node->name, t + 1);
+            CFunctionDeclaration* p_node = ast_cast<CFunctionDeclaration>(node);
+            field("TIdentifier", identifier_string(p_node->name), t + 1);
             field("List[" + std::to_string(p_node->params.size()) + "]", "", t + 1);
             for (const auto& item : p_node->params) {
-                field("TIdentifier", item, t + 2);
+                field("TIdentifier", identifier_string(item), t + 2);
             }
             print_ast(p_node->body.get(), t);
             print_ast(p_node->fun_type.get(), t);
@@ -855,8 +875,8 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::CVariableDeclaration_t: {
             field("CVariableDeclaration", "", ++t);
-            CVariableDeclaration* p_node = static_cast<CVariableDeclaration*>(node);
-            field("TIdentifier", p_node->name, t + 1);
+            CVariableDeclaration* p_node = ast_cast<CVariableDeclaration>(node);
+            field("TIdentifier", identifier_string(p_node->name), t + 1);
             print_ast(p_node->init.get(), t);
             print_ast(p_node->var_type.get(), t);
             print_ast(p_node->storage_class.get(), t);
@@ -868,25 +888,25 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::CFunDecl_t: {
             field("CFunDecl", "", ++t);
-            CFunDecl* p_node = static_cast<CFunDecl*>(node);
+            CFunDecl* p_node = ast_cast<CFunDecl>(node);
             print_ast(p_node->function_decl.get(), t);
             break;
         }
         case AST_T::CVarDecl_t: {
             field("CVarDecl", "", ++t);
-            CVarDecl* p_node = static_cast<CVarDecl*>(node);
+            CVarDecl* p_node = ast_cast<CVarDecl>(node);
             print_ast(p_node->variable_decl.get(), t);
             break;
         }
         case AST_T::CStructDecl_t: {
             field("CStructDecl", "", ++t);
-            CStructDecl* p_node = static_cast<CStructDecl*>(node);
+            CStructDecl* p_node = ast_cast<CStructDecl>(node);
             print_ast(p_node->struct_decl.get(), t);
             break;
         }
         case AST_T::CProgram_t: {
             field("CProgram", "", ++t);
-            CProgram* p_node = static_cast<CProgram*>(node);
+            CProgram* p_node = ast_cast<CProgram>(node);
             field("List[" + std::to_string(p_node->declarations.size()) + "]", "", t + 1);
             for (const auto& item : p_node->declarations) {
                 print_ast(item.get(), t + 1);
@@ -987,14 +1007,14 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::TacConstant_t: {
             field("TacConstant", "", ++t);
-            TacConstant* p_node = static_cast<TacConstant*>(node);
+            TacConstant* p_node = ast_cast<TacConstant>(node);
             print_ast(p_node->constant.get(), t);
             break;
         }
         case AST_T::TacVariable_t: {
             field("TacVariable", "", ++t);
-            TacVariable* p_node = static_cast<TacVariable*>(node);
-            field("TIdentifier", p_node->name, t + 1);
+            TacVariable* p_node = ast_cast<TacVariable>(node);
+            field("TIdentifier", identifier_string(p_node->name), t + 1);
             break;
         }
         case AST_T::TacExpResult_t: {
@@ -1003,20 +1023,20 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::TacPlainOperand_t: {
             field("TacPlainOperand", "", ++t);
-            TacPlainOperand* p_node = static_cast<TacPlainOperand*>(node);
+            TacPlainOperand* p_node = ast_cast<TacPlainOperand>(node);
             print_ast(p_node->val.get(), t);
             break;
         }
         case AST_T::TacDereferencedPointer_t: {
             field("TacDereferencedPointer", "", ++t);
-            TacDereferencedPointer* p_node = static_cast<TacDereferencedPointer*>(node);
+            TacDereferencedPointer* p_node = ast_cast<TacDereferencedPointer>(node);
             print_ast(p_node->val.get(), t);
             break;
         }
         case AST_T::TacSubObject_t: {
             field("TacSubObject", "", ++t);
-            TacSubObject* p_node = static_cast<TacSubObject*>(node);
-            field("TIdentifier", p_node->base_name, t + 1);
+            TacSubObject* p_node = ast_cast<TacSubObject>(node);
+            field("TIdentifier", identifier_string(p_node->base_name), t + 1);
             field("TLong", std::to_string(p_node->offset), t + 1);
             break;
         }
@@ -1026,63 +1046,63 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::TacReturn_t: {
             field("TacReturn", "", ++t);
-            TacReturn* p_node = static_cast<TacReturn*>(node);
+            TacReturn* p_node = ast_cast<TacReturn>(node);
             print_ast(p_node->val.get(), t);
             break;
         }
         case AST_T::TacSignExtend_t: {
             field("TacSignExtend", "", ++t);
-            TacSignExtend* p_node = static_cast<TacSignExtend*>(node);
+            TacSignExtend* p_node = ast_cast<TacSignExtend>(node);
             print_ast(p_node->src.get(), t);
             print_ast(p_node->dst.get(), t);
             break;
         }
         case AST_T::TacTruncate_t: {
             field("TacTruncate", "", ++t);
-            TacTruncate* p_node = static_cast<TacTruncate*>(node);
+            TacTruncate* p_node = ast_cast<TacTruncate>(node);
             print_ast(p_node->src.get(), t);
             print_ast(p_node->dst.get(), t);
             break;
         }
         case AST_T::TacZeroExtend_t: {
             field("TacZeroExtend", "", ++t);
-            TacZeroExtend* p_node = static_cast<TacZeroExtend*>(node);
+            TacZeroExtend* p_node = ast_cast<TacZeroExtend>(node);
             print_ast(p_node->src.get(), t);
             print_ast(p_node->dst.get(), t);
             break;
         }
         case AST_T::TacDoubleToInt_t: {
             field("TacDoubleToInt", "", ++t);
-            TacDoubleToInt* p_node = static_cast<TacDoubleToInt*>(node);
+            TacDoubleToInt* p_node = ast_cast<TacDoubleToInt>(node);
             print_ast(p_node->src.get(), t);
             print_ast(p_node->dst.get(), t);
             break;
         }
         case AST_T::TacDoubleToUInt_t: {
             field("TacDoubleToUInt", "", ++t);
-            TacDoubleToUInt* p_node = static_cast<TacDoubleToUInt*>(node);
+            TacDoubleToUInt* p_node = ast_cast<TacDoubleToUInt>(node);
             print_ast(p_node->src.get(), t);
             print_ast(p_node->dst.get(), t);
             break;
         }
         case AST_T::TacIntToDouble_t: {
             field("TacIntToDouble", "", ++t);
-            TacIntToDouble* p_node = static_cast<TacIntToDouble*>(node);
+            TacIntToDouble* p_node = ast_cast<TacIntToDouble>(node);
             print_ast(p_node->src.get(), t);
             print_ast(p_node->dst.get(), t);
             break;
         }
         case AST_T::TacUIntToDouble_t: {
             field("TacUIntToDouble", "", ++t);
-            TacUIntToDouble* p_node = static_cast<TacUIntToDouble*>(node);
+            TacUIntToDouble* p_node = ast_cast<TacUIntToDouble>(node);
             print_ast(p_node->src.get(), t);
             print_ast(p_node->dst.get(), t);
             break;
         }
         case AST_T::TacFunCall_t: {
             field("TacFunCall", "", ++t);
-            TacFunCall* p_node = static_cast<TacFunCall*>(node);
-            field("TIdentifier", p_node->name, t + 1);
+            TacFunCall* p_node = ast_cast<TacFunCall>(node);
+            field("TIdentifier", identifier_string(p_node->name), t + 1);
             field("List[" + std::to_string(p_node->args.size()) + "]", "", t + 1);
             for (const auto& item : p_node->args) {
                 print_ast(item.get(), t + 1);
@@ -1092,7 +1112,7 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::TacUnary_t: {
             field("TacUnary", "", ++t);
-            TacUnary* p_node = static_cast<TacUnary*>(node);
+            TacUnary* p_node = ast_cast<TacUnary>(node);
             print_ast(p_node->unary_op.get(), t);
             print_ast(p_node->src.get(), t);
             print_ast(p_node->dst.get(), t);
@@ -1100,7 +1120,7 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::TacBinary_t: {
             field("TacBinary", "", ++t);
-            TacBinary* p_node = static_cast<TacBinary*>(node);
+            TacBinary* p_node = ast_cast<TacBinary>(node);
             print_ast(p_node->binary_op.get(), t);
             print_ast(p_node->src1.get(), t);
             print_ast(p_node->src2.get(), t);
@@ -1109,35 +1129,35 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::TacCopy_t: {
             field("TacCopy", "", ++t);
-            TacCopy* p_node = static_cast<TacCopy*>(node);
+            TacCopy* p_node = ast_cast<TacCopy>(node);
             print_ast(p_node->src.get(), t);
             print_ast(p_node->dst.get(), t);
             break;
         }
         case AST_T::TacGetAddress_t: {
             field("TacGetAddress", "", ++t);
-            TacGetAddress* p_node = static_cast<TacGetAddress*>(node);
+            TacGetAddress* p_node = ast_cast<TacGetAddress>(node);
             print_ast(p_node->src.get(), t);
             print_ast(p_node->dst.get(), t);
             break;
         }
         case AST_T::TacLoad_t: {
             field("TacLoad", "", ++t);
-            TacLoad* p_node = static_cast<TacLoad*>(node);
+            TacLoad* p_node = ast_cast<TacLoad>(node);
             print_ast(p_node->src_ptr.get(), t);
             print_ast(p_node->dst.get(), t);
             break;
         }
         case AST_T::TacStore_t: {
             field("TacStore", "", ++t);
-            TacStore* p_node = static_cast<TacStore*>(node);
+            TacStore* p_node = ast_cast<TacStore>(node);
             print_ast(p_node->src.get(), t);
             print_ast(p_node->dst_ptr.get(), t);
             break;
         }
         case AST_T::TacAddPtr_t: {
             field("TacAddPtr", "", ++t);
-            TacAddPtr* p_node = static_cast<TacAddPtr*>(node);
+            TacAddPtr* p_node = ast_cast<TacAddPtr>(node);
             field("TLong", std::to_string(p_node->scale), t + 1);
             print_ast(p_node->src_ptr.get(), t);
             print_ast(p_node->index.get(), t);
@@ -1146,44 +1166,52 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::TacCopyToOffset_t: {
             field("TacCopyToOffset", "", ++t);
-            TacCopyToOffset* p_node = static_cast<TacCopyToOffset*>(node);
-            field("TIdentifier", p_node->dst_name, t + 1);
+            TacCopyToOffset* p_node = ast_cast<TacCopyToOffset>(node);
+            field("TIdentifier", identifier_string(p_node->dst_name), t + 1);
             field("TLong", std::to_string(p_node->offset), t + 1);
             print_ast(p_node->src.get(), t);
             break;
         }
         case AST_T::TacCopyFromOffset_t: {
             field("TacCopyFromOffset", "", ++t);
-            TacCopyFromOffset* p_node = static_cast<TacCopyFromOffset*>(node);
-            field("TIdentifier", p_node->src_name, t + 1);
+            TacCopyFromOffset* p_node = ast_cast<TacCopyFromOffset>(node);
+            field("TIdentifier", identifier_string(p_node->src_name), t + 1);
             field("TLong", std::to_string(p_node->offset), t + 1);
             print_ast(p_node->dst.get(), t);
             break;
         }
+        case AST_T::TacZeroFill_t: {
+            field("TacZeroFill", "", ++t);
+            TacZeroFill* p_node = ast_cast<TacZeroFill>(node);
+            field("TIdentifier", identifier_string(p_node->dst_name), t + 1);
+            field("TLong", std::to_string(p_node->offset), t + 1);
+            field("TLong", std::to_string(p_node->byte), t + 1);
+            break;
+        }
         case AST_T::TacJump_t: {
             field("TacJump", "", ++t);
-            TacJump* p_node = static_cast<TacJump*>(node);
-            field("TIdentifier", p_node->target, t + 1);
+            TacJump* p_node = ast_cast<TacJump>(node);
+            field("TIdentifier", identifier_string(p_node->target), t + 1);
             break;
         }
         case AST_T::TacJumpIfZero_t: {
             field("TacJumpIfZero", "", ++t);
-            TacJumpIfZero* p_node = static_cast<TacJumpIfZero*>(node);
-            field("TIdentifier", p_node->target, t + 1);
+            TacJumpIfZero* p_node = ast_cast<TacJumpIfZero>(node);
+            field("TIdentifier", identifier_string(p_node->target), t + 1);
             print_ast(p_node->condition.get(), t);
             break;
         }
         case AST_T::TacJumpIfNotZero_t: {
             field("TacJumpIfNotZero", "", ++t);
-            TacJumpIfNotZero* p_node = static_cast<TacJumpIfNotZero*>(node);
-            field("TIdentifier", p_node->target, t + 1);
+            TacJumpIfNotZero* p_node = ast_cast<TacJumpIfNotZero>(node);
+            field("TIdentifier", identifier_string(p_node->target), t + 1);
             print_ast(p_node->condition.get(), t);
             break;
         }
         case AST_T::TacLabel_t: {
             field("TacLabel", "", ++t);
-            TacLabel* p_node = static_cast<TacLabel*>(node);
-            field("TIdentifier", p_node->name, t + 1);
+            TacLabel* p_node = ast_cast<TacLabel>(node);
+            field("TIdentifier", identifier_string(p_node->name), t + 1);
             break;
         }
         case AST_T::TacTopLevel_t: {
@@ -1192,23 +1220,27 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::TacFunction_t: {
             field("TacFunction", "", ++t);
-            TacFunction* p_node = static_cast<TacFunction*>(node);
-            field("TIdentifier", p_node->name, t + 1);
+            TacFunction* p_node = ast_cast<TacFunction>(node);
+            field("TIdentifier", identifier_string(p_node->name), t + 1);
             field("Bool", std::to_string(p_node->is_global), t + 1);
             field("List[" + std::to_string(p_node->params.size()) + "]", "", t + 1);
             for (const auto& item : p_node->params) {
-                field("TIdentifier", item, t + 2);
+                field("TIdentifier", identifier_string(item), t + 2);
             }
             field("List[" + std::to_string(p_node->body.size()) + "]", "", t + 1);
             for (const auto& item : p_node->body) {
                 print_ast(item.get(), t + 1);
             }
+            field("List[" + std::to_string(p_node->temp_types.size()) + "]", "", t + 1);
+            for (const auto& item : p_node->temp_types) {
+                print_ast(item.get(), t + 1);
+            }
             break;
         }
         case AST_T::TacStaticVariable_t: {
             field("TacStaticVariable", "", ++t);
-            TacStaticVariable* p_node = static_cast<TacStaticVariable*>(node);
-            field("TIdentifier", p_node->name, t + 1);
+            TacStaticVariable* p_node = ast_cast<TacStaticVariable>(node);
+            field("TIdentifier", identifier_string(p_node->name), t + 1);
             field("Bool", std::to_string(p_node->is_global), t + 1);
             print_ast(p_node->static_init_type.get(), t);
             field("List[" + std::to_string(p_node->static_inits.size()) + "]", "", t + 1);
@@ -1219,15 +1251,15 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::TacStaticConstant_t: {
             field("TacStaticConstant", "", ++t);
-            TacStaticConstant* p_node = static_cast<TacStaticConstant*>(node);
-            field("TIdentifier", p_node->name, t + 1);
+            TacStaticConstant* p_node = ast_cast<TacStaticConstant>(node);
+            field("TIdentifier", identifier_string(p_node->name), t + 1);
             print_ast(p_node->static_init_type.get(), t);
             print_ast(p_node->static_init.get(), t);
             break;
         }
         case AST_T::TacProgram_t: {
             field("TacProgram", "", ++t);
-            TacProgram* p_node = static_cast<TacProgram*>(node);
+            TacProgram* p_node = ast_cast<TacProgram>(node);
             field("List[" + std::to_string(p_node->static_constant_top_levels.size()) + "]", "", t + 1);
             for (const auto& item : p_node->static_constant_top_levels) {
                 print_ast(item.get(), t + 1);
@@ -1384,48 +1416,48 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::AsmImm_t: {
             field("AsmImm", "", ++t);
-            AsmImm* p_node = static_cast<AsmImm*>(node);
+            AsmImm* p_node = ast_cast<AsmImm>(node);
             field("Bool", std::to_string(p_node->is_byte), t + 1);
             field("Bool", std::to_string(p_node->is_quad), t + 1);
-            field("TIdentifier", p_node->value, t + 1);
+            field("TIdentifier", identifier_string(p_node->value), t + 1);
             break;
         }
         case AST_T::AsmRegister_t: {
             field("AsmRegister", "", ++t);
-            AsmRegister* p_node = static_cast<AsmRegister*>(node);
+            AsmRegister* p_node = ast_cast<AsmRegister>(node);
             print_ast(p_node->reg.get(), t);
             break;
         }
         case AST_T::AsmPseudo_t: {
             field("AsmPseudo", "", ++t);
-            AsmPseudo* p_node = static_cast<AsmPseudo*>(node);
-            field("TIdentifier", p_node->name, t + 1);
+            AsmPseudo* p_node = ast_cast<AsmPseudo>(node);
+            field("TIdentifier", identifier_string(p_node->name), t + 1);
             break;
         }
         case AST_T::AsmMemory_t: {
             field("AsmMemory", "", ++t);
-            AsmMemory* p_node = static_cast<AsmMemory*>(node);
+            AsmMemory* p_node = ast_cast<AsmMemory>(node);
             field("TLong", std::to_string(p_node->value), t + 1);
             print_ast(p_node->reg.get(), t);
             break;
         }
         case AST_T::AsmData_t: {
             field("AsmData", "", ++t);
-            AsmData* p_node = static_cast<AsmData*>(node);
-            field("TIdentifier", p_node->name, t + 1);
+            AsmData* p_node = ast_cast<AsmData>(node);
+            field("TIdentifier", identifier_string(p_node->name), t + 1);
             field("TLong", std::to_string(p_node->offset), t + 1);
             break;
         }
         case AST_T::AsmPseudoMem_t: {
             field("AsmPseudoMem", "", ++t);
-            AsmPseudoMem* p_node = static_cast<AsmPseudoMem*>(node);
-            field("TIdentifier", p_node->name, t + 1);
+            AsmPseudoMem* p_node = ast_cast<AsmPseudoMem>(node);
+            field("TIdentifier", identifier_string(p_node->name), t + 1);
             field("TLong", std::to_string(p_node->offset), t + 1);
             break;
         }
         case AST_T::AsmIndexed_t: {
             field("AsmIndexed", "", ++t);
-            AsmIndexed* p_node = static_cast<AsmIndexed*>(node);
+            AsmIndexed* p_node = ast_cast<AsmIndexed>(node);
             field("TLong", std::to_string(p_node->scale), t + 1);
             print_ast(p_node->reg_base.get(), t);
             print_ast(p_node->reg_index.get(), t);
@@ -1497,7 +1529,7 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::AsmMov_t: {
             field("AsmMov", "", ++t);
-            AsmMov* p_node = static_cast<AsmMov*>(node);
+            AsmMov* p_node = ast_cast<AsmMov>(node);
             print_ast(p_node->assembly_type.get(), t);
             print_ast(p_node->src.get(), t);
             print_ast(p_node->dst.get(), t);
@@ -1505,7 +1537,7 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::AsmMovSx_t: {
             field("AsmMovSx", "", ++t);
-            AsmMovSx* p_node = static_cast<AsmMovSx*>(node);
+            AsmMovSx* p_node = ast_cast<AsmMovSx>(node);
             print_ast(p_node->assembly_type_src.get(), t);
             print_ast(p_node->assembly_type_dst.get(), t);
             print_ast(p_node->src.get(), t);
@@ -1514,7 +1546,7 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::AsmMovZeroExtend_t: {
             field("AsmMovZeroExtend", "", ++t);
-            AsmMovZeroExtend* p_node = static_cast<AsmMovZeroExtend*>(node);
+            AsmMovZeroExtend* p_node = ast_cast<AsmMovZeroExtend>(node);
             print_ast(p_node->assembly_type_src.get(), t);
             print_ast(p_node->assembly_type_dst.get(), t);
             print_ast(p_node->src.get(), t);
@@ -1523,14 +1555,14 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::AsmLea_t: {
             field("AsmLea", "", ++t);
-            AsmLea* p_node = static_cast<AsmLea*>(node);
+            AsmLea* p_node = ast_cast<AsmLea>(node);
             print_ast(p_node->src.get(), t);
             print_ast(p_node->dst.get(), t);
             break;
         }
         case AST_T::AsmCvttsd2si_t: {
             field("AsmCvttsd2si", "", ++t);
-            AsmCvttsd2si* p_node = static_cast<AsmCvttsd2si*>(node);
+            AsmCvttsd2si* p_node = ast_cast<AsmCvttsd2si>(node);
             print_ast(p_node->assembly_type.get(), t);
             print_ast(p_node->src.get(), t);
             print_ast(p_node->dst.get(), t);
@@ -1538,7 +1570,7 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::AsmCvtsi2sd_t: {
             field("AsmCvtsi2sd", "", ++t);
-            AsmCvtsi2sd* p_node = static_cast<AsmCvtsi2sd*>(node);
+            AsmCvtsi2sd* p_node = ast_cast<AsmCvtsi2sd>(node);
             print_ast(p_node->assembly_type.get(), t);
             print_ast(p_node->src.get(), t);
             print_ast(p_node->dst.get(), t);
@@ -1546,7 +1578,7 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::AsmUnary_t: {
             field("AsmUnary", "", ++t);
-            AsmUnary* p_node = static_cast<AsmUnary*>(node);
+            AsmUnary* p_node = ast_cast<AsmUnary>(node);
             print_ast(p_node->unary_op.get(), t);
             print_ast(p_node->assembly_type.get(), t);
             print_ast(p_node->dst.get(), t);
@@ -1554,7 +1586,7 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::AsmBinary_t: {
             field("AsmBinary", "", ++t);
-            AsmBinary* p_node = static_cast<AsmBinary*>(node);
+            AsmBinary* p_node = ast_cast<AsmBinary>(node);
             print_ast(p_node->binary_op.get(), t);
             print_ast(p_node->assembly_type.get(), t);
             print_ast(p_node->src.get(), t);
@@ -1563,7 +1595,7 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::AsmCmp_t: {
             field("AsmCmp", "", ++t);
-            AsmCmp* p_node = static_cast<AsmCmp*>(node);
+            AsmCmp* p_node = ast_cast<AsmCmp>(node);
             print_ast(p_node->assembly_type.get(), t);
             print_ast(p_node->src.get(), t);
             print_ast(p_node->dst.get(), t);
@@ -1571,60 +1603,66 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::AsmIdiv_t: {
             field("AsmIdiv", "", ++t);
-            AsmIdiv* p_node = static_cast<AsmIdiv*>(node);
+            AsmIdiv* p_node = ast_cast<AsmIdiv>(node);
             print_ast(p_node->assembly_type.get(), t);
             print_ast(p_node->src.get(), t);
             break;
         }
         case AST_T::AsmDiv_t: {
             field("AsmDiv", "", ++t);
-            AsmDiv* p_node = static_cast<AsmDiv*>(node);
+            AsmDiv* p_node = ast_cast<AsmDiv>(node);
             print_ast(p_node->assembly_type.get(), t);
             print_ast(p_node->src.get(), t);
             break;
         }
         case AST_T::AsmCdq_t: {
             field("AsmCdq", "", ++t);
-            AsmCdq* p_node = static_cast<AsmCdq*>(node);
+            AsmCdq* p_node = ast_cast<AsmCdq>(node);
+            print_ast(p_node->assembly_type.get(), t);
+            break;
+        }
+        case AST_T::AsmRepStos_t: {
+            field("AsmRepStos", "", ++t);
+            AsmRepStos* p_node = ast_cast<AsmRepStos>(node);
             print_ast(p_node->assembly_type.get(), t);
             break;
         }
         case AST_T::AsmJmp_t: {
             field("AsmJmp", "", ++t);
-            AsmJmp* p_node = static_cast<AsmJmp*>(node);
-            field("TIdentifier", p_node->target, t + 1);
+            AsmJmp* p_node = ast_cast<AsmJmp>(node);
+            field("TIdentifier", identifier_string(p_node->target), t + 1);
             break;
         }
         case AST_T::AsmJmpCC_t: {
             field("AsmJmpCC", "", ++t);
-            AsmJmpCC* p_node = static_cast<AsmJmpCC*>(node);
-            field("TIdentifier", p_node->target, t + 1);
+            AsmJmpCC* p_node = ast_cast<AsmJmpCC>(node);
+            field("TIdentifier", identifier_string(p_node->target), t + 1);
             print_ast(p_node->cond_code.get(), t);
             break;
         }
         case AST_T::AsmSetCC_t: {
             field("AsmSetCC", "", ++t);
-            AsmSetCC* p_node = static_cast<AsmSetCC*>(node);
+            AsmSetCC* p_node = ast_cast<AsmSetCC>(node);
             print_ast(p_node->cond_code.get(), t);
             print_ast(p_node->dst.get(), t);
             break;
         }
         case AST_T::AsmLabel_t: {
             field("AsmLabel", "", ++t);
-            AsmLabel* p_node = static_cast<AsmLabel*>(node);
-            field("TIdentifier", p_node->name, t + 1);
+            AsmLabel* p_node = ast_cast<AsmLabel>(node);
+            field("TIdentifier", identifier_string(p_node->name), t + 1);
             break;
         }
         case AST_T::AsmPush_t: {
             field("AsmPush", "", ++t);
-            AsmPush* p_node = static_cast<AsmPush*>(node);
+            AsmPush* p_node = ast_cast<AsmPush>(node);
             print_ast(p_node->src.get(), t);
             break;
         }
         case AST_T::AsmCall_t: {
             field("AsmCall", "", ++t);
-            AsmCall* p_node = static_cast<AsmCall*>(node);
-            field("TIdentifier", p_node->name, t + 1);
+            AsmCall* p_node = ast_cast<AsmCall>(node);
+            field("TIdentifier", identifier_string(p_node->name), t + 1);
             break;
         }
         case AST_T::AsmRet_t: {
@@ -1637,20 +1675,24 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::AsmFunction_t: {
             field("AsmFunction", "", ++t);
-            AsmFunction* p_node = static_cast<AsmFunction*>(node);
-            field("TIdentifier", p_node->name, t + 1);
+            AsmFunction* p_node = ast_cast<AsmFunction>(node);
+            field("TIdentifier", identifier_string(p_node->name), t + 1);
             field("Bool", std::to_string(p_node->is_global), t + 1);
             field("Bool", std::to_string(p_node->is_return_memory), t + 1);
             field("List[" + std::to_string(p_node->instructions.size()) + "]", "", t + 1);
             for (const auto& item : p_node->instructions) {
                 print_ast(item.get(), t + 1);
             }
+            field("List[" + std::to_string(p_node->temp_types.size()) + "]", "", t + 1);
+            for (const auto& item : p_node->temp_types) {
+                print_ast(item.get(), t + 1);
+            }
             break;
         }
         case AST_T::AsmStaticVariable_t: {
             field("AsmStaticVariable", "", ++t);
-            AsmStaticVariable* p_node = static_cast<AsmStaticVariable*>(node);
-            field("TIdentifier", p_node->name, t + 1);
+            AsmStaticVariable* p_node = ast_cast<AsmStaticVariable>(node);
+            field("TIdentifier", identifier_string(p_node->name), t + 1);
             field("TInt", std::to_string(p_node->alignment), t + 1);
             field("Bool", std::to_string(p_node->is_global), t + 1);
             field("List[" + std::to_string(p_node->static_inits.size()) + "]", "", t + 1);
@@ -1661,15 +1703,15 @@ static void print_ast(Ast* node, size_t t) {
         }
         case AST_T::AsmStaticConstant_t: {
             field("AsmStaticConstant", "", ++t);
-            AsmStaticConstant* p_node = static_cast<AsmStaticConstant*>(node);
-            field("TIdentifier", p_node->name, t + 1);
+            AsmStaticConstant* p_node = ast_cast<AsmStaticConstant>(node);
+            field("TIdentifier", identifier_string(p_node->name), t + 1);
             field("TInt", std::to_string(p_node->alignment), t + 1);
             print_ast(p_node->static_init.get(), t);
             break;
         }
         case AST_T::AsmProgram_t: {
             field("AsmProgram", "", ++t);
-            AsmProgram* p_node = static_cast<AsmProgram*>(node);
+            AsmProgram* p_node = ast_cast<AsmProgram>(node);
             field("List[" + std::to_string(p_node->static_constant_top_levels.size()) + "]", "", t + 1);
             for (const auto& item : p_node->static_constant_top_levels) {
                 print_ast(item.get(), t + 1);
@@ -1695,7 +1737,7 @@ void pretty_print_symbol_table() {
     header_string("Symbol Table");
     std::cout << "\nDict(" << std::to_string(frontend->symbol_table.size()) << "):";
     for (const auto& symbol : frontend->symbol_table) {
-        field("[" + symbol.first + "]", "", 2);
+        field("[" + identifier_string(symbol.first) + "]", "", 2);
         print_ast(symbol.second.get(), 2);
     }
     std::cout << std::endl;
@@ -1703,17 +1745,19 @@ void pretty_print_symbol_table() {
 
 void pretty_print_static_constant_table() {
     header_string("Static Constant Table");
-    std::cout << "\nDict(" << std::to_string(frontend->static_constant_table.size()) << "):";
+    std::cout << "\nDict("
+              << std::to_string(frontend->static_constant_table.size() + frontend->double_constant_table.size())
+              << "):";
     for (const auto& static_constant : frontend->static_constant_table) {
-        field("[" + static_constant.first + "]", "", 2);
+        field("[" + identifier_string(static_constant.first) + "]", "", 2);
         if (frontend->symbol_table.find(static_constant.second) != frontend->symbol_table.end()
             && frontend->symbol_table[static_constant.second]->attrs->type() == AST_T::ConstantAttr_t) {
             ConstantAttr* constant_attr =
-                static_cast<ConstantAttr*>(frontend->symbol_table[static_constant.second]->attrs.get());
+                ast_cast<ConstantAttr>(frontend->symbol_table[static_constant.second]->attrs.get());
             if (constant_attr->static_init->type() == AST_T::StringInit_t) {
                 std::cout << "\n    string: \"";
                 for (const TChar& byte :
-                    static_cast<StringInit*>(constant_attr->static_init.get())->literal.get()->value) {
+                    ast_cast<StringInit>(constant_attr->static_init.get())->literal.get()->value) {
                     switch (byte) {
                         case 39:
                             std::cout << "\\'";
@@ -1757,13 +1801,17 @@ void pretty_print_static_constant_table() {
                 continue;
             }
         }
-        else if (backend->backend_symbol_table.find(static_constant.second) != backend->backend_symbol_table.end()
-                 && backend->backend_symbol_table[static_constant.second]->type() == AST_T::BackendObj_t) {
+        RAISE_INTERNAL_ERROR;
+    }
+    for (const auto& double_constant : frontend->double_constant_table) {
+        field("[" + std::to_string(double_constant.first) + "]", "", 2);
+        if (backend->backend_symbol_table.find(double_constant.second) != backend->backend_symbol_table.end()
+            && backend->backend_symbol_table[double_constant.second]->type() == AST_T::BackendObj_t) {
             BackendObj* backend_obj =
-                static_cast<BackendObj*>(backend->backend_symbol_table[static_constant.second].get());
+                ast_cast<BackendObj>(backend->backend_symbol_table[double_constant.second].get());
             if (backend_obj->is_constant && backend_obj->assembly_type->type() == AST_T::BackendDouble_t) {
                 double decimal;
-                uint64_t binary = string_to_uint64(static_constant.first);
+                uint64_t binary = double_constant.first;
                 std::memcpy(&decimal, &binary, sizeof(double));
                 std::cout << "\n    double: " << std::to_string(decimal);
                 continue;
@@ -1778,7 +1826,7 @@ void pretty_print_struct_typedef_table() {
     header_string("Structure Typedef Table");
     std::cout << "\nDict(" << std::to_string(frontend->struct_typedef_table.size()) << "):";
     for (const auto& struct_typedef : frontend->struct_typedef_table) {
-        field("[" + struct_typedef.first + "]", "", 2);
+        field("[" + identifier_string(struct_typedef.first) + "]", "", 2);
         print_ast(struct_typedef.second.get(), 2);
     }
     std::cout << std::endl;
@@ -1788,7 +1836,7 @@ void pretty_print_backend_symbol_table() {
     header_string("Backend Symbol Table");
     std::cout << "\nDict(" << std::to_string(backend->backend_symbol_table.size()) << "):";
     for (const auto& backend_symbol : backend->backend_symbol_table) {
-        field("[" + backend_symbol.first + "]", "", 2);
+        field("[" + identifier_string(backend_symbol.first) + "]", "", 2);
         print_ast(backend_symbol.second.get(), 2);
     }
     std::cout << std::endl;
@@ -1,9 +1,12 @@
+#include <charconv>
 #include <cstring>
 #include <inttypes.h>
 #include <iomanip>
 #include <sstream>
 #include <stdlib.h>
 #include <string>
+#include <string_view>
+#include <system_error>
 #include <vector>
 
 #include "util/str2t.hpp"
@@ -15,17 +18,42 @@
 
 // String to type
 
-intmax_t string_to_intmax(const std::string& s_int, size_t line) {
-    std::vector<char> buffer(s_int.begin(), s_int.end());
-    buffer.push_back('\0');
-    char* end_ptr = nullptr;
-    errno = 0;
-    intmax_t intmax = strtoimax(&buffer[0], &end_ptr, 10);
+// Literals are decoded in place from the token, out of range values saturate like strtoimax and strtoumax
+static bool decimal_to_intmax(std::string_view s_int, intmax_t& intmax) {
+    std::from_chars_result result = std::from_chars(s_int.data(), s_int.data() + s_int.size(), intmax, 10);
+    if (result.ptr == s_int.data()) {
+        return false;
+    }
+    if (result.ec == std::errc::result_out_of_range) {
+        intmax = s_int[0] == '-' ? INTMAX_MIN : INTMAX_MAX;
+    }
+    return true;
+}
 
-    if (end_ptr == &buffer[0]) {
+static bool decimal_to_uintmax(std::string_view s_uint, uintmax_t& uintmax) {
+    bool is_negative = !s_uint.empty() && s_uint[0] == '-';
+    if (is_negative) {
+        s_uint.remove_prefix(1);
+    }
+    std::from_chars_result result = std::from_chars(s_uint.data(), s_uint.data() + s_uint.size(), uintmax, 10);
+    if (result.ptr == s_uint.data()) {
+        return false;
+    }
+    if (result.ec == std::errc::result_out_of_range) {
+        uintmax = UINTMAX_MAX;
+    }
+    else if (is_negative) {
+        uintmax = -uintmax;
+    }
+    return true;
+}
+
+intmax_t string_to_intmax(std::string_view s_int, size_t line) {
+    intmax_t intmax = 0;
+    if (!decimal_to_intmax(s_int, intmax)) {
         if (line > 0) {
             RAISE_RUNTIME_ERROR_AT_LINE(
-                GET_ERROR_MESSAGE(ERROR_MESSAGE_UTIL::failed_to_interpret_string_to_integer, s_int), line);
+                GET_ERROR_MESSAGE(ERROR_MESSAGE_UTIL::failed_to_interpret_string_to_integer, std::string(s_int)), line);
         }
         else {
             RAISE_INTERNAL_ERROR;
@@ -39,17 +67,14 @@ int32_t intmax_to_int32(intmax_t intmax) { return static_cast<int32_t>(intmax);
 
 int64_t intmax_to_int64(intmax_t intmax) { return static_cast<int64_t>(intmax); }
 
-uintmax_t string_to_uintmax(const std::string& s_uint, size_t line) {
-    std::vector<char> buffer(s_uint.begin(), s_uint.end());
-    buffer.push_back('\0');
-    char* end_ptr = nullptr;
-    errno = 0;
-    uintmax_t uintmax = strtoumax(&buffer[0], &end_ptr, 10);
-
-    if (end_ptr == &buffer[0]) {
+uintmax_t string_to_uintmax(std::string_view s_uint, size_t line) {
+    uintmax_t uintmax = 0;
+    if (!decimal_to_uintmax(s_uint, uintmax)) {
         if (line > 0) {
             RAISE_RUNTIME_ERROR_AT_LINE(
-                GET_ERROR_MESSAGE(ERROR_MESSAGE_UTIL::failed_to_interpret_string_to_unsigned_integer, s_uint), line);
+                GET_ERROR_MESSAGE(
+                    ERROR_MESSAGE_UTIL::failed_to_interpret_string_to_unsigned_integer, std::string(s_uint)),
+                line);
         }
         else {
             RAISE_INTERNAL_ERROR;
@@ -63,7 +88,7 @@ uint32_t uintmax_to_uint32(uintmax_t uintmax) { return static_cast<uint32_t>(uin
 
 uint64_t uintmax_to_uint64(uintmax_t uintmax) { return static_cast<uint64_t>(uintmax); }
 
-uint64_t string_to_uint64(const std::string& s_uint) { return uintmax_to_uint64(string_to_uintmax(s_uint, 0)); }
+uint64_t string_to_uint64(std::string_view s_uint) { return uintmax_to_uint64(string_to_uintmax(s_uint, 0)); }
 
 void string_to_string_literal(const std::string& s_string, std::vector<int8_t>& string_literal) {
     for (size_t byte = 1; byte < s_string.size() - 1; ++byte) {
@@ -255,16 +280,17 @@ std::string string_literal_to_string_constant(const std::vector<int8_t>& string_
     return string_constant;
 }
 
-double string_to_double(const std::string& s_double, size_t line) {
-    std::vector<char> buffer(s_double.begin(), s_double.end());
-    buffer.push_back('\0');
-    char* end_ptr = nullptr;
-    errno = 0;
-    double float64 = strtod(&buffer[0], &end_ptr);
-
-    if (end_ptr == &buffer[0]) {
+// Fall back to strtod for values out of range, which rounds them to infinity or to a subnormal
+double string_to_double(std::string_view s_double, size_t line) {
+    double float64 = 0.0;
+    std::from_chars_result result = std::from_chars(s_double.data(), s_double.data() + s_double.size(), float64);
+    if (result.ptr == s_double.data()) {
         RAISE_RUNTIME_ERROR_AT_LINE(
-            GET_ERROR_MESSAGE(ERROR_MESSAGE_UTIL::failed_to_interpret_string_to_float, s_double), line);
+            GET_ERROR_MESSAGE(ERROR_MESSAGE_UTIL::failed_to_interpret_string_to_float, std::string(s_double)), line);
+    }
+    if (result.ec == std::errc::result_out_of_range) {
+        std::string buffer(s_double.data(), result.ptr);
+        float64 = strtod(buffer.c_str(), nullptr);
     }
 
     return float64;
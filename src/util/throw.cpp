@@ -4,6 +4,7 @@
 #include <stdexcept>
 #include <stdio.h>
 #include <string>
+#include <thread>
 
 #include "util/throw.hpp"
 #include "util/util.hpp"
@@ -12,15 +13,16 @@
 
 // Throw
 
+// Other threads leave the file reads to their owner thread, which may still be reading them
+static bool is_file_reads_thread() { return util->file_reads_thread_id == std::this_thread::get_id(); }
+
 static void free_resources() {
-    for (auto& file_read : util->file_reads) {
-        if (file_read.buffer != nullptr) {
-            free(file_read.buffer);
-            file_read.buffer = nullptr;
-        }
-        if (file_read.file_descriptor != nullptr) {
-            fclose(file_read.file_descriptor);
-            file_read.file_descriptor = nullptr;
+    if (is_file_reads_thread()) {
+        for (auto& file_read : util->file_reads) {
+            if (file_read.buffer != nullptr) {
+                free(file_read.buffer);
+                file_read.buffer = nullptr;
+            }
         }
     }
     if (util->file_descriptor_write != nullptr) {
@@ -30,7 +32,7 @@ static void free_resources() {
 }
 
 static const std::string& get_filename() {
-    if (!util->file_reads.empty()) {
+    if (!util->file_reads.empty() && is_file_reads_thread()) {
         return util->file_reads.back().filename;
     }
     else {
@@ -86,6 +88,13 @@ std::string em(const std::string& message) { return "\033[1m‘" + message + "
                              + std::to_string(line_number) + ": \033[1m" + line + "\033[0m");
 }
 
+// Warnings are printed to stderr and compilation goes on
+void raise_warning_at_line(const std::string& message, size_t line_number) {
+    std::string warning = "\033[1m" + get_filename() + ":" + std::to_string(line_number)
+                          + ":\033[0m\n\033[0;35mwarning:\033[0m " + message + "\n";
+    fputs(warning.c_str(), stderr);
+}
+
 [[noreturn]] void raise_internal_error(const char* func, const char* file, int line) {
     free_resources();
     throw std::runtime_error("\n\033[1m" + std::string(file) + ":" + std::to_string(line)
@@ -4,7 +4,7 @@
 
 std::unique_ptr<UtilContext> util;
 
-MainContext::MainContext() : is_verbose(false) {}
+MainContext::MainContext() : is_verbose(false), is_regex_lexer(false), is_preprocessor(false), is_pipeline(false) {}
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -0,0 +1,110 @@
+#!/bin/bash
+
+PACKAGE_NAME="$(cat ../bin/package_name.txt)"
+
+LIGHT_RED='\033[1;31m'
+LIGHT_GREEN='\033[1;32m'
+NC='\033[0m'
+
+TEST_DIR="${PWD}/tests/compiler"
+TEST_SRCS=()
+for i in $(seq 1 18); do
+    TEST_SRCS+=("$(basename $(find ${TEST_DIR} -maxdepth 1 -name "${i}_*" -type d))")
+done
+
+function file () {
+    FILE=${1%.*}
+    if [ -f "${FILE}.s" ]; then rm ${FILE}.s; fi
+    echo "${FILE}"
+}
+
+function total () {
+    echo "----------------------------------------------------------------------"
+    RESULT="${PASS} / ${TOTAL}"
+    if [ ${PASS} -eq ${TOTAL} ]; then
+        RESULT="${LIGHT_GREEN}PASS: ${RESULT}${NC}"
+    else
+        RESULT="${LIGHT_RED}FAIL: ${RESULT}${NC}"
+    fi
+    echo -e "${RESULT}"
+}
+
+function print_check () {
+    echo " - check ${1} -> ${2}"
+}
+
+function print_lexer () {
+    echo -e -n "${TOTAL} ${RESULT} ${FILE}.c${NC}"
+    PRINT="regex: ${RETURN_REGEX}, scan: ${RETURN_SCAN}, pipeline: ${RETURN_PIPELINE}"
+    print_check "lexer" "[${PRINT}]"
+}
+
+function compile () {
+    INCLUDE_DIR="$(dirname ${TEST_DIR}/${FILE}.c)/"
+    STDOUT=$(./${PACKAGE_NAME} 0 ${1} 0 ${TEST_DIR}/${FILE}.c ${INCLUDE_DIR} 2>&1)
+    RETURN=${?}
+    if [ -f "${TEST_DIR}/${FILE}.s" ]; then
+        STDOUT="${STDOUT}$(cat ${TEST_DIR}/${FILE}.s)"
+        rm ${TEST_DIR}/${FILE}.s
+    fi
+}
+
+function check_lexer () {
+    let TOTAL+=1
+
+    compile 1
+    STDOUT_REGEX="${STDOUT}"
+    RETURN_REGEX=${RETURN}
+
+    compile 0
+    STDOUT_SCAN="${STDOUT}"
+    RETURN_SCAN=${RETURN}
+
+    compile 8
+    STDOUT_PIPELINE="${STDOUT}"
+    RETURN_PIPELINE=${RETURN}
+
+    if [ ${RETURN_REGEX} -eq ${RETURN_SCAN} ] && [[ "${STDOUT_REGEX}" == "${STDOUT_SCAN}" ]] &&
+       [ ${RETURN_PIPELINE} -eq ${RETURN_SCAN} ] && [[ "${STDOUT_PIPELINE}" == "${STDOUT_SCAN}" ]]; then
+        RESULT="${LIGHT_GREEN}[y]"
+        let PASS+=1
+    else
+        RESULT="${LIGHT_RED}[n]"
+    fi
+
+    print_lexer
+}
+
+function check_test () {
+    FILE=$(file ${1})
+    cd ../../../bin/
+    check_lexer
+    cd ${TEST_DIR}
+}
+
+function test_src () {
+    SRC=${1}
+    for FILE in $(find ${SRC} -name "*.c" -type f | sort --uniq)
+    do
+        check_test ${FILE}
+    done
+}
+
+function test_all () {
+    for SRC in ${TEST_SRCS[@]}
+    do
+        test_src ${SRC}
+    done
+}
+
+PASS=0
+TOTAL=0
+cd ${TEST_DIR}
+if [ ! -z "${1}" ]; then
+    test_src ${TEST_SRCS["$((${1} - 1))"]}
+else
+    test_all
+fi
+total
+
+exit 0
@@ -0,0 +1,137 @@
+#!/bin/bash
+
+PACKAGE_NAME="$(cat ../bin/package_name.txt)"
+
+LIGHT_RED='\033[1;31m'
+LIGHT_GREEN='\033[1;32m'
+NC='\033[0m'
+
+TEST_DIR="${PWD}/tests/compiler"
+TEST_SRCS=()
+for i in $(seq 1 18); do
+    TEST_SRCS+=("$(basename $(find ${TEST_DIR} -maxdepth 1 -name "${i}_*" -type d))")
+done
+
+OPTIM_ARGS=("--fold" "--propagate" "--unreachable" "-O1" "-O2")
+
+function file () {
+    FILE=${1%.*}
+    if [ -f "${FILE}" ]; then rm ${FILE}; fi
+    echo "${FILE}"
+}
+
+function total () {
+    echo "----------------------------------------------------------------------"
+    RESULT="${PASS} / ${TOTAL}"
+    if [ ${PASS} -eq ${TOTAL} ]; then
+        RESULT="${LIGHT_GREEN}PASS: ${RESULT}${NC}"
+    else
+        RESULT="${LIGHT_RED}FAIL: ${RESULT}${NC}"
+    fi
+    echo -e "${RESULT}"
+}
+
+function print_check () {
+    echo " - check ${1} -> ${2}"
+}
+
+function print_optim () {
+    echo -e -n "${TOTAL} ${RESULT} ${FILE}.c${NC}"
+    PRINT="-O0: ${RETURN_O0}"
+    for i in ${!OPTIM_ARGS[@]}; do
+        PRINT="${PRINT}, ${OPTIM_ARGS[${i}]}: ${RETURNS[${i}]}"
+    done
+    print_check "optim" "[${PRINT}]"
+}
+
+# Programs which fail to compile are only checked to fail at every level
+function compile () {
+    STDOUT=""
+    ${PACKAGE_NAME} ${1} -c ${LIBS} ${FILE}.c > /dev/null 2>&1
+    RETURN=${?}
+    if [ ${RETURN} -eq 0 ]; then
+        gcc ${FILE}.o ${LINK_FILES} ${LIBS} -o ${FILE} > /dev/null 2>&1
+        RETURN=${?}
+    fi
+    if [ -f "${FILE}.o" ]; then rm ${FILE}.o; fi
+
+    if [ ${RETURN} -ne 0 ]; then
+        RETURN="fail"
+        return
+    fi
+    STDOUT=$(${FILE})
+    RETURN=${?}
+    rm ${FILE}
+}
+
+function check_optim () {
+    let TOTAL+=1
+
+    compile "-O0"
+    STDOUT_O0="${STDOUT}"
+    RETURN_O0=${RETURN}
+
+    RESULT="${LIGHT_GREEN}[y]"
+    RETURNS=()
+    for i in ${!OPTIM_ARGS[@]}; do
+        compile "${OPTIM_ARGS[${i}]}"
+        RETURNS+=(${RETURN})
+        if [[ "${RETURN}" != "${RETURN_O0}" ]] || [[ "${STDOUT}" != "${STDOUT_O0}" ]]; then
+            RESULT="${LIGHT_RED}[n]"
+        fi
+    done
+    if [[ "${RESULT}" == "${LIGHT_GREEN}[y]" ]]; then
+        let PASS+=1
+    fi
+
+    print_optim
+}
+
+function check_test () {
+    FILE=$(file ${1})
+    if [[ "${FILE}" == *"_client" ]]; then
+        return
+    fi
+
+    LIBS=""
+    if [[ "${FILE}" == *"__+l"* ]]; then
+        LIBS=" -"$(echo "${FILE}" | cut -d "+" -f2- | tr "+" "-" | tr "_" " ")
+    fi
+
+    LINK_FILES=""
+    if [ -f "${FILE}_data.s" ]; then
+        LINK_FILES="${FILE}_data.s"
+    elif [ -f "${FILE}_client.c" ]; then
+        LINK_FILES="${FILE}_client.c"
+    fi
+
+    check_optim
+}
+
+function test_src () {
+    SRC=${1}
+    for FILE in $(find ${SRC} -name "*.c" -type f | sort --uniq)
+    do
+        check_test ${FILE}
+    done
+}
+
+function test_all () {
+    for SRC in ${TEST_SRCS[@]}
+    do
+        test_src ${SRC}
+    done
+}
+
+LIBS=""
+PASS=0
+TOTAL=0
+cd ${TEST_DIR}
+if [ ! -z "${1}" ]; then
+    test_src ${TEST_SRCS["$((${1} - 1))"]}
+else
+    test_all
+fi
+total
+
+exit 0
@@ -8,6 +8,7 @@ NC='\033[0m'
 
 TEST_DIR="${PWD}/tests/preprocessor"
 TEST_SRC="${TEST_DIR}/preprocessor"
+CACHE_DIR="${TEST_DIR}/cache"
 
 function file () {
     FILE=${1%.*}
@@ -35,7 +36,7 @@ function print_check () {
 }
 
 function print_preprocess () {
-    echo -e -n "${TOTAL} ${RESULT} ${FILE}.c${NC}"
+    echo -e -n "${TOTAL} ${RESULT} ${FILE}.c${ARGS}${NC}"
     PRINT="${PACKAGE_NAME}: ${RETURN}"
     print_check "return" "[${PRINT}]"
     if [ ! -z "${STDOUT}" ]; then
@@ -46,7 +47,7 @@ function print_preprocess () {
 }
 
 function print_error () {
-    echo -e -n "${TOTAL} ${RESULT} ${FILE}.c${NC}"
+    echo -e -n "${TOTAL} ${RESULT} ${FILE}.c${ARGS}${NC}"
     PRINT=$(echo "${PACKAGE_NAME}:"; echo "${STDOUT}")
     print_check "error" "[${PRINT}]"
 }
@@ -69,7 +70,9 @@ function make_test () {
 
     for i in $(seq 1 $((N-1)))
     do
-        echo "int x${i} = 1;" > ${TEST_SRC}/$(header_dir ${i})test-header_${i}.h
+        echo "#ifndef TEST_HEADER_${i}_H" > ${TEST_SRC}/$(header_dir ${i})test-header_${i}.h
+        echo "#define TEST_HEADER_${i}_H" >> ${TEST_SRC}/$(header_dir ${i})test-header_${i}.h
+        echo "int x${i} = 1;" >> ${TEST_SRC}/$(header_dir ${i})test-header_${i}.h
         echo "// a single-line comment ${i}" >> ${TEST_SRC}/$(header_dir ${i})test-header_${i}.h
         echo "#pragma pragma${i}" >> ${TEST_SRC}/$(header_dir ${i})test-header_${i}.h
         echo "#include \"$(header_dir $((${N}-${i})))test-header_$((${N}-${i})).h\"" >> ${TEST_SRC}/$(header_dir ${i})test-header_${i}.h
@@ -78,9 +81,12 @@ function make_test () {
         echo "   */" >> ${TEST_SRC}/$(header_dir ${i})test-header_${i}.h
         echo "#define MACRO_${i} ${i}" >> ${TEST_SRC}/$(header_dir ${i})test-header_${i}.h
         echo "char* s${i} = \"Hello ${i}!\";" >> ${TEST_SRC}/$(header_dir ${i})test-header_${i}.h
+        echo "#endif" >> ${TEST_SRC}/$(header_dir ${i})test-header_${i}.h
     done
 
-    echo "int x${N} = 1;" > ${TEST_SRC}/test-header_${N}.h
+    echo "#ifndef TEST_HEADER_${N}_H" > ${TEST_SRC}/test-header_${N}.h
+    echo "#define TEST_HEADER_${N}_H" >> ${TEST_SRC}/test-header_${N}.h
+    echo "int x${N} = 1;" >> ${TEST_SRC}/test-header_${N}.h
     echo "// a single-line comment ${N}" >> ${TEST_SRC}/test-header_${N}.h
     echo "#pragma pragma${N}" >> ${TEST_SRC}/test-header_${N}.h
     echo "#include \"test-header_0.h\"" >> ${TEST_SRC}/test-header_${N}.h
@@ -89,6 +95,7 @@ function make_test () {
     echo "   */" >> ${TEST_SRC}/test-header_${N}.h
     echo "#define MACRO_${N} ${N}" >> ${TEST_SRC}/test-header_${N}.h
     echo "char* s${N} = \"Hello ${N}!\";" >> ${TEST_SRC}/test-header_${N}.h
+    echo "#endif" >> ${TEST_SRC}/test-header_${N}.h
 
     echo -n "" > ${TEST_SRC}/test-header_0.h
 
@@ -126,10 +133,8 @@ function make_test () {
 
 check_preprocess () {
     let TOTAL+=1
-    
-    make_test
 
-    ${PACKAGE_NAME} ${FILE}.c > /dev/null 2>&1
+    ${PACKAGE_NAME}${ARGS} ${FILE}.c > /dev/null 2>&1
     RETURN=${?}
     STDOUT=""
     if [ ${RETURN} -ne 0 ]; then
@@ -160,16 +165,18 @@ check_preprocess () {
     print_preprocess
 }
 
+make_error () {
+    echo "int e1 = {0};" >> ${TEST_SRC}/$(header_dir ${ERR})test-header_${ERR}.h
+}
+
 check_error () {
     let TOTAL+=1
 
-    echo "int e1 = {0};" >> ${TEST_SRC}/$(header_dir ${ERR})test-header_${ERR}.h
-
     if [ -f "${FILE}" ]; then
         rm ${FILE}
     fi
 
-    STDOUT=$(${PACKAGE_NAME} ${FILE}.c 2>&1)
+    STDOUT=$(${PACKAGE_NAME}${ARGS} ${FILE}.c 2>&1)
     RETURN=${?}
     if [ ${RETURN} -eq 0 ]; then
         rm ${FILE}
@@ -181,9 +188,9 @@ check_error () {
             do
                 echo -n "${i}/"
             done
-            echo -e "test-header_${ERR}.h:10:${NC}"
+            echo -e "test-header_${ERR}.h:13:${NC}"
             echo -e "\033[0;31merror:${NC} (no. 545) cannot initialize scalar type \033[1m‘int’${NC} with compound initializer"
-            echo -e "at line 10: \033[1mint e1 = {0};${NC}"
+            echo -e "at line 13: \033[1mint e1 = {0};${NC}"
             echo -e "${PACKAGE_NAME}: \033[0;31merror:${NC} compilation failed"
         ) | grep -q "identical"
         if [ ${?} -eq 0 ]; then
@@ -197,10 +204,107 @@ check_error () {
     print_error
 }
 
-function check_test () {
-    FILE=$(file ${1})
+function make_macro () {
+    echo "#" > ${TEST_SRC}/test-macro.h
+    echo "#define STR(x) #x" >> ${TEST_SRC}/test-macro.h
+    echo "# /* a null directive */" >> ${TEST_SRC}/test-macro.h
+    echo "char* m1 = STR(a + \"q\");" >> ${TEST_SRC}/test-macro.h
+    echo "char* m2 = STR( a+ b  /* c */ -  'd' );" >> ${TEST_SRC}/test-macro.h
+    echo "char* m3 = STR(int" >> ${TEST_SRC}/test-macro.h
+    echo "    long);" >> ${TEST_SRC}/test-macro.h
+    echo "#define C 1 // a line continuation \\" >> ${TEST_SRC}/test-macro.h
+    echo "    continues the comment" >> ${TEST_SRC}/test-macro.h
+    echo "#if C != 1 || 0 && (1 / 0)" >> ${TEST_SRC}/test-macro.h
+    echo "#error not short circuited" >> ${TEST_SRC}/test-macro.h
+    echo "#elif -1 < 0u" >> ${TEST_SRC}/test-macro.h
+    echo "#error not converted to unsigned" >> ${TEST_SRC}/test-macro.h
+    echo "#endif" >> ${TEST_SRC}/test-macro.h
+    echo "#warning a warning" >> ${TEST_SRC}/test-macro.h
+    echo "#line 100 \"test-macro.h\"" >> ${TEST_SRC}/test-macro.h
+
+    echo "int puts(char* s);" > ${FILE}.c
+    echo "#include \"test-macro.h\"" >> ${FILE}.c
+    echo "#" >> ${FILE}.c
+    echo "int main(void) {" >> ${FILE}.c
+    echo "    puts(m1);" >> ${FILE}.c
+    echo "    puts(m2);" >> ${FILE}.c
+    echo "    puts(m3);" >> ${FILE}.c
+    echo "    return 0;" >> ${FILE}.c
+    echo "}" >> ${FILE}.c
+}
+
+check_macro () {
+    let TOTAL+=1
+
+    ${PACKAGE_NAME}${ARGS} ${FILE}.c > /dev/null 2>&1
+    RETURN=${?}
+    STDOUT=""
+    if [ ${RETURN} -ne 0 ]; then
+        RESULT="${LIGHT_RED}[n]"
+    else
+        STDOUT=$(${FILE})
+        RETURN=${?}
+        rm ${FILE}
+
+        # Whitespace between the tokens of a stringified argument is kept as a single space
+        diff -sq <(echo "${STDOUT}") <(
+            echo "a + \"q\""
+            echo "a+ b - 'd'"
+            echo "int long"
+        ) | grep -q "identical"
+        if [ ${?} -eq 0 ] && [ ${RETURN} -eq 0 ]; then
+            RESULT="${LIGHT_GREEN}[y]"
+            let PASS+=1
+        else
+            RESULT="${LIGHT_RED}[n]"
+        fi
+    fi
+
+    print_preprocess
+}
+
+function make_cache () {
+    if [ -d "${CACHE_DIR}" ]; then
+        rm -r ${CACHE_DIR}
+    fi
+    mkdir -p ${CACHE_DIR}
+}
+
+function check_args () {
+    make_test
+    make_cache
+    ARGS="${1}"
+    check_preprocess
+    # Header tokens are cached by the first run, and read from cache by the second run
+    ARGS="${1} --cache=${CACHE_DIR}"
+    check_preprocess
     check_preprocess
+    make_error
+    ARGS="${1}"
     check_error
+    ARGS="${1} --cache=${CACHE_DIR}"
+    check_error
+    check_error
+    rm -r ${CACHE_DIR}
+}
+
+function check_test () {
+    FILE=$(file ${1})
+    check_args ""
+    # Headers are included again with macro expansion, unless their include guard is defined
+    check_args " -E"
+}
+
+function check_macro_test () {
+    FILE=$(file ${1})
+    make_macro
+    make_cache
+    ARGS=" -E"
+    check_macro
+    ARGS=" -E --cache=${CACHE_DIR}"
+    check_macro
+    check_macro
+    rm -r ${CACHE_DIR}
 }
 
 N=63
@@ -209,6 +313,7 @@ ERR=27
 PASS=0
 TOTAL=0
 check_test ${TEST_SRC}/main.c
+check_macro_test ${TEST_SRC}/macro.c
 total
 
 exit 0
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_62_H
+#define TEST_HEADER_62_H
 int x62 = 1;
 // a single-line comment 62
 #pragma pragma62
@@ -7,3 +9,4 @@ comment 62
    */
 #define MACRO_62 62
 char* s62 = "Hello 62!";
+#endif
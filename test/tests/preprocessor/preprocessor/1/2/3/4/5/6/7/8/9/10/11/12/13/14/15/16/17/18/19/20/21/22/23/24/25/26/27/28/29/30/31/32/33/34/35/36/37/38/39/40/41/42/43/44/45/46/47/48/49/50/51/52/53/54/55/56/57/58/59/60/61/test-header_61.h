@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_61_H
+#define TEST_HEADER_61_H
 int x61 = 1;
 // a single-line comment 61
 #pragma pragma61
@@ -7,3 +9,4 @@ comment 61
    */
 #define MACRO_61 61
 char* s61 = "Hello 61!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_60_H
+#define TEST_HEADER_60_H
 int x60 = 1;
 // a single-line comment 60
 #pragma pragma60
@@ -7,3 +9,4 @@ comment 60
    */
 #define MACRO_60 60
 char* s60 = "Hello 60!";
+#endif
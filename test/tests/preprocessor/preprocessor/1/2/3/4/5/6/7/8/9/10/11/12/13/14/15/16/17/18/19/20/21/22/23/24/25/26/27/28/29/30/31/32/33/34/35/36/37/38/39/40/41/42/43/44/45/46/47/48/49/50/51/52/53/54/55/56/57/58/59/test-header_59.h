@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_59_H
+#define TEST_HEADER_59_H
 int x59 = 1;
 // a single-line comment 59
 #pragma pragma59
@@ -7,3 +9,4 @@ comment 59
    */
 #define MACRO_59 59
 char* s59 = "Hello 59!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_58_H
+#define TEST_HEADER_58_H
 int x58 = 1;
 // a single-line comment 58
 #pragma pragma58
@@ -7,3 +9,4 @@ comment 58
    */
 #define MACRO_58 58
 char* s58 = "Hello 58!";
+#endif
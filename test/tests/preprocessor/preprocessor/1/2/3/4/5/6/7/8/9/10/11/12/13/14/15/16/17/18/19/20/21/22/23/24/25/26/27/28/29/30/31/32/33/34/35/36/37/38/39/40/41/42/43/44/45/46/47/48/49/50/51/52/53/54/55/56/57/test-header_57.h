@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_57_H
+#define TEST_HEADER_57_H
 int x57 = 1;
 // a single-line comment 57
 #pragma pragma57
@@ -7,3 +9,4 @@ comment 57
    */
 #define MACRO_57 57
 char* s57 = "Hello 57!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_56_H
+#define TEST_HEADER_56_H
 int x56 = 1;
 // a single-line comment 56
 #pragma pragma56
@@ -7,3 +9,4 @@ comment 56
    */
 #define MACRO_56 56
 char* s56 = "Hello 56!";
+#endif
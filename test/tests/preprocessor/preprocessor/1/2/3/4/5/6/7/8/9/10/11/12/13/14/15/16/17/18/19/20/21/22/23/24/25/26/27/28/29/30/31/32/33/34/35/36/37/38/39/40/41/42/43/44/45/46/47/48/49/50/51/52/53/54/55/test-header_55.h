@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_55_H
+#define TEST_HEADER_55_H
 int x55 = 1;
 // a single-line comment 55
 #pragma pragma55
@@ -7,3 +9,4 @@ comment 55
    */
 #define MACRO_55 55
 char* s55 = "Hello 55!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_54_H
+#define TEST_HEADER_54_H
 int x54 = 1;
 // a single-line comment 54
 #pragma pragma54
@@ -7,3 +9,4 @@ comment 54
    */
 #define MACRO_54 54
 char* s54 = "Hello 54!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_53_H
+#define TEST_HEADER_53_H
 int x53 = 1;
 // a single-line comment 53
 #pragma pragma53
@@ -7,3 +9,4 @@ comment 53
    */
 #define MACRO_53 53
 char* s53 = "Hello 53!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_52_H
+#define TEST_HEADER_52_H
 int x52 = 1;
 // a single-line comment 52
 #pragma pragma52
@@ -7,3 +9,4 @@ comment 52
    */
 #define MACRO_52 52
 char* s52 = "Hello 52!";
+#endif
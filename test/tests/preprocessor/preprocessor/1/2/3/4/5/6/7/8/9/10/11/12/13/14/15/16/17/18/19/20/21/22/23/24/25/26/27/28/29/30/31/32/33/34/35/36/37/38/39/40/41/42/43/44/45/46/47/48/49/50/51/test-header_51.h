@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_51_H
+#define TEST_HEADER_51_H
 int x51 = 1;
 // a single-line comment 51
 #pragma pragma51
@@ -7,3 +9,4 @@ comment 51
    */
 #define MACRO_51 51
 char* s51 = "Hello 51!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_50_H
+#define TEST_HEADER_50_H
 int x50 = 1;
 // a single-line comment 50
 #pragma pragma50
@@ -7,3 +9,4 @@ comment 50
    */
 #define MACRO_50 50
 char* s50 = "Hello 50!";
+#endif
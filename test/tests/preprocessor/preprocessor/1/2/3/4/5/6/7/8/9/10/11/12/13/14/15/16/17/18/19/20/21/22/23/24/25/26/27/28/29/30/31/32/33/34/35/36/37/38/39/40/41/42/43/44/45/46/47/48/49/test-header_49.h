@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_49_H
+#define TEST_HEADER_49_H
 int x49 = 1;
 // a single-line comment 49
 #pragma pragma49
@@ -7,3 +9,4 @@ comment 49
    */
 #define MACRO_49 49
 char* s49 = "Hello 49!";
+#endif
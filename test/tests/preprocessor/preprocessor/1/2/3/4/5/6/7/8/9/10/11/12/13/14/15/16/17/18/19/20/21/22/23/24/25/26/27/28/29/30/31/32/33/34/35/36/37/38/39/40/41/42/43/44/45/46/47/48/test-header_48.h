@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_48_H
+#define TEST_HEADER_48_H
 int x48 = 1;
 // a single-line comment 48
 #pragma pragma48
@@ -7,3 +9,4 @@ comment 48
    */
 #define MACRO_48 48
 char* s48 = "Hello 48!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_47_H
+#define TEST_HEADER_47_H
 int x47 = 1;
 // a single-line comment 47
 #pragma pragma47
@@ -7,3 +9,4 @@ comment 47
    */
 #define MACRO_47 47
 char* s47 = "Hello 47!";
+#endif
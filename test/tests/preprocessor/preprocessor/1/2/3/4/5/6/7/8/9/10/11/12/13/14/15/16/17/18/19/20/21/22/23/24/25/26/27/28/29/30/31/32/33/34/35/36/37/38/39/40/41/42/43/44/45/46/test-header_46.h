@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_46_H
+#define TEST_HEADER_46_H
 int x46 = 1;
 // a single-line comment 46
 #pragma pragma46
@@ -7,3 +9,4 @@ comment 46
    */
 #define MACRO_46 46
 char* s46 = "Hello 46!";
+#endif
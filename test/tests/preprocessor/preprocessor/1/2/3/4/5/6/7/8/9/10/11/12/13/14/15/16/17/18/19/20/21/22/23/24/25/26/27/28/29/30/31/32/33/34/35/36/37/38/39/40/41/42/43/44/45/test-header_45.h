@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_45_H
+#define TEST_HEADER_45_H
 int x45 = 1;
 // a single-line comment 45
 #pragma pragma45
@@ -7,3 +9,4 @@ comment 45
    */
 #define MACRO_45 45
 char* s45 = "Hello 45!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_44_H
+#define TEST_HEADER_44_H
 int x44 = 1;
 // a single-line comment 44
 #pragma pragma44
@@ -7,3 +9,4 @@ comment 44
    */
 #define MACRO_44 44
 char* s44 = "Hello 44!";
+#endif
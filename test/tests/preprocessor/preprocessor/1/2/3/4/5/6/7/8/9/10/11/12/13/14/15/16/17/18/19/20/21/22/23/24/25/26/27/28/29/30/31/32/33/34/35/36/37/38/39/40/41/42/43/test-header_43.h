@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_43_H
+#define TEST_HEADER_43_H
 int x43 = 1;
 // a single-line comment 43
 #pragma pragma43
@@ -7,3 +9,4 @@ comment 43
    */
 #define MACRO_43 43
 char* s43 = "Hello 43!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_42_H
+#define TEST_HEADER_42_H
 int x42 = 1;
 // a single-line comment 42
 #pragma pragma42
@@ -7,3 +9,4 @@ comment 42
    */
 #define MACRO_42 42
 char* s42 = "Hello 42!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_41_H
+#define TEST_HEADER_41_H
 int x41 = 1;
 // a single-line comment 41
 #pragma pragma41
@@ -7,3 +9,4 @@ comment 41
    */
 #define MACRO_41 41
 char* s41 = "Hello 41!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_40_H
+#define TEST_HEADER_40_H
 int x40 = 1;
 // a single-line comment 40
 #pragma pragma40
@@ -7,3 +9,4 @@ comment 40
    */
 #define MACRO_40 40
 char* s40 = "Hello 40!";
+#endif
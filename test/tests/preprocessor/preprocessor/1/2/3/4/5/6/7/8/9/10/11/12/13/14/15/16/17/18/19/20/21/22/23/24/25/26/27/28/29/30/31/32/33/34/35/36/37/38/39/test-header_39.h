@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_39_H
+#define TEST_HEADER_39_H
 int x39 = 1;
 // a single-line comment 39
 #pragma pragma39
@@ -7,3 +9,4 @@ comment 39
    */
 #define MACRO_39 39
 char* s39 = "Hello 39!";
+#endif
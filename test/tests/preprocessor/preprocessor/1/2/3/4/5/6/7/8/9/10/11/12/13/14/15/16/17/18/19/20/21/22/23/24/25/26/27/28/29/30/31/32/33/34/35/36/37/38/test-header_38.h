@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_38_H
+#define TEST_HEADER_38_H
 int x38 = 1;
 // a single-line comment 38
 #pragma pragma38
@@ -7,3 +9,4 @@ comment 38
    */
 #define MACRO_38 38
 char* s38 = "Hello 38!";
+#endif
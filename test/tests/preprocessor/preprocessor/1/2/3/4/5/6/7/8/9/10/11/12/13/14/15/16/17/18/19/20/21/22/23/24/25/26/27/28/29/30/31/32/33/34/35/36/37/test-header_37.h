@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_37_H
+#define TEST_HEADER_37_H
 int x37 = 1;
 // a single-line comment 37
 #pragma pragma37
@@ -7,3 +9,4 @@ comment 37
    */
 #define MACRO_37 37
 char* s37 = "Hello 37!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_36_H
+#define TEST_HEADER_36_H
 int x36 = 1;
 // a single-line comment 36
 #pragma pragma36
@@ -7,3 +9,4 @@ comment 36
    */
 #define MACRO_36 36
 char* s36 = "Hello 36!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_35_H
+#define TEST_HEADER_35_H
 int x35 = 1;
 // a single-line comment 35
 #pragma pragma35
@@ -7,3 +9,4 @@ comment 35
    */
 #define MACRO_35 35
 char* s35 = "Hello 35!";
+#endif
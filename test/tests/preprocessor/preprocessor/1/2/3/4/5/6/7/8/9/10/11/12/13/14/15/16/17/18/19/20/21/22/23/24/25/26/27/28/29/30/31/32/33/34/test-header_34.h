@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_34_H
+#define TEST_HEADER_34_H
 int x34 = 1;
 // a single-line comment 34
 #pragma pragma34
@@ -7,3 +9,4 @@ comment 34
    */
 #define MACRO_34 34
 char* s34 = "Hello 34!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_33_H
+#define TEST_HEADER_33_H
 int x33 = 1;
 // a single-line comment 33
 #pragma pragma33
@@ -7,3 +9,4 @@ comment 33
    */
 #define MACRO_33 33
 char* s33 = "Hello 33!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_32_H
+#define TEST_HEADER_32_H
 int x32 = 1;
 // a single-line comment 32
 #pragma pragma32
@@ -7,3 +9,4 @@ comment 32
    */
 #define MACRO_32 32
 char* s32 = "Hello 32!";
+#endif
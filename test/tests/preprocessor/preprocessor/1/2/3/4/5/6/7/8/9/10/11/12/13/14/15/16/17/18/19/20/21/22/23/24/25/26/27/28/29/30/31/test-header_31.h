@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_31_H
+#define TEST_HEADER_31_H
 int x31 = 1;
 // a single-line comment 31
 #pragma pragma31
@@ -7,3 +9,4 @@ comment 31
    */
 #define MACRO_31 31
 char* s31 = "Hello 31!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_30_H
+#define TEST_HEADER_30_H
 int x30 = 1;
 // a single-line comment 30
 #pragma pragma30
@@ -7,3 +9,4 @@ comment 30
    */
 #define MACRO_30 30
 char* s30 = "Hello 30!";
+#endif
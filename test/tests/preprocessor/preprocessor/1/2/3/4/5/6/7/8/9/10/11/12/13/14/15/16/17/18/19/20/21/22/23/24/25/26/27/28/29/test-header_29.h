@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_29_H
+#define TEST_HEADER_29_H
 int x29 = 1;
 // a single-line comment 29
 #pragma pragma29
@@ -7,3 +9,4 @@ comment 29
    */
 #define MACRO_29 29
 char* s29 = "Hello 29!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_28_H
+#define TEST_HEADER_28_H
 int x28 = 1;
 // a single-line comment 28
 #pragma pragma28
@@ -7,3 +9,4 @@ comment 28
    */
 #define MACRO_28 28
 char* s28 = "Hello 28!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_27_H
+#define TEST_HEADER_27_H
 int x27 = 1;
 // a single-line comment 27
 #pragma pragma27
@@ -7,4 +9,5 @@ comment 27
    */
 #define MACRO_27 27
 char* s27 = "Hello 27!";
+#endif
 int e1 = {0};
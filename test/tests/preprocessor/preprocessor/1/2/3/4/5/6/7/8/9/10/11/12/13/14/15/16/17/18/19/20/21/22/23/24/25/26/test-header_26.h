@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_26_H
+#define TEST_HEADER_26_H
 int x26 = 1;
 // a single-line comment 26
 #pragma pragma26
@@ -7,3 +9,4 @@ comment 26
    */
 #define MACRO_26 26
 char* s26 = "Hello 26!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_25_H
+#define TEST_HEADER_25_H
 int x25 = 1;
 // a single-line comment 25
 #pragma pragma25
@@ -7,3 +9,4 @@ comment 25
    */
 #define MACRO_25 25
 char* s25 = "Hello 25!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_24_H
+#define TEST_HEADER_24_H
 int x24 = 1;
 // a single-line comment 24
 #pragma pragma24
@@ -7,3 +9,4 @@ comment 24
    */
 #define MACRO_24 24
 char* s24 = "Hello 24!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_23_H
+#define TEST_HEADER_23_H
 int x23 = 1;
 // a single-line comment 23
 #pragma pragma23
@@ -7,3 +9,4 @@ comment 23
    */
 #define MACRO_23 23
 char* s23 = "Hello 23!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_22_H
+#define TEST_HEADER_22_H
 int x22 = 1;
 // a single-line comment 22
 #pragma pragma22
@@ -7,3 +9,4 @@ comment 22
    */
 #define MACRO_22 22
 char* s22 = "Hello 22!";
+#endif
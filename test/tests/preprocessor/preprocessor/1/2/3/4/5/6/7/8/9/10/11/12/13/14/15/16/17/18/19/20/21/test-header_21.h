@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_21_H
+#define TEST_HEADER_21_H
 int x21 = 1;
 // a single-line comment 21
 #pragma pragma21
@@ -7,3 +9,4 @@ comment 21
    */
 #define MACRO_21 21
 char* s21 = "Hello 21!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_20_H
+#define TEST_HEADER_20_H
 int x20 = 1;
 // a single-line comment 20
 #pragma pragma20
@@ -7,3 +9,4 @@ comment 20
    */
 #define MACRO_20 20
 char* s20 = "Hello 20!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_19_H
+#define TEST_HEADER_19_H
 int x19 = 1;
 // a single-line comment 19
 #pragma pragma19
@@ -7,3 +9,4 @@ comment 19
    */
 #define MACRO_19 19
 char* s19 = "Hello 19!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_18_H
+#define TEST_HEADER_18_H
 int x18 = 1;
 // a single-line comment 18
 #pragma pragma18
@@ -7,3 +9,4 @@ comment 18
    */
 #define MACRO_18 18
 char* s18 = "Hello 18!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_17_H
+#define TEST_HEADER_17_H
 int x17 = 1;
 // a single-line comment 17
 #pragma pragma17
@@ -7,3 +9,4 @@ comment 17
    */
 #define MACRO_17 17
 char* s17 = "Hello 17!";
+#endif
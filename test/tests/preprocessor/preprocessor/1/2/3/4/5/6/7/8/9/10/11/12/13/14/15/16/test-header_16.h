@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_16_H
+#define TEST_HEADER_16_H
 int x16 = 1;
 // a single-line comment 16
 #pragma pragma16
@@ -7,3 +9,4 @@ comment 16
    */
 #define MACRO_16 16
 char* s16 = "Hello 16!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_15_H
+#define TEST_HEADER_15_H
 int x15 = 1;
 // a single-line comment 15
 #pragma pragma15
@@ -7,3 +9,4 @@ comment 15
    */
 #define MACRO_15 15
 char* s15 = "Hello 15!";
+#endif
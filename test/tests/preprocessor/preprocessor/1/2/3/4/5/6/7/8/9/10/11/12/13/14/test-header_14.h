@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_14_H
+#define TEST_HEADER_14_H
 int x14 = 1;
 // a single-line comment 14
 #pragma pragma14
@@ -7,3 +9,4 @@ comment 14
    */
 #define MACRO_14 14
 char* s14 = "Hello 14!";
+#endif
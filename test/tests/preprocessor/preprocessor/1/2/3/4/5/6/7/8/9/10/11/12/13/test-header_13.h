@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_13_H
+#define TEST_HEADER_13_H
 int x13 = 1;
 // a single-line comment 13
 #pragma pragma13
@@ -7,3 +9,4 @@ comment 13
    */
 #define MACRO_13 13
 char* s13 = "Hello 13!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_12_H
+#define TEST_HEADER_12_H
 int x12 = 1;
 // a single-line comment 12
 #pragma pragma12
@@ -7,3 +9,4 @@ comment 12
    */
 #define MACRO_12 12
 char* s12 = "Hello 12!";
+#endif
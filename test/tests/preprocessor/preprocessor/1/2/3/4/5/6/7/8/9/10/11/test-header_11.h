@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_11_H
+#define TEST_HEADER_11_H
 int x11 = 1;
 // a single-line comment 11
 #pragma pragma11
@@ -7,3 +9,4 @@ comment 11
    */
 #define MACRO_11 11
 char* s11 = "Hello 11!";
+#endif
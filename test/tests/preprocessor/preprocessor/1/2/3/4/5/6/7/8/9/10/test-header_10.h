@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_10_H
+#define TEST_HEADER_10_H
 int x10 = 1;
 // a single-line comment 10
 #pragma pragma10
@@ -7,3 +9,4 @@ comment 10
    */
 #define MACRO_10 10
 char* s10 = "Hello 10!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_9_H
+#define TEST_HEADER_9_H
 int x9 = 1;
 // a single-line comment 9
 #pragma pragma9
@@ -7,3 +9,4 @@ comment 9
    */
 #define MACRO_9 9
 char* s9 = "Hello 9!";
+#endif
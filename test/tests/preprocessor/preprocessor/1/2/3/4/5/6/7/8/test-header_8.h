@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_8_H
+#define TEST_HEADER_8_H
 int x8 = 1;
 // a single-line comment 8
 #pragma pragma8
@@ -7,3 +9,4 @@ comment 8
    */
 #define MACRO_8 8
 char* s8 = "Hello 8!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_7_H
+#define TEST_HEADER_7_H
 int x7 = 1;
 // a single-line comment 7
 #pragma pragma7
@@ -7,3 +9,4 @@ comment 7
    */
 #define MACRO_7 7
 char* s7 = "Hello 7!";
+#endif
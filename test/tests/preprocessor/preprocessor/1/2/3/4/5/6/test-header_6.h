@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_6_H
+#define TEST_HEADER_6_H
 int x6 = 1;
 // a single-line comment 6
 #pragma pragma6
@@ -7,3 +9,4 @@ comment 6
    */
 #define MACRO_6 6
 char* s6 = "Hello 6!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_5_H
+#define TEST_HEADER_5_H
 int x5 = 1;
 // a single-line comment 5
 #pragma pragma5
@@ -7,3 +9,4 @@ comment 5
    */
 #define MACRO_5 5
 char* s5 = "Hello 5!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_4_H
+#define TEST_HEADER_4_H
 int x4 = 1;
 // a single-line comment 4
 #pragma pragma4
@@ -7,3 +9,4 @@ comment 4
    */
 #define MACRO_4 4
 char* s4 = "Hello 4!";
+#endif
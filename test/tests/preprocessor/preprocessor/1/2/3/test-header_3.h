@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_3_H
+#define TEST_HEADER_3_H
 int x3 = 1;
 // a single-line comment 3
 #pragma pragma3
@@ -7,3 +9,4 @@ comment 3
    */
 #define MACRO_3 3
 char* s3 = "Hello 3!";
+#endif
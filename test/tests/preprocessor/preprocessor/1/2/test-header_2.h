@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_2_H
+#define TEST_HEADER_2_H
 int x2 = 1;
 // a single-line comment 2
 #pragma pragma2
@@ -7,3 +9,4 @@ comment 2
    */
 #define MACRO_2 2
 char* s2 = "Hello 2!";
+#endif
@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_1_H
+#define TEST_HEADER_1_H
 int x1 = 1;
 // a single-line comment 1
 #pragma pragma1
@@ -7,3 +9,4 @@ comment 1
    */
 #define MACRO_1 1
 char* s1 = "Hello 1!";
+#endif
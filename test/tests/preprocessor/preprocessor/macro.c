@@ -0,0 +1,9 @@
+int puts(char* s);
+#include "test-macro.h"
+#
+int main(void) {
+    puts(m1);
+    puts(m2);
+    puts(m3);
+    return 0;
+}
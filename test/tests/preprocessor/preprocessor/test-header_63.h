@@ -1,3 +1,5 @@
+#ifndef TEST_HEADER_63_H
+#define TEST_HEADER_63_H
 int x63 = 1;
 // a single-line comment 63
 #pragma pragma63
@@ -7,3 +9,4 @@ comment 63
    */
 #define MACRO_63 63
 char* s63 = "Hello 63!";
+#endif
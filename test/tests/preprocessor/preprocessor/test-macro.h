@@ -0,0 +1,16 @@
+#
+#define STR(x) #x
+# /* a null directive */
+char* m1 = STR(a + "q");
+char* m2 = STR( a+ b  /* c */ -  'd' );
+char* m3 = STR(int
+    long);
+#define C 1 // a line continuation \
+    continues the comment
+#if C != 1 || 0 && (1 / 0)
+#error not short circuited
+#elif -1 < 0u
+#error not converted to unsigned
+#endif
+#warning a warning
+#line 100 "test-macro.h"
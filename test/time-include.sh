@@ -0,0 +1,75 @@
+#!/bin/bash
+
+PACKAGE_NAME="$(cat ../bin/package_name.txt)"
+
+TEST_DIR="${PWD}/tests/preprocessor"
+TEST_SRC="${TEST_DIR}/include"
+FILE="${TEST_SRC}/time_include"
+
+# Number of headers in the include chain, lines before each include
+N=64
+M=5000
+
+function header_lines () {
+    for j in $(seq 1 ${M})
+    do
+        echo "// line ${j} of ${1}"
+    done
+}
+
+function make_test () {
+    if [ -d "${TEST_SRC}" ]; then
+        rm -r ${TEST_SRC}
+    fi
+    mkdir -p ${TEST_SRC}
+
+    for i in $(seq 1 $((N-1)))
+    do
+        header_lines "header_${i}" > ${TEST_SRC}/time-header_${i}.h
+        echo "#include \"time-header_$((${i}+1)).h\"" >> ${TEST_SRC}/time-header_${i}.h
+        echo "int x${i} = ${i};" >> ${TEST_SRC}/time-header_${i}.h
+    done
+    header_lines "header_${N}" > ${TEST_SRC}/time-header_${N}.h
+    echo "int x${N} = ${N};" >> ${TEST_SRC}/time-header_${N}.h
+
+    header_lines "source" > ${FILE}.c
+    for i in $(seq 1 ${N})
+    do
+        echo "#include \"time-header_${i}.h\"" >> ${FILE}.c
+    done
+    echo "" >> ${FILE}.c
+    echo "int main(void) {" >> ${FILE}.c
+    echo "    return 0" >> ${FILE}.c;
+    for i in $(seq 1 ${N})
+    do
+        echo "    + x${i}" >> ${FILE}.c
+    done
+    echo "    ;" >> ${FILE}.c
+    echo "}" >> ${FILE}.c
+}
+
+function performance () {
+    echo ""
+    echo "----------------------------------------------------------------------"
+    echo "--include ${N} headers x ${M} lines"
+    echo "----------------------------------------------------------------------"
+    echo ""
+    echo "${PACKAGE_NAME}"
+    time for i in $(seq 1 ${1})
+    do
+        ${PACKAGE_NAME} -S ${FILE}.c > /dev/null 2>&1
+    done
+    if [ -f ${FILE}.s ]; then
+        rm ${FILE}.s
+    fi
+}
+
+make_test
+if [ ! -z "${1}" ]; then
+    performance ${1}
+else
+    performance 10
+fi
+rm -r ${TEST_SRC}
+
+exit 0
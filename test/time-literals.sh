@@ -0,0 +1,80 @@
+#!/bin/bash
+
+PACKAGE_NAME="$(cat ../bin/package_name.txt)"
+
+TEST_DIR="${PWD}/tests/preprocessor"
+TEST_SRC="${TEST_DIR}/literals"
+FILE="${TEST_SRC}/time_literals"
+
+# Number of lookup tables, constants in each table
+N=8
+M=20000
+
+function table_lines () {
+    for j in $(seq 1 ${M})
+    do
+        echo "    ${1}${j}${2},"
+    done
+}
+
+function make_test () {
+    if [ -d "${TEST_SRC}" ]; then
+        rm -r ${TEST_SRC}
+    fi
+    mkdir -p ${TEST_SRC}
+
+    echo -n "" > ${FILE}.c
+    for i in $(seq 1 ${N})
+    do
+        echo "long int_table_${i}[${M}] = {" >> ${FILE}.c
+        table_lines "$((i * 104729))" "" >> ${FILE}.c
+        echo "};" >> ${FILE}.c
+        echo "unsigned long uint_table_${i}[${M}] = {" >> ${FILE}.c
+        table_lines "184467440" "ul" >> ${FILE}.c
+        echo "};" >> ${FILE}.c
+        echo "double double_table_${i}[${M}] = {" >> ${FILE}.c
+        table_lines "${i}." "e-3" >> ${FILE}.c
+        echo "};" >> ${FILE}.c
+    done
+
+    echo "" >> ${FILE}.c
+    echo "int main(void) {" >> ${FILE}.c
+    echo "    return 0;" >> ${FILE}.c
+    echo "}" >> ${FILE}.c
+}
+
+function time_compiler () {
+    echo ""
+    echo "${1}"
+    time for i in $(seq 1 ${2})
+    do
+        ${1} -S ${FILE}.c > /dev/null 2>&1
+    done
+    if [ -f ${FILE}.s ]; then
+        rm ${FILE}.s
+    fi
+}
+
+function performance () {
+    echo ""
+    echo "----------------------------------------------------------------------"
+    echo "--literals $((N * 3)) tables x ${M} constants"
+    echo "----------------------------------------------------------------------"
+    time_compiler ${PACKAGE_NAME} ${1}
+    # A baseline compiler, e.g. a driver built before literals were decoded in place, is timed on the same file
+    if [ ! -z "${BASELINE}" ]; then
+        time_compiler ${BASELINE} ${1}
+    fi
+}
+
+# Usage: ./time-literals.sh [iterations] [baseline compiler]
+BASELINE="${2}"
+make_test
+if [ ! -z "${1}" ]; then
+    performance ${1}
+else
+    performance 3
+fi
+rm -r ${TEST_SRC}
+
+exit 0
@@ -22,12 +22,14 @@ function performance () {
     do
         ${PACKAGE_NAME} -S ${FILE} > /dev/null 2>&1
     done
-    echo ""
-    echo "nqcc2"
-    time for FILE in ${FILES}
-    do
-        ${NQCC2}/_build/default/bin/main.exe -S $(readlink -f ${FILE}) > /dev/null 2>&1
-    done
+    if [ -f ${NQCC2}/_build/default/bin/main.exe ]; then
+        echo ""
+        echo "nqcc2"
+        time for FILE in ${FILES}
+        do
+            ${NQCC2}/_build/default/bin/main.exe -S $(readlink -f ${FILE}) > /dev/null 2>&1
+        done
+    fi
     for FILE in ${FILES}
     do
         FILE=${FILE%.*}.s